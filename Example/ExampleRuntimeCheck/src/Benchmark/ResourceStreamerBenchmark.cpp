@@ -0,0 +1,180 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/ResourceStreamerBenchmark.h"
+#include "Framework/FakeResourceManager.h"
+#include "Framework/MemoryFileManager.h"
+#include "Framework/NullRendererRuntime.h"
+
+#include <RendererRuntime/IRendererRuntime.h>
+
+#include <chrono>
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_RESOURCES			= 1000;
+		static const uint32_t DESERIALIZATION_MICROSECONDS	= 200;
+		static const uint32_t PROCESSING_MICROSECONDS		= 50;
+		static const uint32_t ORDERED_LOADING_STRIDE		= 4;	///< Every 4th fake resource requires ordered loading
+		static const uint32_t NUMBER_OF_WORKER_THREADS[]	= { 1, 2, 4, 8 };
+		static const uint32_t NUMBER_OF_SYNCHRONOUS_LOADS	= 200;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void commitLoadRequests(RendererRuntime::ResourceStreamer& resourceStreamer, FakeResourceManager& fakeResourceManager)
+		{
+			// Mix the load priorities so the load requests requiring ordered loading have to hold their own against overtaking ones
+			for (uint32_t resourceIndex = 0; resourceIndex < NUMBER_OF_RESOURCES; ++resourceIndex)
+			{
+				const RendererRuntime::ResourceStreamer::LoadPriority loadPriority = static_cast<RendererRuntime::ResourceStreamer::LoadPriority>(resourceIndex % RendererRuntime::ResourceStreamer::NUMBER_OF_LOAD_PRIORITIES);
+				resourceStreamer.commitLoadRequest(fakeResourceManager.getLoadRequest(resourceIndex, loadPriority, 0 == resourceIndex % ORDERED_LOADING_STRIDE));
+			}
+		}
+
+		bool isOrderedLoadingRespected(const FakeResourceManager& fakeResourceManager)
+		{
+			uint32_t nextOrderedResourceIndex = 0;
+			for (uint32_t resourceIndex : fakeResourceManager.getDispatchedResourceIndices())
+			{
+				if (0 == resourceIndex % ORDERED_LOADING_STRIDE)
+				{
+					if (resourceIndex != nextOrderedResourceIndex)
+					{
+						return false;
+					}
+					nextOrderedResourceIndex += ORDERED_LOADING_STRIDE;
+				}
+			}
+			return true;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+void ResourceStreamerBenchmark::onRun()
+{
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::ResourceStreamer& resourceStreamer = nullRendererRuntime.getRendererRuntime().getResourceStreamer();
+	FakeResourceManager fakeResourceManager(memoryFileManager, ::detail::NUMBER_OF_RESOURCES, ::detail::DESERIALIZATION_MICROSECONDS, ::detail::PROCESSING_MICROSECONDS);
+	print("%u fake resources: %u microseconds deserialization, %u microseconds processing, every %u. requires ordered loading", ::detail::NUMBER_OF_RESOURCES, ::detail::DESERIALIZATION_MICROSECONDS, ::detail::PROCESSING_MICROSECONDS, ::detail::ORDERED_LOADING_STRIDE);
+
+	{ // Loading screen: Dispatch once per frame until everything has been loaded
+		double singleWorkerThreadMilliseconds = 0.0;
+		for (uint32_t numberOfWorkerThreads : ::detail::NUMBER_OF_WORKER_THREADS)
+		{
+			resourceStreamer.setNumberOfDeserializationThreads(numberOfWorkerThreads);
+			resourceStreamer.setNumberOfProcessingThreads(numberOfWorkerThreads);
+			fakeResourceManager.reset();
+			const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+			::detail::commitLoadRequests(resourceStreamer, fakeResourceManager);
+			while (fakeResourceManager.getDispatchedResourceIndices().size() < ::detail::NUMBER_OF_RESOURCES)
+			{
+				resourceStreamer.dispatch();
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+			if (1 == numberOfWorkerThreads)
+			{
+				singleWorkerThreadMilliseconds = milliseconds;
+			}
+			print("Loading screen, %u worker threads per stage: %.1f ms (%.2fx)", numberOfWorkerThreads, milliseconds, singleWorkerThreadMilliseconds / milliseconds);
+			check(::detail::isOrderedLoadingRespected(fakeResourceManager), "Load requests requiring ordered loading are dispatched in commit order");
+		}
+	}
+
+	{ // Blocking load: Flush all queues until everything has been loaded, the calling thread helps the worker threads
+		resourceStreamer.setNumberOfDeserializationThreads(1);
+		resourceStreamer.setNumberOfProcessingThreads(1);
+		fakeResourceManager.reset();
+		const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+		::detail::commitLoadRequests(resourceStreamer, fakeResourceManager);
+		resourceStreamer.flushAllQueues();
+		const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+		print("Blocking load, 1 worker thread per stage: %.1f ms", milliseconds);
+		check(fakeResourceManager.getDispatchedResourceIndices().size() == ::detail::NUMBER_OF_RESOURCES, "Flushing all queues loads everything");
+		check(::detail::isOrderedLoadingRespected(fakeResourceManager), "Load requests requiring ordered loading are dispatched in commit order while flushing");
+	}
+
+	{ // Flush latency: Load single resources synchronously, e.g. during startup, compared to polling the resource streamer with a 1 ms sleep
+		double flushMicroseconds = 0.0;
+		double maximumFlushMicroseconds = 0.0;
+		double pollingMicroseconds = 0.0;
+		for (uint32_t i = 0; i < ::detail::NUMBER_OF_SYNCHRONOUS_LOADS; ++i)
+		{
+			const uint32_t resourceIndex = i % ::detail::NUMBER_OF_RESOURCES;
+			{ // Flush all queues
+				fakeResourceManager.reset();
+				const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+				resourceStreamer.commitLoadRequest(fakeResourceManager.getLoadRequest(resourceIndex, RendererRuntime::ResourceStreamer::LoadPriority::EMERGENCY));
+				resourceStreamer.flushAllQueues();
+				const double microseconds = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - startTime).count();
+				flushMicroseconds += microseconds;
+				if (maximumFlushMicroseconds < microseconds)
+				{
+					maximumFlushMicroseconds = microseconds;
+				}
+			}
+			{ // Poll
+				fakeResourceManager.reset();
+				const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+				resourceStreamer.commitLoadRequest(fakeResourceManager.getLoadRequest(resourceIndex, RendererRuntime::ResourceStreamer::LoadPriority::EMERGENCY));
+				while (fakeResourceManager.getDispatchedResourceIndices().empty())
+				{
+					resourceStreamer.dispatch();
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+				pollingMicroseconds += std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - startTime).count();
+			}
+		}
+		flushMicroseconds /= ::detail::NUMBER_OF_SYNCHRONOUS_LOADS;
+		pollingMicroseconds /= ::detail::NUMBER_OF_SYNCHRONOUS_LOADS;
+		print("Synchronous load of a single resource (%u microseconds of work): flush %.0f microseconds on average (maximum %.0f), polling %.0f microseconds on average", ::detail::DESERIALIZATION_MICROSECONDS + ::detail::PROCESSING_MICROSECONDS, flushMicroseconds, maximumFlushMicroseconds, pollingMicroseconds);
+	}
+
+	// Cleanup, all resource loader instances are back at the fake resource manager
+	resourceStreamer.flushAllQueues();
+	check(0 == fakeResourceManager.getNumberOfUsedResourceLoaderInstances(), "All resource loader instances have been released");
+}
@@ -0,0 +1,75 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/IRuntimeCheck.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Resource streamer benchmark: Loading times using fake resource loaders
+*
+*  @remarks
+*    Loads fake resources spending a fixed time inside the deserialization stage (sleeping like file input does) and inside the
+*    processing stage (busy waiting like number crunching does):
+*    - Loading with 1, 2, 4 and 8 worker threads per asynchronous resource streamer stage, dispatching once per frame like
+*      a loading screen does; load requests requiring ordered loading must still be dispatched in commit order
+*    - Blocking load flushing all queues, the calling thread helps the worker threads instead of idling
+*    - Flush latency of single synchronous loads compared to polling the resource streamer with a 1 ms sleep
+*/
+class ResourceStreamerBenchmark : public IRuntimeCheck
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	inline ResourceStreamerBenchmark() :
+		IRuntimeCheck("ResourceStreamerBenchmark", true)
+	{
+		// Nothing here
+	}
+
+	inline virtual ~ResourceStreamerBenchmark()
+	{
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+protected:
+	virtual void onRun() override;
+
+
+};
@@ -0,0 +1,849 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Benchmark/RuntimeBenchmark.h"
+#include "Framework/AllocationCounter.h"
+#include "Framework/MemoryFileManager.h"
+#include "Framework/NullRendererRuntime.h"
+
+#include <RendererRuntime/IRendererRuntime.h>
+#include <RendererRuntime/Core/Thread/ThreadManager.h>
+#include <RendererRuntime/Core/GetUninitialized.h>
+#include <RendererRuntime/RenderQueue/RenderQueue.h>
+#include <RendererRuntime/RenderQueue/IndirectBufferManager.h>
+#include <RendererRuntime/RenderQueue/RenderableManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/Preprocessor/Preprocessor.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCompiler.h>
+#include <RendererRuntime/Resource/Material/MaterialResourceManager.h>
+#include <RendererRuntime/Resource/Material/MaterialTechnique.h>
+#include <RendererRuntime/Resource/Scene/SceneResource.h>
+#include <RendererRuntime/Resource/Scene/SceneResourceManager.h>
+#include <RendererRuntime/Resource/Scene/Node/ISceneNode.h>
+#include <RendererRuntime/Resource/Scene/Item/MeshSceneItem.h>
+#include <RendererRuntime/Resource/Scene/Item/CameraSceneItem.h>
+#include <RendererRuntime/Resource/Scene/Factory/ISceneFactory.h>
+#include <RendererRuntime/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h>
+#include <RendererRuntime/Resource/CompositorWorkspace/CompositorContextData.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <future>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_JOB_ITEMS				= 1024 * 1024;
+		static const uint32_t NUMBER_OF_JOB_ITEMS_PER_JOB		= 1024;
+		static const uint32_t NUMBER_OF_JOB_SYSTEM_FRAMES		= 20;
+		static const uint32_t NUMBER_OF_SINGLE_JOBS				= 1000;
+		static const uint32_t NUMBER_OF_SORTED_RENDERABLES		= 100000;
+		static const uint32_t NUMBER_OF_SORT_FRAMES				= 60;
+		static const uint32_t NUMBER_OF_CHANGED_RENDERABLES[]	= { 0, 50, 1000 };	///< Number of renderables removed from and added to the render queue per frame
+		static const float	  CAMERA_SPEED						= 1.0f;					///< World space units the camera moves along the x-axis per frame
+		static const uint32_t NUMBER_OF_SCENE_NODES				= 20000;
+		static const uint32_t NUMBER_OF_RENDERABLES_PER_MESH	= 2;
+		static const float	  SCENE_EXTENT						= 1000.0f;				///< The scene nodes are spread across a square of this size around the camera
+		static const uint32_t NUMBER_OF_CULL_AND_FILL_FRAMES	= 20;
+		static const uint32_t NUMBER_OF_WORKER_THREADS[]		= { 1, 2, 4, 8 };
+		static const uint32_t NUMBER_OF_COMMAND_PACKETS			= 1000000;
+		static const uint32_t NUMBER_OF_COMPARED_COMMAND_PACKETS	= 100000;	///< The former fixed growth copies quadratically, so it's compared using less command packets
+		static const uint32_t FORMER_NUMBER_OF_BYTES_TO_GROW	= 8192;
+		static const uint32_t NUMBER_OF_SHADER_PROPERTIES		= 6;
+		static const uint32_t NUMBER_OF_PREPROCESSOR_PASSES		= 4;	///< The first pass fills the preprocessed source code cache
+		static const char* SHADER_PROPERTY_NAMES[NUMBER_OF_SHADER_PROPERTIES] = { "USE_ALPHA_MAP", "USE_EMISSIVE_MAP", "LIGHTING", "RECEIVE_SHADOWS", "USE_FOG", "WET_SURFACE" };
+
+		// Mesh fragment shader source code like the shader builder creates it from the example shader blueprints, the shader properties are added as definitions in front of it
+		static const char* MESH_FRAGMENT_SHADER_SOURCE_CODE = R"(
+// Cross platform settings
+#define float2 vec2
+#define float3 vec3
+#define float4 vec4
+#define float4x4 mat4
+#define INPUT_BEGIN
+#define INPUT_END
+#define INPUT_TEXTURE_COORDINATE(type, name, index) in type name;
+#define OUTPUT_BEGIN
+#define OUTPUT_END
+#define OUTPUT_COLOR(index) layout(location = index) out vec4 OutputColor##index;
+#define UNIFORM_BUFFER_BEGIN(name, index) layout(std140) uniform name {
+#define UNIFORM_BUFFER_END };
+#define TEXTURE_2D(name, index) uniform sampler2D name;
+#define SAMPLE_2D(textureMap, samplerState, coordinate) texture(textureMap, coordinate)
+#define MAIN_BEGIN void main() {
+#define MAIN_END }
+#define SATURATE(value) clamp(value, 0.0f, 1.0f)
+
+// Input / output
+INPUT_BEGIN
+	INPUT_TEXTURE_COORDINATE(float2, TexCoordVS, 1)	// Texture coordinate
+	INPUT_TEXTURE_COORDINATE(float3, TangentFrame0VS, 2)	// Tangent frame
+	INPUT_TEXTURE_COORDINATE(float3, TangentFrame1VS, 3)	// Tangent frame
+	INPUT_TEXTURE_COORDINATE(float3, TangentFrame2VS, 4)	// Tangent frame
+INPUT_END
+OUTPUT_BEGIN
+	OUTPUT_COLOR(0)
+OUTPUT_END
+
+// Uniform buffers
+struct PassDataStruct
+{
+	float4x4 WorldSpaceToClipSpaceMatrix;
+	float3	 ViewSpaceSunLightDirection;
+	float	 Wetness;
+	float3	 AmbientColor;
+	float3	 SunLightColor;
+#if defined(USE_FOG)
+	float4	 FogColorDensity;
+#endif
+};
+UNIFORM_BUFFER_BEGIN(PassUniformBuffer, 0)
+	PassDataStruct PassData;
+UNIFORM_BUFFER_END
+
+// Textures
+TEXTURE_2D(DiffuseMap, 1)
+#ifdef USE_ALPHA_MAP
+	TEXTURE_2D(AlphaMap, 2)
+#endif
+#ifdef USE_EMISSIVE_MAP
+	TEXTURE_2D(EmissiveMap, 3)
+#endif
+TEXTURE_2D(NormalMap, 4)	// Tangent space normal map
+TEXTURE_2D(SpecularMap, 5)
+#if defined(RECEIVE_SHADOWS) && defined(LIGHTING)
+	TEXTURE_2D(ShadowMap, 6)
+#endif
+
+// Programs
+MAIN_BEGIN
+	/* Perform alpha map based fragment rejection */
+#ifdef USE_ALPHA_MAP
+	if (SAMPLE_2D(AlphaMap, SamplerLinear, TexCoordVS).r < 0.5f)
+	{
+		discard;
+	}
+#endif
+
+	// Get the per fragment normal [0..1] by using a tangent space normal map
+	float3 normal = SAMPLE_2D(NormalMap, SamplerLinear, TexCoordVS).rgb;
+	normal = normal * 2.0f - 1.0f;
+	normal = normalize(normal.x * TangentFrame0VS + normal.y * TangentFrame1VS + normal.z * TangentFrame2VS);
+
+#ifdef LIGHTING
+	// Perform standard Blinn-Phong diffuse and specular lighting
+	float diffuseLightFactor = max(dot(normal, PassData.ViewSpaceSunLightDirection), 0.0f);
+	float3 diffuseLightColor = PassData.SunLightColor * diffuseLightFactor;
+	float3 viewSpaceHalfVector = normalize(PassData.ViewSpaceSunLightDirection + float3(0.0f, 0.0f, 1.0f));
+#ifdef WET_SURFACE
+	float specularPower = 256.0f;
+#else
+	float specularPower = 128.0f;
+#endif
+	float specularLightFactor = (diffuseLightFactor > 0.0f) ? pow(max(dot(normal, viewSpaceHalfVector), 0.0f), specularPower) : 0.0f;
+	float3 specularLightColor = PassData.Wetness * PassData.SunLightColor * specularLightFactor;
+#if defined(RECEIVE_SHADOWS)
+	float shadowFactor = SATURATE(SAMPLE_2D(ShadowMap, SamplerLinear, TexCoordVS).r);
+	diffuseLightColor *= shadowFactor;
+	specularLightColor *= shadowFactor;
+#endif
+#else
+	float3 diffuseLightColor = float3(1.0f, 1.0f, 1.0f);
+	float3 specularLightColor = float3(0.0f, 0.0f, 0.0f);
+#endif
+
+	// Calculate the fragment color
+	float3 color = SAMPLE_2D(DiffuseMap, SamplerLinear, TexCoordVS).rgb * (PassData.AmbientColor + diffuseLightColor);
+	color += SAMPLE_2D(SpecularMap, SamplerLinear, TexCoordVS).rgb * specularLightColor;
+#ifdef USE_EMISSIVE_MAP
+	color += SAMPLE_2D(EmissiveMap, SamplerLinear, TexCoordVS).rgb;
+#endif
+#if defined(USE_FOG)
+	color = mix(color, PassData.FogColorDensity.rgb, SATURATE(PassData.FogColorDensity.a * gl_FragCoord.z));
+#endif
+	OutputColor0 = float4(color, 1.0f);
+MAIN_END
+)";
+
+		// Draw packets: Each material uses its own shader combination and hence its own pipeline state, the shader blueprints reference all shader properties
+		static const uint32_t NUMBER_OF_DRAW_PACKET_MATERIALS					= 64;
+		static const uint32_t NUMBER_OF_DRAW_PACKET_RENDERABLE_MANAGERS			= 1000;
+		static const uint32_t NUMBER_OF_RENDERABLES_PER_RENDERABLE_MANAGER		= 10;
+		static const uint32_t NUMBER_OF_DRAW_PACKET_FRAMES						= 100;
+		static const char*	  DRAW_PACKET_SHADER_SOURCE_CODE						= "void main()\n{\n}\n";	// The null renderer doesn't care about the shader source code as long as there's one
+		static const RendererRuntime::ShaderPropertyId DRAW_PACKET_SHADER_PROPERTY_A = RendererRuntime::StringId("RuntimeBenchmarkA");	// Boolean
+		static const RendererRuntime::ShaderPropertyId DRAW_PACKET_SHADER_PROPERTY_B = RendererRuntime::StringId("RuntimeBenchmarkB");	// Boolean
+		static const RendererRuntime::ShaderPropertyId DRAW_PACKET_SHADER_PROPERTY_C = RendererRuntime::StringId("RuntimeBenchmarkC");	// Integer in [0, 15]
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    The former renderer runtime thread pool, reduced to what the job system benchmark needs
+		*
+		*  @remarks
+		*    Queued tasks are processed in batches of one "std::async()" call per thread, each batch is waited for before the next
+		*    one starts. So every task pays for a thread launch and the slowest task of a batch stalls the others.
+		*/
+		class AsyncThreadPool
+		{
+		public:
+			explicit AsyncThreadPool(size_t numberOfThreads) :
+				mNumberOfThreads((0 != numberOfThreads) ? numberOfThreads : 1)
+			{
+				// Nothing here
+			}
+
+			void queueTask(std::function<void()>&& task)
+			{
+				mTasks.emplace_back(std::move(task));
+			}
+
+			void process()
+			{
+				std::vector<std::future<void>> futures;
+				futures.reserve(mNumberOfThreads);
+				for (size_t taskIndex = 0; taskIndex < mTasks.size(); taskIndex += mNumberOfThreads)
+				{
+					const size_t numberOfTasks = std::min(mNumberOfThreads, mTasks.size() - taskIndex);
+					for (size_t i = 0; i < numberOfTasks; ++i)
+					{
+						futures.emplace_back(std::async(std::launch::async, mTasks[taskIndex + i]));
+					}
+					for (std::future<void>& future : futures)
+					{
+						future.wait();
+					}
+					futures.clear();
+				}
+				mTasks.clear();
+			}
+
+		private:
+			size_t							   mNumberOfThreads;
+			std::vector<std::function<void()>> mTasks;
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void updateJobItems(void* userData, uint32_t firstIndex, uint32_t numberOfIndices)
+		{
+			// Some number crunching per item, similar to what an entity update does
+			float* items = static_cast<float*>(userData);
+			for (uint32_t i = firstIndex; i < firstIndex + numberOfIndices; ++i)
+			{
+				items[i] = std::sqrt(static_cast<float>(i)) * 0.5f + 1.0f;
+			}
+		}
+
+		void emptyJob(void*, uint32_t, uint32_t)
+		{
+			// Nothing here
+		}
+
+		uint64_t getSortingKey(uint32_t materialIndex, float positionX, float cameraPositionX)
+		{
+			// Material in the upper bits, view distance in the lower bits: Sorted by material, then front to back
+			return (static_cast<uint64_t>(materialIndex) << 32) | static_cast<uint64_t>(std::abs(positionX - cameraPositionX) * 10.0f);
+		}
+
+		void recordDrawCommands(Renderer::CommandBuffer& commandBuffer, uint32_t numberOfCommandPackets)
+		{
+			for (uint32_t i = 0; i < numberOfCommandPackets; ++i)
+			{
+				Renderer::Command::Draw::create(commandBuffer, 3);
+			}
+		}
+
+		void recordWithFormerFixedGrowth(const uint8_t* commandPacket, uint32_t numberOfCommandPacketBytes, uint32_t numberOfCommandPackets)
+		{
+			// The former command buffer growth: Grow by a fixed number of bytes and copy the whole command packet buffer each time
+			uint32_t commandPacketBufferNumberOfBytes = 0;
+			uint8_t* commandPacketBuffer = nullptr;
+			uint32_t currentCommandPacketByteIndex = 0;
+			for (uint32_t i = 0; i < numberOfCommandPackets; ++i)
+			{
+				if (commandPacketBufferNumberOfBytes < currentCommandPacketByteIndex + numberOfCommandPacketBytes)
+				{
+					const uint32_t newCommandPacketBufferNumberOfBytes = commandPacketBufferNumberOfBytes + FORMER_NUMBER_OF_BYTES_TO_GROW + numberOfCommandPacketBytes;
+					uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
+					if (nullptr != commandPacketBuffer)
+					{
+						memcpy(newCommandPacketBuffer, commandPacketBuffer, commandPacketBufferNumberOfBytes);
+						delete [] commandPacketBuffer;
+					}
+					commandPacketBuffer = newCommandPacketBuffer;
+					commandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
+				}
+				memcpy(commandPacketBuffer + currentCommandPacketByteIndex, commandPacket, numberOfCommandPacketBytes);
+				currentCommandPacketByteIndex += numberOfCommandPacketBytes;
+			}
+			delete [] commandPacketBuffer;
+		}
+
+		std::string getShaderSourceCode(uint32_t combination, const char* header)
+		{
+			// Header comment, a different header comment results in a different source code for the preprocessed source code cache but in the same preprocessed source code
+			std::string sourceCode = header;
+			for (uint32_t i = 0; i < NUMBER_OF_SHADER_PROPERTIES; ++i)
+			{
+				if (0 != (combination & (1u << i)))
+				{
+					sourceCode += "#define ";
+					sourceCode += SHADER_PROPERTY_NAMES[i];
+					sourceCode += '\n';
+				}
+			}
+			sourceCode += MESH_FRAGMENT_SHADER_SOURCE_CODE;
+			return sourceCode;
+		}
+
+		bool areJobItemsUpdated(const std::vector<float>& items)
+		{
+			for (uint32_t i = 0; i < NUMBER_OF_JOB_ITEMS; ++i)
+			{
+				if (items[i] != std::sqrt(static_cast<float>(i)) * 0.5f + 1.0f)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+void RuntimeBenchmark::onRun()
+{
+	benchmarkJobSystem();
+	benchmarkTemporalSort();
+	benchmarkParallelCullAndFill();
+	benchmarkCommandBuffer();
+	benchmarkPreprocessor();
+	benchmarkDrawPackets();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void RuntimeBenchmark::benchmarkJobSystem()
+{
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::JobScheduler& jobScheduler = nullRendererRuntime.getRendererRuntime().getThreadManager().getJobScheduler();
+	const uint32_t numberOfWorkerThreads = jobScheduler.getNumberOfWorkerThreads();
+	::detail::AsyncThreadPool asyncThreadPool(numberOfWorkerThreads + 1);	// The job scheduler lets the waiting thread help out
+	print("Job system: %u worker threads, %u items in jobs of %u items, %u frames", numberOfWorkerThreads, ::detail::NUMBER_OF_JOB_ITEMS, ::detail::NUMBER_OF_JOB_ITEMS_PER_JOB, ::detail::NUMBER_OF_JOB_SYSTEM_FRAMES);
+
+	{ // Throughput: Update all items once per frame
+		std::vector<float> items(::detail::NUMBER_OF_JOB_ITEMS, 0.0f);
+		float* itemData = items.data();
+
+		// Job scheduler
+		std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < ::detail::NUMBER_OF_JOB_SYSTEM_FRAMES; ++frame)
+		{
+			RendererRuntime::JobCounter jobCounter;
+			jobScheduler.parallelFor(&::detail::updateJobItems, itemData, ::detail::NUMBER_OF_JOB_ITEMS, ::detail::NUMBER_OF_JOB_ITEMS_PER_JOB, jobCounter);
+			jobScheduler.waitForCounter(jobCounter);
+		}
+		const double jobSchedulerMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count() / ::detail::NUMBER_OF_JOB_SYSTEM_FRAMES;
+		check(::detail::areJobItemsUpdated(items), "The job scheduler updates all items");
+
+		// Former thread pool
+		std::fill(items.begin(), items.end(), 0.0f);
+		startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < ::detail::NUMBER_OF_JOB_SYSTEM_FRAMES; ++frame)
+		{
+			for (uint32_t firstIndex = 0; firstIndex < ::detail::NUMBER_OF_JOB_ITEMS; firstIndex += ::detail::NUMBER_OF_JOB_ITEMS_PER_JOB)
+			{
+				asyncThreadPool.queueTask([itemData, firstIndex]() { ::detail::updateJobItems(itemData, firstIndex, ::detail::NUMBER_OF_JOB_ITEMS_PER_JOB); });
+			}
+			asyncThreadPool.process();
+		}
+		const double asyncThreadPoolMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count() / ::detail::NUMBER_OF_JOB_SYSTEM_FRAMES;
+		check(::detail::areJobItemsUpdated(items), "The former thread pool updates all items");
+
+		print("Throughput per frame: job scheduler %.2f ms, former thread pool %.2f ms (%.1fx)", jobSchedulerMilliseconds, asyncThreadPoolMilliseconds, asyncThreadPoolMilliseconds / jobSchedulerMilliseconds);
+	}
+
+	{ // Scheduling latency: Time from adding a single empty job until it has been executed
+		// Job scheduler
+		std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < ::detail::NUMBER_OF_SINGLE_JOBS; ++i)
+		{
+			RendererRuntime::JobCounter jobCounter;
+			jobScheduler.addJob(&::detail::emptyJob, nullptr, &jobCounter);
+			jobScheduler.waitForCounter(jobCounter);
+		}
+		const double jobSchedulerMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - startTime).count() / ::detail::NUMBER_OF_SINGLE_JOBS;
+
+		// Former thread pool
+		startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < ::detail::NUMBER_OF_SINGLE_JOBS; ++i)
+		{
+			asyncThreadPool.queueTask([]() { ::detail::emptyJob(nullptr, 0, 1); });
+			asyncThreadPool.process();
+		}
+		const double asyncThreadPoolMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - startTime).count() / ::detail::NUMBER_OF_SINGLE_JOBS;
+
+		print("Scheduling latency of a single job: job scheduler %.1f microseconds, former thread pool %.1f microseconds (%.1fx)", jobSchedulerMicroseconds, asyncThreadPoolMicroseconds, asyncThreadPoolMicroseconds / jobSchedulerMicroseconds);
+	}
+}
+
+void RuntimeBenchmark::benchmarkTemporalSort()
+{
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::IndirectBufferManager indirectBufferManager(nullRendererRuntime.getRendererRuntime());
+	RendererRuntime::RenderQueue renderQueue(indirectBufferManager, 0, 0, false, true);
+	RendererRuntime::RenderQueue::Queue& queue = renderQueue.mQueues[0];
+	print("Temporal sort: %u renderables, camera moving %.1f units per frame, %u frames", ::detail::NUMBER_OF_SORTED_RENDERABLES, ::detail::CAMERA_SPEED, ::detail::NUMBER_OF_SORT_FRAMES);
+
+	// Renderables are only compared by identity when sorting, so they don't need to be set up
+	const uint32_t maximumNumberOfRenderables = ::detail::NUMBER_OF_SORTED_RENDERABLES + ::detail::NUMBER_OF_CHANGED_RENDERABLES[2] * ::detail::NUMBER_OF_SORT_FRAMES;
+	std::vector<RendererRuntime::Renderable> renderables(maximumNumberOfRenderables);
+	std::vector<uint32_t> materialIndices(maximumNumberOfRenderables);
+	std::vector<float> positionsX(maximumNumberOfRenderables);
+	std::mt19937 random(42);
+	for (uint32_t i = 0; i < maximumNumberOfRenderables; ++i)
+	{
+		materialIndices[i] = random() % 64;
+		positionsX[i] = static_cast<float>(random() % 100000) * 0.1f;
+	}
+
+	for (uint32_t numberOfChangedRenderables : ::detail::NUMBER_OF_CHANGED_RENDERABLES)
+	{
+		double milliseconds[2] = { 0.0, 0.0 };
+		for (uint32_t temporal = 0; temporal < 2; ++temporal)
+		{
+			bool sorted = true;
+			renderQueue.clear();
+			for (uint32_t frame = 0; frame < ::detail::NUMBER_OF_SORT_FRAMES; ++frame)
+			{
+				// Fill the render queue, the queuing order is stable across frames like the renderable managers are
+				renderQueue.clear();
+				const float cameraPositionX = static_cast<float>(frame) * ::detail::CAMERA_SPEED;
+				const uint32_t firstRenderableIndex = frame * numberOfChangedRenderables;
+				for (uint32_t i = firstRenderableIndex; i < firstRenderableIndex + ::detail::NUMBER_OF_SORTED_RENDERABLES; ++i)
+				{
+					queue.queuedRenderables.emplace_back(renderables[i], ::detail::getSortingKey(materialIndices[i], positionsX[i], cameraPositionX));
+				}
+				if (0 == temporal)
+				{
+					// Forget the previous frame, enforces a full radix sort
+					queue.previousQueuedRenderables.clear();
+				}
+
+				// Sort, the first frame has no previous frame to exploit and is excluded
+				const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+				renderQueue.sortQueue(queue);
+				queue.sorted = true;
+				if (frame > 0)
+				{
+					milliseconds[temporal] += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+				}
+
+				// Validate the sorted order
+				for (uint32_t i = 1; i < ::detail::NUMBER_OF_SORTED_RENDERABLES; ++i)
+				{
+					if (queue.sortedQueuedRenderables[i - 1].sortingKey > queue.sortedQueuedRenderables[i].sortingKey || queue.queuedRenderables[queue.sortedQueuedRenderables[i].queuedRenderableIndex].sortingKey != queue.sortedQueuedRenderables[i].sortingKey)
+					{
+						sorted = false;
+					}
+				}
+			}
+			milliseconds[temporal] /= ::detail::NUMBER_OF_SORT_FRAMES - 1;
+			check(sorted, (0 == temporal) ? "The full radix sort sorts all renderables" : "The temporal coherence sort sorts all renderables");
+		}
+		print("%u renderables changed per frame: temporal coherence sort %.2f ms, full radix sort %.2f ms (%.1fx)", numberOfChangedRenderables, milliseconds[1], milliseconds[0], milliseconds[0] / milliseconds[1]);
+	}
+}
+
+void RuntimeBenchmark::benchmarkParallelCullAndFill()
+{
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::IRendererRuntime& rendererRuntime = nullRendererRuntime.getRendererRuntime();
+	RendererRuntime::JobScheduler& jobScheduler = rendererRuntime.getThreadManager().getJobScheduler();
+	Renderer::IFramebufferPtr framebuffer(nullRendererRuntime.getRenderer().createFramebuffer(0, nullptr));
+	print("Parallel cull and fill: %u scene nodes with %u renderables each, %u frames", ::detail::NUMBER_OF_SCENE_NODES, ::detail::NUMBER_OF_RENDERABLES_PER_MESH, ::detail::NUMBER_OF_CULL_AND_FILL_FRAMES);
+
+	// Scene with a camera in the middle of randomly placed meshes, there are no mesh resources so the renderable managers are filled directly
+	RendererRuntime::ISceneResource* sceneResource = rendererRuntime.getSceneResourceManager().getSceneFactory().createSceneResource(RendererRuntime::SceneResource::TYPE_ID, rendererRuntime, 0);
+	const RendererRuntime::CameraSceneItem& cameraSceneItem = *static_cast<RendererRuntime::CameraSceneItem*>(sceneResource->createSceneItem(RendererRuntime::CameraSceneItem::TYPE_ID, *sceneResource->createSceneNode(RendererRuntime::Transform())));
+	{
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> positionDistribution(-::detail::SCENE_EXTENT * 0.5f, ::detail::SCENE_EXTENT * 0.5f);
+		for (uint32_t i = 0; i < ::detail::NUMBER_OF_SCENE_NODES; ++i)
+		{
+			RendererRuntime::ISceneNode* sceneNode = sceneResource->createSceneNode(RendererRuntime::Transform(glm::vec3(positionDistribution(random), positionDistribution(random), positionDistribution(random))));
+			RendererRuntime::MeshSceneItem* meshSceneItem = static_cast<RendererRuntime::MeshSceneItem*>(sceneResource->createSceneItem(RendererRuntime::MeshSceneItem::TYPE_ID, *sceneNode));
+			RendererRuntime::RenderableManager& renderableManager = meshSceneItem->mRenderableManager;
+			for (uint32_t renderableIndex = 0; renderableIndex < ::detail::NUMBER_OF_RENDERABLES_PER_MESH; ++renderableIndex)
+			{
+				renderableManager.getRenderables().emplace_back(renderableManager, Renderer::IVertexArrayPtr(), Renderer::PrimitiveTopology::TRIANGLE_LIST, false, 0, 3, rendererRuntime.getMaterialResourceManager(), RendererRuntime::getUninitialized<RendererRuntime::MaterialResourceId>());
+			}
+			renderableManager.setBoundingSpherePositionRadius(glm::vec3(0.0f, 0.0f, 0.0f), 1.0f);
+			renderableManager.updateCachedRenderablesData();
+		}
+	}
+
+	{
+		// Compositor workspace instance without compositor workspace resource, the scene is culled into a single render queue index range
+		RendererRuntime::CompositorWorkspaceInstance compositorWorkspaceInstance(rendererRuntime, RendererRuntime::AssetId());
+		compositorWorkspaceInstance.mRenderQueueIndexRanges.emplace_back(0, 255);
+		const RendererRuntime::CompositorWorkspaceInstance::RenderableManagers& renderableManagers = compositorWorkspaceInstance.mRenderQueueIndexRanges[0].renderableManagers;
+		RendererRuntime::RenderQueue renderQueue(compositorWorkspaceInstance.getIndirectBufferManager(), 0, 255, false, true);
+
+		// The result must be identical regardless of the number of worker threads
+		RendererRuntime::CompositorWorkspaceInstance::RenderableManagers singleWorkerThreadRenderableManagers;
+		std::vector<const RendererRuntime::Renderable*> singleWorkerThreadRenderables;
+		std::vector<const RendererRuntime::Renderable*> renderables;
+		double singleWorkerThreadMilliseconds = 0.0;
+		for (uint32_t numberOfWorkerThreads : ::detail::NUMBER_OF_WORKER_THREADS)
+		{
+			jobScheduler.setNumberOfWorkerThreads(numberOfWorkerThreads);
+			double cullMilliseconds = 0.0;
+			double fillMilliseconds = 0.0;
+			for (uint32_t frame = 0; frame < ::detail::NUMBER_OF_CULL_AND_FILL_FRAMES; ++frame)
+			{
+				// Cull
+				compositorWorkspaceInstance.mRenderQueueIndexRanges[0].renderableManagers.clear();
+				std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+				compositorWorkspaceInstance.gatherRenderQueueIndexRangesRenderableManagers(*framebuffer, cameraSceneItem);
+				cullMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+				// Fill
+				renderQueue.clear();
+				startTime = std::chrono::high_resolution_clock::now();
+				renderQueue.addRenderablesFromRenderableManagers(renderableManagers.data(), static_cast<uint32_t>(renderableManagers.size()));
+				fillMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+			}
+			cullMilliseconds /= ::detail::NUMBER_OF_CULL_AND_FILL_FRAMES;
+			fillMilliseconds /= ::detail::NUMBER_OF_CULL_AND_FILL_FRAMES;
+
+			// Gather the queued renderables
+			renderables.clear();
+			for (const RendererRuntime::RenderQueue::Queue& queue : renderQueue.mQueues)
+			{
+				for (const RendererRuntime::RenderQueue::QueuedRenderable& queuedRenderable : queue.queuedRenderables)
+				{
+					renderables.push_back(queuedRenderable.renderable);
+				}
+			}
+
+			if (1 == numberOfWorkerThreads)
+			{
+				singleWorkerThreadRenderableManagers = renderableManagers;
+				singleWorkerThreadRenderables = renderables;
+				singleWorkerThreadMilliseconds = cullMilliseconds + fillMilliseconds;
+				check(!renderableManagers.empty() && renderableManagers.size() < ::detail::NUMBER_OF_SCENE_NODES, "Frustum culling keeps some but not all renderable managers");
+				check(renderables.size() == renderableManagers.size() * ::detail::NUMBER_OF_RENDERABLES_PER_MESH, "All renderables of the visible renderable managers are queued");
+			}
+			else
+			{
+				check(renderableManagers == singleWorkerThreadRenderableManagers, "Parallel culling keeps the same renderable managers in the same order as a single worker thread");
+				check(renderables == singleWorkerThreadRenderables, "Parallel filling queues the same renderables in the same order as a single worker thread");
+			}
+			print("%u worker threads: cull %.2f ms, fill %.2f ms, %u of %u renderable managers visible (%.2fx)", numberOfWorkerThreads, cullMilliseconds, fillMilliseconds, static_cast<uint32_t>(renderableManagers.size()), ::detail::NUMBER_OF_SCENE_NODES, singleWorkerThreadMilliseconds / (cullMilliseconds + fillMilliseconds));
+		}
+		renderQueue.clear();
+	}
+
+	// Cleanup
+	delete sceneResource;
+}
+
+void RuntimeBenchmark::benchmarkCommandBuffer()
+{
+	print("Command buffer: %u draw command packets", ::detail::NUMBER_OF_COMMAND_PACKETS);
+
+	{ // Geometric growth compared to the former fixed growth
+		Renderer::CommandBuffer commandBuffer;
+		uint64_t numberOfAllocations = AllocationCounter::getNumberOfThreadAllocations();
+		std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+		::detail::recordDrawCommands(commandBuffer, ::detail::NUMBER_OF_COMPARED_COMMAND_PACKETS);
+		const double geometricGrowthMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+		const uint64_t geometricGrowthNumberOfAllocations = AllocationCounter::getNumberOfThreadAllocations() - numberOfAllocations;
+
+		// Record command packets of the same size using the former growth
+		const uint32_t numberOfCommandPacketBytes = commandBuffer.getNumberOfUsedBytes() / ::detail::NUMBER_OF_COMPARED_COMMAND_PACKETS;
+		const std::vector<uint8_t> commandPacket(numberOfCommandPacketBytes, 0);
+		numberOfAllocations = AllocationCounter::getNumberOfThreadAllocations();
+		startTime = std::chrono::high_resolution_clock::now();
+		::detail::recordWithFormerFixedGrowth(commandPacket.data(), numberOfCommandPacketBytes, ::detail::NUMBER_OF_COMPARED_COMMAND_PACKETS);
+		const double fixedGrowthMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+		const uint64_t fixedGrowthNumberOfAllocations = AllocationCounter::getNumberOfThreadAllocations() - numberOfAllocations;
+
+		print("%u command packets of %u bytes: geometric growth %.2f ms with %u allocations, former fixed growth %.2f ms with %u allocations (%.1fx)", ::detail::NUMBER_OF_COMPARED_COMMAND_PACKETS, numberOfCommandPacketBytes, geometricGrowthMilliseconds, static_cast<uint32_t>(geometricGrowthNumberOfAllocations), fixedGrowthMilliseconds, static_cast<uint32_t>(fixedGrowthNumberOfAllocations), fixedGrowthMilliseconds / geometricGrowthMilliseconds);
+	}
+
+	{ // Recording a frame, recording the next frame after clearing and recording into external memory
+		Renderer::CommandBuffer commandBuffer;
+		uint64_t numberOfAllocations = AllocationCounter::getNumberOfThreadAllocations();
+		std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+		::detail::recordDrawCommands(commandBuffer, ::detail::NUMBER_OF_COMMAND_PACKETS);
+		const double firstMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+		const uint64_t firstNumberOfAllocations = AllocationCounter::getNumberOfThreadAllocations() - numberOfAllocations;
+		const uint32_t numberOfUsedBytes = commandBuffer.getNumberOfUsedBytes();
+		const uint32_t numberOfReservedBytes = commandBuffer.getNumberOfReservedBytes();
+
+		commandBuffer.clear();
+		numberOfAllocations = AllocationCounter::getNumberOfThreadAllocations();
+		startTime = std::chrono::high_resolution_clock::now();
+		::detail::recordDrawCommands(commandBuffer, ::detail::NUMBER_OF_COMMAND_PACKETS);
+		const double clearedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+		check(AllocationCounter::getNumberOfThreadAllocations() == numberOfAllocations, "Recording the same commands again after clearing doesn't allocate memory");
+		check(commandBuffer.getNumberOfUsedBytes() == numberOfUsedBytes && commandBuffer.getNumberOfReservedBytes() == numberOfReservedBytes, "Clearing keeps the command packet buffer memory");
+
+		std::vector<uint8_t> externalMemory(numberOfUsedBytes);
+		Renderer::CommandBuffer externalMemoryCommandBuffer(externalMemory.data(), numberOfUsedBytes);
+		numberOfAllocations = AllocationCounter::getNumberOfThreadAllocations();
+		startTime = std::chrono::high_resolution_clock::now();
+		::detail::recordDrawCommands(externalMemoryCommandBuffer, ::detail::NUMBER_OF_COMMAND_PACKETS);
+		const double externalMemoryMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+		check(AllocationCounter::getNumberOfThreadAllocations() == numberOfAllocations, "Recording into large enough external memory doesn't allocate memory");
+		check(externalMemoryCommandBuffer.getNumberOfReservedBytes() == numberOfUsedBytes, "The command buffer records into the external memory");
+
+		print("%u command packets: first recording %.2f ms with %u allocations (%u of %u reserved bytes used), after clearing %.2f ms, into external memory %.2f ms", ::detail::NUMBER_OF_COMMAND_PACKETS, firstMilliseconds, static_cast<uint32_t>(firstNumberOfAllocations), numberOfUsedBytes, numberOfReservedBytes, clearedMilliseconds, externalMemoryMilliseconds);
+	}
+}
+
+void RuntimeBenchmark::benchmarkPreprocessor()
+{
+	const uint32_t numberOfCombinations = 1u << ::detail::NUMBER_OF_SHADER_PROPERTIES;
+	print("Preprocessor: %u mesh fragment shader combinations, %u passes", numberOfCombinations, ::detail::NUMBER_OF_PREPROCESSOR_PASSES);
+
+	std::vector<std::string> preprocessedSourceCodes(numberOfCombinations);
+	std::string preprocessedSourceCode;
+	double milliseconds[2] = { 0.0, 0.0 };
+	double firstPassMilliseconds = 0.0;
+	bool identical = true;
+	for (uint32_t cached = 0; cached < 2; ++cached)
+	{
+		for (uint32_t pass = 0; pass < ::detail::NUMBER_OF_PREPROCESSOR_PASSES; ++pass)
+		{
+			// The preprocessed source code cache is process wide, without cache each pass uses a new header comment so each source code is preprocessed again
+			char header[64];
+			snprintf(header, sizeof(header), "// Pass %u\n", cached ? 0 : pass + 1);
+			std::vector<std::string> sourceCodes(numberOfCombinations);
+			for (uint32_t combination = 0; combination < numberOfCombinations; ++combination)
+			{
+				sourceCodes[combination] = ::detail::getShaderSourceCode(combination, header);
+			}
+
+			const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+			for (uint32_t combination = 0; combination < numberOfCombinations; ++combination)
+			{
+				RendererRuntime::Preprocessor::preprocess(sourceCodes[combination], preprocessedSourceCode);
+				if (0 == cached && 0 == pass)
+				{
+					preprocessedSourceCodes[combination] = preprocessedSourceCode;
+				}
+				else if (preprocessedSourceCode != preprocessedSourceCodes[combination])
+				{
+					identical = false;
+				}
+			}
+			const double passMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+			if (cached && 0 == pass)
+			{
+				firstPassMilliseconds = passMilliseconds;
+			}
+			milliseconds[cached] += passMilliseconds;
+		}
+	}
+	check(identical, "Preprocessing the same source code always results in the same preprocessed source code");
+	check(!preprocessedSourceCodes[0].empty() && std::string::npos == preprocessedSourceCodes[0].find("#define"), "The source code is preprocessed");
+
+	const uint32_t numberOfCalls = numberOfCombinations * ::detail::NUMBER_OF_PREPROCESSOR_PASSES;
+	print("Per call: without cache %.1f microseconds, with cache %.1f microseconds (%.1fx), cache hits only %.1f microseconds", milliseconds[0] * 1000.0 / numberOfCalls, milliseconds[1] * 1000.0 / numberOfCalls, milliseconds[0] / milliseconds[1], (milliseconds[1] - firstPassMilliseconds) * 1000.0 / (numberOfCalls - numberOfCombinations));
+}
+
+void RuntimeBenchmark::benchmarkDrawPackets()
+{
+	print("Draw packets: %u renderables using %u materials, %u frames", ::detail::NUMBER_OF_DRAW_PACKET_RENDERABLE_MANAGERS * ::detail::NUMBER_OF_RENDERABLES_PER_RENDERABLE_MANAGER, ::detail::NUMBER_OF_DRAW_PACKET_MATERIALS, ::detail::NUMBER_OF_DRAW_PACKET_FRAMES);
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	Renderer::IRenderer& renderer = nullRendererRuntime.getRenderer();
+	RendererRuntime::IRendererRuntime& rendererRuntime = nullRendererRuntime.getRendererRuntime();
+	RendererRuntime::ShaderBlueprintResourceManager& shaderBlueprintResourceManager = rendererRuntime.getShaderBlueprintResourceManager();
+	RendererRuntime::MaterialBlueprintResourceManager& materialBlueprintResourceManager = rendererRuntime.getMaterialBlueprintResourceManager();
+	RendererRuntime::MaterialResourceManager& materialResourceManager = rendererRuntime.getMaterialResourceManager();
+
+	// Pipeline state caches unknown so far are compiled synchronously, this way the first frame creates all pipeline states
+	RendererRuntime::PipelineStateCompiler& pipelineStateCompiler = rendererRuntime.getPipelineStateCompiler();
+	const bool asynchronousCompilationEnabled = pipelineStateCompiler.isAsynchronousCompilationEnabled();
+	pipelineStateCompiler.setAsynchronousCompilationEnabled(false);
+
+	// Create the shader blueprint resources and the material blueprint resource without loading them, only the data relevant for the pipeline states is set
+	RendererRuntime::MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.mMaterialBlueprintResources.addElement();
+	materialBlueprintResource.setResourceManager(&materialBlueprintResourceManager);
+	materialBlueprintResource.setAssetId(RendererRuntime::StringId("ExampleRuntimeCheck/RuntimeBenchmarkMaterialBlueprint"));
+	const RendererRuntime::ShaderType shaderTypes[] = { RendererRuntime::ShaderType::Vertex, RendererRuntime::ShaderType::Fragment };
+	for (RendererRuntime::ShaderType shaderType : shaderTypes)
+	{
+		RendererRuntime::ShaderBlueprintResource& shaderBlueprintResource = shaderBlueprintResourceManager.mShaderBlueprintResources.addElement();
+		shaderBlueprintResource.setResourceManager(&shaderBlueprintResourceManager);
+		shaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::DRAW_PACKET_SHADER_PROPERTY_A, 1);
+		shaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::DRAW_PACKET_SHADER_PROPERTY_B, 1);
+		shaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::DRAW_PACKET_SHADER_PROPERTY_C, 1);
+		shaderBlueprintResource.mShaderSourceCode = ::detail::DRAW_PACKET_SHADER_SOURCE_CODE;
+		RendererRuntime::ShaderBuilder::compileShaderTemplate(shaderBlueprintResource.mShaderSourceCode, shaderBlueprintResource.mShaderTemplate);
+		materialBlueprintResource.mShaderBlueprintResourceId[static_cast<uint8_t>(shaderType)] = shaderBlueprintResource.getId();
+	}
+	{ // The program cache manager needs a root signature to create the programs with
+		Renderer::RootSignatureBuilder rootSignature;
+		rootSignature.initialize(0, nullptr, 0, nullptr, Renderer::RootSignatureFlags::ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+		materialBlueprintResource.mRootSignaturePtr = renderer.createRootSignature(rootSignature);
+	}
+	materialBlueprintResource.setLoadingState(RendererRuntime::IResource::LoadingState::LOADED);
+
+	// Create the material resources without material blueprint asset, each one uses a different shader combination
+	std::vector<RendererRuntime::MaterialResourceId> materialResourceIds(::detail::NUMBER_OF_DRAW_PACKET_MATERIALS);
+	for (uint32_t i = 0; i < ::detail::NUMBER_OF_DRAW_PACKET_MATERIALS; ++i)
+	{
+		RendererRuntime::MaterialResource& materialResource = materialResourceManager.mMaterialResources.addElement();
+		materialResource.setResourceManager(&materialResourceManager);
+		materialResource.mSortedMaterialTechniqueVector.push_back(new RendererRuntime::MaterialTechnique(RendererRuntime::MaterialResourceManager::DEFAULT_MATERIAL_TECHNIQUE_ID, materialResource, materialBlueprintResource.getId()));
+		materialResource.setPropertyById(::detail::DRAW_PACKET_SHADER_PROPERTY_A, RendererRuntime::MaterialPropertyValue::fromBoolean(0 != (i & 1)), RendererRuntime::MaterialProperty::Usage::SHADER_COMBINATION);
+		materialResource.setPropertyById(::detail::DRAW_PACKET_SHADER_PROPERTY_B, RendererRuntime::MaterialPropertyValue::fromBoolean(0 != (i & 2)), RendererRuntime::MaterialProperty::Usage::SHADER_COMBINATION);
+		materialResource.setPropertyById(::detail::DRAW_PACKET_SHADER_PROPERTY_C, RendererRuntime::MaterialPropertyValue::fromInteger(static_cast<int>(i / 4)), RendererRuntime::MaterialProperty::Usage::SHADER_COMBINATION);
+		materialResource.setLoadingState(RendererRuntime::IResource::LoadingState::LOADED);
+		materialResourceIds[i] = materialResource.getId();
+	}
+
+	// Create the renderable managers, each one has its own vertex array and the materials are spread across the renderables
+	Renderer::IBufferManagerPtr bufferManager(renderer.createBufferManager());
+	const Renderer::VertexAttributes vertexAttributes(0, nullptr);
+	std::vector<RendererRuntime::RenderableManager> renderableManagers(::detail::NUMBER_OF_DRAW_PACKET_RENDERABLE_MANAGERS);
+	for (uint32_t i = 0; i < ::detail::NUMBER_OF_DRAW_PACKET_RENDERABLE_MANAGERS; ++i)
+	{
+		RendererRuntime::RenderableManager& renderableManager = renderableManagers[i];
+		const Renderer::IVertexArrayPtr vertexArrayPtr(bufferManager->createVertexArray(vertexAttributes, 0, nullptr));
+		RendererRuntime::RenderableManager::Renderables& renderables = renderableManager.getRenderables();
+		renderables.reserve(::detail::NUMBER_OF_RENDERABLES_PER_RENDERABLE_MANAGER);
+		for (uint32_t renderableIndex = 0; renderableIndex < ::detail::NUMBER_OF_RENDERABLES_PER_RENDERABLE_MANAGER; ++renderableIndex)
+		{
+			const uint32_t materialIndex = (i * ::detail::NUMBER_OF_RENDERABLES_PER_RENDERABLE_MANAGER + renderableIndex) * 7 % ::detail::NUMBER_OF_DRAW_PACKET_MATERIALS;
+			renderables.emplace_back(renderableManager, vertexArrayPtr, Renderer::PrimitiveTopology::TRIANGLE_LIST, true, 0, 36, materialResourceManager, materialResourceIds[materialIndex]);
+		}
+		renderableManager.updateCachedRenderablesData();
+	}
+
+	// Fill the render queue once, the command buffer is filled with it each frame
+	RendererRuntime::IndirectBufferManager indirectBufferManager(rendererRuntime);
+	RendererRuntime::RenderQueue renderQueue(indirectBufferManager, 0, 255, false, true);
+	for (const RendererRuntime::RenderableManager& renderableManager : renderableManagers)
+	{
+		renderQueue.addRenderablesFromRenderableManager(renderableManager);
+	}
+	Renderer::IFramebufferPtr framebuffer(renderer.createFramebuffer(0, nullptr));
+	Renderer::CommandBuffer commandBuffer;
+
+	{ // Warm up, this creates the pipeline states and caches the draw packets
+		const RendererRuntime::CompositorContextData compositorContextData;
+		renderQueue.fillCommandBuffer(*framebuffer, RendererRuntime::MaterialResourceManager::DEFAULT_MATERIAL_TECHNIQUE_ID, compositorContextData, commandBuffer);
+	}
+	const uint32_t numberOfUsedBytes = commandBuffer.getNumberOfUsedBytes();
+	const uint32_t numberOfDraws = renderQueue.getNumberOfDrawCalls() + renderQueue.getNumberOfBatchedDrawCalls();
+
+	// Fill the command buffer each frame using the cached draw packets and resolving the draw packets each frame, the way it was done before draw packets were cached
+	// -> Resolving means looking up the material resource, material technique and material blueprint resource and gathering the shader properties to find the pipeline state cache
+	double nanoseconds[2] = { 0.0, 0.0 };
+	uint64_t numberOfAllocations[2] = { 0, 0 };
+	bool identical = true;
+	for (uint32_t resolve = 0; resolve < 2; ++resolve)
+	{
+		for (uint32_t frame = 0; frame < ::detail::NUMBER_OF_DRAW_PACKET_FRAMES; ++frame)
+		{
+			if (0 != resolve)
+			{
+				for (const RendererRuntime::RenderableManager& renderableManager : renderableManagers)
+				{
+					for (const RendererRuntime::Renderable& renderable : renderableManager.getRenderables())
+					{
+						renderable.mDrawPackets.clear();
+					}
+				}
+			}
+			commandBuffer.clear();
+			const RendererRuntime::CompositorContextData compositorContextData;
+
+			const uint64_t numberOfThreadAllocations = AllocationCounter::getNumberOfThreadAllocations();
+			const std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+			renderQueue.fillCommandBuffer(*framebuffer, RendererRuntime::MaterialResourceManager::DEFAULT_MATERIAL_TECHNIQUE_ID, compositorContextData, commandBuffer);
+			nanoseconds[resolve] += std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - startTime).count();
+			numberOfAllocations[resolve] += AllocationCounter::getNumberOfThreadAllocations() - numberOfThreadAllocations;
+
+			if (commandBuffer.getNumberOfUsedBytes() != numberOfUsedBytes || renderQueue.getNumberOfDrawCalls() + renderQueue.getNumberOfBatchedDrawCalls() != numberOfDraws)
+			{
+				identical = false;
+			}
+		}
+	}
+	check(::detail::NUMBER_OF_DRAW_PACKET_RENDERABLE_MANAGERS * ::detail::NUMBER_OF_RENDERABLES_PER_RENDERABLE_MANAGER == numberOfDraws, "Each renderable is drawn");
+	check(identical, "Cached and resolved draw packets result in the same command buffer");
+	check(0 == numberOfAllocations[0], "Filling the command buffer with cached draw packets doesn't allocate");
+
+	const double numberOfMeasuredDraws = static_cast<double>(numberOfDraws) * ::detail::NUMBER_OF_DRAW_PACKET_FRAMES;
+	print("Per draw: resolving every frame %.1f nanoseconds, cached draw packets %.1f nanoseconds (%.1fx)", nanoseconds[1] / numberOfMeasuredDraws, nanoseconds[0] / numberOfMeasuredDraws, nanoseconds[1] / nanoseconds[0]);
+	print("Heap allocations per frame: resolving every frame %.1f, cached draw packets %.1f", static_cast<double>(numberOfAllocations[1]) / ::detail::NUMBER_OF_DRAW_PACKET_FRAMES, static_cast<double>(numberOfAllocations[0]) / ::detail::NUMBER_OF_DRAW_PACKET_FRAMES);
+
+	// Cleanup, the resources created in here are destroyed together with the renderer runtime
+	materialBlueprintResource.getPipelineStateCacheManager().clearCache();
+	pipelineStateCompiler.setAsynchronousCompilationEnabled(asynchronousCompilationEnabled);
+}
@@ -0,0 +1,94 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/IRuntimeCheck.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Renderer runtime benchmark: CPU costs of the renderer runtime hot paths on top of the null renderer
+*
+*  @remarks
+*    Each section measures one hot path against the approach it replaced:
+*    - Job system: Throughput and scheduling latency of the work stealing job scheduler compared to the former "std::async()"
+*      based thread pool
+*    - Temporal sort: Render queue sorting while the camera is moving, exploiting the sorted order of the previous frame compared
+*      to a full radix sort each frame
+*    - Parallel cull and fill: Frustum culling the scene nodes and filling the render queue with the visible renderable managers
+*      using 1, 2, 4 and 8 job scheduler worker threads
+*    - Command buffer: Recording draw command packets with geometric growth compared to the former fixed 8 KiB growth, recording
+*      again after clearing and recording into external memory
+*    - Preprocessor: Preprocessing shader source code of all combinations of a mesh fragment shader repeatedly, the way shader
+*      combinations resulting in the same source code do, with and without the preprocessed source code cache
+*    - Draw packets: Per-draw CPU cost of filling the command buffer with the render queue using the draw packets cached inside
+*      the renderables compared to resolving the material and pipeline state of each renderable every frame
+*/
+class RuntimeBenchmark : public IRuntimeCheck
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	inline RuntimeBenchmark() :
+		IRuntimeCheck("RuntimeBenchmark", true)
+	{
+		// Nothing here
+	}
+
+	inline virtual ~RuntimeBenchmark()
+	{
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+protected:
+	virtual void onRun() override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	void benchmarkJobSystem();
+	void benchmarkTemporalSort();
+	void benchmarkParallelCullAndFill();
+	void benchmarkCommandBuffer();
+	void benchmarkPreprocessor();
+	void benchmarkDrawPackets();
+
+
+};
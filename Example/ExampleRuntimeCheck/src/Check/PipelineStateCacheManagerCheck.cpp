@@ -0,0 +1,256 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Check/PipelineStateCacheManagerCheck.h"
+#include "Framework/AllocationCounter.h"
+#include "Framework/MemoryFileManager.h"
+#include "Framework/NullRendererRuntime.h"
+
+#include <RendererRuntime/IRendererRuntime.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCompiler.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateSignature.h>
+
+#include <set>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_LOOKUP_ROUNDS = 100;
+		static const char*	  SHADER_SOURCE_CODE	  = "void main()\n{\n}\n";	// The null renderer doesn't care about the shader source code as long as there's one
+
+		// Shader properties "A" and "C" are referenced by both shader blueprints, "B" only by the fragment shader blueprint and "D" by none of them
+		static const RendererRuntime::ShaderPropertyId SHADER_PROPERTY_A = RendererRuntime::StringId("PipelineStateCacheManagerCheckA");
+		static const RendererRuntime::ShaderPropertyId SHADER_PROPERTY_B = RendererRuntime::StringId("PipelineStateCacheManagerCheckB");
+		static const RendererRuntime::ShaderPropertyId SHADER_PROPERTY_C = RendererRuntime::StringId("PipelineStateCacheManagerCheckC");
+		static const RendererRuntime::ShaderPropertyId SHADER_PROPERTY_D = RendererRuntime::StringId("PipelineStateCacheManagerCheckD");
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct Combination
+		{
+			RendererRuntime::ShaderProperties	 shaderProperties;
+			RendererRuntime::DynamicShaderPieces dynamicShaderPieces[RendererRuntime::NUMBER_OF_SHADER_TYPES];
+		};
+		typedef std::vector<Combination> Combinations;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void addCombinations(Combinations& combinations)
+		{
+			// A in {absent, 1} x B in {absent, 1, 2, 3} x C in {absent, 1} x D in {absent, 1} x {no dynamic shader piece, one fragment shader piece}
+			for (uint32_t i = 0; i < 2 * 4 * 2 * 2 * 2; ++i)
+			{
+				Combination combination;
+				const uint32_t a = i % 2;
+				const uint32_t b = (i / 2) % 4;
+				const uint32_t c = (i / 8) % 2;
+				const uint32_t d = (i / 16) % 2;
+				const uint32_t piece = (i / 32) % 2;
+				if (0 != a)
+				{
+					combination.shaderProperties.setPropertyValue(SHADER_PROPERTY_A, 1);
+				}
+				if (0 != b)
+				{
+					combination.shaderProperties.setPropertyValue(SHADER_PROPERTY_B, static_cast<int32_t>(b));
+				}
+				if (0 != c)
+				{
+					combination.shaderProperties.setPropertyValue(SHADER_PROPERTY_C, 1);
+				}
+				if (0 != d)
+				{
+					combination.shaderProperties.setPropertyValue(SHADER_PROPERTY_D, 1);
+				}
+				if (0 != piece)
+				{
+					combination.dynamicShaderPieces[static_cast<uint8_t>(RendererRuntime::ShaderType::Fragment)][RendererRuntime::StringId("PipelineStateCacheManagerCheckPiece")] = "// Dynamic shader piece";
+				}
+				combinations.push_back(combination);
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+void PipelineStateCacheManagerCheck::onRun()
+{
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::IRendererRuntime& rendererRuntime = nullRendererRuntime.getRendererRuntime();
+	RendererRuntime::ShaderBlueprintResourceManager& shaderBlueprintResourceManager = rendererRuntime.getShaderBlueprintResourceManager();
+	RendererRuntime::MaterialBlueprintResourceManager& materialBlueprintResourceManager = rendererRuntime.getMaterialBlueprintResourceManager();
+
+	// Pipeline state caches unknown so far are compiled synchronously, this way there are no pipeline state compiler threads involved
+	RendererRuntime::PipelineStateCompiler& pipelineStateCompiler = rendererRuntime.getPipelineStateCompiler();
+	const bool asynchronousCompilationEnabled = pipelineStateCompiler.isAsynchronousCompilationEnabled();
+	pipelineStateCompiler.setAsynchronousCompilationEnabled(false);
+
+	// Create the shader blueprint resources and the material blueprint resource without loading them, only the data relevant for the pipeline state signature is set
+	RendererRuntime::ShaderBlueprintResource& vertexShaderBlueprintResource = shaderBlueprintResourceManager.mShaderBlueprintResources.addElement();
+	vertexShaderBlueprintResource.setResourceManager(&shaderBlueprintResourceManager);
+	vertexShaderBlueprintResource.setAssetId(RendererRuntime::StringId("ExampleRuntimeCheck/PipelineStateCacheManagerCheckVertexShader"));
+	vertexShaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::SHADER_PROPERTY_A, 1);
+	vertexShaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::SHADER_PROPERTY_C, 1);
+	vertexShaderBlueprintResource.mShaderSourceCode = ::detail::SHADER_SOURCE_CODE;
+	RendererRuntime::ShaderBuilder::compileShaderTemplate(vertexShaderBlueprintResource.mShaderSourceCode, vertexShaderBlueprintResource.mShaderTemplate);
+	RendererRuntime::ShaderBlueprintResource& fragmentShaderBlueprintResource = shaderBlueprintResourceManager.mShaderBlueprintResources.addElement();
+	fragmentShaderBlueprintResource.setResourceManager(&shaderBlueprintResourceManager);
+	fragmentShaderBlueprintResource.setAssetId(RendererRuntime::StringId("ExampleRuntimeCheck/PipelineStateCacheManagerCheckFragmentShader"));
+	fragmentShaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::SHADER_PROPERTY_A, 1);
+	fragmentShaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::SHADER_PROPERTY_B, 1);
+	fragmentShaderBlueprintResource.mReferencedShaderProperties.setPropertyValue(::detail::SHADER_PROPERTY_C, 1);
+	fragmentShaderBlueprintResource.mShaderSourceCode = ::detail::SHADER_SOURCE_CODE;
+	RendererRuntime::ShaderBuilder::compileShaderTemplate(fragmentShaderBlueprintResource.mShaderSourceCode, fragmentShaderBlueprintResource.mShaderTemplate);
+	RendererRuntime::MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.mMaterialBlueprintResources.addElement();
+	materialBlueprintResource.setResourceManager(&materialBlueprintResourceManager);
+	materialBlueprintResource.setAssetId(RendererRuntime::StringId("ExampleRuntimeCheck/PipelineStateCacheManagerCheckMaterialBlueprint"));
+	materialBlueprintResource.mShaderBlueprintResourceId[static_cast<uint8_t>(RendererRuntime::ShaderType::Vertex)] = vertexShaderBlueprintResource.getId();
+	materialBlueprintResource.mShaderBlueprintResourceId[static_cast<uint8_t>(RendererRuntime::ShaderType::Fragment)] = fragmentShaderBlueprintResource.getId();
+	{ // The program cache manager needs a root signature to create the programs with
+		Renderer::RootSignatureBuilder rootSignature;
+		rootSignature.initialize(0, nullptr, 0, nullptr, Renderer::RootSignatureFlags::ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+		materialBlueprintResource.mRootSignaturePtr = nullRendererRuntime.getRenderer().createRootSignature(rootSignature);
+	}
+	materialBlueprintResource.setLoadingState(RendererRuntime::IResource::LoadingState::LOADED);
+	RendererRuntime::PipelineStateCacheManager& pipelineStateCacheManager = materialBlueprintResource.getPipelineStateCacheManager();
+
+	::detail::Combinations combinations;
+	::detail::addCombinations(combinations);
+	const uint32_t numberOfCombinations = static_cast<uint32_t>(combinations.size());
+
+	{ // The incremental pipeline state signature ID must be identical to the one of a fully constructed pipeline state signature
+		bool sameSignatureId = true;
+		bool sameShaderCombinationIds = true;
+		bool sameCopiedSignatureId = true;
+		bool unreferencedShaderPropertyIgnored = true;
+		std::set<RendererRuntime::PipelineStateSignatureId> pipelineStateSignatureIds;
+		for (uint32_t i = 0; i < numberOfCombinations; ++i)
+		{
+			const ::detail::Combination& combination = combinations[i];
+			RendererRuntime::ShaderCombinationId shaderCombinationId[RendererRuntime::NUMBER_OF_SHADER_TYPES];
+			const RendererRuntime::PipelineStateSignatureId pipelineStateSignatureId = RendererRuntime::PipelineStateSignature::generatePipelineStateSignatureId(materialBlueprintResource, combination.shaderProperties, combination.dynamicShaderPieces, shaderCombinationId);
+			const RendererRuntime::PipelineStateSignature pipelineStateSignature(materialBlueprintResource, combination.shaderProperties, combination.dynamicShaderPieces);
+			const RendererRuntime::PipelineStateSignature copiedPipelineStateSignature(pipelineStateSignature);
+			if (pipelineStateSignature.getPipelineStateSignatureId() != pipelineStateSignatureId)
+			{
+				sameSignatureId = false;
+			}
+			if (copiedPipelineStateSignature.getPipelineStateSignatureId() != pipelineStateSignatureId)
+			{
+				sameCopiedSignatureId = false;
+			}
+			for (uint8_t shaderType = 0; shaderType < RendererRuntime::NUMBER_OF_SHADER_TYPES; ++shaderType)
+			{
+				if (pipelineStateSignature.getShaderCombinationId(static_cast<RendererRuntime::ShaderType>(shaderType)) != shaderCombinationId[shaderType])
+				{
+					sameShaderCombinationIds = false;
+				}
+			}
+
+			// The combinations with the unreferenced shader property "D" are the second half of each dynamic shader piece block
+			if (combination.shaderProperties.hasPropertyValue(::detail::SHADER_PROPERTY_D))
+			{
+				const ::detail::Combination& combinationWithoutD = combinations[i - 16];
+				RendererRuntime::ShaderCombinationId shaderCombinationIdWithoutD[RendererRuntime::NUMBER_OF_SHADER_TYPES];
+				if (RendererRuntime::PipelineStateSignature::generatePipelineStateSignatureId(materialBlueprintResource, combinationWithoutD.shaderProperties, combinationWithoutD.dynamicShaderPieces, shaderCombinationIdWithoutD) != pipelineStateSignatureId)
+				{
+					unreferencedShaderPropertyIgnored = false;
+				}
+			}
+			pipelineStateSignatureIds.insert(pipelineStateSignatureId);
+		}
+		print("%u combinations: %u distinct pipeline state signature IDs", numberOfCombinations, static_cast<uint32_t>(pipelineStateSignatureIds.size()));
+		check(sameSignatureId, "Incremental pipeline state signature ID is identical to the one of a fully constructed pipeline state signature");
+		check(sameShaderCombinationIds, "Incremental shader combination IDs are identical to the ones of a fully constructed pipeline state signature");
+		check(sameCopiedSignatureId, "A copied pipeline state signature keeps the pipeline state signature ID");
+		check(unreferencedShaderPropertyIgnored, "Shader properties not referenced by a shader blueprint don't change the pipeline state signature ID");
+		check(pipelineStateSignatureIds.size() == numberOfCombinations / 2, "Each distinct combination has its own pipeline state signature ID");
+	}
+
+	{ // Once known, looking up pipeline state caches must not touch the heap
+		// Warm up, this creates the pipeline state caches
+		std::vector<Renderer::IPipelineState*> pipelineStates(numberOfCombinations, nullptr);
+		for (uint32_t i = 0; i < numberOfCombinations; ++i)
+		{
+			pipelineStates[i] = pipelineStateCacheManager.getPipelineStateCacheByCombination(combinations[i].shaderProperties, combinations[i].dynamicShaderPieces, true);
+		}
+		const uint32_t numberOfPipelineStateCaches = pipelineStateCacheManager.mNumberOfPipelineStateCaches;
+
+		{ // Make sure the allocation counter is able to detect the allocations of the slow path
+			const uint64_t numberOfThreadAllocations = AllocationCounter::getNumberOfThreadAllocations();
+			const RendererRuntime::PipelineStateSignature pipelineStateSignature(materialBlueprintResource, combinations.back().shaderProperties, combinations.back().dynamicShaderPieces);
+			check(AllocationCounter::getNumberOfThreadAllocations() > numberOfThreadAllocations, "The allocation counter detects the allocations of a pipeline state signature construction");
+		}
+
+		// Steady state
+		bool samePipelineState = true;
+		const uint64_t numberOfThreadAllocations = AllocationCounter::getNumberOfThreadAllocations();
+		for (uint32_t round = 0; round < ::detail::NUMBER_OF_LOOKUP_ROUNDS; ++round)
+		{
+			for (uint32_t i = 0; i < numberOfCombinations; ++i)
+			{
+				if (pipelineStateCacheManager.getPipelineStateCacheByCombination(combinations[i].shaderProperties, combinations[i].dynamicShaderPieces, false) != pipelineStates[i])
+				{
+					samePipelineState = false;
+				}
+			}
+		}
+		const uint64_t numberOfSteadyStateAllocations = AllocationCounter::getNumberOfThreadAllocations() - numberOfThreadAllocations;
+		print("%u pipeline state caches, %u lookups: %u heap allocations", numberOfPipelineStateCaches, ::detail::NUMBER_OF_LOOKUP_ROUNDS * numberOfCombinations, static_cast<uint32_t>(numberOfSteadyStateAllocations));
+		check(numberOfPipelineStateCaches == numberOfCombinations / 2, "One pipeline state cache per distinct combination");
+		check(0 == numberOfSteadyStateAllocations, "Looking up known pipeline state caches doesn't allocate");
+		check(samePipelineState, "Looking up known pipeline state caches returns the pipeline state received during warm up");
+		check(pipelineStateCacheManager.mNumberOfPipelineStateCaches == numberOfPipelineStateCaches, "Looking up known pipeline state caches doesn't create new ones");
+	}
+
+	// Cleanup, the resources created in here are destroyed together with the renderer runtime
+	pipelineStateCacheManager.clearCache();
+	pipelineStateCompiler.setAsynchronousCompilationEnabled(asynchronousCompilationEnabled);
+}
@@ -0,0 +1,74 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/IRuntimeCheck.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Pipeline state cache manager check: Allocation free lookups and pipeline state signature ID equality
+*
+*  @remarks
+*    Drives "RendererRuntime::PipelineStateCacheManager::getPipelineStateCacheByCombination()" with a material blueprint resource
+*    referencing a vertex and a fragment shader blueprint resource, both created without loading them:
+*    - The incremental "RendererRuntime::PipelineStateSignature::generatePipelineStateSignatureId()" must result in the same IDs as a
+*      fully constructed pipeline state signature, shader properties not referenced by the shader blueprints must not change the IDs
+*    - Once the pipeline state caches are known, the lookup must not touch the heap
+*/
+class PipelineStateCacheManagerCheck : public IRuntimeCheck
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	inline PipelineStateCacheManagerCheck() :
+		IRuntimeCheck("PipelineStateCacheManager", false)
+	{
+		// Nothing here
+	}
+
+	inline virtual ~PipelineStateCacheManagerCheck()
+	{
+		// Nothing here
+	}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+protected:
+	virtual void onRun() override;
+
+
+};
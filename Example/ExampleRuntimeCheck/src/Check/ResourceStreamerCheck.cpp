@@ -0,0 +1,124 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Check/ResourceStreamerCheck.h"
+#include "Framework/FakeResourceManager.h"
+#include "Framework/MemoryFileManager.h"
+#include "Framework/NullRendererRuntime.h"
+
+#include <RendererRuntime/IRendererRuntime.h>
+#include <RendererRuntime/Core/GetUninitialized.h>
+
+#include <chrono>
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+void ResourceStreamerCheck::onRun()
+{
+	static const uint32_t NUMBER_OF_BACKGROUND_LOAD_REQUESTS = 3000;
+	static const uint32_t CANCELLATION_STRIDE				 = 15;	///< Every 15th background load request is cancelled, in flight ones as well as pending ones
+	static const uint32_t NUMBER_OF_CANCELLATIONS			 = NUMBER_OF_BACKGROUND_LOAD_REQUESTS / CANCELLATION_STRIDE;
+	static const uint32_t PROMOTED_IN_FLIGHT_RESOURCE_INDEX	 = 901;	///< Background load request which has already entered the pipeline when it gets promoted, not cancelled
+	static const uint32_t LATE_EMERGENCY_RESOURCE_INDEX		 = NUMBER_OF_BACKGROUND_LOAD_REQUESTS;
+	static const uint32_t PROMOTED_PENDING_RESOURCE_INDEX	 = NUMBER_OF_BACKGROUND_LOAD_REQUESTS + 1;
+	static const uint32_t MAXIMUM_OVERTAKE_DISPATCH_POSITION = 100;	///< Far less than the number of background load requests which are already in flight
+
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::ResourceStreamer& resourceStreamer = nullRendererRuntime.getRendererRuntime().getResourceStreamer();
+	resourceStreamer.setNumberOfDeserializationThreads(4);
+	resourceStreamer.setNumberOfProcessingThreads(4);
+	FakeResourceManager fakeResourceManager(memoryFileManager, NUMBER_OF_BACKGROUND_LOAD_REQUESTS + 2, 50, 50);
+
+	{ // Commit, re-prioritize and cancel while the worker threads are already busy
+		typedef RendererRuntime::ResourceStreamer::LoadPriority LoadPriority;
+		for (uint32_t resourceIndex = 0; resourceIndex < NUMBER_OF_BACKGROUND_LOAD_REQUESTS; ++resourceIndex)
+		{
+			resourceStreamer.commitLoadRequest(fakeResourceManager.getLoadRequest(resourceIndex, LoadPriority::BACKGROUND));
+		}
+		check(resourceStreamer.mNumberOfPendingLoadRequests > 0, "The background load requests don't fit into the pipeline");
+		resourceStreamer.commitLoadRequest(fakeResourceManager.getLoadRequest(LATE_EMERGENCY_RESOURCE_INDEX, LoadPriority::EMERGENCY));
+		resourceStreamer.commitLoadRequest(fakeResourceManager.getLoadRequest(PROMOTED_PENDING_RESOURCE_INDEX, LoadPriority::BACKGROUND));
+		bool promoted = resourceStreamer.setLoadPriority(fakeResourceManager.getResource(PROMOTED_PENDING_RESOURCE_INDEX), LoadPriority::EMERGENCY);
+		promoted = resourceStreamer.setLoadPriority(fakeResourceManager.getResource(PROMOTED_IN_FLIGHT_RESOURCE_INDEX), LoadPriority::EMERGENCY) && promoted;
+		check(promoted, "Load requests which haven't been dispatched, yet, can be promoted");
+		uint32_t numberOfCancelledLoadRequests = 0;
+		for (uint32_t resourceIndex = 0; resourceIndex < NUMBER_OF_BACKGROUND_LOAD_REQUESTS; resourceIndex += CANCELLATION_STRIDE)
+		{
+			if (resourceStreamer.cancelLoadRequest(fakeResourceManager.getResource(resourceIndex)))
+			{
+				++numberOfCancelledLoadRequests;
+			}
+		}
+		check(NUMBER_OF_CANCELLATIONS == numberOfCancelledLoadRequests, "Load requests which haven't been dispatched, yet, can be cancelled");
+		resourceStreamer.flushAllQueues();
+	}
+
+	{ // Evaluate overtaking
+		const uint32_t lateEmergencyDispatchPosition = fakeResourceManager.getDispatchPosition(LATE_EMERGENCY_RESOURCE_INDEX);
+		const uint32_t promotedPendingDispatchPosition = fakeResourceManager.getDispatchPosition(PROMOTED_PENDING_RESOURCE_INDEX);
+		const uint32_t promotedInFlightDispatchPosition = fakeResourceManager.getDispatchPosition(PROMOTED_IN_FLIGHT_RESOURCE_INDEX);
+		print("%u background load requests, %u cancelled, dispatch positions: late emergency %u, promoted pending %u, promoted in flight %u",
+			  NUMBER_OF_BACKGROUND_LOAD_REQUESTS, NUMBER_OF_CANCELLATIONS, lateEmergencyDispatchPosition, promotedPendingDispatchPosition, promotedInFlightDispatchPosition);
+		check(lateEmergencyDispatchPosition < MAXIMUM_OVERTAKE_DISPATCH_POSITION, "The late emergency load request overtakes the background load requests");
+		check(promotedPendingDispatchPosition < MAXIMUM_OVERTAKE_DISPATCH_POSITION, "The promoted pending load request overtakes the background load requests");
+		check(promotedInFlightDispatchPosition < MAXIMUM_OVERTAKE_DISPATCH_POSITION, "The promoted in-flight load request overtakes the background load requests");
+	}
+
+	{ // Evaluate cancellation
+		bool loadingStatesValid = true;
+		bool cancelledNotDispatched = true;
+		for (uint32_t resourceIndex = 0; resourceIndex < fakeResourceManager.getNumberOfResources(); ++resourceIndex)
+		{
+			const bool cancelled = (resourceIndex < NUMBER_OF_BACKGROUND_LOAD_REQUESTS && 0 == (resourceIndex % CANCELLATION_STRIDE));
+			if (fakeResourceManager.getResource(resourceIndex).getLoadingState() != (cancelled ? RendererRuntime::IResource::LoadingState::UNLOADED : RendererRuntime::IResource::LoadingState::LOADED))
+			{
+				loadingStatesValid = false;
+			}
+			if (cancelled && RendererRuntime::isInitialized(fakeResourceManager.getDispatchPosition(resourceIndex)))
+			{
+				cancelledNotDispatched = false;
+			}
+		}
+		check(loadingStatesValid, "Cancelled resources are unloaded, all other resources are loaded");
+		check(cancelledNotDispatched, "Cancelled load requests aren't dispatched");
+		check(fakeResourceManager.getNumberOfCancellations() == NUMBER_OF_CANCELLATIONS, "The resource loader of each cancelled load request is informed exactly once");
+		check(fakeResourceManager.getDispatchedResourceIndices().size() == fakeResourceManager.getNumberOfResources() - NUMBER_OF_CANCELLATIONS, "Each load request which hasn't been cancelled is dispatched exactly once");
+	}
+
+	{ // Evaluate release
+		// -> Worker threads drop queue entries outdated by the promotion of the in-flight load request on their own, give them a moment
+		const std::chrono::high_resolution_clock::time_point endTime = std::chrono::high_resolution_clock::now() + std::chrono::seconds(1);
+		while (resourceStreamer.mFreeInFlightLoadRequestIndices.getApproximateNumberOfElements() != RendererRuntime::ResourceStreamer::MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS && std::chrono::high_resolution_clock::now() < endTime)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		check(0 == fakeResourceManager.getNumberOfUsedResourceLoaderInstances(), "All resource loader instances are released");
+		check(fakeResourceManager.getNumberOfFreeResourceLoaderInstances() == fakeResourceManager.getNumberOfResources(), "All resource loader instances can be reused");
+		check(0 == resourceStreamer.mNumberOfInFlightLoadRequests && 0 == resourceStreamer.mNumberOfPendingLoadRequests, "No load request is left inside the resource streamer");
+		check(resourceStreamer.mFreeInFlightLoadRequestIndices.getApproximateNumberOfElements() == RendererRuntime::ResourceStreamer::MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS, "All in-flight load request slots are given back");
+	}
+}
@@ -0,0 +1,249 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Check/ShaderBuilderCheck.h"
+#include "Framework/MemoryFileManager.h"
+#include "Framework/NullRendererRuntime.h"
+
+#include <RendererRuntime/IRendererRuntime.h>
+#include <RendererRuntime/Resource/ShaderPiece/ShaderPieceResourceManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h>
+
+#include <random>
+#include <string>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_SOURCE_CODES			 = 2000;
+		static const uint32_t NUMBER_OF_SHADER_PROPERTY_SETS	 = 8;	///< Per generated source code
+		static const uint32_t NUMBER_OF_SHADER_PIECES			 = 2;	///< The first shader piece defines "PieceA", the second one "PieceB"
+		static const uint32_t MAXIMUM_DIRECTIVE_NESTING			 = 3;
+		static const char*	  TEXTS[]						 = { "float value;\n", "\tvalue += 1.0;\n", "color", " = ", "\n", "(a, b)", "\t", ";" };
+		static const char*	  PROPERTY_EXPRESSIONS[]		 = { "A", "!B", "A && B", "A || C", "!(A && B)", "(A || B) && !C", "N", "P" };
+		static const char*	  FOREACH_COUNTS[]				 = { "0", "1", "3", "N", "P" };
+		static const char*	  FOREACH_STARTS[]				 = { "0", "1", "2" };
+		static const char*	  PIECE_NAMES[]					 = { "PieceA", "PieceB" };
+		static const char*	  COUNTER_OPERATIONS[]			 = { "@counter(C)", "@value(C)", "@set(C, 1)", "@add(C, 2)", "@sub(C, 1)", "@mul(C, C, 2)", "@max(C, N, 1)", "@value(N)" };
+		static const char*	  MATH_OPERATIONS[]				 = { "@pset(P, 2)", "@padd(P, A, 1)", "@pmul(N, 2)", "@pmax(N, B, 1)", "@psub(A, 1)", "@pmod(P, 2)" };
+		static const char*	  DIRECTIVE_ENDS[]				 = { "\n", "\n", " ", "x" };	///< The character after "@end" is skipped
+		static const char*	  SHADER_PROPERTY_NAMES[]		 = { "A", "B", "C", "N", "P" };
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		template <typename T, size_t N>
+		const T& randomElement(std::mt19937& random, const T (&elements)[N])
+		{
+			return elements[random() % N];
+		}
+
+		/**
+		*  @brief
+		*    Append a random sequence of text and directives to the given source code
+		*
+		*  @note
+		*    - A piece must only be defined once, so it's neither defined inside "@foreach" nor by more than one source code
+		*    - Inside a piece only "PieceB" is inserted and "PieceB" itself doesn't insert pieces, parsing the source code would never end if a piece inserts itself
+		*/
+		void appendSourceCode(std::mt19937& random, std::string& sourceCode, uint32_t nesting, bool insideForEach, bool insidePiece, const char*& pieceToDefine, bool insertPieces)
+		{
+			const uint32_t numberOfElements = 2 + random() % 5;
+			for (uint32_t i = 0; i < numberOfElements; ++i)
+			{
+				const uint32_t element = (nesting < MAXIMUM_DIRECTIVE_NESTING) ? (random() % 10) : 0;
+				switch (element)
+				{
+					case 3:
+						sourceCode += "@property(";
+						sourceCode += randomElement(random, PROPERTY_EXPRESSIONS);
+						sourceCode += ')';
+						appendSourceCode(random, sourceCode, nesting + 1, insideForEach, insidePiece, pieceToDefine, insertPieces);
+						sourceCode += "@end";
+						sourceCode += randomElement(random, DIRECTIVE_ENDS);
+						break;
+
+					case 4:
+						if (!insideForEach)
+						{
+							sourceCode += "@foreach(";
+							sourceCode += randomElement(random, FOREACH_COUNTS);
+							sourceCode += ", n";
+							if (0 == random() % 2)
+							{
+								sourceCode += ", ";
+								sourceCode += randomElement(random, FOREACH_STARTS);
+							}
+							sourceCode += ")value@n = @n;\n";
+							appendSourceCode(random, sourceCode, nesting + 1, true, insidePiece, pieceToDefine, insertPieces);
+							sourceCode += "@end";
+							sourceCode += randomElement(random, DIRECTIVE_ENDS);
+						}
+						break;
+
+					case 5:
+						if (!insideForEach && !insidePiece && nullptr != pieceToDefine)
+						{
+							sourceCode += "@piece(";
+							sourceCode += pieceToDefine;
+							sourceCode += ')';
+							pieceToDefine = nullptr;
+							appendSourceCode(random, sourceCode, nesting + 1, insideForEach, true, pieceToDefine, insertPieces);
+							sourceCode += "@end";
+							sourceCode += randomElement(random, DIRECTIVE_ENDS);
+						}
+						break;
+
+					case 6:
+						if (insertPieces)
+						{
+							sourceCode += "@insertpiece(";
+							sourceCode += PIECE_NAMES[insidePiece ? 1 : (random() % 2)];
+							sourceCode += ")\n";
+						}
+						break;
+
+					case 7:
+						sourceCode += randomElement(random, COUNTER_OPERATIONS);
+						sourceCode += '\n';
+						break;
+
+					case 8:
+						sourceCode += randomElement(random, MATH_OPERATIONS);
+						sourceCode += '\n';
+						break;
+
+					default:
+						sourceCode += randomElement(random, TEXTS);
+						break;
+				}
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+void ShaderBuilderCheck::onRun()
+{
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::IRendererRuntime& rendererRuntime = nullRendererRuntime.getRendererRuntime();
+	RendererRuntime::ShaderPieceResourceManager& shaderPieceResourceManager = rendererRuntime.getShaderPieceResourceManager();
+	RendererRuntime::ShaderBlueprintResourceManager& shaderBlueprintResourceManager = rendererRuntime.getShaderBlueprintResourceManager();
+
+	// Create the shader piece resources and the shader blueprint resource including them without loading them, the source codes are set for each test run
+	RendererRuntime::ShaderPieceResource* shaderPieceResources[::detail::NUMBER_OF_SHADER_PIECES] = {};
+	RendererRuntime::ShaderBlueprintResource& shaderBlueprintResource = shaderBlueprintResourceManager.mShaderBlueprintResources.addElement();
+	shaderBlueprintResource.setResourceManager(&shaderBlueprintResourceManager);
+	for (uint32_t i = 0; i < ::detail::NUMBER_OF_SHADER_PIECES; ++i)
+	{
+		shaderPieceResources[i] = &shaderPieceResourceManager.mShaderPieceResources.addElement();
+		shaderPieceResources[i]->setResourceManager(&shaderPieceResourceManager);
+		shaderBlueprintResource.mIncludeShaderPieceResourceIds.push_back(shaderPieceResources[i]->getId());
+	}
+
+	// The random number generator is seeded with a constant so failures can be reproduced
+	std::mt19937 random(42);
+	RendererRuntime::ShaderBuilder templateShaderBuilder;
+	RendererRuntime::ShaderBuilder parsingShaderBuilder;
+	uint32_t numberOfBuilds = 0;
+	uint32_t numberOfTemplateBuilds = 0;
+	uint32_t numberOfDifferences = 0;
+	size_t numberOfCharacters = 0;
+	for (uint32_t sourceCodeIndex = 0; sourceCodeIndex < ::detail::NUMBER_OF_SOURCE_CODES; ++sourceCodeIndex)
+	{
+		// Generate the source codes and compile them into shader templates, just like the resource loaders are doing it
+		for (uint32_t i = 0; i < ::detail::NUMBER_OF_SHADER_PIECES; ++i)
+		{
+			RendererRuntime::ShaderPieceResource& shaderPieceResource = *shaderPieceResources[i];
+			const char* pieceToDefine = ::detail::PIECE_NAMES[i];
+			shaderPieceResource.mShaderSourceCode.clear();
+			::detail::appendSourceCode(random, shaderPieceResource.mShaderSourceCode, 0, false, false, pieceToDefine, 0 == i);
+			RendererRuntime::ShaderBuilder::compileShaderTemplate(shaderPieceResource.mShaderSourceCode, shaderPieceResource.mShaderTemplate);
+		}
+		const char* pieceToDefine = nullptr;
+		shaderBlueprintResource.mShaderSourceCode.clear();
+		::detail::appendSourceCode(random, shaderBlueprintResource.mShaderSourceCode, 0, false, false, pieceToDefine, true);
+		RendererRuntime::ShaderBuilder::compileShaderTemplate(shaderBlueprintResource.mShaderSourceCode, shaderBlueprintResource.mShaderTemplate);
+
+		// Build the source code with different shader properties, the first build is without any shader properties
+		RendererRuntime::ShaderProperties shaderProperties;
+		for (uint32_t shaderPropertySetIndex = 0; shaderPropertySetIndex < ::detail::NUMBER_OF_SHADER_PROPERTY_SETS; ++shaderPropertySetIndex)
+		{
+			if (shaderPropertySetIndex > 0)
+			{
+				shaderProperties.clear();
+				for (const char* shaderPropertyName : ::detail::SHADER_PROPERTY_NAMES)
+				{
+					if (0 != random() % 2)
+					{
+						shaderProperties.setPropertyValue(RendererRuntime::StringId(shaderPropertyName), static_cast<int32_t>(random() % 4));
+					}
+				}
+			}
+
+			// Compare the source codes before the C-preprocessor is applied
+			++numberOfBuilds;
+			if (templateShaderBuilder.createSourceCodeByShaderTemplates(shaderPieceResourceManager, shaderBlueprintResource, shaderProperties))
+			{
+				++numberOfTemplateBuilds;
+				numberOfCharacters += templateShaderBuilder.mInString.size();
+				parsingShaderBuilder.createSourceCodeByParsing(shaderPieceResourceManager, shaderBlueprintResource, shaderProperties);
+				if (templateShaderBuilder.mInString != parsingShaderBuilder.mInString)
+				{
+					if (0 == numberOfDifferences)
+					{
+						print("First difference, shader blueprint source code:\n%s", shaderBlueprintResource.mShaderSourceCode.c_str());
+					}
+					++numberOfDifferences;
+				}
+			}
+		}
+	}
+	print("%u source codes, %u builds: %u evaluated shader templates with %u characters on average, %u differences to parsing the source code", ::detail::NUMBER_OF_SOURCE_CODES, numberOfBuilds, numberOfTemplateBuilds, static_cast<uint32_t>((numberOfTemplateBuilds > 0) ? (numberOfCharacters / numberOfTemplateBuilds) : 0), numberOfDifferences);
+	check(0 == numberOfDifferences, "Evaluating the shader templates results in the same source code as parsing the source code");
+	check(numberOfTemplateBuilds * 2 >= numberOfBuilds, "The majority of the builds evaluated shader templates");
+
+	// Cleanup, the resources created in here are destroyed together with the renderer runtime
+	shaderBlueprintResource.mIncludeShaderPieceResourceIds.clear();
+}
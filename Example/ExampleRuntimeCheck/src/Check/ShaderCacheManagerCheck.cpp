@@ -0,0 +1,159 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Check/ShaderCacheManagerCheck.h"
+#include "Framework/MemoryFileManager.h"
+#include "Framework/NullRendererRuntime.h"
+
+#include <RendererRuntime/IRendererRuntime.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCacheManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCache.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+void ShaderCacheManagerCheck::onRun()
+{
+	static const uint32_t NUMBER_OF_THREADS		  = 16;
+	static const uint32_t NUMBER_OF_SHADER_CACHES = 200;	///< Every second shader cache fails the first time it's build
+
+	MemoryFileManager memoryFileManager;
+	NullRendererRuntime nullRendererRuntime(memoryFileManager);
+	RendererRuntime::ShaderCacheManager& shaderCacheManager = nullRendererRuntime.getRendererRuntime().getShaderBlueprintResourceManager().getShaderCacheManager();
+
+	// Per shader cache statistics, only accessed while holding the shader cache manager mutex
+	struct ShaderCacheStatistics
+	{
+		uint32_t numberOfBuilds;
+		uint32_t numberOfInFlightWaits;
+	};
+	std::vector<ShaderCacheStatistics> shaderCacheStatistics(NUMBER_OF_SHADER_CACHES, ShaderCacheStatistics{0, 0});
+	std::vector<RendererRuntime::ShaderCache*> receivedShaderCaches(NUMBER_OF_THREADS * NUMBER_OF_SHADER_CACHES, nullptr);
+	std::atomic<uint32_t> numberOfFailedRequests(0);
+
+	{ // All threads walk through the shader caches in the same order, the building thread takes its time so the others pile up waiting for it
+		std::atomic<bool> start(false);
+		std::vector<std::thread> threads;
+		for (uint32_t threadIndex = 0; threadIndex < NUMBER_OF_THREADS; ++threadIndex)
+		{
+			threads.emplace_back([&, threadIndex]()
+			{
+				while (!start)
+				{
+					std::this_thread::yield();
+				}
+				for (uint32_t shaderCacheIndex = 0; shaderCacheIndex < NUMBER_OF_SHADER_CACHES; ++shaderCacheIndex)
+				{
+					const RendererRuntime::ShaderCacheId shaderCacheId = 1 + shaderCacheIndex;
+					RendererRuntime::ShaderCache* shaderCache = nullptr;
+					do
+					{
+						// Same procedure as "RendererRuntime::ShaderCacheManager::getShaderCache()"
+						std::unique_lock<std::mutex> mutexLock(shaderCacheManager.mMutex);
+						std::promise<RendererRuntime::ShaderCache*> shaderCachePromise;
+						const bool inFlight = (shaderCacheManager.mInFlightShaderCacheByShaderCacheId.find(shaderCacheId) != shaderCacheManager.mInFlightShaderCacheByShaderCacheId.cend());
+						ShaderCacheStatistics& statistics = shaderCacheStatistics[shaderCacheIndex];
+						if (shaderCacheManager.findOrBeginShaderCache(shaderCacheId, mutexLock, shaderCachePromise, shaderCache))
+						{
+							if (inFlight)
+							{
+								++statistics.numberOfInFlightWaits;
+							}
+						}
+						else
+						{
+							// Build the shader cache without holding the mutex
+							++statistics.numberOfBuilds;
+							const bool failed = ((shaderCacheIndex % 2) != 0 && 1 == statistics.numberOfBuilds);
+							mutexLock.unlock();
+							std::this_thread::sleep_for(std::chrono::microseconds(200));
+							mutexLock.lock();
+							if (!failed)
+							{
+								shaderCache = new RendererRuntime::ShaderCache(shaderCacheId);
+								shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+							}
+							shaderCacheManager.endShaderCache(shaderCacheId, shaderCachePromise, shaderCache);
+						}
+
+						// A failed build means the request has to be made again
+						if (nullptr == shaderCache)
+						{
+							++numberOfFailedRequests;
+						}
+					} while (nullptr == shaderCache);
+					receivedShaderCaches[threadIndex * NUMBER_OF_SHADER_CACHES + shaderCacheIndex] = shaderCache;
+				}
+			});
+		}
+		start = true;
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	{ // Evaluate
+		uint32_t numberOfInFlightWaits = 0;
+		bool singleBuild = true;
+		bool sameShaderCache = true;
+		for (uint32_t shaderCacheIndex = 0; shaderCacheIndex < NUMBER_OF_SHADER_CACHES; ++shaderCacheIndex)
+		{
+			// Shader caches which fail the first time are build exactly twice, else exactly once
+			const ShaderCacheStatistics& statistics = shaderCacheStatistics[shaderCacheIndex];
+			numberOfInFlightWaits += statistics.numberOfInFlightWaits;
+			if (statistics.numberOfBuilds != (((shaderCacheIndex % 2) != 0) ? 2u : 1u))
+			{
+				singleBuild = false;
+			}
+
+			// All threads must have received the shader cache known by the shader cache manager
+			const RendererRuntime::ShaderCacheId shaderCacheId = 1 + shaderCacheIndex;
+			RendererRuntime::ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator iterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
+			const RendererRuntime::ShaderCache* shaderCache = (iterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend()) ? iterator->second : nullptr;
+			for (uint32_t threadIndex = 0; threadIndex < NUMBER_OF_THREADS; ++threadIndex)
+			{
+				if (nullptr == shaderCache || receivedShaderCaches[threadIndex * NUMBER_OF_SHADER_CACHES + shaderCacheIndex] != shaderCache)
+				{
+					sameShaderCache = false;
+				}
+			}
+		}
+		print("%u threads, %u shader caches: %u in-flight waits, %u failed requests made again", NUMBER_OF_THREADS, NUMBER_OF_SHADER_CACHES, numberOfInFlightWaits, numberOfFailedRequests.load());
+		check(singleBuild, "Each shader cache is build once, failed shader caches are build once more");
+		check(sameShaderCache, "All threads receive the one and only shader cache instance");
+		check(shaderCacheManager.mInFlightShaderCacheByShaderCacheId.empty(), "No shader cache is left in flight");
+		check(numberOfInFlightWaits > 0, "The in-flight path has been exercised");
+		check(numberOfFailedRequests > 0, "The path requesting a failed shader cache again has been exercised");
+	}
+
+	// Cleanup, destroys the shader caches created in here
+	shaderCacheManager.clearCache();
+}
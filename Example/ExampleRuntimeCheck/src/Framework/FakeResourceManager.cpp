@@ -0,0 +1,209 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/FakeResourceManager.h"
+#include "Framework/MemoryFileManager.h"
+
+#include <RendererRuntime/Core/File/IFile.h>
+#include <RendererRuntime/Core/GetUninitialized.h>
+
+#include <chrono>
+#include <thread>
+#include <cassert>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const size_t FILE_SIZE = 4096;	///< Size in bytes of the fake resource file
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+const RendererRuntime::ResourceLoaderTypeId FakeResourceLoader::TYPE_ID("fake");
+const char FakeResourceManager::ASSET_FILENAME[] = "ExampleRuntimeCheck/FakeResource";
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IResourceLoader methods ]
+//[-------------------------------------------------------]
+void FakeResourceLoader::onDeserialization(RendererRuntime::IFile& file)
+{
+	// Read the file and pretend it's a slow one
+	mFileData.resize(file.getNumberOfBytes());
+	file.read(mFileData.data(), mFileData.size());
+	std::this_thread::sleep_for(std::chrono::microseconds(mFakeResourceManager.mDeserializationMicroseconds));
+}
+
+void FakeResourceLoader::onProcessing()
+{
+	// Keep the processor busy
+	const std::chrono::high_resolution_clock::time_point endTime = std::chrono::high_resolution_clock::now() + std::chrono::microseconds(mFakeResourceManager.mProcessingMicroseconds);
+	uint8_t checksum = 0;
+	do
+	{
+		for (uint8_t value : mFileData)
+		{
+			checksum = static_cast<uint8_t>(checksum * 31 + value);
+		}
+	} while (std::chrono::high_resolution_clock::now() < endTime);
+	mFileData[0] = checksum;
+}
+
+bool FakeResourceLoader::onDispatch()
+{
+	// Dispatch is always done by the thread the resource manager is used on, no need to synchronize
+	mFakeResourceManager.mDispatchedResourceIndices.push_back(mResourceIndex);
+
+	// Fully loaded
+	return true;
+}
+
+void FakeResourceLoader::onCancellation()
+{
+	++mFakeResourceManager.mNumberOfCancellations;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+FakeResourceLoader::FakeResourceLoader(FakeResourceManager& fakeResourceManager) :
+	IResourceLoader(fakeResourceManager),
+	mFakeResourceManager(fakeResourceManager),
+	mResourceIndex(RendererRuntime::getUninitialized<uint32_t>()),
+	mOrderedLoading(false)
+{
+	// All fake resource loaders read the same file
+	RendererRuntime::Asset asset;
+	asset.assetId = RendererRuntime::StringId(FakeResourceManager::ASSET_FILENAME);
+	strcpy(asset.assetFilename, FakeResourceManager::ASSET_FILENAME);
+	initialize(asset);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+FakeResourceManager::FakeResourceManager(MemoryFileManager& memoryFileManager, uint32_t numberOfResources, uint32_t deserializationMicroseconds, uint32_t processingMicroseconds) :
+	mNumberOfResources(numberOfResources),
+	mResources(new FakeResource[numberOfResources]),
+	mDeserializationMicroseconds(deserializationMicroseconds),
+	mProcessingMicroseconds(processingMicroseconds),
+	mNumberOfCancellations(0)
+{
+	// Provide the fake resource file
+	memoryFileManager.setFile(ASSET_FILENAME, MemoryFileManager::FileData(::detail::FILE_SIZE, 42));
+
+	// One resource loader instance per fake resource, destroyed by the resource manager interface
+	mFreeResourceLoaderInstances.reserve(numberOfResources);
+	mUsedResourceLoaderInstances.reserve(numberOfResources);
+	for (uint32_t i = 0; i < numberOfResources; ++i)
+	{
+		mFreeResourceLoaderInstances.push_back(new FakeResourceLoader(*this));
+	}
+	mDispatchedResourceIndices.reserve(numberOfResources);
+}
+
+FakeResourceManager::~FakeResourceManager()
+{
+	// The resource loader instances are destroyed by the resource manager interface
+	delete [] mResources;
+}
+
+RendererRuntime::ResourceStreamer::LoadRequest FakeResourceManager::getLoadRequest(uint32_t resourceIndex, RendererRuntime::ResourceStreamer::LoadPriority loadPriority, bool orderedLoading)
+{
+	assert(resourceIndex < mNumberOfResources);
+	FakeResourceLoader* fakeResourceLoader = static_cast<FakeResourceLoader*>(acquireResourceLoaderInstance(FakeResourceLoader::TYPE_ID));
+	assert(nullptr != fakeResourceLoader);
+	fakeResourceLoader->mResourceIndex = resourceIndex;
+	fakeResourceLoader->mOrderedLoading = orderedLoading;
+
+	// Done
+	RendererRuntime::ResourceStreamer::LoadRequest loadRequest;
+	loadRequest.resource = &mResources[resourceIndex];
+	loadRequest.resourceLoader = fakeResourceLoader;
+	loadRequest.loadPriority = loadPriority;
+	return loadRequest;
+}
+
+uint32_t FakeResourceManager::getDispatchPosition(uint32_t resourceIndex) const
+{
+	const size_t numberOfDispatchedResourceIndices = mDispatchedResourceIndices.size();
+	for (size_t i = 0; i < numberOfDispatchedResourceIndices; ++i)
+	{
+		if (mDispatchedResourceIndices[i] == resourceIndex)
+		{
+			return static_cast<uint32_t>(i);
+		}
+	}
+
+	// Not dispatched
+	return RendererRuntime::getUninitialized<uint32_t>();
+}
+
+void FakeResourceManager::reset()
+{
+	assert(mUsedResourceLoaderInstances.empty());
+	mDispatchedResourceIndices.clear();
+	mNumberOfCancellations = 0;
+	for (uint32_t i = 0; i < mNumberOfResources; ++i)
+	{
+		setResourceLoadingState(mResources[i], RendererRuntime::IResource::LoadingState::UNLOADED);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IResourceManager methods ]
+//[-------------------------------------------------------]
+RendererRuntime::IResource& FakeResourceManager::getResourceByResourceId(RendererRuntime::ResourceId resourceId) const
+{
+	// Fake resources are identified by their index
+	assert(resourceId < mNumberOfResources);
+	return mResources[resourceId];
+}
+
+RendererRuntime::IResource* FakeResourceManager::tryGetResourceByResourceId(RendererRuntime::ResourceId resourceId) const
+{
+	// Fake resources are identified by their index
+	return (resourceId < mNumberOfResources) ? &mResources[resourceId] : nullptr;
+}
@@ -0,0 +1,252 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <RendererRuntime/Resource/Detail/IResourceManager.h>
+#include <RendererRuntime/Resource/Detail/ResourceStreamer.h>
+
+#include <atomic>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class MemoryFileManager;
+class FakeResourceManager;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Resource without any data, only the loading state is of interest
+*/
+class FakeResource : public RendererRuntime::IResource
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	inline FakeResource();
+	inline virtual ~FakeResource();
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	FakeResource(const FakeResource&) = delete;
+	FakeResource& operator=(const FakeResource&) = delete;
+
+
+};
+
+/**
+*  @brief
+*    Resource loader reading the fake resource file and keeping the resource streamer stages busy for a given time
+*/
+class FakeResourceLoader : public RendererRuntime::IResourceLoader
+{
+
+
+//[-------------------------------------------------------]
+//[ Friends                                               ]
+//[-------------------------------------------------------]
+	friend class FakeResourceManager;
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	static const RendererRuntime::ResourceLoaderTypeId TYPE_ID;
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IResourceLoader methods ]
+//[-------------------------------------------------------]
+public:
+	inline virtual RendererRuntime::ResourceLoaderTypeId getResourceLoaderTypeId() const override;
+	inline virtual bool requiresOrderedLoading() const override;
+	virtual void onDeserialization(RendererRuntime::IFile& file) override;
+	virtual void onProcessing() override;
+	virtual bool onDispatch() override;
+	inline virtual bool isFullyLoaded() override;
+	virtual void onCancellation() override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	FakeResourceLoader(FakeResourceManager& fakeResourceManager);
+	inline virtual ~FakeResourceLoader();
+	FakeResourceLoader(const FakeResourceLoader&) = delete;
+	FakeResourceLoader& operator=(const FakeResourceLoader&) = delete;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	FakeResourceManager&		 mFakeResourceManager;
+	uint32_t					 mResourceIndex;	///< Index of the fake resource the resource loader is currently used for
+	bool						 mOrderedLoading;
+	std::vector<uint8_t>		 mFileData;
+
+
+};
+
+/**
+*  @brief
+*    Resource manager handing out load requests for fake resources, used to drive the resource streamer without any real asset
+*
+*  @note
+*    - There's one resource loader instance per fake resource, so every fake resource can be in flight at the same time
+*    - The deserialization time is spent sleeping (file input), the processing time busy waiting (number crunching)
+*/
+class FakeResourceManager : public RendererRuntime::IResourceManager
+{
+
+
+//[-------------------------------------------------------]
+//[ Friends                                               ]
+//[-------------------------------------------------------]
+	friend class FakeResourceLoader;	// Reports back
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	static const char ASSET_FILENAME[];	///< Name of the file all fake resource loaders are reading
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Constructor
+	*
+	*  @param[in] memoryFileManager
+	*    Memory file manager the renderer runtime is using, receives the fake resource file
+	*  @param[in] numberOfResources
+	*    Number of fake resources
+	*  @param[in] deserializationMicroseconds
+	*    Time in microseconds a load request spends inside the deserialization stage
+	*  @param[in] processingMicroseconds
+	*    Time in microseconds a load request spends inside the processing stage
+	*/
+	FakeResourceManager(MemoryFileManager& memoryFileManager, uint32_t numberOfResources, uint32_t deserializationMicroseconds, uint32_t processingMicroseconds);
+
+	virtual ~FakeResourceManager();
+	inline uint32_t getNumberOfResources() const;
+	inline FakeResource& getResource(uint32_t resourceIndex);
+
+	/**
+	*  @brief
+	*    Return a load request for a fake resource
+	*
+	*  @param[in] resourceIndex
+	*    Index of the fake resource, must not be in flight
+	*  @param[in] loadPriority
+	*    Load priority
+	*  @param[in] orderedLoading
+	*    "true" if the load request has to use the ordered resource streamer lane, else "false"
+	*
+	*  @return
+	*    The load request to commit, the resource loader instance is released by the resource streamer
+	*/
+	RendererRuntime::ResourceStreamer::LoadRequest getLoadRequest(uint32_t resourceIndex, RendererRuntime::ResourceStreamer::LoadPriority loadPriority, bool orderedLoading = false);
+
+	/**
+	*  @brief
+	*    Return the indices of the fake resources in dispatch order, cancelled load requests are not dispatched
+	*/
+	inline const std::vector<uint32_t>& getDispatchedResourceIndices() const;
+
+	/**
+	*  @brief
+	*    Return the dispatch position of a fake resource, "RendererRuntime::getUninitialized<uint32_t>()" if it hasn't been dispatched
+	*/
+	uint32_t getDispatchPosition(uint32_t resourceIndex) const;
+
+	inline uint32_t getNumberOfCancellations() const;
+	inline uint32_t getNumberOfFreeResourceLoaderInstances() const;
+	inline uint32_t getNumberOfUsedResourceLoaderInstances() const;
+
+	/**
+	*  @brief
+	*    Forget about all dispatched and cancelled load requests and set all fake resources back to unloaded, there must not be any load request in flight
+	*/
+	void reset();
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IResourceManager methods ]
+//[-------------------------------------------------------]
+public:
+	virtual RendererRuntime::IResource& getResourceByResourceId(RendererRuntime::ResourceId resourceId) const override;
+	virtual RendererRuntime::IResource* tryGetResourceByResourceId(RendererRuntime::ResourceId resourceId) const override;
+	inline virtual void reloadResourceByAssetId(RendererRuntime::AssetId assetId) override;
+	inline virtual void update() override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	FakeResourceManager(const FakeResourceManager&) = delete;
+	FakeResourceManager& operator=(const FakeResourceManager&) = delete;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	uint32_t				  mNumberOfResources;
+	FakeResource*			  mResources;
+	uint32_t				  mDeserializationMicroseconds;
+	uint32_t				  mProcessingMicroseconds;
+	std::vector<uint32_t>	  mDispatchedResourceIndices;	///< Only touched during dispatch
+	std::atomic<uint32_t>	  mNumberOfCancellations;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Framework/FakeResourceManager.inl"
@@ -0,0 +1,110 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+inline FakeResource::FakeResource()
+{
+	// Nothing here
+}
+
+inline FakeResource::~FakeResource()
+{
+	// The resource interface insists on unloaded resources
+	setLoadingState(LoadingState::UNLOADED);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IResourceLoader methods ]
+//[-------------------------------------------------------]
+inline RendererRuntime::ResourceLoaderTypeId FakeResourceLoader::getResourceLoaderTypeId() const
+{
+	return TYPE_ID;
+}
+
+inline bool FakeResourceLoader::requiresOrderedLoading() const
+{
+	return mOrderedLoading;
+}
+
+inline bool FakeResourceLoader::isFullyLoaded()
+{
+	// Fully loaded as soon as it has been dispatched
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+inline FakeResourceLoader::~FakeResourceLoader()
+{
+	// Nothing here
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+inline uint32_t FakeResourceManager::getNumberOfResources() const
+{
+	return mNumberOfResources;
+}
+
+inline FakeResource& FakeResourceManager::getResource(uint32_t resourceIndex)
+{
+	return mResources[resourceIndex];
+}
+
+inline const std::vector<uint32_t>& FakeResourceManager::getDispatchedResourceIndices() const
+{
+	return mDispatchedResourceIndices;
+}
+
+inline uint32_t FakeResourceManager::getNumberOfCancellations() const
+{
+	return mNumberOfCancellations;
+}
+
+inline uint32_t FakeResourceManager::getNumberOfFreeResourceLoaderInstances() const
+{
+	return static_cast<uint32_t>(mFreeResourceLoaderInstances.size());
+}
+
+inline uint32_t FakeResourceManager::getNumberOfUsedResourceLoaderInstances() const
+{
+	return static_cast<uint32_t>(mUsedResourceLoaderInstances.size());
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IResourceManager methods ]
+//[-------------------------------------------------------]
+inline void FakeResourceManager::reloadResourceByAssetId(RendererRuntime::AssetId)
+{
+	// Nothing here
+}
+
+inline void FakeResourceManager::update()
+{
+	// Nothing here
+}
@@ -0,0 +1,89 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/IRuntimeCheck.h"
+
+#include <cstdio>
+#include <cstdarg>
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+IRuntimeCheck::~IRuntimeCheck()
+{
+	// Nothing here
+}
+
+bool IRuntimeCheck::run()
+{
+	printf("%s: %s\n", mBenchmark ? "Benchmark" : "Check", mName);
+	fflush(stdout);
+	mNumberOfFailedChecks = 0;
+	onRun();
+	if (0 == mNumberOfFailedChecks)
+	{
+		printf("\tPassed\n");
+		return true;
+	}
+	else
+	{
+		printf("\tFailed, %u failed checks\n", mNumberOfFailedChecks);
+		return false;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected methods                                     ]
+//[-------------------------------------------------------]
+IRuntimeCheck::IRuntimeCheck(const char* name, bool benchmark) :
+	mName(name),
+	mBenchmark(benchmark),
+	mNumberOfFailedChecks(0)
+{
+	// Nothing here
+}
+
+void IRuntimeCheck::check(bool condition, const char* description)
+{
+	if (!condition)
+	{
+		printf("\tFAILED: %s\n", description);
+		fflush(stdout);
+		++mNumberOfFailedChecks;
+	}
+}
+
+void IRuntimeCheck::print(const char* format, ...) const
+{
+	va_list argumentList;
+	va_start(argumentList, format);
+	printf("\t");
+	vprintf(format, argumentList);
+	printf("\n");
+	va_end(argumentList);
+
+	// Keep the output in order with the renderer runtime output and don't lose it in case something goes horribly wrong
+	fflush(stdout);
+}
@@ -0,0 +1,135 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Abstract runtime check interface
+*
+*  @remarks
+*    A runtime check drives renderer runtime internals on top of the null renderer, so it doesn't need a GPU. Checks verify
+*    invariants and fail on violations, benchmarks report timings and are only run on request.
+*
+*  @note
+*    - Runtime checks reaching into renderer runtime internals are declared as friend by the classes they are checking,
+*      this is also why the runtime check is always statically linked against the renderer runtime
+*/
+class IRuntimeCheck
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	virtual ~IRuntimeCheck();
+
+	/**
+	*  @brief
+	*    Return the name used to request the runtime check by command line
+	*
+	*  @return
+	*    The ASCII name of the runtime check, always valid
+	*/
+	inline const char* getName() const;
+
+	/**
+	*  @brief
+	*    Return whether or not this is a benchmark
+	*
+	*  @return
+	*    "true" if this is a benchmark which is only run on request, else "false"
+	*/
+	inline bool isBenchmark() const;
+
+	/**
+	*  @brief
+	*    Run the runtime check
+	*
+	*  @return
+	*    "true" if all checks passed, else "false"
+	*/
+	bool run();
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual IRuntimeCheck methods               ]
+//[-------------------------------------------------------]
+protected:
+	virtual void onRun() = 0;
+
+
+//[-------------------------------------------------------]
+//[ Protected methods                                     ]
+//[-------------------------------------------------------]
+protected:
+	IRuntimeCheck(const char* name, bool benchmark);
+
+	/**
+	*  @brief
+	*    Check a condition, a failed condition is printed and lets the runtime check fail
+	*
+	*  @param[in] condition
+	*    Condition which must be "true"
+	*  @param[in] description
+	*    ASCII description of the condition, always valid
+	*/
+	void check(bool condition, const char* description);
+
+	/**
+	*  @brief
+	*    Print a "printf()"-formatted line of the runtime check output
+	*/
+	void print(const char* format, ...) const;
+
+	IRuntimeCheck(const IRuntimeCheck&) = delete;
+	IRuntimeCheck& operator=(const IRuntimeCheck&) = delete;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	const char* mName;
+	bool		mBenchmark;
+	uint32_t	mNumberOfFailedChecks;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Framework/IRuntimeCheck.inl"
@@ -0,0 +1,210 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/MemoryFileManager.h"
+
+#include <RendererRuntime/Core/File/IFile.h>
+
+#include <cassert>
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		class MemoryFile : public RendererRuntime::IFile
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			// Readable file
+			explicit MemoryFile(const MemoryFileManager::FileData& fileData) :
+				mFileData(fileData),
+				mPosition(0),
+				mWritable(false)
+			{
+				// Nothing here
+			}
+
+			// Writable file
+			explicit MemoryFile(const char* filename) :
+				mFilename(filename),
+				mPosition(0),
+				mWritable(true)
+			{
+				// Nothing here
+			}
+
+			virtual ~MemoryFile()
+			{
+				// Nothing here
+			}
+
+			inline const std::string& getFilename() const
+			{
+				return mFilename;
+			}
+
+			inline const MemoryFileManager::FileData& getFileData() const
+			{
+				return mFileData;
+			}
+
+			inline bool isWritable() const
+			{
+				return mWritable;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Public virtual RendererRuntime::IFile methods         ]
+		//[-------------------------------------------------------]
+		public:
+			virtual size_t getNumberOfBytes() override
+			{
+				return mFileData.size();
+			}
+
+			virtual void read(void* destinationBuffer, size_t numberOfBytes) override
+			{
+				assert(!mWritable && mPosition + numberOfBytes <= mFileData.size());
+				memcpy(destinationBuffer, mFileData.data() + mPosition, numberOfBytes);
+				mPosition += numberOfBytes;
+			}
+
+			virtual void skip(size_t numberOfBytes) override
+			{
+				assert(!mWritable && mPosition + numberOfBytes <= mFileData.size());
+				mPosition += numberOfBytes;
+			}
+
+			virtual void write(const void* sourceBuffer, size_t numberOfBytes) override
+			{
+				assert(mWritable);
+				mFileData.insert(mFileData.end(), static_cast<const uint8_t*>(sourceBuffer), static_cast<const uint8_t*>(sourceBuffer) + numberOfBytes);
+			}
+
+			virtual bool supportsViews() const override
+			{
+				return !mWritable;
+			}
+
+			virtual const uint8_t* readView(size_t numberOfBytes) override
+			{
+				assert(!mWritable && mPosition + numberOfBytes <= mFileData.size());
+				const uint8_t* view = mFileData.data() + mPosition;
+				mPosition += numberOfBytes;
+				return view;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Protected methods                                     ]
+		//[-------------------------------------------------------]
+		protected:
+			MemoryFile(const MemoryFile&) = delete;
+			MemoryFile& operator=(const MemoryFile&) = delete;
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			std::string					mFilename;	///< Only set for writable files
+			MemoryFileManager::FileData mFileData;
+			size_t						mPosition;
+			bool						mWritable;
+
+
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+void MemoryFileManager::setFile(const std::string& filename, const FileData& fileData)
+{
+	std::lock_guard<std::mutex> mutexLock(mMutex);
+	mFiles[filename] = fileData;
+}
+
+bool MemoryFileManager::getFile(const std::string& filename, FileData& fileData) const
+{
+	std::lock_guard<std::mutex> mutexLock(mMutex);
+	Files::const_iterator iterator = mFiles.find(filename);
+	if (iterator != mFiles.cend())
+	{
+		fileData = iterator->second;
+		return true;
+	}
+	return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IFileManager methods  ]
+//[-------------------------------------------------------]
+RendererRuntime::IFile* MemoryFileManager::openFile(const char* filename)
+{
+	assert(nullptr != filename);
+	std::lock_guard<std::mutex> mutexLock(mMutex);
+	Files::const_iterator iterator = mFiles.find(filename);
+	return (iterator != mFiles.cend()) ? new ::detail::MemoryFile(iterator->second) : nullptr;
+}
+
+RendererRuntime::IFile* MemoryFileManager::createFile(const char* filename)
+{
+	assert(nullptr != filename);
+	return new ::detail::MemoryFile(filename);
+}
+
+void MemoryFileManager::closeFile(RendererRuntime::IFile& file)
+{
+	::detail::MemoryFile* memoryFile = static_cast< ::detail::MemoryFile*>(&file);
+	if (memoryFile->isWritable())
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		mFiles[memoryFile->getFilename()] = memoryFile->getFileData();
+		++mNumberOfWrittenFiles;
+	}
+	delete memoryFile;
+}
@@ -0,0 +1,138 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <RendererRuntime/Core/File/IFileManager.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Memory file manager implementation class, keeps all files inside the memory
+*
+*  @note
+*    - Thread safe, the resource streamer opens files from multiple worker threads
+*    - A created file becomes visible as soon as it has been closed
+*/
+class MemoryFileManager : public RendererRuntime::IFileManager
+{
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	typedef std::vector<uint8_t> FileData;
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	inline MemoryFileManager();
+	inline virtual ~MemoryFileManager();
+
+	/**
+	*  @brief
+	*    Set the content of a file, an already existing file is overwritten
+	*
+	*  @param[in] filename
+	*    ASCII name of the file
+	*  @param[in] fileData
+	*    File content
+	*/
+	void setFile(const std::string& filename, const FileData& fileData);
+
+	/**
+	*  @brief
+	*    Return a copy of the content of a file
+	*
+	*  @param[in] filename
+	*    ASCII name of the file
+	*  @param[out] fileData
+	*    Receives the file content, not touched if there's no such file
+	*
+	*  @return
+	*    "true" if there's such a file, else "false"
+	*/
+	bool getFile(const std::string& filename, FileData& fileData) const;
+
+	/**
+	*  @brief
+	*    Return the number of files which have been written by using "RendererRuntime::IFileManager::createFile()"
+	*/
+	inline uint32_t getNumberOfWrittenFiles() const;
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IFileManager methods  ]
+//[-------------------------------------------------------]
+public:
+	virtual RendererRuntime::IFile* openFile(const char* filename) override;
+	virtual RendererRuntime::IFile* createFile(const char* filename) override;
+	virtual void closeFile(RendererRuntime::IFile& file) override;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	MemoryFileManager(const MemoryFileManager&) = delete;
+	MemoryFileManager& operator=(const MemoryFileManager&) = delete;
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	typedef std::unordered_map<std::string, FileData> Files;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	mutable std::mutex mMutex;
+	Files			   mFiles;
+	uint32_t		   mNumberOfWrittenFiles;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Framework/MemoryFileManager.inl"
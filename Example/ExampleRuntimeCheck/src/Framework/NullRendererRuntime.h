@@ -0,0 +1,101 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/Public/RendererInstance.h>
+#include <RendererRuntime/IRendererRuntime.h>	// The checks need the internal renderer runtime headers, so don't use the amalgamated public one
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Renderer runtime instance on top of the null renderer
+*/
+class NullRendererRuntime
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Constructor
+	*
+	*  @param[in] fileManager
+	*    File manager to use, must stay valid as long as the null renderer runtime instance exists
+	*/
+	explicit NullRendererRuntime(RendererRuntime::IFileManager& fileManager);
+
+	inline ~NullRendererRuntime();
+
+	/**
+	*  @brief
+	*    Return the null renderer instance
+	*
+	*  @return
+	*    The null renderer instance, do not release the returned instance unless you added an own reference to it
+	*/
+	inline Renderer::IRenderer& getRenderer() const;
+
+	/**
+	*  @brief
+	*    Return the renderer runtime instance
+	*
+	*  @return
+	*    The renderer runtime instance, do not release the returned instance unless you added an own reference to it
+	*/
+	inline RendererRuntime::IRendererRuntime& getRendererRuntime() const;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	NullRendererRuntime(const NullRendererRuntime&) = delete;
+	NullRendererRuntime& operator=(const NullRendererRuntime&) = delete;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	Renderer::RendererInstance				 mRendererInstance;
+	RendererRuntime::IRendererRuntimePtr	 mRendererRuntime;	///< Destroyed before the renderer instance
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Framework/NullRendererRuntime.inl"
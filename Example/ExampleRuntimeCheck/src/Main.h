@@ -0,0 +1,68 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Platform independent program entry point              ]
+//[-------------------------------------------------------]
+int programEntryPoint(int argc, char** argv);
+
+
+//[-------------------------------------------------------]
+//[ Platform dependent program entry point                ]
+//[-------------------------------------------------------]
+// Windows implementation
+#ifdef WIN32
+
+	// For memory leak detection
+	#ifdef _DEBUG
+		#define _CRTDBG_MAP_ALLOC
+		#include <stdlib.h>
+		#include <crtdbg.h>
+	#endif
+
+	// The runtime check is a console application by intent, the results are written into the standard output
+	int main(int argc, char** argv)
+	{
+		// Call the platform independent program entry point
+		const int result = programEntryPoint(argc, argv);
+
+		// For memory leak detection
+		#ifdef _DEBUG
+			_CrtDumpMemoryLeaks();
+		#endif
+
+		// Done
+		return result;
+	}
+
+// Linux implementation
+#elif LINUX
+	int main(int argc, char** argv)
+	{
+		// Call the platform independent program entry point
+		return programEntryPoint(argc, argv);
+	}
+#endif
@@ -0,0 +1,135 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RuntimeCheckRunner.h"
+#include "Framework/IRuntimeCheck.h"
+// Checks
+#include "Check/PipelineStateCacheManagerCheck.h"
+#include "Check/ResourceStreamerCheck.h"
+#include "Check/ShaderBuilderCheck.h"
+#include "Check/ShaderCacheManagerCheck.h"
+// Benchmarks
+#include "Benchmark/ResourceStreamerBenchmark.h"
+#include "Benchmark/RuntimeBenchmark.h"
+
+#include <cstdio>
+#include <cstring>
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+RuntimeCheckRunner::RuntimeCheckRunner()
+{
+	// Checks
+	mRuntimeChecks.push_back(new ShaderCacheManagerCheck());
+	mRuntimeChecks.push_back(new ResourceStreamerCheck());
+	mRuntimeChecks.push_back(new PipelineStateCacheManagerCheck());
+	mRuntimeChecks.push_back(new ShaderBuilderCheck());
+
+	// Benchmarks
+	mRuntimeChecks.push_back(new ResourceStreamerBenchmark());
+	mRuntimeChecks.push_back(new RuntimeBenchmark());
+}
+
+RuntimeCheckRunner::~RuntimeCheckRunner()
+{
+	for (IRuntimeCheck* runtimeCheck : mRuntimeChecks)
+	{
+		delete runtimeCheck;
+	}
+}
+
+int RuntimeCheckRunner::run(int argc, char** argv)
+{
+	// Validate the requested check and benchmark names
+	for (int i = 1; i < argc; ++i)
+	{
+		bool known = false;
+		for (const IRuntimeCheck* runtimeCheck : mRuntimeChecks)
+		{
+			if (0 == strcmp(runtimeCheck->getName(), argv[i]))
+			{
+				known = true;
+				break;
+			}
+		}
+		if (!known)
+		{
+			printf("Unknown check or benchmark \"%s\"\n", argv[i]);
+			printUsage();
+			return 1;
+		}
+	}
+
+	// Run all checks or the requested checks and benchmarks, in the order they're known
+	uint32_t numberOfRuns = 0;
+	uint32_t numberOfFailures = 0;
+	for (IRuntimeCheck* runtimeCheck : mRuntimeChecks)
+	{
+		bool requested = (1 == argc && !runtimeCheck->isBenchmark());
+		for (int i = 1; i < argc && !requested; ++i)
+		{
+			requested = (0 == strcmp(runtimeCheck->getName(), argv[i]));
+		}
+		if (requested)
+		{
+			++numberOfRuns;
+			if (!runtimeCheck->run())
+			{
+				++numberOfFailures;
+			}
+		}
+	}
+
+	// Done
+	printf("%u of %u passed\n", numberOfRuns - numberOfFailures, numberOfRuns);
+	return (0 == numberOfFailures) ? 0 : 1;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void RuntimeCheckRunner::printUsage() const
+{
+	printf("Usage: ExampleRuntimeCheck [<checkOrBenchmarkName> ...]\n");
+	printf("Without arguments all checks are run, benchmarks only run if requested by name\n");
+	printf("Available checks:\n");
+	for (const IRuntimeCheck* runtimeCheck : mRuntimeChecks)
+	{
+		if (!runtimeCheck->isBenchmark())
+		{
+			printf("\t%s\n", runtimeCheck->getName());
+		}
+	}
+	printf("Available benchmarks:\n");
+	for (const IRuntimeCheck* runtimeCheck : mRuntimeChecks)
+	{
+		if (runtimeCheck->isBenchmark())
+		{
+			printf("\t%s\n", runtimeCheck->getName());
+		}
+	}
+}
@@ -0,0 +1,100 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class IRuntimeCheck;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Runtime check runner
+*
+*  @remarks
+*    Usage: "ExampleRuntimeCheck [<checkOrBenchmarkName> ...]"
+*    - Without arguments all checks are run, benchmarks are only run if they're requested by name
+*    - The exit code is zero if all requested checks passed
+*/
+class RuntimeCheckRunner
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	RuntimeCheckRunner();
+	~RuntimeCheckRunner();
+
+	/**
+	*  @brief
+	*    Run the checks and benchmarks selected by the given command line arguments
+	*
+	*  @param[in] argc
+	*    Number of command line arguments, the first one is the program name
+	*  @param[in] argv
+	*    Command line arguments
+	*
+	*  @return
+	*    Program exit code, zero if all requested checks passed
+	*/
+	int run(int argc, char** argv);
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	RuntimeCheckRunner(const RuntimeCheckRunner&) = delete;
+	RuntimeCheckRunner& operator=(const RuntimeCheckRunner&) = delete;
+	void printUsage() const;
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	typedef std::vector<IRuntimeCheck*> RuntimeChecks;
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	RuntimeChecks mRuntimeChecks;	///< Known checks and benchmarks, we own the instances
+
+
+};
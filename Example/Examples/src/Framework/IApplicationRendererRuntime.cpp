@@ -36,7 +36,11 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Framework/IApplicationRendererRuntime.h"
-#include "Framework/StdFileManager.h"
+#ifdef LINUX
+	#include "Framework/MemoryMappedFileManager.h"
+#else
+	#include "Framework/StdFileManager.h"
+#endif
 
 #ifdef SHARED_LIBRARIES
 	#include <RendererToolkit/Public/RendererToolkitInstance.h>
@@ -44,6 +48,11 @@
 
 #include <RendererRuntime/Public/RendererRuntimeInstance.h>
 #include <RendererRuntime/Asset/AssetManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCacheManager.h>
+#include <RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h>
+
+#include <string>
 
 
 //[-------------------------------------------------------]
@@ -107,7 +116,12 @@ void IApplicationRendererRuntime::onInitialization()
 	if (nullptr != renderer)
 	{
 		// Create the renderer runtime instance
-		mFileManager = new StdFileManager();
+		#ifdef LINUX
+			// Memory mapped files let resource loaders access the file data without copying it
+			mFileManager = new MemoryMappedFileManager();
+		#else
+			mFileManager = new StdFileManager();
+		#endif
 		mRendererRuntimeInstance = new RendererRuntime::RendererRuntimeInstance(*renderer, *mFileManager);
 
 		{
@@ -126,6 +140,17 @@ void IApplicationRendererRuntime::onInitialization()
 					rendererRuntime->getAssetManager().addAssetPackageByFilename("../DataPc/Content/AssetPackage.assets");
 				}
 
+				// Load the persistent shader cache, one file per renderer since shader bytecode is renderer specific
+				const std::string shaderCacheFilename = std::string(rendererIsOpenGLES ? "../DataMobile/" : "../DataPc/") + renderer->getName() + ".shadercache";
+				rendererRuntime->getShaderBlueprintResourceManager().getShaderCacheManager().loadCacheByFilename(shaderCacheFilename.c_str());
+
+				// Load the persistent program binary cache before any shader is created, program binaries are renderer and graphics driver specific
+				const std::string programBinaryCacheFilename = std::string(rendererIsOpenGLES ? "../DataMobile/" : "../DataPc/") + renderer->getName() + ".programbinarycache";
+				rendererRuntime->getMaterialBlueprintResourceManager().getProgramBinaryCacheManager().loadProgramBinaryCacheByFilename(programBinaryCacheFilename.c_str());
+
+				// Load the pipeline state warm-up list, this already loads and warms up the listed material blueprints
+				rendererRuntime->getMaterialBlueprintResourceManager().getPipelineStateWarmUpManager().loadWarmUpListByFilename(rendererIsOpenGLES ? "../DataMobile/PipelineStateWarmUp.warmup" : "../DataPc/PipelineStateWarmUp.warmup");
+
 				#ifdef SHARED_LIBRARIES
 				{
 					// TODO(co) First asset hot-reloading test
@@ -0,0 +1,190 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PrecompiledHeader.h"
+#include "Framework/MemoryMappedFileManager.h"
+
+#include <RendererRuntime/Core/File/IFile.h>
+
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <cassert>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		class MemoryMappedFile : public RendererRuntime::IFile
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			explicit MemoryMappedFile(const char* filename) :
+				mMappedData(nullptr),
+				mNumberOfBytes(0),
+				mCurrentPosition(0)
+			{
+				// The mapping stays valid after closing the file descriptor, so there's no need to keep it open
+				const int fileDescriptor = ::open(filename, O_RDONLY);
+				if (-1 != fileDescriptor)
+				{
+					struct stat fileStatus;
+					if (0 == ::fstat(fileDescriptor, &fileStatus) && fileStatus.st_size > 0)
+					{
+						const size_t numberOfBytes = static_cast<size_t>(fileStatus.st_size);
+						void* mappedData = ::mmap(nullptr, numberOfBytes, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+						if (MAP_FAILED != mappedData)
+						{
+							// Resource loaders usually consume the whole file, so let the kernel start reading ahead right now
+							::madvise(mappedData, numberOfBytes, MADV_WILLNEED);
+							mMappedData = static_cast<const uint8_t*>(mappedData);
+							mNumberOfBytes = numberOfBytes;
+						}
+					}
+					::close(fileDescriptor);
+				}
+			}
+
+			virtual ~MemoryMappedFile()
+			{
+				if (nullptr != mMappedData)
+				{
+					::munmap(const_cast<uint8_t*>(mMappedData), mNumberOfBytes);
+				}
+			}
+
+			bool isInvalid() const
+			{
+				return (nullptr == mMappedData);
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Public virtual RendererRuntime::IFile methods         ]
+		//[-------------------------------------------------------]
+		public:
+			virtual size_t getNumberOfBytes() override
+			{
+				return mNumberOfBytes;
+			}
+
+			virtual void read(void* destinationBuffer, size_t numberOfBytes) override
+			{
+				memcpy(destinationBuffer, readView(numberOfBytes), numberOfBytes);
+			}
+
+			virtual void skip(size_t numberOfBytes) override
+			{
+				readView(numberOfBytes);
+			}
+
+			virtual void write(const void*, size_t) override
+			{
+				// Error! Memory mapped files are read-only.
+				assert(false);
+			}
+
+			virtual bool supportsViews() const override
+			{
+				return true;
+			}
+
+			virtual const uint8_t* readView(size_t numberOfBytes) override
+			{
+				assert((mCurrentPosition + numberOfBytes) <= mNumberOfBytes);
+				const uint8_t* view = mMappedData + mCurrentPosition;
+				mCurrentPosition += numberOfBytes;
+				return view;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Protected methods                                     ]
+		//[-------------------------------------------------------]
+		protected:
+			MemoryMappedFile(const MemoryMappedFile&) = delete;
+			MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			const uint8_t* mMappedData;
+			size_t		   mNumberOfBytes;
+			size_t		   mCurrentPosition;
+
+
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IFileManager methods  ]
+//[-------------------------------------------------------]
+RendererRuntime::IFile* MemoryMappedFileManager::openFile(const char* filename)
+{
+	assert(nullptr != filename);
+	::detail::MemoryMappedFile* file = new ::detail::MemoryMappedFile(filename);
+	if (file->isInvalid())
+	{
+		// Maybe the file can't be mapped, e.g. because it's empty, give the STD file manager a try which also takes care of error reporting
+		delete file;
+		return StdFileManager::openFile(filename);
+	}
+	return file;
+}
+
+void MemoryMappedFileManager::closeFile(RendererRuntime::IFile& file)
+{
+	// Only memory mapped files support views, all other files are owned by the STD file manager
+	if (file.supportsViews())
+	{
+		delete static_cast< ::detail::MemoryMappedFile*>(&file);
+	}
+	else
+	{
+		StdFileManager::closeFile(file);
+	}
+}
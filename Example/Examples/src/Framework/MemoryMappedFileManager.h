@@ -0,0 +1,81 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Framework/StdFileManager.h"
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Memory mapped file manager implementation class
+*
+*  @remarks
+*    Files opened for reading are memory mapped, so resource loaders can access the file data through read-only views
+*    without copying it (see "RendererRuntime::IFile::readView()"). Files which can't be mapped, e.g. empty ones, as well
+*    as files created for writing are handled by the STD file manager.
+*
+*  @note
+*    - Linux only
+*/
+class MemoryMappedFileManager : public StdFileManager
+{
+
+
+//[-------------------------------------------------------]
+//[ Friends                                               ]
+//[-------------------------------------------------------]
+	friend class IApplicationRendererRuntime;	// Manages the instance
+
+
+//[-------------------------------------------------------]
+//[ Public virtual RendererRuntime::IFileManager methods  ]
+//[-------------------------------------------------------]
+public:
+	virtual RendererRuntime::IFile* openFile(const char* filename) override;
+	virtual void closeFile(RendererRuntime::IFile& file) override;
+
+
+//[-------------------------------------------------------]
+//[ Protected methods                                     ]
+//[-------------------------------------------------------]
+protected:
+	inline MemoryMappedFileManager();
+	inline virtual ~MemoryMappedFileManager();
+	MemoryMappedFileManager(const MemoryMappedFileManager&) = delete;
+	MemoryMappedFileManager& operator=(const MemoryMappedFileManager&) = delete;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Framework/MemoryMappedFileManager.inl"
@@ -51,8 +51,8 @@ namespace
 		//[ Public methods                                        ]
 		//[-------------------------------------------------------]
 		public:
-			explicit StdFile(const char* filename) :
-				mFileStream(filename, std::ios::binary)
+			StdFile(const char* filename, std::ios::openmode openMode) :
+				mFileStream(filename, std::ios::binary | openMode)
 			{
 				// Nothing here
 			}
@@ -91,6 +91,11 @@ namespace
 				mFileStream.ignore(static_cast<std::streamsize>(numberOfBytes));
 			}
 
+			virtual void write(const void* sourceBuffer, size_t numberOfBytes) override
+			{
+				mFileStream.write(reinterpret_cast<const char*>(sourceBuffer), static_cast<std::streamsize>(numberOfBytes));
+			}
+
 
 		//[-------------------------------------------------------]
 		//[ Protected methods                                     ]
@@ -104,7 +109,7 @@ namespace
 		//[ Private data                                          ]
 		//[-------------------------------------------------------]
 		private:
-			std::ifstream mFileStream;
+			std::fstream mFileStream;
 
 
 		};
@@ -123,7 +128,7 @@ namespace
 RendererRuntime::IFile* StdFileManager::openFile(const char* filename)
 {
 	assert(nullptr != filename);
-	::detail::StdFile* file = new ::detail::StdFile(filename);
+	::detail::StdFile* file = new ::detail::StdFile(filename, std::ios::in);
 	if (file->isInvalid())
 	{
 		RENDERERRUNTIME_OUTPUT_ERROR_PRINTF("Failed to open file %s", filename);
@@ -133,6 +138,19 @@ RendererRuntime::IFile* StdFileManager::openFile(const char* filename)
 	return file;
 }
 
+RendererRuntime::IFile* StdFileManager::createFile(const char* filename)
+{
+	assert(nullptr != filename);
+	::detail::StdFile* file = new ::detail::StdFile(filename, std::ios::out | std::ios::trunc);
+	if (file->isInvalid())
+	{
+		RENDERERRUNTIME_OUTPUT_ERROR_PRINTF("Failed to create file %s", filename);
+		delete file;
+		file = nullptr;
+	}
+	return file;
+}
+
 void StdFileManager::closeFile(RendererRuntime::IFile& file)
 {
 	delete static_cast< ::detail::StdFile*>(&file);
@@ -52,6 +52,7 @@ class StdFileManager : public RendererRuntime::IFileManager
 //[-------------------------------------------------------]
 public:
 	virtual RendererRuntime::IFile* openFile(const char* filename) override;
+	virtual RendererRuntime::IFile* createFile(const char* filename) override;
 	virtual void closeFile(RendererRuntime::IFile& file) override;
 
 
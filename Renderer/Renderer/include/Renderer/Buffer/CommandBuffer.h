@@ -63,9 +63,12 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	enum CommandDispatchFunctionIndex : uint8_t
 	{
+		// Command buffer
+		ExecuteCommandBuffer = 0,
 		// Resource handling
-		CopyUniformBufferData = 0,
+		CopyUniformBufferData,
 		CopyTextureBufferData,
+		CopyIndirectBufferData,
 		// Graphics root
 		SetGraphicsRootSignature,
 		SetGraphicsRootDescriptorTable,
@@ -192,6 +195,9 @@ namespace Renderer
 	*    - The commands are stored as a flat contiguous array to be cache friendly
 	*    - Each command can have an additional auxiliary buffer, e.g. to store uniform buffer data to submit to the renderer
 	*    - It's valid to record a command buffer only once, and submit it multiple times to the renderer
+	*    - Command buffers can be recorded in parallel (one command buffer per thread) and merged in a defined order without copying by using "Renderer::Command::ExecuteCommandBuffer"
+	*    - The command packet buffer grows geometrically so recording many commands has amortized constant costs, clearing keeps the memory for reuse
+	*    - Optionally, an external memory block can be provided (e.g. from a per-frame arena) so no memory is allocated as long as the commands fit into it
 	*/
 	class CommandBuffer
 	{
@@ -208,6 +214,32 @@ namespace Renderer
 		inline CommandBuffer() :
 			mCommandPacketBufferNumberOfBytes(0),
 			mCommandPacketBuffer(nullptr),
+			mOwnsCommandPacketBuffer(false),
+			mPreviousCommandPacketByteIndex(~0u),
+			mCurrentCommandPacketByteIndex(0)
+			#ifndef RENDERER_NO_STATISTICS
+				, mNumberOfCommands(0)
+			#endif
+		{
+			// Nothing here
+		}
+
+		/**
+		*  @brief
+		*    Constructor using external memory
+		*
+		*  @param[in] externalCommandPacketBuffer
+		*    External command packet buffer memory to record into, can be a null pointer, must stay valid as long as the command buffer instance exists, we don't own the memory so don't destroy it
+		*  @param[in] numberOfExternalBytes
+		*    Number of bytes inside the external command packet buffer memory
+		*
+		*  @note
+		*    - In case the commands don't fit into the external memory, the command buffer switches over to internally allocated memory
+		*/
+		inline CommandBuffer(uint8_t* externalCommandPacketBuffer, uint32_t numberOfExternalBytes) :
+			mCommandPacketBufferNumberOfBytes((nullptr != externalCommandPacketBuffer) ? numberOfExternalBytes : 0),
+			mCommandPacketBuffer(externalCommandPacketBuffer),
+			mOwnsCommandPacketBuffer(false),
 			mPreviousCommandPacketByteIndex(~0u),
 			mCurrentCommandPacketByteIndex(0)
 			#ifndef RENDERER_NO_STATISTICS
@@ -223,7 +255,7 @@ namespace Renderer
 		*/
 		inline ~CommandBuffer()
 		{
-			if (nullptr != mCommandPacketBuffer)
+			if (mOwnsCommandPacketBuffer)
 			{
 				delete [] mCommandPacketBuffer;
 			}
@@ -258,9 +290,51 @@ namespace Renderer
 			}
 		#endif
 
+		/**
+		*  @brief
+		*    Return the number of command packet buffer bytes used by the recorded commands
+		*
+		*  @return
+		*    The number of command packet buffer bytes used by the recorded commands
+		*/
+		inline uint32_t getNumberOfUsedBytes() const
+		{
+			return mCurrentCommandPacketByteIndex;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of command packet buffer bytes which can be used without reallocation
+		*
+		*  @return
+		*    The number of command packet buffer bytes which can be used without reallocation
+		*/
+		inline uint32_t getNumberOfReservedBytes() const
+		{
+			return mCommandPacketBufferNumberOfBytes;
+		}
+
+		/**
+		*  @brief
+		*    Ensure the command packet buffer can hold at least the given number of bytes without reallocation
+		*
+		*  @param[in] numberOfBytes
+		*    Number of command packet buffer bytes to reserve
+		*/
+		inline void reserve(uint32_t numberOfBytes)
+		{
+			if (mCommandPacketBufferNumberOfBytes < numberOfBytes)
+			{
+				reallocateCommandPacketBuffer(numberOfBytes);
+			}
+		}
+
 		/**
 		*  @brief
 		*    Clear the command buffer
+		*
+		*  @note
+		*    - The command packet buffer memory is kept, so recording the same amount of commands again doesn't allocate memory
 		*/
 		inline void clear()
 		{
@@ -294,20 +368,15 @@ namespace Renderer
 			// Grow command packet buffer, if required
 			if (mCommandPacketBufferNumberOfBytes < mCurrentCommandPacketByteIndex + numberOfCommandBytes)
 			{
-				// Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
-				const uint32_t newCommandPacketBufferNumberOfBytes = mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-				uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
-
-				// Copy over current command package buffer content and free it, if required
-				if (nullptr != mCommandPacketBuffer)
+				// Grow geometrically so the total number of copied bytes stays linear to the number of recorded bytes
+				// -> Do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
+				uint64_t newCommandPacketBufferNumberOfBytes = static_cast<uint64_t>(mCommandPacketBufferNumberOfBytes) * 2;
+				if (newCommandPacketBufferNumberOfBytes < MINIMUM_NUMBER_OF_BYTES)
 				{
-					memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes);
-					delete [] mCommandPacketBuffer;
+					newCommandPacketBufferNumberOfBytes = MINIMUM_NUMBER_OF_BYTES;
 				}
-
-				// Finalize
-				mCommandPacketBuffer = newCommandPacketBuffer;
-				mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
+				newCommandPacketBufferNumberOfBytes += numberOfCommandBytes;
+				reallocateCommandPacketBuffer((newCommandPacketBufferNumberOfBytes < 4294967295u) ? static_cast<uint32_t>(newCommandPacketBufferNumberOfBytes) : 4294967295u);
 			}
 
 			// Get command package for the new command
@@ -330,6 +399,27 @@ namespace Renderer
 			return CommandPacketHelper::getCommand<U>(commandPacket);
 		}
 
+		/**
+		*  @brief
+		*    Return an already added command
+		*
+		*  @param[in] commandPacketByteIndex
+		*    Command packet byte index of the command, this is "Renderer::CommandBuffer::getNumberOfUsedBytes()" right before the command was added
+		*
+		*  @return
+		*    The command, don't destroy the memory; returned memory address is considered unstable and might change as soon as another command is added
+		*
+		*  @note
+		*    - Useful for commands with auxiliary memory which can only be filled after further commands were added, e.g. the draw arguments of multi-draw indirect draw calls
+		*/
+		template <typename U>
+		U* getCommand(uint32_t commandPacketByteIndex)
+		{
+			assert(commandPacketByteIndex < mCurrentCommandPacketByteIndex);
+			assert(U::COMMAND_DISPATCH_FUNCTION_INDEX == CommandPacketHelper::loadCommandDispatchFunctionIndex(&mCommandPacketBuffer[commandPacketByteIndex]));
+			return CommandPacketHelper::getCommand<U>(&mCommandPacketBuffer[commandPacketByteIndex]);
+		}
+
 		/**
 		*  @brief
 		*    Submit the command buffer to the renderer without flushing; use this for recording command buffers once and submit them multiple times
@@ -363,14 +453,48 @@ namespace Renderer
 		*    Return the command packet buffer
 		*
 		*  @return
-		*    The command packet buffer, can be a null pointer, don't destroy the instance
+		*    The command packet buffer, null pointer if the command buffer is empty, don't destroy the instance
 		*
 		*  @note
 		*    - Don't put this method into the public interface, there's no need for public access
 		*/
 		const uint8_t* getCommandPacketBuffer() const
 		{
-			return mCommandPacketBuffer;
+			// A cleared command buffer still owns memory holding outdated command packets, those must never be executed
+			return isEmpty() ? nullptr : mCommandPacketBuffer;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Reallocate the command packet buffer while keeping the recorded commands
+		*
+		*  @param[in] numberOfBytes
+		*    New number of command packet buffer bytes, must be at least the number of used bytes
+		*/
+		inline void reallocateCommandPacketBuffer(uint32_t numberOfBytes)
+		{
+			assert(numberOfBytes >= mCurrentCommandPacketByteIndex);
+			uint8_t* newCommandPacketBuffer = new uint8_t[numberOfBytes];
+
+			// Copy over the used part of the current command package buffer content and free it, if required
+			if (nullptr != mCommandPacketBuffer)
+			{
+				memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCurrentCommandPacketByteIndex);
+				if (mOwnsCommandPacketBuffer)
+				{
+					delete [] mCommandPacketBuffer;
+				}
+			}
+
+			// Finalize
+			mCommandPacketBuffer = newCommandPacketBuffer;
+			mCommandPacketBufferNumberOfBytes = numberOfBytes;
+			mOwnsCommandPacketBuffer = true;
 		}
 
 
@@ -378,7 +502,7 @@ namespace Renderer
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		static const uint32_t NUMBER_OF_BYTES_TO_GROW = 8192;
+		static const uint32_t MINIMUM_NUMBER_OF_BYTES = 8192;	///< Minimum number of bytes the command packet buffer grows to
 
 
 	//[-------------------------------------------------------]
@@ -388,6 +512,7 @@ namespace Renderer
 		// Memory
 		uint32_t mCommandPacketBufferNumberOfBytes;
 		uint8_t* mCommandPacketBuffer;
+		bool	 mOwnsCommandPacketBuffer;	///< "true" if the command packet buffer was allocated by us, "false" if it's a null pointer or external memory
 		// Current state
 		uint32_t mPreviousCommandPacketByteIndex;
 		uint32_t mCurrentCommandPacketByteIndex;
@@ -406,6 +531,42 @@ namespace Renderer
 	{
 
 
+		//[-------------------------------------------------------]
+		//[ Command buffer                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Execute the commands of another command buffer at this position of the command buffer
+		*
+		*  @param[in] commandBufferToExecute
+		*    Command buffer to execute, must stay valid until the command buffer recording this command was submitted, can be recorded after this command was added
+		*
+		*  @remarks
+		*    Use this to record command buffers in parallel (e.g. one command buffer per render queue or compositor pass, each recorded by its own thread)
+		*    and to submit them in a defined order by recording "Renderer::Command::ExecuteCommandBuffer" commands into a primary command buffer. The
+		*    command packets of the executed command buffer are not copied, so the executed command buffer must not be cleared before the submission.
+		*
+		*  @note
+		*    - A command buffer must never execute itself, neither directly nor indirectly
+		*/
+		struct ExecuteCommandBuffer
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, const CommandBuffer& commandBufferToExecute)
+			{
+				assert(&commandBuffer != &commandBufferToExecute);
+				*commandBuffer.addCommand<ExecuteCommandBuffer>() = ExecuteCommandBuffer(commandBufferToExecute);
+			}
+			// Constructor
+			inline explicit ExecuteCommandBuffer(const CommandBuffer& _commandBufferToExecute) :
+				commandBufferToExecute(&_commandBufferToExecute)
+			{}
+			// Data
+			const CommandBuffer* commandBufferToExecute;
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::ExecuteCommandBuffer;
+		};
+
 		//[-------------------------------------------------------]
 		//[ Resource handling                                     ]
 		//[-------------------------------------------------------]
@@ -459,6 +620,31 @@ namespace Renderer
 			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::CopyTextureBufferData;
 		};
 
+		struct CopyIndirectBufferData
+		{
+			// Static methods
+			inline static void create(CommandBuffer& commandBuffer, IIndirectBuffer* indirectBuffer, uint32_t numberOfBytes, void* data)
+			{
+				Command::CopyIndirectBufferData* copyIndirectBufferDataCommand = commandBuffer.addCommand<Command::CopyIndirectBufferData>(numberOfBytes);
+				copyIndirectBufferDataCommand->indirectBuffer = indirectBuffer;
+				copyIndirectBufferDataCommand->numberOfBytes  = numberOfBytes;
+				copyIndirectBufferDataCommand->data			  = nullptr;
+				memcpy(CommandPacketHelper::getAuxiliaryMemory(copyIndirectBufferDataCommand), data, numberOfBytes);
+			}
+			// Constructor
+			inline CopyIndirectBufferData(IIndirectBuffer* _indirectBuffer, uint32_t _numberOfBytes, void* _data) :
+				indirectBuffer(_indirectBuffer),
+				numberOfBytes(_numberOfBytes),
+				data(_data)
+			{}
+			// Data
+			IIndirectBuffer* indirectBuffer;
+			uint32_t		 numberOfBytes;
+			void*			 data;	///< If null pointer, command auxiliary memory is used instead
+			// Static data
+			static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::CopyIndirectBufferData;
+		};
+
 		//[-------------------------------------------------------]
 		//[ Graphics root                                         ]
 		//[-------------------------------------------------------]
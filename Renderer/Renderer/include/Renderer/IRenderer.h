@@ -57,6 +57,7 @@ namespace Renderer
 	struct PipelineState;
 	class ITextureManager;
 	class IShaderLanguage;
+	class IProgramBinaryCache;
 }
 
 
@@ -140,6 +141,28 @@ namespace Renderer
 			inline const Statistics &getStatistics() const;
 		#endif
 
+		/**
+		*  @brief
+		*    Return the program binary cache
+		*
+		*  @return
+		*    The program binary cache, can be a null pointer, do not destroy the instance
+		*/
+		inline IProgramBinaryCache *getProgramBinaryCache() const;
+
+		/**
+		*  @brief
+		*    Set the program binary cache
+		*
+		*  @param[in] programBinaryCache
+		*    Program binary cache to use, can be a null pointer, must stay valid as long as it's set
+		*
+		*  @note
+		*    - Only used by renderer backends which are able to receive the binary of linked programs, see "Renderer::IProgramBinaryCache" for details
+		*    - Should be set during startup, before any shader has been created
+		*/
+		inline void setProgramBinaryCache(IProgramBinaryCache *programBinaryCache);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual IRenderer methods                      ]
@@ -486,12 +509,13 @@ namespace Renderer
 		Capabilities mCapabilities;	///< Capabilities
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		IProgramBinaryCache *mProgramBinaryCache;	///< Program binary cache, can be a null pointer, don't destroy the instance
 	#ifndef RENDERER_NO_STATISTICS
-		//[-------------------------------------------------------]
-		//[ Private data                                          ]
-		//[-------------------------------------------------------]
-		private:
-			Statistics mStatistics;	///< Statistics
+		Statistics			 mStatistics;			///< Statistics
 	#endif
 
 
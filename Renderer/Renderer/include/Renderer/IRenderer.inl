@@ -45,16 +45,28 @@ namespace Renderer
 		}
 	#endif
 
+	inline IProgramBinaryCache *IRenderer::getProgramBinaryCache() const
+	{
+		return mProgramBinaryCache;
+	}
+
+	inline void IRenderer::setProgramBinaryCache(IProgramBinaryCache *programBinaryCache)
+	{
+		mProgramBinaryCache = programBinaryCache;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
-	inline IRenderer::IRenderer()
+	inline IRenderer::IRenderer() :
+		mProgramBinaryCache(nullptr)
 	{
 		// Nothing here
 	}
 
-	inline IRenderer::IRenderer(const IRenderer &)
+	inline IRenderer::IRenderer(const IRenderer &) :
+		mProgramBinaryCache(nullptr)
 	{
 		// Not supported
 	}
@@ -47,6 +47,7 @@ namespace Renderer
 {
 	class IRenderer;
 	class IShaderLanguage;
+	class IProgramBinaryCache;
 	class IResource;
 		class IRootSignature;
 		class IProgram;
@@ -1781,6 +1782,29 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Interfaces                                            ]
 	//[-------------------------------------------------------]
+	// Renderer/Shader/IProgramBinaryCache.h
+	#ifndef __RENDERER_IPROGRAMBINARYCACHE_H__
+	#define __RENDERER_IPROGRAMBINARYCACHE_H__
+		class IProgramBinaryCache
+		{
+		public:
+			inline virtual ~IProgramBinaryCache()
+			{}
+		public:
+			virtual const uint8_t* getProgramBinary(uint64_t programBinaryId, uint32_t& binaryFormat, uint32_t& numberOfBytes) = 0;
+			virtual void setProgramBinary(uint64_t programBinaryId, uint32_t binaryFormat, const uint8_t* binary, uint32_t numberOfBytes) = 0;
+		protected:
+			inline IProgramBinaryCache()
+			{}
+			inline explicit IProgramBinaryCache(const IProgramBinaryCache&)
+			{}
+			inline IProgramBinaryCache& operator =(const IProgramBinaryCache&)
+			{
+				return *this;
+			}
+		};
+	#endif
+
 	// Renderer/IRenderer.h
 	#ifndef __RENDERER_IRENDERER_H__
 	#define __RENDERER_IRENDERER_H__
@@ -1798,6 +1822,14 @@ namespace Renderer
 					return mStatistics;
 				}
 			#endif
+			inline IProgramBinaryCache* getProgramBinaryCache() const
+			{
+				return mProgramBinaryCache;
+			}
+			inline void setProgramBinaryCache(IProgramBinaryCache* programBinaryCache)
+			{
+				mProgramBinaryCache = programBinaryCache;
+			}
 		public:
 			virtual const char* getName() const = 0;
 			virtual bool isInitialized() const = 0;
@@ -1826,9 +1858,10 @@ namespace Renderer
 			IRenderer& operator =(const IRenderer& source);
 		protected:
 			Capabilities mCapabilities;
+		private:
+			IProgramBinaryCache* mProgramBinaryCache;
 		#ifndef RENDERER_NO_STATISTICS
-			private:
-				Statistics mStatistics;
+			Statistics mStatistics;
 		#endif
 		};
 		typedef SmartRefCount<IRenderer> IRendererPtr;
@@ -2357,6 +2390,11 @@ namespace Renderer
 			virtual ~IShader();
 		public:
 			virtual const char* getShaderLanguageName() const = 0;
+			virtual const uint8_t* getShaderBytecode(uint32_t& numberOfBytes) const
+			{
+				numberOfBytes = 0;
+				return nullptr;
+			}
 		protected:
 			IShader(ResourceType resourceType, IRenderer& renderer);
 			explicit IShader(const IShader& source);
@@ -2445,8 +2483,10 @@ namespace Renderer
 	#define __RENDERER_COMMANDBUFFER_H__
 		enum CommandDispatchFunctionIndex : uint8_t
 		{
-			CopyUniformBufferData = 0,
+			ExecuteCommandBuffer = 0,
+			CopyUniformBufferData,
 			CopyTextureBufferData,
+			CopyIndirectBufferData,
 			SetGraphicsRootSignature,
 			SetGraphicsRootDescriptorTable,
 			SetPipelineState,
@@ -2523,6 +2563,17 @@ namespace Renderer
 			inline CommandBuffer() :
 				mCommandPacketBufferNumberOfBytes(0),
 				mCommandPacketBuffer(nullptr),
+				mOwnsCommandPacketBuffer(false),
+				mPreviousCommandPacketByteIndex(~0u),
+				mCurrentCommandPacketByteIndex(0)
+				#ifndef RENDERER_NO_STATISTICS
+					, mNumberOfCommands(0)
+				#endif
+			{}
+			inline CommandBuffer(uint8_t* externalCommandPacketBuffer, uint32_t numberOfExternalBytes) :
+				mCommandPacketBufferNumberOfBytes((nullptr != externalCommandPacketBuffer) ? numberOfExternalBytes : 0),
+				mCommandPacketBuffer(externalCommandPacketBuffer),
+				mOwnsCommandPacketBuffer(false),
 				mPreviousCommandPacketByteIndex(~0u),
 				mCurrentCommandPacketByteIndex(0)
 				#ifndef RENDERER_NO_STATISTICS
@@ -2531,7 +2582,7 @@ namespace Renderer
 			{}
 			inline ~CommandBuffer()
 			{
-				if (nullptr != mCommandPacketBuffer)
+				if (mOwnsCommandPacketBuffer)
 				{
 					delete [] mCommandPacketBuffer;
 				}
@@ -2546,6 +2597,21 @@ namespace Renderer
 					return mNumberOfCommands;
 				}
 			#endif
+			inline uint32_t getNumberOfUsedBytes() const
+			{
+				return mCurrentCommandPacketByteIndex;
+			}
+			inline uint32_t getNumberOfReservedBytes() const
+			{
+				return mCommandPacketBufferNumberOfBytes;
+			}
+			inline void reserve(uint32_t numberOfBytes)
+			{
+				if (mCommandPacketBufferNumberOfBytes < numberOfBytes)
+				{
+					reallocateCommandPacketBuffer(numberOfBytes);
+				}
+			}
 			inline void clear()
 			{
 				mPreviousCommandPacketByteIndex = ~0u;
@@ -2563,15 +2629,13 @@ namespace Renderer
 				#endif
 				if (mCommandPacketBufferNumberOfBytes < mCurrentCommandPacketByteIndex + numberOfCommandBytes)
 				{
-					const uint32_t newCommandPacketBufferNumberOfBytes = mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-					uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
-					if (nullptr != mCommandPacketBuffer)
+					uint64_t newCommandPacketBufferNumberOfBytes = static_cast<uint64_t>(mCommandPacketBufferNumberOfBytes) * 2;
+					if (newCommandPacketBufferNumberOfBytes < MINIMUM_NUMBER_OF_BYTES)
 					{
-						memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes);
-						delete [] mCommandPacketBuffer;
+						newCommandPacketBufferNumberOfBytes = MINIMUM_NUMBER_OF_BYTES;
 					}
-					mCommandPacketBuffer = newCommandPacketBuffer;
-					mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
+					newCommandPacketBufferNumberOfBytes += numberOfCommandBytes;
+					reallocateCommandPacketBuffer((newCommandPacketBufferNumberOfBytes < 4294967295u) ? static_cast<uint32_t>(newCommandPacketBufferNumberOfBytes) : 4294967295u);
 				}
 				CommandPacket commandPacket = &mCommandPacketBuffer[mCurrentCommandPacketByteIndex];
 				if (~0u != mPreviousCommandPacketByteIndex)
@@ -2587,6 +2651,13 @@ namespace Renderer
 				#endif
 				return CommandPacketHelper::getCommand<U>(commandPacket);
 			}
+			template <typename U>
+			U* getCommand(uint32_t commandPacketByteIndex)
+			{
+				assert(commandPacketByteIndex < mCurrentCommandPacketByteIndex);
+				assert(U::COMMAND_DISPATCH_FUNCTION_INDEX == CommandPacketHelper::loadCommandDispatchFunctionIndex(&mCommandPacketBuffer[commandPacketByteIndex]));
+				return CommandPacketHelper::getCommand<U>(&mCommandPacketBuffer[commandPacketByteIndex]);
+			}
 			inline void submit(IRenderer& renderer) const
 			{
 				renderer.submitCommandBuffer(*this);
@@ -2597,10 +2668,30 @@ namespace Renderer
 				clear();
 			}
 		private:
-			static const uint32_t NUMBER_OF_BYTES_TO_GROW = 8192;
+			inline void reallocateCommandPacketBuffer(uint32_t numberOfBytes)
+			{
+				#ifndef RENDERER_NO_DEBUG
+					assert(numberOfBytes >= mCurrentCommandPacketByteIndex);
+				#endif
+				uint8_t* newCommandPacketBuffer = new uint8_t[numberOfBytes];
+				if (nullptr != mCommandPacketBuffer)
+				{
+					memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCurrentCommandPacketByteIndex);
+					if (mOwnsCommandPacketBuffer)
+					{
+						delete [] mCommandPacketBuffer;
+					}
+				}
+				mCommandPacketBuffer = newCommandPacketBuffer;
+				mCommandPacketBufferNumberOfBytes = numberOfBytes;
+				mOwnsCommandPacketBuffer = true;
+			}
+		private:
+			static const uint32_t MINIMUM_NUMBER_OF_BYTES = 8192;
 		private:
 			uint32_t mCommandPacketBufferNumberOfBytes;
 			uint8_t* mCommandPacketBuffer;
+			bool	 mOwnsCommandPacketBuffer;
 			uint32_t mPreviousCommandPacketByteIndex;
 			uint32_t mCurrentCommandPacketByteIndex;
 			#ifndef RENDERER_NO_STATISTICS
@@ -2609,6 +2700,21 @@ namespace Renderer
 		};
 		namespace Command
 		{
+			struct ExecuteCommandBuffer
+			{
+				inline static void create(CommandBuffer& commandBuffer, const CommandBuffer& commandBufferToExecute)
+				{
+					#ifndef RENDERER_NO_DEBUG
+						assert(&commandBuffer != &commandBufferToExecute);
+					#endif
+					*commandBuffer.addCommand<ExecuteCommandBuffer>() = ExecuteCommandBuffer(commandBufferToExecute);
+				}
+				inline explicit ExecuteCommandBuffer(const CommandBuffer& _commandBufferToExecute) :
+					commandBufferToExecute(&_commandBufferToExecute)
+				{}
+				const CommandBuffer* commandBufferToExecute;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::ExecuteCommandBuffer;
+			};
 			struct CopyUniformBufferData
 			{
 				inline static void create(CommandBuffer& commandBuffer, IUniformBuffer* uniformBuffer, uint32_t numberOfBytes, void* data)
@@ -2649,6 +2755,26 @@ namespace Renderer
 				void*			data;
 				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::CopyTextureBufferData;
 			};
+			struct CopyIndirectBufferData
+			{
+				inline static void create(CommandBuffer& commandBuffer, IIndirectBuffer* indirectBuffer, uint32_t numberOfBytes, void* data)
+				{
+					Command::CopyIndirectBufferData* copyIndirectBufferDataCommand = commandBuffer.addCommand<Command::CopyIndirectBufferData>(numberOfBytes);
+					copyIndirectBufferDataCommand->indirectBuffer = indirectBuffer;
+					copyIndirectBufferDataCommand->numberOfBytes  = numberOfBytes;
+					copyIndirectBufferDataCommand->data			  = nullptr;
+					memcpy(CommandPacketHelper::getAuxiliaryMemory(copyIndirectBufferDataCommand), data, numberOfBytes);
+				}
+				inline CopyIndirectBufferData(IIndirectBuffer* _indirectBuffer, uint32_t _numberOfBytes, void* _data) :
+					indirectBuffer(_indirectBuffer),
+					numberOfBytes(_numberOfBytes),
+					data(_data)
+				{}
+				IIndirectBuffer* indirectBuffer;
+				uint32_t		 numberOfBytes;
+				void*			 data;
+				static const CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::CopyIndirectBufferData;
+			};
 			struct SetGraphicsRootSignature
 			{
 				inline static void create(CommandBuffer& commandBuffer, IRootSignature* rootSignature)
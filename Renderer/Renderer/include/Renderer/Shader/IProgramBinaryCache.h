@@ -0,0 +1,158 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract program binary cache interface
+	*
+	*  @remarks
+	*    Renderer backends which are able to receive the binary of linked programs (e.g. OpenGL with "GL_ARB_get_program_binary") are using the program
+	*    binary cache to skip shader compilation and program linking. The program binary cache is implemented by the renderer user which is also
+	*    responsible for persisting the program binaries. The renderer backend takes care of creating program binary IDs which change as soon as the
+	*    shader source codes or the graphics driver change.
+	*
+	*  @note
+	*    - The renderer backend falls back to shader compilation and program linking in case a program binary gets rejected
+	*    - Set by using "Renderer::IRenderer::setProgramBinaryCache()"
+	*/
+	class IProgramBinaryCache
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~IProgramBinaryCache();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual IProgramBinaryCache methods            ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return a program binary
+		*
+		*  @param[in] programBinaryId
+		*    Program binary ID, result of hashing the shader source codes as well as graphics driver information
+		*  @param[out] binaryFormat
+		*    Receives the renderer backend specific program binary format
+		*  @param[out] numberOfBytes
+		*    Receives the number of program binary bytes
+		*
+		*  @return
+		*    The program binary, null pointer if there's no such program binary
+		*
+		*  @note
+		*    - The returned memory must stay valid until the program binary is set again or the program binary cache instance is destroyed
+		*/
+		virtual const uint8_t *getProgramBinary(uint64_t programBinaryId, uint32_t &binaryFormat, uint32_t &numberOfBytes) = 0;
+
+		/**
+		*  @brief
+		*    Set a program binary
+		*
+		*  @param[in] programBinaryId
+		*    Program binary ID, result of hashing the shader source codes as well as graphics driver information
+		*  @param[in] binaryFormat
+		*    Renderer backend specific program binary format
+		*  @param[in] binary
+		*    Program binary to copy, must be valid
+		*  @param[in] numberOfBytes
+		*    Number of program binary bytes
+		*
+		*  @note
+		*    - An already existing program binary with the same program binary ID is replaced
+		*/
+		virtual void setProgramBinary(uint64_t programBinaryId, uint32_t binaryFormat, const uint8_t *binary, uint32_t numberOfBytes) = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline IProgramBinaryCache();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*/
+		inline explicit IProgramBinaryCache(const IProgramBinaryCache &source);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] source
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline IProgramBinaryCache &operator =(const IProgramBinaryCache &source);
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "Renderer/Shader/IProgramBinaryCache.inl"
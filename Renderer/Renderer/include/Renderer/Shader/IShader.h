@@ -75,6 +75,22 @@ namespace Renderer
 		*/
 		virtual const char *getShaderLanguageName() const = 0;
 
+		/**
+		*  @brief
+		*    Return the shader bytecode
+		*
+		*  @param[out] numberOfBytes
+		*    Receives the number of bytes of the shader bytecode, 0 if there's no shader bytecode
+		*
+		*  @return
+		*    The shader bytecode which can be passed into the "Renderer::IShaderLanguage::create*ShaderFromBytecode()"-methods, null pointer if the renderer backend doesn't support shader bytecode or the shader bytecode isn't available
+		*
+		*  @note
+		*    - Do not free the memory the returned pointer is pointing to
+		*    - Used to persist compiled shaders in order to avoid compiling them again on the next run
+		*/
+		inline virtual const uint8_t *getShaderBytecode(uint32_t &numberOfBytes) const;
+
 		/**
 		*  @brief
 		*    Return the shader source code
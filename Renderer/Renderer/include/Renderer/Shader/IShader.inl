@@ -34,6 +34,17 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual IShader methods                        ]
+	//[-------------------------------------------------------]
+	inline const uint8_t *IShader::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// No shader bytecode by default
+		numberOfBytes = 0;
+		return nullptr;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
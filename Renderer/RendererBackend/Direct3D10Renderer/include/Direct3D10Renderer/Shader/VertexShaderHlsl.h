@@ -125,6 +125,7 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	public:
 		virtual const char *getShaderLanguageName() const override;
+		virtual const uint8_t *getShaderBytecode(uint32_t &numberOfBytes) const override;
 
 
 	//[-------------------------------------------------------]
@@ -110,6 +110,16 @@ namespace
 		{
 
 
+			//[-------------------------------------------------------]
+			//[ Command buffer                                        ]
+			//[-------------------------------------------------------]
+			void ExecuteCommandBuffer(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ExecuteCommandBuffer* realData = static_cast<const Renderer::Command::ExecuteCommandBuffer*>(data);
+				assert(nullptr != realData->commandBufferToExecute);
+				static_cast<Direct3D10Renderer::Direct3D10Renderer&>(renderer).submitCommandBuffer(*realData->commandBufferToExecute);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource handling                                     ]
 			//[-------------------------------------------------------]
@@ -125,6 +135,12 @@ namespace
 				realData->textureBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
 			}
 
+			void CopyIndirectBufferData(const void* data, Renderer::IRenderer&)
+			{
+				const Renderer::Command::CopyIndirectBufferData* realData = static_cast<const Renderer::Command::CopyIndirectBufferData*>(data);
+				realData->indirectBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
+			}
+
 			//[-------------------------------------------------------]
 			//[ Graphics root                                         ]
 			//[-------------------------------------------------------]
@@ -269,9 +285,12 @@ namespace
 		//[-------------------------------------------------------]
 		static const Renderer::BackendDispatchFunction DISPATCH_FUNCTIONS[Renderer::CommandDispatchFunctionIndex::NumberOfFunctions] =
 		{
+			// Command buffer
+			&BackendDispatch::ExecuteCommandBuffer,
 			// Resource handling
 			&BackendDispatch::CopyUniformBufferData,
 			&BackendDispatch::CopyTextureBufferData,
+			&BackendDispatch::CopyIndirectBufferData,
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsRootDescriptorTable,
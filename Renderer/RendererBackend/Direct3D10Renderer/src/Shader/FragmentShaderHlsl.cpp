@@ -26,6 +26,7 @@
 #include "Direct3D10Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
 #include "Direct3D10Renderer/D3D10.h"
 #include "Direct3D10Renderer/Direct3D10Renderer.h"
+#include "Direct3D10Renderer/Direct3D10RuntimeLinking.h"
 
 
 //[-------------------------------------------------------]
@@ -40,8 +41,13 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	FragmentShaderHlsl::FragmentShaderHlsl(Direct3D10Renderer &direct3D10Renderer, const uint8_t *bytecode, uint32_t numberOfBytes) :
 		IFragmentShader(direct3D10Renderer),
+		mD3DBlobFragmentShader(nullptr),
 		mD3D10PixelShader(nullptr)
 	{
+		// Backup the fragment shader bytecode
+		D3D10CreateBlob(numberOfBytes, &mD3DBlobFragmentShader);
+		memcpy(mD3DBlobFragmentShader->GetBufferPointer(), bytecode, numberOfBytes);
+
 		// Create the Direct3D 10 vertex shader
 		direct3D10Renderer.getD3D10Device()->CreatePixelShader(bytecode, numberOfBytes, &mD3D10PixelShader);
 
@@ -50,17 +56,15 @@ namespace Direct3D10Renderer
 
 	FragmentShaderHlsl::FragmentShaderHlsl(Direct3D10Renderer &direct3D10Renderer, const char *sourceCode) :
 		IFragmentShader(direct3D10Renderer),
+		mD3DBlobFragmentShader(nullptr),
 		mD3D10PixelShader(nullptr)
 	{
 		// Create the Direct3D 10 binary large object for the pixel shader
-		ID3DBlob *d3dBlob = static_cast<ShaderLanguageHlsl*>(direct3D10Renderer.getShaderLanguage())->loadShader("ps_4_0", sourceCode, nullptr);
-		if (nullptr != d3dBlob)
+		mD3DBlobFragmentShader = static_cast<ShaderLanguageHlsl*>(direct3D10Renderer.getShaderLanguage())->loadShader("ps_4_0", sourceCode, nullptr);
+		if (nullptr != mD3DBlobFragmentShader)
 		{
 			// Create the Direct3D 10 pixel shader
-			direct3D10Renderer.getD3D10Device()->CreatePixelShader(d3dBlob->GetBufferPointer(), d3dBlob->GetBufferSize(), &mD3D10PixelShader);
-
-			// Release the Direct3D 10 shader binary large object
-			d3dBlob->Release();
+			direct3D10Renderer.getD3D10Device()->CreatePixelShader(mD3DBlobFragmentShader->GetBufferPointer(), mD3DBlobFragmentShader->GetBufferSize(), &mD3D10PixelShader);
 		}
 
 		// Don't assign a default name to the resource for debugging purposes, Direct3D 10 automatically sets a decent default name
@@ -68,6 +72,12 @@ namespace Direct3D10Renderer
 
 	FragmentShaderHlsl::~FragmentShaderHlsl()
 	{
+		// Release the Direct3D 10 shader binary large object
+		if (nullptr != mD3DBlobFragmentShader)
+		{
+			mD3DBlobFragmentShader->Release();
+		}
+
 		// Release the Direct3D 10 pixel shader
 		if (nullptr != mD3D10PixelShader)
 		{
@@ -102,6 +112,21 @@ namespace Direct3D10Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *FragmentShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the fragment shader bytecode, if there's any
+		if (nullptr != mD3DBlobFragmentShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobFragmentShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobFragmentShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -26,6 +26,7 @@
 #include "Direct3D10Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
 #include "Direct3D10Renderer/D3D10.h"
 #include "Direct3D10Renderer/Direct3D10Renderer.h"
+#include "Direct3D10Renderer/Direct3D10RuntimeLinking.h"
 
 
 //[-------------------------------------------------------]
@@ -40,8 +41,13 @@ namespace Direct3D10Renderer
 	//[-------------------------------------------------------]
 	GeometryShaderHlsl::GeometryShaderHlsl(Direct3D10Renderer &direct3D10Renderer, const uint8_t *bytecode, uint32_t numberOfBytes) :
 		IGeometryShader(direct3D10Renderer),
+		mD3DBlobGeometryShader(nullptr),
 		mD3D10GeometryShader(nullptr)
 	{
+		// Backup the geometry shader bytecode
+		D3D10CreateBlob(numberOfBytes, &mD3DBlobGeometryShader);
+		memcpy(mD3DBlobGeometryShader->GetBufferPointer(), bytecode, numberOfBytes);
+
 		// Create the Direct3D 10 geometry shader
 		direct3D10Renderer.getD3D10Device()->CreateGeometryShader(bytecode, numberOfBytes, &mD3D10GeometryShader);
 
@@ -50,17 +56,15 @@ namespace Direct3D10Renderer
 
 	GeometryShaderHlsl::GeometryShaderHlsl(Direct3D10Renderer &direct3D10Renderer, const char *sourceCode) :
 		IGeometryShader(direct3D10Renderer),
+		mD3DBlobGeometryShader(nullptr),
 		mD3D10GeometryShader(nullptr)
 	{
 		// Create the Direct3D 10 binary large object for the geometry shader
-		ID3DBlob *d3dBlob = static_cast<ShaderLanguageHlsl*>(direct3D10Renderer.getShaderLanguage())->loadShader("gs_4_0", sourceCode, nullptr);
-		if (nullptr != d3dBlob)
+		mD3DBlobGeometryShader = static_cast<ShaderLanguageHlsl*>(direct3D10Renderer.getShaderLanguage())->loadShader("gs_4_0", sourceCode, nullptr);
+		if (nullptr != mD3DBlobGeometryShader)
 		{
 			// Create the Direct3D 10 geometry shader
-			direct3D10Renderer.getD3D10Device()->CreateGeometryShader(d3dBlob->GetBufferPointer(), d3dBlob->GetBufferSize(), &mD3D10GeometryShader);
-
-			// Release the Direct3D 10 shader binary large object
-			d3dBlob->Release();
+			direct3D10Renderer.getD3D10Device()->CreateGeometryShader(mD3DBlobGeometryShader->GetBufferPointer(), mD3DBlobGeometryShader->GetBufferSize(), &mD3D10GeometryShader);
 		}
 
 		// Don't assign a default name to the resource for debugging purposes, Direct3D 10 automatically sets a decent default name
@@ -68,6 +72,12 @@ namespace Direct3D10Renderer
 
 	GeometryShaderHlsl::~GeometryShaderHlsl()
 	{
+		// Release the Direct3D 10 shader binary large object
+		if (nullptr != mD3DBlobGeometryShader)
+		{
+			mD3DBlobGeometryShader->Release();
+		}
+
 		// Release the Direct3D 10 geometry shader
 		if (nullptr != mD3D10GeometryShader)
 		{
@@ -102,6 +112,21 @@ namespace Direct3D10Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *GeometryShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the geometry shader bytecode, if there's any
+		if (nullptr != mD3DBlobGeometryShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobGeometryShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobGeometryShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
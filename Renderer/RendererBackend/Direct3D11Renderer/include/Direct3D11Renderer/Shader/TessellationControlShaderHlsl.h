@@ -33,6 +33,8 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+typedef __interface ID3D10Blob *LPD3D10BLOB;	// "__interface" is no keyword of the ISO C++ standard, shouldn't be a problem because this in here is MS Windows only and it's also within the Direct3D headers we have to use
+typedef ID3D10Blob ID3DBlob;
 struct ID3D11HullShader;
 namespace Direct3D11Renderer
 {
@@ -114,12 +116,14 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	public:
 		virtual const char *getShaderLanguageName() const override;
+		virtual const uint8_t *getShaderBytecode(uint32_t &numberOfBytes) const override;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
+		ID3DBlob		 *mD3DBlobHullShader;	///< Direct3D 11 hull shader blob, can be a null pointer
 		ID3D11HullShader *mD3D11HullShader;	///< Direct3D 11 hull shader, can be a null pointer
 
 
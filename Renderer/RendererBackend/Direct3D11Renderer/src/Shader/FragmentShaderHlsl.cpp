@@ -26,6 +26,7 @@
 #include "Direct3D11Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
 #include "Direct3D11Renderer/D3D11.h"
 #include "Direct3D11Renderer/Direct3D11Renderer.h"
+#include "Direct3D11Renderer/Direct3D11RuntimeLinking.h"
 
 
 //[-------------------------------------------------------]
@@ -40,8 +41,13 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	FragmentShaderHlsl::FragmentShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const uint8_t *bytecode, uint32_t numberOfBytes) :
 		IFragmentShader(direct3D11Renderer),
+		mD3DBlobFragmentShader(nullptr),
 		mD3D11PixelShader(nullptr)
 	{
+		// Backup the fragment shader bytecode
+		D3DCreateBlob(numberOfBytes, &mD3DBlobFragmentShader);
+		memcpy(mD3DBlobFragmentShader->GetBufferPointer(), bytecode, numberOfBytes);
+
 		// Create the Direct3D 11 vertex shader
 		direct3D11Renderer.getD3D11Device()->CreatePixelShader(bytecode, numberOfBytes, nullptr, &mD3D11PixelShader);
 
@@ -50,17 +56,15 @@ namespace Direct3D11Renderer
 
 	FragmentShaderHlsl::FragmentShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const char *sourceCode) :
 		IFragmentShader(direct3D11Renderer),
+		mD3DBlobFragmentShader(nullptr),
 		mD3D11PixelShader(nullptr)
 	{
 		// Create the Direct3D 11 binary large object for the pixel shader
-		ID3DBlob *d3dBlob = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("ps_5_0", sourceCode, nullptr);
-		if (nullptr != d3dBlob)
+		mD3DBlobFragmentShader = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("ps_5_0", sourceCode, nullptr);
+		if (nullptr != mD3DBlobFragmentShader)
 		{
 			// Create the Direct3D 11 pixel shader
-			direct3D11Renderer.getD3D11Device()->CreatePixelShader(d3dBlob->GetBufferPointer(), d3dBlob->GetBufferSize(), nullptr, &mD3D11PixelShader);
-
-			// Release the Direct3D 11 shader binary large object
-			d3dBlob->Release();
+			direct3D11Renderer.getD3D11Device()->CreatePixelShader(mD3DBlobFragmentShader->GetBufferPointer(), mD3DBlobFragmentShader->GetBufferSize(), nullptr, &mD3D11PixelShader);
 		}
 
 		// Don't assign a default name to the resource for debugging purposes, Direct3D 11 automatically sets a decent default name
@@ -68,6 +72,12 @@ namespace Direct3D11Renderer
 
 	FragmentShaderHlsl::~FragmentShaderHlsl()
 	{
+		// Release the Direct3D 11 shader binary large object
+		if (nullptr != mD3DBlobFragmentShader)
+		{
+			mD3DBlobFragmentShader->Release();
+		}
+
 		// Release the Direct3D 11 pixel shader
 		if (nullptr != mD3D11PixelShader)
 		{
@@ -102,6 +112,21 @@ namespace Direct3D11Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *FragmentShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the fragment shader bytecode, if there's any
+		if (nullptr != mD3DBlobFragmentShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobFragmentShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobFragmentShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
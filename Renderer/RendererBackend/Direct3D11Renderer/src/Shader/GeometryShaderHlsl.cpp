@@ -26,6 +26,7 @@
 #include "Direct3D11Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
 #include "Direct3D11Renderer/D3D11.h"
 #include "Direct3D11Renderer/Direct3D11Renderer.h"
+#include "Direct3D11Renderer/Direct3D11RuntimeLinking.h"
 
 
 //[-------------------------------------------------------]
@@ -40,8 +41,13 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	GeometryShaderHlsl::GeometryShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const uint8_t *bytecode, uint32_t numberOfBytes) :
 		IGeometryShader(direct3D11Renderer),
+		mD3DBlobGeometryShader(nullptr),
 		mD3D11GeometryShader(nullptr)
 	{
+		// Backup the geometry shader bytecode
+		D3DCreateBlob(numberOfBytes, &mD3DBlobGeometryShader);
+		memcpy(mD3DBlobGeometryShader->GetBufferPointer(), bytecode, numberOfBytes);
+
 		// Create the Direct3D 11 geometry shader
 		direct3D11Renderer.getD3D11Device()->CreateGeometryShader(bytecode, numberOfBytes, nullptr, &mD3D11GeometryShader);
 
@@ -50,17 +56,15 @@ namespace Direct3D11Renderer
 
 	GeometryShaderHlsl::GeometryShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const char *sourceCode) :
 		IGeometryShader(direct3D11Renderer),
+		mD3DBlobGeometryShader(nullptr),
 		mD3D11GeometryShader(nullptr)
 	{
 		// Create the Direct3D 11 binary large object for the geometry shader
-		ID3DBlob *d3dBlob = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("gs_5_0", sourceCode, nullptr);
-		if (nullptr != d3dBlob)
+		mD3DBlobGeometryShader = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("gs_5_0", sourceCode, nullptr);
+		if (nullptr != mD3DBlobGeometryShader)
 		{
 			// Create the Direct3D 11 geometry shader
-			direct3D11Renderer.getD3D11Device()->CreateGeometryShader(d3dBlob->GetBufferPointer(), d3dBlob->GetBufferSize(), nullptr, &mD3D11GeometryShader);
-
-			// Release the Direct3D 11 shader binary large object
-			d3dBlob->Release();
+			direct3D11Renderer.getD3D11Device()->CreateGeometryShader(mD3DBlobGeometryShader->GetBufferPointer(), mD3DBlobGeometryShader->GetBufferSize(), nullptr, &mD3D11GeometryShader);
 		}
 
 		// Don't assign a default name to the resource for debugging purposes, Direct3D 11 automatically sets a decent default name
@@ -68,6 +72,12 @@ namespace Direct3D11Renderer
 
 	GeometryShaderHlsl::~GeometryShaderHlsl()
 	{
+		// Release the Direct3D 11 shader binary large object
+		if (nullptr != mD3DBlobGeometryShader)
+		{
+			mD3DBlobGeometryShader->Release();
+		}
+
 		// Release the Direct3D 11 geometry shader
 		if (nullptr != mD3D11GeometryShader)
 		{
@@ -102,6 +112,21 @@ namespace Direct3D11Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *GeometryShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the geometry shader bytecode, if there's any
+		if (nullptr != mD3DBlobGeometryShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobGeometryShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobGeometryShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -26,6 +26,7 @@
 #include "Direct3D11Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
 #include "Direct3D11Renderer/D3D11.h"
 #include "Direct3D11Renderer/Direct3D11Renderer.h"
+#include "Direct3D11Renderer/Direct3D11RuntimeLinking.h"
 
 
 //[-------------------------------------------------------]
@@ -40,8 +41,13 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	TessellationControlShaderHlsl::TessellationControlShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const uint8_t *bytecode, uint32_t numberOfBytes) :
 		ITessellationControlShader(direct3D11Renderer),
+		mD3DBlobHullShader(nullptr),
 		mD3D11HullShader(nullptr)
 	{
+		// Backup the hull shader bytecode
+		D3DCreateBlob(numberOfBytes, &mD3DBlobHullShader);
+		memcpy(mD3DBlobHullShader->GetBufferPointer(), bytecode, numberOfBytes);
+
 		// Create the Direct3D 11 hull shader
 		direct3D11Renderer.getD3D11Device()->CreateHullShader(bytecode, numberOfBytes, nullptr, &mD3D11HullShader);
 
@@ -50,17 +56,15 @@ namespace Direct3D11Renderer
 
 	TessellationControlShaderHlsl::TessellationControlShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const char *sourceCode) :
 		ITessellationControlShader(direct3D11Renderer),
+		mD3DBlobHullShader(nullptr),
 		mD3D11HullShader(nullptr)
 	{
 		// Create the Direct3D 11 binary large object for the hull shader
-		ID3DBlob *d3dBlob = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("hs_5_0", sourceCode, nullptr);
-		if (nullptr != d3dBlob)
+		mD3DBlobHullShader = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("hs_5_0", sourceCode, nullptr);
+		if (nullptr != mD3DBlobHullShader)
 		{
 			// Create the Direct3D 11 hull shader
-			direct3D11Renderer.getD3D11Device()->CreateHullShader(d3dBlob->GetBufferPointer(), d3dBlob->GetBufferSize(), nullptr, &mD3D11HullShader);
-
-			// Release the Direct3D 11 shader binary large object
-			d3dBlob->Release();
+			direct3D11Renderer.getD3D11Device()->CreateHullShader(mD3DBlobHullShader->GetBufferPointer(), mD3DBlobHullShader->GetBufferSize(), nullptr, &mD3D11HullShader);
 		}
 
 		// Don't assign a default name to the resource for debugging purposes, Direct3D 11 automatically sets a decent default name
@@ -68,6 +72,12 @@ namespace Direct3D11Renderer
 
 	TessellationControlShaderHlsl::~TessellationControlShaderHlsl()
 	{
+		// Release the Direct3D 11 shader binary large object
+		if (nullptr != mD3DBlobHullShader)
+		{
+			mD3DBlobHullShader->Release();
+		}
+
 		// Release the Direct3D 11 hull shader
 		if (nullptr != mD3D11HullShader)
 		{
@@ -102,6 +112,21 @@ namespace Direct3D11Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *TessellationControlShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the hull shader bytecode, if there's any
+		if (nullptr != mD3DBlobHullShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobHullShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobHullShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
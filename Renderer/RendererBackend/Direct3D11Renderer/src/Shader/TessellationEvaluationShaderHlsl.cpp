@@ -26,6 +26,7 @@
 #include "Direct3D11Renderer/Guid.h"	// For "WKPDID_D3DDebugObjectName"
 #include "Direct3D11Renderer/D3D11.h"
 #include "Direct3D11Renderer/Direct3D11Renderer.h"
+#include "Direct3D11Renderer/Direct3D11RuntimeLinking.h"
 
 
 //[-------------------------------------------------------]
@@ -40,8 +41,13 @@ namespace Direct3D11Renderer
 	//[-------------------------------------------------------]
 	TessellationEvaluationShaderHlsl::TessellationEvaluationShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const uint8_t *bytecode, uint32_t numberOfBytes) :
 		ITessellationEvaluationShader(direct3D11Renderer),
+		mD3DBlobDomainShader(nullptr),
 		mD3D11DomainShader(nullptr)
 	{
+		// Backup the domain shader bytecode
+		D3DCreateBlob(numberOfBytes, &mD3DBlobDomainShader);
+		memcpy(mD3DBlobDomainShader->GetBufferPointer(), bytecode, numberOfBytes);
+
 		// Create the Direct3D 11 domain shader
 		direct3D11Renderer.getD3D11Device()->CreateDomainShader(bytecode, numberOfBytes, nullptr, &mD3D11DomainShader);
 
@@ -50,17 +56,15 @@ namespace Direct3D11Renderer
 
 	TessellationEvaluationShaderHlsl::TessellationEvaluationShaderHlsl(Direct3D11Renderer &direct3D11Renderer, const char *sourceCode) :
 		ITessellationEvaluationShader(direct3D11Renderer),
+		mD3DBlobDomainShader(nullptr),
 		mD3D11DomainShader(nullptr)
 	{
 		// Create the Direct3D 11 binary large object for the domain shader
-		ID3DBlob *d3dBlob = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("ds_5_0", sourceCode, nullptr);
-		if (nullptr != d3dBlob)
+		mD3DBlobDomainShader = static_cast<ShaderLanguageHlsl*>(direct3D11Renderer.getShaderLanguage())->loadShader("ds_5_0", sourceCode, nullptr);
+		if (nullptr != mD3DBlobDomainShader)
 		{
 			// Create the Direct3D 11 domain shader
-			direct3D11Renderer.getD3D11Device()->CreateDomainShader(d3dBlob->GetBufferPointer(), d3dBlob->GetBufferSize(), nullptr, &mD3D11DomainShader);
-
-			// Release the Direct3D 11 shader binary large object
-			d3dBlob->Release();
+			direct3D11Renderer.getD3D11Device()->CreateDomainShader(mD3DBlobDomainShader->GetBufferPointer(), mD3DBlobDomainShader->GetBufferSize(), nullptr, &mD3D11DomainShader);
 		}
 
 		// Don't assign a default name to the resource for debugging purposes, Direct3D 11 automatically sets a decent default name
@@ -68,6 +72,12 @@ namespace Direct3D11Renderer
 
 	TessellationEvaluationShaderHlsl::~TessellationEvaluationShaderHlsl()
 	{
+		// Release the Direct3D 11 shader binary large object
+		if (nullptr != mD3DBlobDomainShader)
+		{
+			mD3DBlobDomainShader->Release();
+		}
+
 		// Release the Direct3D 11 domain shader
 		if (nullptr != mD3D11DomainShader)
 		{
@@ -102,6 +112,21 @@ namespace Direct3D11Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *TessellationEvaluationShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the domain shader bytecode, if there's any
+		if (nullptr != mD3DBlobDomainShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobDomainShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobDomainShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
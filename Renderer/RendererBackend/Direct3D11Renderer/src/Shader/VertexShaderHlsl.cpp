@@ -112,6 +112,21 @@ namespace Direct3D11Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *VertexShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the vertex shader bytecode, if there's any
+		if (nullptr != mD3DBlobVertexShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobVertexShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobVertexShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
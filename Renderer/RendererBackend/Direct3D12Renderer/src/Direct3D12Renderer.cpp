@@ -85,6 +85,16 @@ namespace
 		{
 
 
+			//[-------------------------------------------------------]
+			//[ Command buffer                                        ]
+			//[-------------------------------------------------------]
+			void ExecuteCommandBuffer(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ExecuteCommandBuffer* realData = static_cast<const Renderer::Command::ExecuteCommandBuffer*>(data);
+				assert(nullptr != realData->commandBufferToExecute);
+				static_cast<Direct3D12Renderer::Direct3D12Renderer&>(renderer).submitCommandBuffer(*realData->commandBufferToExecute);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource handling                                     ]
 			//[-------------------------------------------------------]
@@ -100,6 +110,12 @@ namespace
 				realData->textureBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
 			}
 
+			void CopyIndirectBufferData(const void* data, Renderer::IRenderer&)
+			{
+				const Renderer::Command::CopyIndirectBufferData* realData = static_cast<const Renderer::Command::CopyIndirectBufferData*>(data);
+				realData->indirectBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
+			}
+
 			//[-------------------------------------------------------]
 			//[ Graphics root                                         ]
 			//[-------------------------------------------------------]
@@ -246,9 +262,12 @@ namespace
 		//[-------------------------------------------------------]
 		static const Renderer::BackendDispatchFunction DISPATCH_FUNCTIONS[Renderer::CommandDispatchFunctionIndex::NumberOfFunctions] =
 		{
+			// Command buffer
+			&BackendDispatch::ExecuteCommandBuffer,
 			// Resource handling
 			&BackendDispatch::CopyUniformBufferData,
 			&BackendDispatch::CopyTextureBufferData,
+			&BackendDispatch::CopyIndirectBufferData,
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsRootDescriptorTable,
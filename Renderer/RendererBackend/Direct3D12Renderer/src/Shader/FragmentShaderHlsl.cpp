@@ -74,6 +74,21 @@ namespace Direct3D12Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *FragmentShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the fragment shader bytecode, if there's any
+		if (nullptr != mD3DBlobFragmentShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobFragmentShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobFragmentShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -74,6 +74,21 @@ namespace Direct3D12Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *GeometryShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the geometry shader bytecode, if there's any
+		if (nullptr != mD3DBlobGeometryShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobGeometryShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobGeometryShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -74,6 +74,21 @@ namespace Direct3D12Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *TessellationControlShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the hull shader bytecode, if there's any
+		if (nullptr != mD3DBlobHullShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobHullShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobHullShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -74,6 +74,21 @@ namespace Direct3D12Renderer
 		return ShaderLanguageHlsl::NAME;
 	}
 
+	const uint8_t *TessellationEvaluationShaderHlsl::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		// Return the domain shader bytecode, if there's any
+		if (nullptr != mD3DBlobDomainShader)
+		{
+			numberOfBytes = static_cast<uint32_t>(mD3DBlobDomainShader->GetBufferSize());
+			return static_cast<const uint8_t*>(mD3DBlobDomainShader->GetBufferPointer());
+		}
+		else
+		{
+			numberOfBytes = 0;
+			return nullptr;
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -78,6 +78,16 @@ namespace
 		{
 
 
+			//[-------------------------------------------------------]
+			//[ Command buffer                                        ]
+			//[-------------------------------------------------------]
+			void ExecuteCommandBuffer(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ExecuteCommandBuffer* realData = static_cast<const Renderer::Command::ExecuteCommandBuffer*>(data);
+				assert(nullptr != realData->commandBufferToExecute);
+				static_cast<Direct3D9Renderer::Direct3D9Renderer&>(renderer).submitCommandBuffer(*realData->commandBufferToExecute);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource handling                                     ]
 			//[-------------------------------------------------------]
@@ -93,6 +103,12 @@ namespace
 				assert(false);
 			}
 
+			void CopyIndirectBufferData(const void* data, Renderer::IRenderer&)
+			{
+				const Renderer::Command::CopyIndirectBufferData* realData = static_cast<const Renderer::Command::CopyIndirectBufferData*>(data);
+				realData->indirectBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
+			}
+
 			//[-------------------------------------------------------]
 			//[ Graphics root                                         ]
 			//[-------------------------------------------------------]
@@ -237,9 +253,12 @@ namespace
 		//[-------------------------------------------------------]
 		static const Renderer::BackendDispatchFunction DISPATCH_FUNCTIONS[Renderer::CommandDispatchFunctionIndex::NumberOfFunctions] =
 		{
+			// Command buffer
+			&BackendDispatch::ExecuteCommandBuffer,
 			// Resource handling
 			&BackendDispatch::CopyUniformBufferData,
 			&BackendDispatch::CopyTextureBufferData,
+			&BackendDispatch::CopyIndirectBufferData,
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsRootDescriptorTable,
@@ -115,9 +115,31 @@ namespace NullRenderer
 		//[-------------------------------------------------------]
 		//[ Draw call                                             ]
 		//[-------------------------------------------------------]
+		void draw(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
+		void drawIndexed(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawIndexedEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		//[-------------------------------------------------------]
+		//[ Draw call statistics                                  ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the total number of draws seen since the renderer was created, each draw of a multi-draw indirect draw call counts
+		*/
+		uint32_t getNumberOfDraws() const;
+
+		/**
+		*  @brief
+		*    Return the number of indirect draw calls seen since the renderer was created, a multi-draw indirect draw call counts once
+		*/
+		uint32_t getNumberOfIndirectDrawCalls() const;
+
+		/**
+		*  @brief
+		*    Return the number of draws issued through indirect draw calls since the renderer was created
+		*/
+		uint32_t getNumberOfIndirectDraws() const;
+		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
 		void setDebugMarker(const char *name);
@@ -178,6 +200,13 @@ namespace NullRenderer
 		void initializeCapabilities();
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const uint32_t MAXIMUM_COMMAND_BUFFER_NESTING_DEPTH = 16;	///< Maximum depth of command buffers executed via "Renderer::Command::ExecuteCommandBuffer", used to detect command buffers executing themselves
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -186,6 +215,13 @@ namespace NullRenderer
 		SwapChain				  *mMainSwapChain;			///< In case the optional native main window handle within the "NullRenderer"-constructor was not a null handle, this holds the instance of the main swap chain (we keep a reference to it), can be a null pointer
 		Renderer::IRenderTarget   *mRenderTarget;			///< Currently set render target (we keep a reference to it), can be a null pointer
 		RootSignature			  *mGraphicsRootSignature;	///< Currently set graphics root signature (we keep a reference to it), can be a null pointer
+		// Command buffer execution order verification
+		const Renderer::CommandBuffer *mSubmittedCommandBuffers[MAXIMUM_COMMAND_BUFFER_NESTING_DEPTH];	///< Currently submitted command buffers, outermost first, don't destroy the instances
+		uint32_t				  mCommandBufferNestingDepth;	///< Number of currently submitted command buffers
+		// Draw call statistics
+		uint32_t				  mNumberOfDraws;				///< Total number of draws
+		uint32_t				  mNumberOfIndirectDrawCalls;	///< Number of indirect draw calls
+		uint32_t				  mNumberOfIndirectDraws;		///< Number of draws issued through indirect draw calls
 
 
 	};
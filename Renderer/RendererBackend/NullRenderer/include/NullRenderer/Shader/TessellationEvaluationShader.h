@@ -67,8 +67,12 @@ namespace NullRenderer
 		*
 		*  @param[in] nullRenderer
 		*    Owner null renderer instance
+		*  @param[in] bytecode
+		*    Shader bytecode, can be a null pointer, the data is copied
+		*  @param[in] numberOfBytes
+		*    Number of bytes in the bytecode
 		*/
-		explicit TessellationEvaluationShader(NullRenderer &nullRenderer);
+		TessellationEvaluationShader(NullRenderer &nullRenderer, const uint8_t *bytecode, uint32_t numberOfBytes);
 
 		/**
 		*  @brief
@@ -82,6 +86,15 @@ namespace NullRenderer
 	//[-------------------------------------------------------]
 	public:
 		virtual const char *getShaderLanguageName() const override;
+		virtual const uint8_t *getShaderBytecode(uint32_t &numberOfBytes) const override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint8_t  *mBytecode;				///< Copy of the shader bytecode, can be a null pointer, we own the memory so free it if no longer needed
+		uint32_t  mNumberOfBytecodeBytes;	///< Number of bytes in the shader bytecode
 
 
 	};
@@ -78,6 +78,16 @@ namespace
 		{
 
 
+			//[-------------------------------------------------------]
+			//[ Command buffer                                        ]
+			//[-------------------------------------------------------]
+			void ExecuteCommandBuffer(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ExecuteCommandBuffer* realData = static_cast<const Renderer::Command::ExecuteCommandBuffer*>(data);
+				assert(nullptr != realData->commandBufferToExecute);
+				static_cast<NullRenderer::NullRenderer&>(renderer).submitCommandBuffer(*realData->commandBufferToExecute);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource handling                                     ]
 			//[-------------------------------------------------------]
@@ -93,6 +103,12 @@ namespace
 				realData->textureBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
 			}
 
+			void CopyIndirectBufferData(const void* data, Renderer::IRenderer&)
+			{
+				const Renderer::Command::CopyIndirectBufferData* realData = static_cast<const Renderer::Command::CopyIndirectBufferData*>(data);
+				realData->indirectBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
+			}
+
 			//[-------------------------------------------------------]
 			//[ Graphics root                                         ]
 			//[-------------------------------------------------------]
@@ -185,8 +201,7 @@ namespace
 				const Renderer::Command::Draw* realData = static_cast<const Renderer::Command::Draw*>(data);
 				if (nullptr != realData->indirectBuffer)
 				{
-					// No resource owner security check in here, we only support emulated indirect buffer
-					static_cast<NullRenderer::NullRenderer&>(renderer).drawEmulated(realData->indirectBuffer->getEmulationData(), realData->indirectBufferOffset, realData->numberOfDraws);
+					static_cast<NullRenderer::NullRenderer&>(renderer).draw(*realData->indirectBuffer, realData->indirectBufferOffset, realData->numberOfDraws);
 				}
 				else
 				{
@@ -199,8 +214,7 @@ namespace
 				const Renderer::Command::Draw* realData = static_cast<const Renderer::Command::Draw*>(data);
 				if (nullptr != realData->indirectBuffer)
 				{
-					// No resource owner security check in here, we only support emulated indirect buffer
-					static_cast<NullRenderer::NullRenderer&>(renderer).drawIndexedEmulated(realData->indirectBuffer->getEmulationData(), realData->indirectBufferOffset, realData->numberOfDraws);
+					static_cast<NullRenderer::NullRenderer&>(renderer).drawIndexed(*realData->indirectBuffer, realData->indirectBufferOffset, realData->numberOfDraws);
 				}
 				else
 				{
@@ -237,9 +251,12 @@ namespace
 		//[-------------------------------------------------------]
 		static const Renderer::BackendDispatchFunction DISPATCH_FUNCTIONS[Renderer::CommandDispatchFunctionIndex::NumberOfFunctions] =
 		{
+			// Command buffer
+			&BackendDispatch::ExecuteCommandBuffer,
 			// Resource handling
 			&BackendDispatch::CopyUniformBufferData,
 			&BackendDispatch::CopyTextureBufferData,
+			&BackendDispatch::CopyIndirectBufferData,
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsRootDescriptorTable,
@@ -288,7 +305,11 @@ namespace NullRenderer
 		mShaderLanguage(nullptr),
 		mMainSwapChain(nullptr),
 		mRenderTarget(nullptr),
-		mGraphicsRootSignature(nullptr)
+		mGraphicsRootSignature(nullptr),
+		mCommandBufferNestingDepth(0),
+		mNumberOfDraws(0),
+		mNumberOfIndirectDrawCalls(0),
+		mNumberOfIndirectDraws(0)
 	{
 		// Initialize the capabilities
 		initializeCapabilities();
@@ -531,14 +552,49 @@ namespace NullRenderer
 	//[-------------------------------------------------------]
 	//[ Draw call                                             ]
 	//[-------------------------------------------------------]
-	void NullRenderer::drawEmulated(const uint8_t*, uint32_t, uint32_t)
+	void NullRenderer::draw(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, uint32_t numberOfDraws)
 	{
-		// Nothing here
+		// No resource owner security check in here, we only support emulated indirect buffer
+		++mNumberOfIndirectDrawCalls;
+		mNumberOfIndirectDraws += numberOfDraws;
+		drawEmulated(indirectBuffer.getEmulationData(), indirectBufferOffset, numberOfDraws);
 	}
 
-	void NullRenderer::drawIndexedEmulated(const uint8_t*, uint32_t, uint32_t)
+	void NullRenderer::drawEmulated(const uint8_t*, uint32_t, uint32_t numberOfDraws)
 	{
-		// Nothing here
+		mNumberOfDraws += numberOfDraws;
+	}
+
+	void NullRenderer::drawIndexed(const Renderer::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, uint32_t numberOfDraws)
+	{
+		// No resource owner security check in here, we only support emulated indirect buffer
+		++mNumberOfIndirectDrawCalls;
+		mNumberOfIndirectDraws += numberOfDraws;
+		drawIndexedEmulated(indirectBuffer.getEmulationData(), indirectBufferOffset, numberOfDraws);
+	}
+
+	void NullRenderer::drawIndexedEmulated(const uint8_t*, uint32_t, uint32_t numberOfDraws)
+	{
+		mNumberOfDraws += numberOfDraws;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Draw call statistics                                  ]
+	//[-------------------------------------------------------]
+	uint32_t NullRenderer::getNumberOfDraws() const
+	{
+		return mNumberOfDraws;
+	}
+
+	uint32_t NullRenderer::getNumberOfIndirectDrawCalls() const
+	{
+		return mNumberOfIndirectDrawCalls;
+	}
+
+	uint32_t NullRenderer::getNumberOfIndirectDraws() const
+	{
+		return mNumberOfIndirectDraws;
 	}
 
 
@@ -736,22 +792,47 @@ namespace NullRenderer
 
 	void NullRenderer::submitCommandBuffer(const Renderer::CommandBuffer& commandBuffer)
 	{
+		// The null renderer is used for testing, so verify that command buffers executed via "Renderer::Command::ExecuteCommandBuffer" are
+		// neither nested too deep nor executing themselves, which would result in an endless recursion
+		assert(mCommandBufferNestingDepth < MAXIMUM_COMMAND_BUFFER_NESTING_DEPTH);
+		for (uint32_t i = 0; i < mCommandBufferNestingDepth; ++i)
+		{
+			assert(mSubmittedCommandBuffers[i] != &commandBuffer);
+		}
+		mSubmittedCommandBuffers[mCommandBufferNestingDepth] = &commandBuffer;
+		++mCommandBufferNestingDepth;
+
 		// Loop through all commands
 		uint8_t* commandPacketBuffer = const_cast<uint8_t*>(commandBuffer.getCommandPacketBuffer());	// TODO(co) Get rid of the evil const-cast
 		Renderer::CommandPacket commandPacket = commandPacketBuffer;
+		#ifndef RENDERER_NO_STATISTICS
+			uint32_t numberOfCommands = 0;
+		#endif
 		while (nullptr != commandPacket)
 		{
 			{ // Submit command packet
 				const Renderer::CommandDispatchFunctionIndex commandDispatchFunctionIndex = Renderer::CommandPacketHelper::loadCommandDispatchFunctionIndex(commandPacket);
+				assert(commandDispatchFunctionIndex < Renderer::CommandDispatchFunctionIndex::NumberOfFunctions);
 				const void* command = Renderer::CommandPacketHelper::loadCommand(commandPacket);
 				detail::DISPATCH_FUNCTIONS[commandDispatchFunctionIndex](command, *this);
+				#ifndef RENDERER_NO_STATISTICS
+					++numberOfCommands;
+				#endif
 			}
 
 			{ // Next command
+				// -> The command packets must be walked in recording order: Each next command packet must be located behind the current one and inside the used command packet buffer
 				const uint32_t nextCommandPacketByteIndex = Renderer::CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
+				assert(~0u == nextCommandPacketByteIndex || (nextCommandPacketByteIndex > static_cast<uint32_t>(static_cast<uint8_t*>(commandPacket) - commandPacketBuffer) && nextCommandPacketByteIndex < commandBuffer.getNumberOfUsedBytes()));
 				commandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
 			}
 		}
+
+		// All recorded commands must have been executed
+		#ifndef RENDERER_NO_STATISTICS
+			assert(commandBuffer.getNumberOfCommands() == numberOfCommands);
+		#endif
+		--mCommandBufferNestingDepth;
 	}
 
 	void NullRenderer::endScene()
@@ -29,6 +29,8 @@
 #include "NullRenderer/Shader/TessellationControlShader.h"
 #include "NullRenderer/Shader/TessellationEvaluationShader.h"
 
+#include <string.h>	// For "strlen()"
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -66,64 +68,69 @@ namespace NullRenderer
 		return NAME;
 	}
 
-	Renderer::IVertexShader *ShaderLanguage::createVertexShaderFromBytecode(const Renderer::VertexAttributes&, const uint8_t *, uint32_t)
+	Renderer::IVertexShader *ShaderLanguage::createVertexShaderFromBytecode(const Renderer::VertexAttributes&, const uint8_t *bytecode, uint32_t numberOfBytes)
 	{
 		// There's no need to check for "Renderer::Capabilities::vertexShader", we know there's vertex shader support
-		return new VertexShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new VertexShader(reinterpret_cast<NullRenderer&>(getRenderer()), bytecode, numberOfBytes);
 	}
 
-	Renderer::IVertexShader *ShaderLanguage::createVertexShaderFromSourceCode(const Renderer::VertexAttributes&, const char *, const char *, const char *, const char *)
+	Renderer::IVertexShader *ShaderLanguage::createVertexShaderFromSourceCode(const Renderer::VertexAttributes&, const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::vertexShader", we know there's vertex shader support
-		return new VertexShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		// -> The null renderer uses the shader source code as shader bytecode
+		return new VertexShader(reinterpret_cast<NullRenderer&>(getRenderer()), reinterpret_cast<const uint8_t*>(sourceCode), static_cast<uint32_t>(strlen(sourceCode)));
 	}
 
-	Renderer::ITessellationControlShader *ShaderLanguage::createTessellationControlShaderFromBytecode(const uint8_t *, uint32_t)
+	Renderer::ITessellationControlShader *ShaderLanguage::createTessellationControlShaderFromBytecode(const uint8_t *bytecode, uint32_t numberOfBytes)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation control shader support
-		return new TessellationControlShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new TessellationControlShader(reinterpret_cast<NullRenderer&>(getRenderer()), bytecode, numberOfBytes);
 	}
 
-	Renderer::ITessellationControlShader *ShaderLanguage::createTessellationControlShaderFromSourceCode(const char *, const char *, const char *, const char *)
+	Renderer::ITessellationControlShader *ShaderLanguage::createTessellationControlShaderFromSourceCode(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation control shader support
-		return new TessellationControlShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		// -> The null renderer uses the shader source code as shader bytecode
+		return new TessellationControlShader(reinterpret_cast<NullRenderer&>(getRenderer()), reinterpret_cast<const uint8_t*>(sourceCode), static_cast<uint32_t>(strlen(sourceCode)));
 	}
 
-	Renderer::ITessellationEvaluationShader *ShaderLanguage::createTessellationEvaluationShaderFromBytecode(const uint8_t *, uint32_t)
+	Renderer::ITessellationEvaluationShader *ShaderLanguage::createTessellationEvaluationShaderFromBytecode(const uint8_t *bytecode, uint32_t numberOfBytes)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation evaluation shader support
-		return new TessellationEvaluationShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new TessellationEvaluationShader(reinterpret_cast<NullRenderer&>(getRenderer()), bytecode, numberOfBytes);
 	}
 
-	Renderer::ITessellationEvaluationShader *ShaderLanguage::createTessellationEvaluationShaderFromSourceCode(const char *, const char *, const char *, const char *)
+	Renderer::ITessellationEvaluationShader *ShaderLanguage::createTessellationEvaluationShaderFromSourceCode(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfPatchVertices", we know there's tessellation evaluation shader support
-		return new TessellationEvaluationShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		// -> The null renderer uses the shader source code as shader bytecode
+		return new TessellationEvaluationShader(reinterpret_cast<NullRenderer&>(getRenderer()), reinterpret_cast<const uint8_t*>(sourceCode), static_cast<uint32_t>(strlen(sourceCode)));
 	}
 
-	Renderer::IGeometryShader *ShaderLanguage::createGeometryShaderFromBytecode(const uint8_t *, uint32_t, Renderer::GsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology, uint32_t, const char *, const char *, const char *)
+	Renderer::IGeometryShader *ShaderLanguage::createGeometryShaderFromBytecode(const uint8_t *bytecode, uint32_t numberOfBytes, Renderer::GsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology, uint32_t, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfGsOutputVertices", we know there's geometry shader support
-		return new GeometryShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new GeometryShader(reinterpret_cast<NullRenderer&>(getRenderer()), bytecode, numberOfBytes);
 	}
 
-	Renderer::IGeometryShader *ShaderLanguage::createGeometryShaderFromSourceCode(const char *, Renderer::GsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology, uint32_t, const char *, const char *, const char *)
+	Renderer::IGeometryShader *ShaderLanguage::createGeometryShaderFromSourceCode(const char *sourceCode, Renderer::GsInputPrimitiveTopology, Renderer::GsOutputPrimitiveTopology, uint32_t, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::maximumNumberOfGsOutputVertices", we know there's geometry shader support
-		return new GeometryShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		// -> The null renderer uses the shader source code as shader bytecode
+		return new GeometryShader(reinterpret_cast<NullRenderer&>(getRenderer()), reinterpret_cast<const uint8_t*>(sourceCode), static_cast<uint32_t>(strlen(sourceCode)));
 	}
 
-	Renderer::IFragmentShader *ShaderLanguage::createFragmentShaderFromBytecode(const uint8_t *, uint32_t)
+	Renderer::IFragmentShader *ShaderLanguage::createFragmentShaderFromBytecode(const uint8_t *bytecode, uint32_t numberOfBytes)
 	{
 		// There's no need to check for "Renderer::Capabilities::fragmentShader", we know there's fragment shader support
-		return new FragmentShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		return new FragmentShader(reinterpret_cast<NullRenderer&>(getRenderer()), bytecode, numberOfBytes);
 	}
 
-	Renderer::IFragmentShader *ShaderLanguage::createFragmentShaderFromSourceCode(const char *, const char *, const char *, const char *)
+	Renderer::IFragmentShader *ShaderLanguage::createFragmentShaderFromSourceCode(const char *sourceCode, const char *, const char *, const char *)
 	{
 		// There's no need to check for "Renderer::Capabilities::fragmentShader", we know there's fragment shader support
-		return new FragmentShader(reinterpret_cast<NullRenderer&>(getRenderer()));
+		// -> The null renderer uses the shader source code as shader bytecode
+		return new FragmentShader(reinterpret_cast<NullRenderer&>(getRenderer()), reinterpret_cast<const uint8_t*>(sourceCode), static_cast<uint32_t>(strlen(sourceCode)));
 	}
 
 	Renderer::IProgram *ShaderLanguage::createProgram(const Renderer::IRootSignature&, const Renderer::VertexAttributes&, Renderer::IVertexShader *vertexShader, Renderer::ITessellationControlShader *tessellationControlShader, Renderer::ITessellationEvaluationShader *tessellationEvaluationShader, Renderer::IGeometryShader *geometryShader, Renderer::IFragmentShader *fragmentShader)
@@ -24,6 +24,8 @@
 #include "NullRenderer/Shader/TessellationControlShader.h"
 #include "NullRenderer/Shader/ShaderLanguage.h"
 
+#include <memory.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -35,15 +37,21 @@ namespace NullRenderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	TessellationControlShader::TessellationControlShader(NullRenderer &nullRenderer) :
-		ITessellationControlShader(reinterpret_cast<Renderer::IRenderer&>(nullRenderer))
+	TessellationControlShader::TessellationControlShader(NullRenderer &nullRenderer, const uint8_t *bytecode, uint32_t numberOfBytes) :
+		ITessellationControlShader(reinterpret_cast<Renderer::IRenderer&>(nullRenderer)),
+		mBytecode((nullptr != bytecode && numberOfBytes > 0) ? new uint8_t[numberOfBytes] : nullptr),
+		mNumberOfBytecodeBytes((nullptr != mBytecode) ? numberOfBytes : 0)
 	{
-		// Nothing here
+		// Keep a copy of the shader bytecode so the null renderer can be used to test shader bytecode persistence
+		if (nullptr != mBytecode)
+		{
+			memcpy(mBytecode, bytecode, numberOfBytes);
+		}
 	}
 
 	TessellationControlShader::~TessellationControlShader()
 	{
-		// Nothing here
+		delete [] mBytecode;
 	}
 
 
@@ -55,6 +63,12 @@ namespace NullRenderer
 		return ShaderLanguage::NAME;
 	}
 
+	const uint8_t *TessellationControlShader::getShaderBytecode(uint32_t &numberOfBytes) const
+	{
+		numberOfBytes = mNumberOfBytecodeBytes;
+		return mBytecode;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -389,6 +389,7 @@ namespace OpenGLRenderer
 	FNDEF_EX(glGetObjectParameterivARB,	PFNGLGETOBJECTPARAMETERIVARBPROC);
 	FNDEF_EX(glGetInfoLogARB,			PFNGLGETINFOLOGARBPROC);
 	FNDEF_EX(glGetUniformLocationARB,	PFNGLGETUNIFORMLOCATIONARBPROC);
+	FNDEF_EX(glGetShaderSourceARB,		PFNGLGETSHADERSOURCEARBPROC);
 
 	// GL_ARB_separate_shader_objects
 	FNDEF_EX(glCreateShaderProgramv,		PFNGLCREATESHADERPROGRAMVPROC);
@@ -404,6 +405,8 @@ namespace OpenGLRenderer
 
 	// GL_ARB_get_program_binary
 	FNDEF_EX(glProgramParameteri,	PFNGLPROGRAMPARAMETERIPROC);
+	FNDEF_EX(glGetProgramBinary,	PFNGLGETPROGRAMBINARYPROC);
+	FNDEF_EX(glProgramBinary,		PFNGLPROGRAMBINARYPROC);
 
 	// GL_ARB_uniform_buffer_object
 	FNDEF_EX(glGetUniformBlockIndex,	PFNGLGETUNIFORMBLOCKINDEXPROC);
@@ -141,6 +141,15 @@ namespace OpenGLRenderer
 		*/
 		inline Extensions &getExtensions();
 
+		/**
+		*  @brief
+		*    Return the program binary driver identifier
+		*
+		*  @return
+		*    Hash of the OpenGL vendor, renderer and version string, 0 if program binaries are not supported (see "OpenGLRenderer::ProgramBinary")
+		*/
+		inline uint64_t getProgramBinaryDriverId() const;
+
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
@@ -287,6 +296,7 @@ namespace OpenGLRenderer
 		RootSignature			  *mGraphicsRootSignature;			///< Currently set graphics root signature (we keep a reference to it), can be a null pointer
 		Renderer::ISamplerState	  *mDefaultSamplerState;			///< Default rasterizer state (we keep a reference to it), can be a null pointer
 		uint32_t				   mOpenGLCopyResourceFramebuffer;	///< OpenGL framebuffer ("container" object, not shared between OpenGL contexts) used by "OpenGLRenderer::OpenGLRenderer::copyResource()" if the "GL_ARB_copy_image"-extension isn't available, can be zero if no resource is allocated (type "GLuint" not used in here in order to keep the header slim)
+		uint64_t				   mProgramBinaryDriverId;			///< Program binary driver identifier, 0 if program binaries are not supported
 		//[-------------------------------------------------------]
 		//[ States                                                ]
 		//[-------------------------------------------------------]
@@ -38,6 +38,11 @@ namespace OpenGLRenderer
 		return *mExtensions;
 	}
 
+	inline uint64_t OpenGLRenderer::getProgramBinaryDriverId() const
+	{
+		return mProgramBinaryDriverId;
+	}
+
 	inline const IContext &OpenGLRenderer::getContext() const
 	{
 		return *mContext;
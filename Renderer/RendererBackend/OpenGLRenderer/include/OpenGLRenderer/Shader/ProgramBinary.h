@@ -0,0 +1,201 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/PlatformTypes.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	struct VertexAttributes;
+}
+namespace OpenGLRenderer
+{
+	class Extensions;
+	class OpenGLRenderer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    OpenGL program binary ("GL_ARB_get_program_binary") support
+	*
+	*  @remarks
+	*    Program binaries are stored inside the program binary cache set via "Renderer::IRenderer::setProgramBinaryCache()". A program binary
+	*    identifier is a FNV-1a hash of the program binary driver identifier and everything which influences the linked program: shader types,
+	*    shader source codes, vertex attribute names and legacy geometry shader parameters. A program binary identifier of 0 means that there's
+	*    either no program binary cache or that the OpenGL implementation doesn't support program binaries.
+	*
+	*    Usage:
+	*    - Calculate the program binary identifier by using "OpenGLRenderer::ProgramBinary::getInitialProgramBinaryId()" and the "hash*()"-methods
+	*    - Try "OpenGLRenderer::ProgramBinary::loadProgramBinary()", on failure fall back to the usual compile and link (set
+	*      "GL_PROGRAM_BINARY_RETRIEVABLE_HINT" before linking) and store the result via "OpenGLRenderer::ProgramBinary::saveProgramBinary()"
+	*/
+	class ProgramBinary
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Calculate the program binary driver identifier
+		*
+		*  @param[in] extensions
+		*    Initialized extensions of the current OpenGL context
+		*
+		*  @return
+		*    Hash of the OpenGL vendor, renderer and version string, 0 if program binaries are not supported
+		*
+		*  @note
+		*    - Drivers reject program binaries created by other drivers or driver versions, the driver identifier avoids pointless load attempts
+		*/
+		static uint64_t calculateDriverId(const Extensions& extensions);
+
+		/**
+		*  @brief
+		*    Return the initial program binary identifier to hash the program into
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*
+		*  @return
+		*    The initial program binary identifier, 0 if program binaries are not used (no program binary cache set or no driver support)
+		*/
+		static uint64_t getInitialProgramBinaryId(const OpenGLRenderer& openGLRenderer);
+
+		/**
+		*  @brief
+		*    Hash data into a program binary identifier
+		*
+		*  @param[in] data
+		*    Data to hash, must be valid
+		*  @param[in] numberOfBytes
+		*    Number of bytes to hash
+		*  @param[in] programBinaryId
+		*    Program binary identifier to hash into, 0 is passed through unchanged
+		*
+		*  @return
+		*    The updated program binary identifier
+		*/
+		static uint64_t hash(const void* data, uint32_t numberOfBytes, uint64_t programBinaryId);
+
+		/**
+		*  @brief
+		*    Hash a null terminated string into a program binary identifier
+		*
+		*  @param[in] string
+		*    Null terminated string to hash, must be valid
+		*  @param[in] programBinaryId
+		*    Program binary identifier to hash into, 0 is passed through unchanged
+		*
+		*  @return
+		*    The updated program binary identifier
+		*/
+		static uint64_t hashString(const char* string, uint64_t programBinaryId);
+
+		/**
+		*  @brief
+		*    Hash the names of vertex attributes into a program binary identifier
+		*
+		*  @param[in] vertexAttributes
+		*    Vertex attributes, the attribute locations are bound by using the attribute index
+		*  @param[in] programBinaryId
+		*    Program binary identifier to hash into, 0 is passed through unchanged
+		*
+		*  @return
+		*    The updated program binary identifier
+		*/
+		static uint64_t hashVertexAttributes(const Renderer::VertexAttributes& vertexAttributes, uint64_t programBinaryId);
+
+		/**
+		*  @brief
+		*    Hash the type and source code of an OpenGL shader into a program binary identifier
+		*
+		*  @param[in] openGLShader
+		*    OpenGL shader to hash, can be zero (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in] programBinaryId
+		*    Program binary identifier to hash into, 0 is passed through unchanged
+		*
+		*  @return
+		*    The updated program binary identifier
+		*/
+		static uint64_t hashOpenGLShader(uint32_t openGLShader, uint64_t programBinaryId);
+
+		/**
+		*  @brief
+		*    Load a program binary from the program binary cache
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] openGLProgram
+		*    OpenGL program to load the program binary into (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in] programBinaryId
+		*    Program binary identifier, 0 if program binaries are not used
+		*
+		*  @return
+		*    "true" if the OpenGL program is linked, else "false" (no cached program binary or the driver rejected it, compile and link from source in this case)
+		*/
+		static bool loadProgramBinary(const OpenGLRenderer& openGLRenderer, uint32_t openGLProgram, uint64_t programBinaryId);
+
+		/**
+		*  @brief
+		*    Save the program binary of a successfully linked OpenGL program into the program binary cache
+		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance
+		*  @param[in] openGLProgram
+		*    Linked OpenGL program (type "GLuint" not used in here in order to keep the header slim)
+		*  @param[in] programBinaryId
+		*    Program binary identifier, 0 if program binaries are not used
+		*/
+		static void saveProgramBinary(const OpenGLRenderer& openGLRenderer, uint32_t openGLProgram, uint64_t programBinaryId);
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
@@ -35,6 +35,10 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+namespace Renderer
+{
+	struct VertexAttributes;
+}
 namespace OpenGLRenderer
 {
 	class OpenGLRenderer;
@@ -74,15 +78,19 @@ namespace OpenGLRenderer
 		*  @brief
 		*    Creates, loads and compiles a shader
 		*
+		*  @param[in] openGLRenderer
+		*    Owner OpenGL renderer instance, if a program binary cache is set the linked shader program is loaded from and stored into it
 		*  @param[in] shaderType
 		*    Shader type (for example "GL_VERTEX_SHADER_ARB", type GLenum not used in here in order to keep the header slim)
 		*  @param[in] shaderSource
 		*    Shader ASCII source code, must be a valid pointer (type GLchar not used in here in order to keep the header slim)
+		*  @param[in] vertexAttributes
+		*    Vertex attributes to bind the attribute locations of, can be a null pointer (only relevant for vertex shaders)
 		*
 		*  @return
-		*    The OpenGL shader, 0 on error, destroy the resource if you no longer need it (type "GLuint" not used in here in order to keep the header slim)
+		*    The OpenGL shader program, 0 on error, destroy the resource if you no longer need it (type "GLuint" not used in here in order to keep the header slim)
 		*/
-		static uint32_t loadShader(uint32_t shaderType, const char *shaderSource);
+		static uint32_t loadShader(const OpenGLRenderer& openGLRenderer, uint32_t shaderType, const char *shaderSource, const Renderer::VertexAttributes* vertexAttributes = nullptr);
 
 
 	//[-------------------------------------------------------]
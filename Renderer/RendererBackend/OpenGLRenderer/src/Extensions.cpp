@@ -515,6 +515,7 @@ namespace OpenGLRenderer
 			IMPORT_FUNC(glGetObjectParameterivARB)
 			IMPORT_FUNC(glGetInfoLogARB)
 			IMPORT_FUNC(glGetUniformLocationARB)
+			IMPORT_FUNC(glGetShaderSourceARB)
 			mGL_ARB_shader_objects = result;
 		}
 
@@ -544,6 +545,8 @@ namespace OpenGLRenderer
 			// Load the entry points
 			bool result = true;	// Success by default
 			IMPORT_FUNC(glProgramParameteri)
+			IMPORT_FUNC(glGetProgramBinary)
+			IMPORT_FUNC(glProgramBinary)
 			mGL_ARB_get_program_binary = result;
 		}
 
@@ -53,6 +53,7 @@
 #include "OpenGLRenderer/Shader/Monolithic/ProgramMonolithic.h"
 #include "OpenGLRenderer/Shader/Separate/ShaderLanguageSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/ProgramSeparate.h"
+#include "OpenGLRenderer/Shader/ProgramBinary.h"
 
 #ifdef WIN32
 	#include "OpenGLRenderer/Windows/ContextWindows.h"
@@ -102,6 +103,16 @@ namespace
 		{
 
 
+			//[-------------------------------------------------------]
+			//[ Command buffer                                        ]
+			//[-------------------------------------------------------]
+			void ExecuteCommandBuffer(const void* data, Renderer::IRenderer& renderer)
+			{
+				const Renderer::Command::ExecuteCommandBuffer* realData = static_cast<const Renderer::Command::ExecuteCommandBuffer*>(data);
+				assert(nullptr != realData->commandBufferToExecute);
+				static_cast<OpenGLRenderer::OpenGLRenderer&>(renderer).submitCommandBuffer(*realData->commandBufferToExecute);
+			}
+
 			//[-------------------------------------------------------]
 			//[ Resource handling                                     ]
 			//[-------------------------------------------------------]
@@ -117,6 +128,12 @@ namespace
 				realData->textureBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
 			}
 
+			void CopyIndirectBufferData(const void* data, Renderer::IRenderer&)
+			{
+				const Renderer::Command::CopyIndirectBufferData* realData = static_cast<const Renderer::Command::CopyIndirectBufferData*>(data);
+				realData->indirectBuffer->copyDataFrom(realData->numberOfBytes, (nullptr != realData->data) ? realData->data : Renderer::CommandPacketHelper::getAuxiliaryMemory(realData));
+			}
+
 			//[-------------------------------------------------------]
 			//[ Graphics root                                         ]
 			//[-------------------------------------------------------]
@@ -259,9 +276,12 @@ namespace
 		//[-------------------------------------------------------]
 		static const Renderer::BackendDispatchFunction DISPATCH_FUNCTIONS[Renderer::CommandDispatchFunctionIndex::NumberOfFunctions] =
 		{
+			// Command buffer
+			&BackendDispatch::ExecuteCommandBuffer,
 			// Resource handling
 			&BackendDispatch::CopyUniformBufferData,
 			&BackendDispatch::CopyTextureBufferData,
+			&BackendDispatch::CopyIndirectBufferData,
 			// Graphics root
 			&BackendDispatch::SetGraphicsRootSignature,
 			&BackendDispatch::SetGraphicsRootDescriptorTable,
@@ -320,6 +340,7 @@ namespace OpenGLRenderer
 		mGraphicsRootSignature(nullptr),
 		mDefaultSamplerState(nullptr),
 		mOpenGLCopyResourceFramebuffer(0),
+		mProgramBinaryDriverId(0),
 		mPipelineState(nullptr),
 		mVertexArray(nullptr),
 		mOpenGLPrimitiveTopology(0xFFFF),	// Unknown default setting
@@ -372,6 +393,9 @@ namespace OpenGLRenderer
 				// Initialize the capabilities
 				initializeCapabilities();
 
+				// Program binaries are only valid for the graphics driver which created them
+				mProgramBinaryDriverId = ProgramBinary::calculateDriverId(*mExtensions);
+
 				// Add references to the default sampler state and set it
 				if (nullptr != mDefaultSamplerState)
 				{
@@ -1374,7 +1398,11 @@ namespace OpenGLRenderer
 					}
 					else
 					{
-						// TODO(co) Emulation (see specification for examples)
+						// Emulate the multi-draw by issuing the tightly packed indirect draws one after another
+						for (uint32_t i = 0; i < numberOfDraws; ++i)
+						{
+							glDrawArraysIndirect(mOpenGLPrimitiveTopology, reinterpret_cast<void*>(static_cast<uintptr_t>(indirectBufferOffset + i * sizeof(Renderer::DrawInstancedArguments))));
+						}
 					}
 				}
 			}
@@ -1456,7 +1484,11 @@ namespace OpenGLRenderer
 							}
 							else
 							{
-								// TODO(co) Emulation (see specification for examples)
+								// Emulate the multi-draw by issuing the tightly packed indirect draws one after another
+								for (uint32_t i = 0; i < numberOfDraws; ++i)
+								{
+									glDrawElementsIndirect(mOpenGLPrimitiveTopology, indexBuffer->getOpenGLType(), reinterpret_cast<void*>(static_cast<uintptr_t>(indirectBufferOffset + i * sizeof(Renderer::DrawIndexedInstancedArguments))));
+								}
 							}
 						}
 					}
@@ -27,6 +27,7 @@
 #include "OpenGLRenderer/Shader/Monolithic/FragmentShaderMonolithic.h"
 #include "OpenGLRenderer/Shader/Monolithic/TessellationControlShaderMonolithic.h"
 #include "OpenGLRenderer/Shader/Monolithic/TessellationEvaluationShaderMonolithic.h"
+#include "OpenGLRenderer/Shader/ProgramBinary.h"
 #include "OpenGLRenderer/IContext.h"
 #include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/RootSignature.h"
@@ -50,24 +51,30 @@ namespace OpenGLRenderer
 		IProgram(openGLRenderer),
 		mOpenGLProgram(glCreateProgramObjectARB())
 	{
+		// Program binary identifier, 0 if program binaries are not used
+		uint64_t programBinaryId = ProgramBinary::getInitialProgramBinaryId(openGLRenderer);
+
 		// Attach the shaders to the program
 		// -> We don't need to keep a reference to the shader, to add and release at once to ensure a nice behaviour
 		if (nullptr != vertexShaderMonolithic)
 		{
 			vertexShaderMonolithic->addReference();
 			glAttachObjectARB(mOpenGLProgram, vertexShaderMonolithic->getOpenGLShader());
+			programBinaryId = ProgramBinary::hashOpenGLShader(vertexShaderMonolithic->getOpenGLShader(), programBinaryId);
 			vertexShaderMonolithic->releaseReference();
 		}
 		if (nullptr != tessellationControlShaderMonolithic)
 		{
 			tessellationControlShaderMonolithic->addReference();
 			glAttachObjectARB(mOpenGLProgram, tessellationControlShaderMonolithic->getOpenGLShader());
+			programBinaryId = ProgramBinary::hashOpenGLShader(tessellationControlShaderMonolithic->getOpenGLShader(), programBinaryId);
 			tessellationControlShaderMonolithic->releaseReference();
 		}
 		if (nullptr != tessellationEvaluationShaderMonolithic)
 		{
 			tessellationEvaluationShaderMonolithic->addReference();
 			glAttachObjectARB(mOpenGLProgram, tessellationEvaluationShaderMonolithic->getOpenGLShader());
+			programBinaryId = ProgramBinary::hashOpenGLShader(tessellationEvaluationShaderMonolithic->getOpenGLShader(), programBinaryId);
 			tessellationEvaluationShaderMonolithic->releaseReference();
 		}
 		if (nullptr != geometryShaderMonolithic)
@@ -77,6 +84,7 @@ namespace OpenGLRenderer
 
 			// Attach the monolithic shader to the monolithic program
 			glAttachObjectARB(mOpenGLProgram, geometryShaderMonolithic->getOpenGLShader());
+			programBinaryId = ProgramBinary::hashOpenGLShader(geometryShaderMonolithic->getOpenGLShader(), programBinaryId);
 
 			// In modern GLSL, "geometry shader input primitive topology" & "geometry shader output primitive topology" & "number of output vertices" can be directly set within GLSL by writing e.g.
 			//   "layout(triangles) in;"
@@ -92,6 +100,10 @@ namespace OpenGLRenderer
 			// Set the number of output vertices
 			glProgramParameteriARB(mOpenGLProgram, GL_GEOMETRY_VERTICES_OUT_ARB, static_cast<GLint>(geometryShaderMonolithic->getNumberOfOutputVertices()));
 
+			// The OpenGL geometry shader parameters are part of the linked program
+			const GLint geometryShaderParameters[] = { geometryShaderMonolithic->getOpenGLGsInputPrimitiveTopology(), geometryShaderMonolithic->getOpenGLGsOutputPrimitiveTopology(), static_cast<GLint>(geometryShaderMonolithic->getNumberOfOutputVertices()) };
+			programBinaryId = ProgramBinary::hash(geometryShaderParameters, sizeof(geometryShaderParameters), programBinaryId);
+
 			// Release the shader
 			geometryShaderMonolithic->releaseReference();
 		}
@@ -99,6 +111,7 @@ namespace OpenGLRenderer
 		{
 			fragmentShaderMonolithic->addReference();
 			glAttachObjectARB(mOpenGLProgram, fragmentShaderMonolithic->getOpenGLShader());
+			programBinaryId = ProgramBinary::hashOpenGLShader(fragmentShaderMonolithic->getOpenGLShader(), programBinaryId);
 			fragmentShaderMonolithic->releaseReference();
 		}
 
@@ -108,16 +121,33 @@ namespace OpenGLRenderer
 			{
 				glBindAttribLocationARB(mOpenGLProgram, vertexAttribute, vertexAttributes.attributes[vertexAttribute].name);
 			}
+			programBinaryId = ProgramBinary::hashVertexAttributes(vertexAttributes, programBinaryId);
 		}
 
-		// Link the program
-		glLinkProgramARB(mOpenGLProgram);
+		// Try to load the program binary, fall back to linking the program
+		// -> The shaders were already compiled, but linking is usually the expensive part
+		const bool programBinaryLoaded = ProgramBinary::loadProgramBinary(openGLRenderer, mOpenGLProgram, programBinaryId);
+		if (!programBinaryLoaded)
+		{
+			// Link the program
+			if (0 != programBinaryId)
+			{
+				glProgramParameteri(mOpenGLProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+			}
+			glLinkProgramARB(mOpenGLProgram);
+		}
 
 		// Check the link status
 		GLint linked = GL_FALSE;
 		glGetObjectParameterivARB(mOpenGLProgram, GL_OBJECT_LINK_STATUS_ARB, &linked);
 		if (GL_TRUE == linked)
 		{
+			// Store the program binary so the next run doesn't need to link the program
+			if (!programBinaryLoaded)
+			{
+				ProgramBinary::saveProgramBinary(openGLRenderer, mOpenGLProgram, programBinaryId);
+			}
+
 			// We're not using "glBindFragDataLocation()", else the user would have to provide us with additional OpenGL-only specific information
 			// -> Use modern GLSL:
 			//    "layout(location = 0) out vec4 ColorOutput0;"
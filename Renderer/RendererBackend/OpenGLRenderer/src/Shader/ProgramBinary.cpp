@@ -0,0 +1,202 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "OpenGLRenderer/Shader/ProgramBinary.h"
+#include "OpenGLRenderer/OpenGLRuntimeLinking.h"
+#include "OpenGLRenderer/OpenGLRenderer.h"
+#include "OpenGLRenderer/Extensions.h"
+
+#include <Renderer/Buffer/VertexArrayTypes.h>
+#include <Renderer/Shader/IProgramBinaryCache.h>
+
+#include <string.h>	// For "strlen()"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint64_t FNV1a_INITIAL_HASH_64 = 0xcbf29ce484222325u;
+		static const uint64_t FNV1a_MAGIC_PRIME_64  = 0x100000001b3u;
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace OpenGLRenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	uint64_t ProgramBinary::calculateDriverId(const Extensions& extensions)
+	{
+		// "GL_ARB_get_program_binary" is required and the OpenGL implementation must support at least one program binary format (e.g. Mesa exposes the extension without formats)
+		if (extensions.isGL_ARB_get_program_binary())
+		{
+			GLint numberOfProgramBinaryFormats = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberOfProgramBinaryFormats);
+			if (numberOfProgramBinaryFormats > 0)
+			{
+				uint64_t driverId = ::detail::FNV1a_INITIAL_HASH_64;
+				static const GLenum NAMES[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+				for (GLenum name : NAMES)
+				{
+					const char* string = reinterpret_cast<const char*>(glGetString(name));
+					if (nullptr != string)
+					{
+						driverId = hashString(string, driverId);
+					}
+				}
+				return driverId;
+			}
+		}
+
+		// Program binaries are not supported
+		return 0;
+	}
+
+	uint64_t ProgramBinary::getInitialProgramBinaryId(const OpenGLRenderer& openGLRenderer)
+	{
+		return (nullptr != openGLRenderer.getProgramBinaryCache()) ? openGLRenderer.getProgramBinaryDriverId() : 0;
+	}
+
+	uint64_t ProgramBinary::hash(const void* data, uint32_t numberOfBytes, uint64_t programBinaryId)
+	{
+		if (0 != programBinaryId)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			for (const uint8_t* bytesEnd = bytes + numberOfBytes; bytes < bytesEnd; ++bytes)
+			{
+				programBinaryId = (programBinaryId ^ *bytes) * ::detail::FNV1a_MAGIC_PRIME_64;
+			}
+		}
+		return programBinaryId;
+	}
+
+	uint64_t ProgramBinary::hashString(const char* string, uint64_t programBinaryId)
+	{
+		// Include the terminating zero so that e.g. "ab" + "c" and "a" + "bc" result in different identifiers
+		return hash(string, static_cast<uint32_t>(strlen(string) + 1), programBinaryId);
+	}
+
+	uint64_t ProgramBinary::hashVertexAttributes(const Renderer::VertexAttributes& vertexAttributes, uint64_t programBinaryId)
+	{
+		if (0 != programBinaryId)
+		{
+			programBinaryId = hash(&vertexAttributes.numberOfAttributes, sizeof(uint32_t), programBinaryId);
+			for (uint32_t vertexAttribute = 0; vertexAttribute < vertexAttributes.numberOfAttributes; ++vertexAttribute)
+			{
+				programBinaryId = hashString(vertexAttributes.attributes[vertexAttribute].name, programBinaryId);
+			}
+		}
+		return programBinaryId;
+	}
+
+	uint64_t ProgramBinary::hashOpenGLShader(uint32_t openGLShader, uint64_t programBinaryId)
+	{
+		if (0 != programBinaryId && 0 != openGLShader)
+		{
+			// Shader type
+			GLint shaderType = 0;
+			glGetObjectParameterivARB(openGLShader, GL_OBJECT_SUBTYPE_ARB, &shaderType);
+			programBinaryId = hash(&shaderType, sizeof(GLint), programBinaryId);
+
+			// Shader source code (including a null termination)
+			GLint sourceCodeLength = 0;
+			glGetObjectParameterivARB(openGLShader, GL_OBJECT_SHADER_SOURCE_LENGTH_ARB, &sourceCodeLength);
+			if (sourceCodeLength > 1)
+			{
+				char* sourceCode = new char[static_cast<uint32_t>(sourceCodeLength)];
+				glGetShaderSourceARB(openGLShader, sourceCodeLength, nullptr, sourceCode);
+				programBinaryId = hash(sourceCode, static_cast<uint32_t>(sourceCodeLength), programBinaryId);
+				delete [] sourceCode;
+			}
+		}
+		return programBinaryId;
+	}
+
+	bool ProgramBinary::loadProgramBinary(const OpenGLRenderer& openGLRenderer, uint32_t openGLProgram, uint64_t programBinaryId)
+	{
+		if (0 != programBinaryId)
+		{
+			Renderer::IProgramBinaryCache* programBinaryCache = openGLRenderer.getProgramBinaryCache();
+			uint32_t binaryFormat = 0;
+			uint32_t numberOfBytes = 0;
+			const uint8_t* binary = programBinaryCache->getProgramBinary(programBinaryId, binaryFormat, numberOfBytes);
+			if (nullptr != binary && numberOfBytes > 0)
+			{
+				// The OpenGL implementation is allowed to reject a program binary at any time (e.g. after a driver update which didn't change the version string), this isn't an error
+				glProgramBinary(openGLProgram, binaryFormat, binary, static_cast<GLsizei>(numberOfBytes));
+				GLint linked = GL_FALSE;
+				glGetObjectParameterivARB(openGLProgram, GL_OBJECT_LINK_STATUS_ARB, &linked);
+				return (GL_TRUE == linked);
+			}
+		}
+
+		// No program binary available
+		return false;
+	}
+
+	void ProgramBinary::saveProgramBinary(const OpenGLRenderer& openGLRenderer, uint32_t openGLProgram, uint64_t programBinaryId)
+	{
+		if (0 != programBinaryId)
+		{
+			GLint numberOfBytes = 0;
+			glGetObjectParameterivARB(openGLProgram, GL_PROGRAM_BINARY_LENGTH, &numberOfBytes);
+			if (numberOfBytes > 0)
+			{
+				uint8_t* binary = new uint8_t[static_cast<uint32_t>(numberOfBytes)];
+				GLsizei length = 0;
+				GLenum binaryFormat = 0;
+				glGetProgramBinary(openGLProgram, numberOfBytes, &length, &binaryFormat, binary);
+				if (length > 0)
+				{
+					openGLRenderer.getProgramBinaryCache()->setProgramBinary(programBinaryId, binaryFormat, binary, static_cast<uint32_t>(length));
+				}
+				delete [] binary;
+			}
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // OpenGLRenderer
@@ -45,7 +45,7 @@ namespace OpenGLRenderer
 
 	FragmentShaderSeparate::FragmentShaderSeparate(OpenGLRenderer &openGLRenderer, const char *sourceCode) :
 		IFragmentShader(reinterpret_cast<Renderer::IRenderer&>(openGLRenderer)),
-		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShader(GL_FRAGMENT_SHADER_ARB, sourceCode))
+		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShader(openGLRenderer, GL_FRAGMENT_SHADER_ARB, sourceCode))
 	{
 		// Nothing here
 	}
@@ -29,10 +29,14 @@
 #include "OpenGLRenderer/Shader/Separate/FragmentShaderSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/TessellationControlShaderSeparate.h"
 #include "OpenGLRenderer/Shader/Separate/TessellationEvaluationShaderSeparate.h"
+#include "OpenGLRenderer/Shader/Monolithic/ShaderLanguageMonolithic.h"
+#include "OpenGLRenderer/Shader/ProgramBinary.h"
 #include "OpenGLRenderer/IContext.h"
 #include "OpenGLRenderer/Extensions.h"
 #include "OpenGLRenderer/OpenGLRenderer.h"
 
+#include <Renderer/Buffer/VertexArrayTypes.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -50,16 +54,77 @@ namespace OpenGLRenderer
 	//[-------------------------------------------------------]
 	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
-	uint32_t ShaderLanguageSeparate::loadShader(uint32_t shaderType, const char *sourceCode)
+	uint32_t ShaderLanguageSeparate::loadShader(const OpenGLRenderer& openGLRenderer, uint32_t shaderType, const char *sourceCode, const Renderer::VertexAttributes* vertexAttributes)
 	{
+		// Calculate the program binary identifier, 0 if program binaries are not used
+		uint64_t programBinaryId = ProgramBinary::getInitialProgramBinaryId(openGLRenderer);
+		programBinaryId = ProgramBinary::hash(&shaderType, sizeof(uint32_t), programBinaryId);
+		programBinaryId = ProgramBinary::hashString(sourceCode, programBinaryId);
+		if (nullptr != vertexAttributes)
+		{
+			programBinaryId = ProgramBinary::hashVertexAttributes(*vertexAttributes, programBinaryId);
+		}
+
 		// Create the shader program
-		const GLuint openGLProgram = glCreateShaderProgramv(shaderType, 1, &sourceCode);
+		GLuint openGLProgram = 0;
+		bool saveProgramBinary = false;
+		if (0 == programBinaryId && nullptr == vertexAttributes)
+		{
+			// "glCreateShaderProgramv()" does the whole job at once
+			openGLProgram = glCreateShaderProgramv(shaderType, 1, &sourceCode);
+		}
+		else
+		{
+			// "glCreateShaderProgramv()" can neither define vertex array attribute binding locations nor request a retrievable program binary
+			openGLProgram = glCreateProgramObjectARB();
+			glProgramParameteri(openGLProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
+
+			// Try to load the program binary, fall back to compiling and linking the shader source code
+			if (!ProgramBinary::loadProgramBinary(openGLRenderer, openGLProgram, programBinaryId))
+			{
+				// Basing on the implementation from https://www.opengl.org/registry/specs/ARB/separate_shader_objects.txt
+				const GLuint openGLShader = ShaderLanguageMonolithic::loadShader(shaderType, sourceCode);
+				if (openGLShader > 0)
+				{
+					// Attach the shader to the program
+					glAttachObjectARB(openGLProgram, openGLShader);
+
+					// Define the vertex array attribute binding locations ("vertex declaration" in Direct3D 9 terminology, "input layout" in Direct3D 10 & 11 & 12 terminology)
+					if (nullptr != vertexAttributes)
+					{
+						const uint32_t numberOfVertexAttributes = vertexAttributes->numberOfAttributes;
+						for (uint32_t vertexAttribute = 0; vertexAttribute < numberOfVertexAttributes; ++vertexAttribute)
+						{
+							glBindAttribLocationARB(openGLProgram, vertexAttribute, vertexAttributes->attributes[vertexAttribute].name);
+						}
+					}
+
+					// Link the program
+					if (0 != programBinaryId)
+					{
+						glProgramParameteri(openGLProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+						saveProgramBinary = true;
+					}
+					glLinkProgramARB(openGLProgram);
+
+					// Detach and destroy the shader
+					glDetachObjectARB(openGLProgram, openGLShader);
+					glDeleteObjectARB(openGLShader);
+				}
+			}
+		}
 
 		// Check the link status
 		GLint linked = GL_FALSE;
 		glGetObjectParameterivARB(openGLProgram, GL_LINK_STATUS, &linked);
 		if (GL_TRUE == linked)
 		{
+			// Store the program binary so the next run doesn't need to compile and link the shader source code
+			if (saveProgramBinary)
+			{
+				ProgramBinary::saveProgramBinary(openGLRenderer, openGLProgram, programBinaryId);
+			}
+
 			// All went fine, return the program
 			return openGLProgram;
 		}
@@ -45,7 +45,7 @@ namespace OpenGLRenderer
 
 	TessellationControlShaderSeparate::TessellationControlShaderSeparate(OpenGLRenderer &openGLRenderer, const char *sourceCode) :
 		ITessellationControlShader(reinterpret_cast<Renderer::IRenderer&>(openGLRenderer)),
-		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShader(GL_TESS_CONTROL_SHADER, sourceCode))
+		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShader(openGLRenderer, GL_TESS_CONTROL_SHADER, sourceCode))
 	{
 		// Nothing here
 	}
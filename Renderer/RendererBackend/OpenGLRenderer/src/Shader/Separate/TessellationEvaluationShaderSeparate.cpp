@@ -45,7 +45,7 @@ namespace OpenGLRenderer
 
 	TessellationEvaluationShaderSeparate::TessellationEvaluationShaderSeparate(OpenGLRenderer &openGLRenderer, const char *sourceCode) :
 		ITessellationEvaluationShader(reinterpret_cast<Renderer::IRenderer&>(openGLRenderer)),
-		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShader(GL_TESS_EVALUATION_SHADER, sourceCode))
+		mOpenGLShaderProgram(ShaderLanguageSeparate::loadShader(openGLRenderer, GL_TESS_EVALUATION_SHADER, sourceCode))
 	{
 		// Nothing here
 	}
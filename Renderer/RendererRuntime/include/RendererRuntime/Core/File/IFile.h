@@ -88,6 +88,49 @@ namespace RendererRuntime
 		*/
 		virtual void skip(size_t numberOfBytes) = 0;
 
+		/**
+		*  @brief
+		*    Write a requested number of bytes into the file
+		*
+		*  @param[in] sourceBuffer
+		*    Source buffer to read from, must be at least "numberOfBytes" long, never ever a null pointer
+		*  @param[in] numberOfBytes
+		*    Number of bytes to write into the file
+		*
+		*  @note
+		*    - Only valid for files created by "RendererRuntime::IFileManager::createFile()"
+		*/
+		virtual void write(const void* sourceBuffer, size_t numberOfBytes) = 0;
+
+		/**
+		*  @brief
+		*    Return whether or not the file supports read-only views, an optional zero-copy alternative to "read()"
+		*
+		*  @return
+		*    "true" if "RendererRuntime::IFile::readView()" is supported, else "false"
+		*
+		*  @note
+		*    - The default implementation returns "false"
+		*/
+		inline virtual bool supportsViews() const;
+
+		/**
+		*  @brief
+		*    Return a read-only view of a requested number of bytes and skip them
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to view, it's the callers responsibility that this number of byte is correct
+		*
+		*  @return
+		*    Read-only view of "numberOfBytes" bytes, null pointer if the file doesn't support views (the file position is left untouched in this case, use "read()" instead)
+		*
+		*  @note
+		*    - Only valid for files opened by "RendererRuntime::IFileManager::openFile()"
+		*    - The view stays valid until the file is closed, the resource streamer keeps a file supporting views open until the resource loader has been dispatched
+		*    - The default implementation returns a null pointer
+		*/
+		inline virtual const uint8_t* readView(size_t numberOfBytes);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -25,6 +25,22 @@ namespace RendererRuntime
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererRuntime::IFile methods         ]
+	//[-------------------------------------------------------]
+	inline bool IFile::supportsViews() const
+	{
+		// Default implementation: Views aren't supported
+		return false;
+	}
+
+	inline const uint8_t* IFile::readView(size_t)
+	{
+		// Default implementation: Views aren't supported
+		return nullptr;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
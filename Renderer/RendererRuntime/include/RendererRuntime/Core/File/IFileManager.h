@@ -73,6 +73,21 @@ namespace RendererRuntime
 		*/
 		virtual IFile* openFile(const char* filename) = 0;
 
+		/**
+		*  @brief
+		*    Create a file
+		*
+		*  @param[in] filename
+		*    ASCII name of the file to create for writing, never ever a null pointer and always finished by a terminating zero, an already existing file is overwritten
+		*
+		*  @return
+		*    The file interface, can be a null pointer if the file can't be created (e.g. read-only file system)
+		*
+		*  @note
+		*    - Used by the renderer runtime to persist caches, not for assets
+		*/
+		virtual IFile* createFile(const char* filename) = 0;
+
 		/**
 		*  @brief
 		*    Close a file
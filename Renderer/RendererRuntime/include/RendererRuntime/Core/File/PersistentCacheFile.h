@@ -0,0 +1,214 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <atomic>
+#include <string>
+#include <vector>
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+	class IFile;
+	class IFileManager;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Persistent cache file, a checksummed file a cache filled during runtime is written back to so the next run can start with it
+	*
+	*  @remarks
+	*    Persistent cache file content:
+	*    - Persistent cache file header, see "RendererRuntime::PersistentCacheFile::Header"
+	*    - Format specific header
+	*    - Format specific payload
+	*    The FNV-1a checksum inside the persistent cache file header is calculated across the format specific header and payload,
+	*    files with an unknown format or which are truncated or corrupted are rejected as a whole.
+	*
+	*    Cache changes are counted. "RendererRuntime::PersistentCacheFile::isWriteBackDue()" is meant to be called once per update
+	*    and reports a due write back as soon as the number of changes didn't increase since the previous update.
+	*
+	*  @note
+	*    - Only the change counter is thread safe, the owner has to guard everything else
+	*/
+	class PersistentCacheFile
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		#pragma pack(push)
+		#pragma pack(1)
+			struct Header
+			{
+				uint32_t formatType;
+				uint16_t formatVersion;
+				uint32_t numberOfBytes;		///< Number of bytes following this header, format specific header and payload
+				uint32_t checksum;			///< FNV-1a hash of the format specific header and payload
+			};
+		#pragma pack(pop)
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline PersistentCacheFile(IFileManager& fileManager, uint32_t formatType, uint16_t formatVersion);
+		inline ~PersistentCacheFile();
+
+		//[-------------------------------------------------------]
+		//[ File                                                  ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Open the persistent cache file for reading and remember the filename for write back
+		*
+		*  @param[in] filename
+		*    ASCII filename of the persistent cache file, must be valid
+		*
+		*  @return
+		*    The file, null pointer if there's no such file, close it by using "RendererRuntime::PersistentCacheFile::closeFile()"
+		*/
+		IFile* openFile(const char* filename);
+
+		/**
+		*  @brief
+		*    Create the persistent cache file for write back, if there are unsaved changes
+		*
+		*  @return
+		*    The file, null pointer if there's nothing to write back, close it by using "RendererRuntime::PersistentCacheFile::closeFile()"
+		*
+		*  @note
+		*    - If the file can't be created, write back gets disabled
+		*/
+		IFile* createFileForWriteBack();
+
+		void closeFile(IFile& file) const;
+
+		//[-------------------------------------------------------]
+		//[ Content                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Read and validate the persistent cache file content
+		*
+		*  @param[in] file
+		*    File to read from
+		*  @param[out] formatHeader
+		*    Receives the format specific header, only valid if "true" is returned
+		*  @param[in] numberOfFormatHeaderBytes
+		*    Number of format specific header bytes
+		*  @param[out] payload
+		*    Receives the format specific payload, only valid if "true" is returned
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (unknown format, truncated or corrupted file)
+		*/
+		bool read(IFile& file, void* formatHeader, uint32_t numberOfFormatHeaderBytes, std::vector<uint8_t>& payload) const;
+
+		/**
+		*  @brief
+		*    Write the persistent cache file content, the cache is in sync with the file afterwards
+		*
+		*  @param[in] file
+		*    File to write to
+		*  @param[in] formatHeader
+		*    Format specific header
+		*  @param[in] numberOfFormatHeaderBytes
+		*    Number of format specific header bytes
+		*  @param[in] payload
+		*    Format specific payload
+		*/
+		void write(IFile& file, const void* formatHeader, uint32_t numberOfFormatHeaderBytes, const std::vector<uint8_t>& payload);
+
+		//[-------------------------------------------------------]
+		//[ Changes                                               ]
+		//[-------------------------------------------------------]
+		inline void addChange();
+		inline void setInSync();
+		inline bool isDirty() const;
+
+		/**
+		*  @brief
+		*    Return whether or not the cache should be written back now, call this method once per update
+		*
+		*  @return
+		*    "true" if there are unsaved changes and no new changes have been made since the previous update, else "false"
+		*/
+		bool isWriteBackDue();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		PersistentCacheFile(const PersistentCacheFile&) = delete;
+		PersistentCacheFile& operator=(const PersistentCacheFile&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		IFileManager&		  mFileManager;
+		uint32_t			  mFormatType;
+		uint16_t			  mFormatVersion;
+		std::string			  mFilename;					///< Persistent cache filename, empty if there's no write back
+		std::atomic<uint32_t> mNumberOfChanges;				///< Number of cache changes since the cache was last in sync with the file
+		uint32_t			  mNumberOfChangesAtLastUpdate;	///< Number of cache changes seen by the previous "RendererRuntime::PersistentCacheFile::isWriteBackDue()" call
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/File/PersistentCacheFile.inl"
@@ -0,0 +1,148 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Math/Math.h"
+
+#include <vector>
+
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4251)	// warning C4251: "needs to have dll-interface to be used by clients of class "
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Batched frustum culler
+	*
+	*  @remarks
+	*    World space bounding spheres are gathered into a structure of arrays (SoA) layout and then tested in one go against the six frustum
+	*    planes, four bounding spheres at a time. SSE2 and NEON are used when available, else a scalar fallback is used.
+	*
+	*    Usage example:
+	*    @code
+	*    frustumCuller.setWorldSpaceToClipSpaceMatrix(worldSpaceToClipSpaceMatrix);
+	*    frustumCuller.clearBoundingSpheres();
+	*    const uint32_t index = frustumCuller.addBoundingSphere(worldSpacePosition, radius);
+	*    frustumCuller.cullBoundingSpheres();
+	*    if (frustumCuller.isBoundingSphereVisible(index)) ...
+	*    @endcode
+	*/
+	class RENDERERRUNTIME_API_EXPORT FrustumCuller
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline FrustumCuller();
+		inline ~FrustumCuller();
+
+		/**
+		*  @brief
+		*    Set the frustum by extracting the frustum planes from a world space to clip space matrix
+		*
+		*  @param[in] worldSpaceToClipSpaceMatrix
+		*    World space to clip space matrix (also known as view projection matrix)
+		*
+		*  @note
+		*    - The near plane is extracted for a clip space depth range of [-1, 1], for a depth range of [0, 1] this is slightly conservative
+		*/
+		void setWorldSpaceToClipSpaceMatrix(const glm::mat4& worldSpaceToClipSpaceMatrix);
+
+		//[-------------------------------------------------------]
+		//[ Bounding spheres                                      ]
+		//[-------------------------------------------------------]
+		inline uint32_t getNumberOfBoundingSpheres() const;
+		inline void clearBoundingSpheres();	// Keeps the allocated memory
+		inline uint32_t addBoundingSphere(const glm::vec3& worldSpacePosition, float radius);	// Returns the bounding sphere index
+
+		/**
+		*  @brief
+		*    Test all added bounding spheres against the frustum
+		*
+		*  @return
+		*    The number of visible bounding spheres
+		*/
+		uint32_t cullBoundingSpheres();
+
+		inline bool isBoundingSphereVisible(uint32_t index) const;	// Only valid after "RendererRuntime::FrustumCuller::cullBoundingSpheres()" has been called
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const uint32_t NUMBER_OF_PLANES = 6;
+		static const uint32_t BATCH_SIZE	   = 4;	///< Number of bounding spheres tested at once, the SoA arrays are padded to a multiple of this
+		typedef std::vector<float>	 Floats;
+		typedef std::vector<uint8_t> VisibilityFlags;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		float			mPlanes[NUMBER_OF_PLANES][4];	///< Normalized frustum planes (xyz = normal pointing inside the frustum, w = distance), left, right, bottom, top, near, far
+		uint32_t		mNumberOfBoundingSpheres;
+		Floats			mPositionsX;					///< World space bounding sphere x position, SoA
+		Floats			mPositionsY;					///< World space bounding sphere y position, SoA
+		Floats			mPositionsZ;					///< World space bounding sphere z position, SoA
+		Floats			mRadii;							///< World space bounding sphere radius, SoA
+		VisibilityFlags	mVisibilityFlags;				///< Per bounding sphere visibility, set by "RendererRuntime::FrustumCuller::cullBoundingSpheres()"
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Math/FrustumCuller.inl"
+
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_POP
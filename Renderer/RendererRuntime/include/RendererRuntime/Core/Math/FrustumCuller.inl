@@ -0,0 +1,86 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <cassert>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	inline FrustumCuller::FrustumCuller() :
+		mNumberOfBoundingSpheres(0)
+	{
+		// Everything is visible until a world space to clip space matrix is set
+		for (uint32_t i = 0; i < NUMBER_OF_PLANES; ++i)
+		{
+			mPlanes[i][0] = mPlanes[i][1] = mPlanes[i][2] = 0.0f;
+			mPlanes[i][3] = 1.0f;
+		}
+	}
+
+	inline FrustumCuller::~FrustumCuller()
+	{
+		// Nothing here
+	}
+
+	inline uint32_t FrustumCuller::getNumberOfBoundingSpheres() const
+	{
+		return mNumberOfBoundingSpheres;
+	}
+
+	inline void FrustumCuller::clearBoundingSpheres()
+	{
+		mNumberOfBoundingSpheres = 0;
+		mPositionsX.clear();
+		mPositionsY.clear();
+		mPositionsZ.clear();
+		mRadii.clear();
+	}
+
+	inline uint32_t FrustumCuller::addBoundingSphere(const glm::vec3& worldSpacePosition, float radius)
+	{
+		mPositionsX.push_back(worldSpacePosition.x);
+		mPositionsY.push_back(worldSpacePosition.y);
+		mPositionsZ.push_back(worldSpacePosition.z);
+		mRadii.push_back(radius);
+		return mNumberOfBoundingSpheres++;
+	}
+
+	inline bool FrustumCuller::isBoundingSphereVisible(uint32_t index) const
+	{
+		assert(index < mNumberOfBoundingSpheres && index < mVisibilityFlags.size());
+		return (0 != mVisibilityFlags[index]);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
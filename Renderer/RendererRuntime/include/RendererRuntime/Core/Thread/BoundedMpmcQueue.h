@@ -0,0 +1,120 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/NonCopyable.h"
+
+#include <atomic>
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Lock-free bounded multiple producer multiple consumer FIFO queue template
+	*
+	*  @remarks
+	*    Each cell carries a sequence number telling producers and consumers whether or not the cell is ready for them. A producer
+	*    or consumer claims a cell by advancing the enqueue or dequeue position, there's no shared lock and no dynamic memory allocation.
+	*    Elements pushed by one and the same producer thread are popped in the order they were pushed.
+	*
+	*  @note
+	*    - Basing on "Bounded MPMC queue" by Dmitry Vyukov ( http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue )
+	*    - Fixed capacity ring buffer, the element type must be trivially copyable
+	*    - "push()" and "pop()" can be called by any thread
+	*/
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	class BoundedMpmcQueue : private NonCopyable
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline BoundedMpmcQueue();
+		inline ~BoundedMpmcQueue();
+		inline uint32_t getApproximateNumberOfElements() const;
+		inline bool push(const ELEMENT_TYPE& element);	// Returns "false" if the queue is full
+		inline bool pop(ELEMENT_TYPE& element);			// Returns "false" if the queue is empty, "element" is left untouched in this case
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+		BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static_assert(0 == (CAPACITY & (CAPACITY - 1)) && CAPACITY >= 2, "The bounded MPMC queue capacity must be a power of two and at least two");
+		static const uint64_t INDEX_MASK = static_cast<uint64_t>(CAPACITY) - 1;
+
+		struct Cell
+		{
+			std::atomic<uint64_t> sequence;
+			ELEMENT_TYPE		  element;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::atomic<uint64_t> mEnqueuePosition;	///< Position the next producer is going to claim
+		uint8_t				  mEnqueuePadding[64 - sizeof(std::atomic<uint64_t>)];	///< Keep the enqueue and dequeue positions on different cache lines to avoid false sharing
+		std::atomic<uint64_t> mDequeuePosition;	///< Position the next consumer is going to claim
+		uint8_t				  mDequeuePadding[64 - sizeof(std::atomic<uint64_t>)];	///< Keep the dequeue position and the cells on different cache lines to avoid false sharing
+		Cell				  mCells[CAPACITY];
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Thread/BoundedMpmcQueue.inl"
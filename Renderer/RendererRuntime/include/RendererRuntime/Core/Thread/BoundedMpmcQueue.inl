@@ -0,0 +1,123 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline BoundedMpmcQueue<ELEMENT_TYPE, CAPACITY>::BoundedMpmcQueue() :
+		mEnqueuePosition(0),
+		mDequeuePosition(0)
+	{
+		for (uint32_t i = 0; i < CAPACITY; ++i)
+		{
+			mCells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline BoundedMpmcQueue<ELEMENT_TYPE, CAPACITY>::~BoundedMpmcQueue()
+	{
+		// Nothing here
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline uint32_t BoundedMpmcQueue<ELEMENT_TYPE, CAPACITY>::getApproximateNumberOfElements() const
+	{
+		const uint64_t enqueuePosition = mEnqueuePosition.load(std::memory_order_relaxed);
+		const uint64_t dequeuePosition = mDequeuePosition.load(std::memory_order_relaxed);
+		return (enqueuePosition > dequeuePosition) ? static_cast<uint32_t>(enqueuePosition - dequeuePosition) : 0u;
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline bool BoundedMpmcQueue<ELEMENT_TYPE, CAPACITY>::push(const ELEMENT_TYPE& element)
+	{
+		uint64_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Cell& cell = mCells[position & INDEX_MASK];
+			const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const int64_t difference = static_cast<int64_t>(sequence - position);
+			if (0 == difference)
+			{
+				// The cell is free, try to claim it
+				if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell.element = element;
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				// The queue is full
+				return false;
+			}
+			else
+			{
+				// Another producer was faster, try again with the current position
+				position = mEnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline bool BoundedMpmcQueue<ELEMENT_TYPE, CAPACITY>::pop(ELEMENT_TYPE& element)
+	{
+		uint64_t position = mDequeuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Cell& cell = mCells[position & INDEX_MASK];
+			const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const int64_t difference = static_cast<int64_t>(sequence - (position + 1));
+			if (0 == difference)
+			{
+				// The cell is filled, try to claim it
+				if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					element = cell.element;
+					cell.sequence.store(position + CAPACITY, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				// The queue is empty
+				return false;
+			}
+			else
+			{
+				// Another consumer was faster, try again with the current position
+				position = mDequeuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
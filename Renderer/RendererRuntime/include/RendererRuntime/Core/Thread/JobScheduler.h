@@ -0,0 +1,346 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Export.h"
+#include "RendererRuntime/Core/Manager.h"
+#include "RendererRuntime/Core/GetUninitialized.h"
+#include "RendererRuntime/Core/Thread/WorkStealingQueue.h"
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Job counter used as job handle
+	*
+	*  @remarks
+	*    Every job added to the job scheduler together with a job counter increments the counter, finished jobs decrement it. So, the
+	*    job counter reaches zero as soon as all jobs associated with it are done. Use "RendererRuntime::JobScheduler::waitForCounter()"
+	*    in order to wait for the jobs while helping to execute pending jobs.
+	*/
+	class JobCounter : private NonCopyable
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class JobScheduler;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline JobCounter();
+		inline ~JobCounter();
+		inline uint32_t getNumberOfPendingJobs() const;
+		inline bool isDone() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::atomic<uint32_t> mNumberOfPendingJobs;
+
+
+	};
+
+	/**
+	*  @brief
+	*    Persistent work stealing job scheduler
+	*
+	*  @remarks
+	*    The job scheduler creates one worker thread per hardware thread (minus the thread creating the job scheduler which is assumed
+	*    to be the main thread which also takes part in job execution while waiting). Each worker thread owns a lock-free work stealing
+	*    queue: Jobs added by a worker thread are pushed onto its own queue and are executed in LIFO order by the owner, idle worker
+	*    threads steal jobs from the other queues in FIFO order. Threads not owned by the job scheduler (e.g. the main thread or
+	*    resource streamer threads) push their jobs into a shared queue which is drained by the worker threads.
+	*
+	*    Jobs can add further jobs (nested work) and wait for them via "RendererRuntime::JobScheduler::waitForCounter()" without
+	*    blocking a worker thread: The waiting thread executes pending jobs until the job counter reaches zero ("wait-while-helping").
+	*
+	*    Usage example:
+	*    // Worker function
+	*    void updateItems(void* userData, uint32_t firstIndex, uint32_t numberOfIndices)
+	*    {
+	*        Item* items = static_cast<Item*>(userData);
+	*        for (uint32_t i = firstIndex; i < firstIndex + numberOfIndices; ++i)
+	*        {
+	*            // ... do work with "items[i]"...
+	*        }
+	*    }
+	*
+	*    // Data parallel processing of the items, each job is processing at least 64 items
+	*    JobScheduler& jobScheduler = rendererRuntime.getThreadManager().getJobScheduler();
+	*    JobCounter jobCounter;
+	*    jobScheduler.parallelFor(&updateItems, items.data(), static_cast<uint32_t>(items.size()), 64, jobCounter);
+	*    jobScheduler.waitForCounter(jobCounter);
+	*
+	*  @note
+	*    - Jobs are plain function pointers with user data, there's no dynamic memory allocation when adding jobs from worker threads
+	*    - Jobs must not block on anything else than "RendererRuntime::JobScheduler::waitForCounter()"
+	*    - Basing on "Job System 2.0: Lock-Free Work Stealing" by Stefan Reinalter ( https://blog.molecular-matters.com/2015/08/24/job-system-2-0-lock-free-work-stealing-part-1-basics/ )
+	*      and "Parallelizing the Naughty Dog engine using fibers" by Christian Gyrling (GDC 2015) minus the fibers
+	*/
+	class JobScheduler : private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class ThreadManager;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Job function
+		*
+		*  @param[in] userData
+		*    User data given when adding the job, can be a null pointer
+		*  @param[in] firstIndex
+		*    First index of the range the job is responsible for (for single jobs the given first index, usually zero)
+		*  @param[in] numberOfIndices
+		*    Number of indices of the range the job is responsible for (for single jobs the given number of indices, usually one)
+		*/
+		typedef void (*JobFunction)(void* userData, uint32_t firstIndex, uint32_t numberOfIndices);
+
+		static const uint32_t MAXIMUM_NUMBER_OF_JOBS_PER_THREAD = 4096;	///< Maximum number of jobs a single worker thread can have in flight at one and the same time, must be a power of two
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the number of worker threads
+		*
+		*  @return
+		*    The number of worker threads, does not include threads helping out while waiting for job counters
+		*/
+		inline uint32_t getNumberOfWorkerThreads() const;
+
+		/**
+		*  @brief
+		*    Set the number of worker threads
+		*
+		*  @param[in] numberOfWorkerThreads
+		*    Number of worker threads to use, at least one worker thread is used
+		*
+		*  @note
+		*    - Not thread safe, must be called by a thread which isn't a worker thread of this job scheduler while there are no jobs in flight
+		*/
+		RENDERERRUNTIME_API_EXPORT void setNumberOfWorkerThreads(uint32_t numberOfWorkerThreads);
+
+		/**
+		*  @brief
+		*    Return whether or not the calling thread is a worker thread of this job scheduler
+		*
+		*  @return
+		*    "true" if the calling thread is a worker thread of this job scheduler, else "false"
+		*/
+		RENDERERRUNTIME_API_EXPORT bool isWorkerThread() const;
+
+		/**
+		*  @brief
+		*    Add a job
+		*
+		*  @param[in] jobFunction
+		*    Job function to execute, must be valid
+		*  @param[in] userData
+		*    User data to pass to the job function, can be a null pointer, must stay valid until the job has been executed
+		*  @param[in] jobCounter
+		*    Optional job counter which is incremented now and decremented as soon as the job has been executed, can be a null pointer, must stay valid until the job has been executed
+		*  @param[in] firstIndex
+		*    First index to pass to the job function
+		*  @param[in] numberOfIndices
+		*    Number of indices to pass to the job function
+		*
+		*  @note
+		*    - Thread safe, can be called from any thread including jobs themselves
+		*/
+		RENDERERRUNTIME_API_EXPORT void addJob(JobFunction jobFunction, void* userData, JobCounter* jobCounter, uint32_t firstIndex = 0, uint32_t numberOfIndices = 1);
+
+		/**
+		*  @brief
+		*    Split a range of indices into multiple jobs
+		*
+		*  @param[in] jobFunction
+		*    Job function to execute, must be valid
+		*  @param[in] userData
+		*    User data to pass to the job function, can be a null pointer, must stay valid until all jobs have been executed
+		*  @param[in] numberOfIndices
+		*    Total number of indices to process
+		*  @param[in] minimumNumberOfIndicesPerJob
+		*    Minimum number of indices a single job is processing, used to avoid job granularity which is too fine grained, zero is treated as one
+		*  @param[in] jobCounter
+		*    Job counter which is incremented by the number of added jobs, must stay valid until all jobs have been executed
+		*
+		*  @return
+		*    The number of added jobs
+		*/
+		RENDERERRUNTIME_API_EXPORT uint32_t parallelFor(JobFunction jobFunction, void* userData, uint32_t numberOfIndices, uint32_t minimumNumberOfIndicesPerJob, JobCounter& jobCounter);
+
+		/**
+		*  @brief
+		*    Wait until the given job counter reaches zero while helping to execute pending jobs
+		*
+		*  @param[in] jobCounter
+		*    Job counter to wait for
+		*
+		*  @note
+		*    - Thread safe, can be called from any thread including jobs themselves
+		*/
+		RENDERERRUNTIME_API_EXPORT void waitForCounter(const JobCounter& jobCounter);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Job
+		{
+			JobFunction jobFunction;
+			void*		userData;
+			JobCounter*	jobCounter;
+			uint32_t	firstIndex;
+			uint32_t	numberOfIndices;
+		};
+		typedef std::deque<Job> Jobs;
+
+		struct Worker : private NonCopyable
+		{
+			JobScheduler&	jobScheduler;
+			uint32_t		workerIndex;
+			uint32_t		randomState;	///< Used for picking the stealing victim
+			uint32_t		nextJobIndex;	///< Next free job inside the job pool, the job pool is used as ring buffer
+			Job				jobPool[MAXIMUM_NUMBER_OF_JOBS_PER_THREAD];
+			std::atomic<bool> jobPoolSlotInUse[MAXIMUM_NUMBER_OF_JOBS_PER_THREAD];	///< A job pool slot is in use as long as the job is inside the work stealing queue
+			WorkStealingQueue<Job, MAXIMUM_NUMBER_OF_JOBS_PER_THREAD> workStealingQueue;
+			std::thread		thread;
+
+			Worker(JobScheduler& _jobScheduler, uint32_t _workerIndex) :
+				jobScheduler(_jobScheduler),
+				workerIndex(_workerIndex),
+				randomState(_workerIndex * 2654435761u + 1u),
+				nextJobIndex(0)
+			{
+				for (uint32_t i = 0; i < MAXIMUM_NUMBER_OF_JOBS_PER_THREAD; ++i)
+				{
+					jobPoolSlotInUse[i].store(false, std::memory_order_relaxed);
+				}
+			}
+		};
+		typedef std::vector<Worker*> Workers;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] numberOfWorkerThreads
+		*    Number of worker threads to create, uninitialized means to use as many threads as there are hardware threads on the system minus one for the main thread
+		*/
+		RENDERERRUNTIME_API_EXPORT explicit JobScheduler(uint32_t numberOfWorkerThreads = getUninitialized<uint32_t>());
+		RENDERERRUNTIME_API_EXPORT ~JobScheduler();
+		JobScheduler(const JobScheduler&) = delete;
+		JobScheduler& operator=(const JobScheduler&) = delete;
+		void startWorkerThreads(uint32_t numberOfWorkerThreads);
+		void stopWorkerThreads();
+		Worker* getCurrentWorker() const;
+		void pushJob(Worker* worker, const Job& job);
+		void notifyNewJobs(uint32_t numberOfNewJobs);
+		bool tryGetJob(Worker* worker, Job& job);
+		bool tryExecuteJob(Worker* worker);
+		void workerThreadWorker(Worker* worker);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Workers					mWorkers;
+		std::atomic<bool>		mShutdownWorkerThreads;
+		std::atomic<uint32_t>	mNumberOfQueuedJobs;	///< Number of jobs waiting for execution, used to let worker threads sleep when there's nothing to do
+		std::atomic<uint32_t>	mNumberOfSleepingWorkerThreads;
+		std::mutex				mSleepMutex;
+		std::condition_variable	mSleepConditionVariable;
+		// Jobs added by threads which aren't worker threads of this job scheduler
+		std::atomic<uint32_t>	mNumberOfExternalJobs;	///< Used to avoid locking the external jobs mutex if there are no external jobs
+		std::mutex				mExternalJobsMutex;
+		Jobs					mExternalJobs;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Thread/JobScheduler.inl"
@@ -0,0 +1,72 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <cassert>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public JobCounter methods                             ]
+	//[-------------------------------------------------------]
+	inline JobCounter::JobCounter() :
+		mNumberOfPendingJobs(0)
+	{
+		// Nothing here
+	}
+
+	inline JobCounter::~JobCounter()
+	{
+		// Sanity check
+		assert(0 == mNumberOfPendingJobs && "Destroying a job counter while there are still pending jobs referencing it is a horrible idea");
+	}
+
+	inline uint32_t JobCounter::getNumberOfPendingJobs() const
+	{
+		return mNumberOfPendingJobs.load(std::memory_order_acquire);
+	}
+
+	inline bool JobCounter::isDone() const
+	{
+		return (0 == mNumberOfPendingJobs.load(std::memory_order_acquire));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public JobScheduler methods                           ]
+	//[-------------------------------------------------------]
+	inline uint32_t JobScheduler::getNumberOfWorkerThreads() const
+	{
+		return static_cast<uint32_t>(mWorkers.size());
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
@@ -28,7 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Core/Manager.h"
-#include "RendererRuntime/Core/Thread/ThreadPool.h"
+#include "RendererRuntime/Core/Thread/JobScheduler.h"
 
 
 //[-------------------------------------------------------]
@@ -46,43 +46,14 @@ namespace RendererRuntime
 	*    Thread manager
 	*
 	*  @remarks
-	*    The data parallel thread pool is handy for situations were data can be processed in parallel (not task parallel). Example use-cases:
+	*    The thread manager is the execution backbone of the renderer runtime. It owns a persistent work stealing job scheduler
+	*    with one worker thread per hardware thread, so there's no thread creation and destruction each tick. The job scheduler
+	*    is handy for situations were data can be processed in parallel as well as for task parallel work. Example use-cases:
 	*    - Frustum culling
 	*    - Animation update
 	*    - Particles update
 	*
-	*    Usage example: TODO(co) Streamline by using e.g. a template
-	*    // Items which are going to be data-parallel-processed
-	*    typedef std::vector<Item> Items;
-	*    Items items;
-	*
-	*    // Worker function
-	*    void updateItem(Items::iterator start, Items::iterator end)
-	*    {
-	*        while (start != end)
-	*        {
-	*            // ... do work...
-	*            ++start;
-	*        }
-	*    }
-	*
-	*    // Setup calculation threads
-	*    ThreadPool<void>& threadPool = ... get thread pool instance...
-	*    size_t itemCount = items.size();
-	*    size_t splitCount = 1;	// Package size for each thread to work on (will change when maximum number of threads is reached)
-	*    const size_t threadCount = threadPool.getThreadCountAndSplitCount(itemCount, splitCount);
-	*    Items::iterator startIterator = items.begin();
-	*    Items::iterator endIterator = items.end();
-	*    for (size_t i = 0; i < threadCount; ++i)
-	*    {
-	*        const size_t numberOfItemsToProcess = (i >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-	*        threadPool.queueTask(std::bind(updateItem, startIterator, startIterator + numberOfItemsToProcess));
-	*        itemCount -= splitCount;
-	*        startIterator += splitCount;
-	*    }
-	*
-	*    // Wait that all worker threads have done their part of the calculation
-	*    threadPool.process();
+	*    See "RendererRuntime::JobScheduler" for an usage example.
 	*/
 	class ThreadManager : private Manager
 	{
@@ -98,7 +69,7 @@ namespace RendererRuntime
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	public:
-		inline ThreadPool<void>& getDataParallelThreadPool();
+		inline JobScheduler& getJobScheduler();
 
 
 	//[-------------------------------------------------------]
@@ -115,7 +86,7 @@ namespace RendererRuntime
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ThreadPool<void> mDataParallelThreadPool;
+		JobScheduler mJobScheduler;
 
 
 	};
@@ -28,9 +28,9 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	inline ThreadPool<void>& ThreadManager::getDataParallelThreadPool()
+	inline JobScheduler& ThreadManager::getJobScheduler()
 	{
-		return mDataParallelThreadPool;
+		return mJobScheduler;
 	}
 
 
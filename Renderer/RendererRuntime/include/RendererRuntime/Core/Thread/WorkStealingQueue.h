@@ -0,0 +1,113 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/NonCopyable.h"
+
+#include <atomic>
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Lock-free single producer multiple consumer work stealing queue template
+	*
+	*  @remarks
+	*    The owner thread pushes and pops at the bottom of the queue (LIFO, cache friendly), other threads steal from the top of the queue (FIFO).
+	*
+	*  @note
+	*    - Basing on "Correct and Efficient Work-Stealing for Weak Memory Models" by Nhat Minh Lê, Antoniu Pop, Albert Cohen and Francesco Zappa Nardelli (Chase-Lev deque with C11 memory model)
+	*    - Fixed capacity ring buffer, there's no dynamic memory allocation
+	*    - "push()" and "pop()" must only be called by the owner thread, "steal()" can be called by any thread
+	*/
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	class WorkStealingQueue : private NonCopyable
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline WorkStealingQueue();
+		inline ~WorkStealingQueue();
+		inline uint32_t getApproximateNumberOfElements() const;
+		inline bool push(ELEMENT_TYPE* element);	// Returns "false" if the queue is full
+		inline ELEMENT_TYPE* pop();				// Returns a null pointer if the queue is empty
+		inline ELEMENT_TYPE* steal();			// Returns a null pointer if the queue is empty or the steal operation lost a race
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		WorkStealingQueue(const WorkStealingQueue&) = delete;
+		WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static_assert(0 == (CAPACITY & (CAPACITY - 1)), "The work stealing queue capacity must be a power of two");
+		static const int64_t INDEX_MASK = static_cast<int64_t>(CAPACITY) - 1;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::atomic<int64_t>		mTop;									///< Index of the oldest element, modified by stealing threads
+		uint8_t						mPadding[64 - sizeof(std::atomic<int64_t>)];	///< Keep top and bottom on different cache lines to avoid false sharing
+		std::atomic<int64_t>		mBottom;								///< Index one past the newest element, only modified by the owner thread
+		std::atomic<ELEMENT_TYPE*>	mElements[CAPACITY];
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Thread/WorkStealingQueue.inl"
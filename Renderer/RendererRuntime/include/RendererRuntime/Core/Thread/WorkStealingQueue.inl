@@ -0,0 +1,129 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline WorkStealingQueue<ELEMENT_TYPE, CAPACITY>::WorkStealingQueue() :
+		mTop(0),
+		mBottom(0)
+	{
+		for (uint32_t i = 0; i < CAPACITY; ++i)
+		{
+			mElements[i].store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline WorkStealingQueue<ELEMENT_TYPE, CAPACITY>::~WorkStealingQueue()
+	{
+		// Nothing here
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline uint32_t WorkStealingQueue<ELEMENT_TYPE, CAPACITY>::getApproximateNumberOfElements() const
+	{
+		const int64_t bottom = mBottom.load(std::memory_order_relaxed);
+		const int64_t top = mTop.load(std::memory_order_relaxed);
+		return (bottom > top) ? static_cast<uint32_t>(bottom - top) : 0u;
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline bool WorkStealingQueue<ELEMENT_TYPE, CAPACITY>::push(ELEMENT_TYPE* element)
+	{
+		const int64_t bottom = mBottom.load(std::memory_order_relaxed);
+		const int64_t top = mTop.load(std::memory_order_acquire);
+		if (bottom - top >= static_cast<int64_t>(CAPACITY))
+		{
+			// The queue is full
+			return false;
+		}
+		mElements[bottom & INDEX_MASK].store(element, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		mBottom.store(bottom + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline ELEMENT_TYPE* WorkStealingQueue<ELEMENT_TYPE, CAPACITY>::pop()
+	{
+		const int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+		mBottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = mTop.load(std::memory_order_relaxed);
+		if (top <= bottom)
+		{
+			// Non-empty queue
+			ELEMENT_TYPE* element = mElements[bottom & INDEX_MASK].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last element inside the queue: Race against stealing threads
+				if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					// Lost the race
+					element = nullptr;
+				}
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return element;
+		}
+		else
+		{
+			// Empty queue
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+	}
+
+	template <typename ELEMENT_TYPE, uint32_t CAPACITY>
+	inline ELEMENT_TYPE* WorkStealingQueue<ELEMENT_TYPE, CAPACITY>::steal()
+	{
+		int64_t top = mTop.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64_t bottom = mBottom.load(std::memory_order_acquire);
+		if (top < bottom)
+		{
+			// Non-empty queue
+			ELEMENT_TYPE* element = mElements[top & INDEX_MASK].load(std::memory_order_relaxed);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				// Lost the race against the owner thread or another stealing thread
+				return nullptr;
+			}
+			return element;
+		}
+
+		// Empty queue
+		return nullptr;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
@@ -0,0 +1,169 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/NonCopyable.h"
+#include "RendererRuntime/Core/Time/TimeBudget.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Frame time budget coordinator for the synchronous work done by the renderer runtime update
+	*
+	*  @remarks
+	*    Each subsystem gets its own slice of wall time per frame. A subsystem which runs out of its slice stops partway
+	*    through its queue and resumes during the next frame, this way a lot of resources finishing at once result in
+	*    a few frames doing a bit more work instead of a single frame spike. The statistics of the last frame tell how
+	*    much work each subsystem had to defer.
+	*
+	*  @note
+	*    - Emergency work, e.g. resource streamer load requests with emergency load priority, ignores the time budget
+	*    - Explicit flushes are never time budgeted
+	*/
+	class FrameTimeBudget : private NonCopyable
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class RendererRuntimeImpl;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		enum class Subsystem : uint8_t
+		{
+			PIPELINE_STATE_COMPILER,	///< Pipeline state compiler dispatch of compiled pipeline state objects
+			RESOURCE_STREAMER			///< Resource streamer dispatch, e.g. renderer resource creation and uploads
+		};
+		static const uint8_t NUMBER_OF_SUBSYSTEMS = 2;
+
+		struct SubsystemStatistics
+		{
+			uint64_t numberOfUsedMicroseconds;	///< Wall time the subsystem used during the last frame, might be above the slice due to emergency work
+			uint32_t numberOfDeferredWorkItems;	///< Number of work items the subsystem deferred to the next frame during the last frame
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the slice of wall time a subsystem is allowed to use per frame
+		*
+		*  @param[in] subsystem
+		*    Subsystem to return the slice of
+		*
+		*  @return
+		*    Maximum number of microseconds per frame, "RendererRuntime::TimeBudget::UNLIMITED_NUMBER_OF_MICROSECONDS" if the subsystem isn't time budgeted
+		*/
+		inline uint64_t getMaximumNumberOfMicroseconds(Subsystem subsystem) const;
+
+		/**
+		*  @brief
+		*    Set the slice of wall time a subsystem is allowed to use per frame
+		*
+		*  @param[in] subsystem
+		*    Subsystem to set the slice of
+		*  @param[in] maximumNumberOfMicroseconds
+		*    Maximum number of microseconds per frame, "RendererRuntime::TimeBudget::UNLIMITED_NUMBER_OF_MICROSECONDS" to not time budget the subsystem at all
+		*
+		*  @note
+		*    - A subsystem always completes at least one work item per frame, so even a tiny slice doesn't stall it completely
+		*/
+		inline void setMaximumNumberOfMicroseconds(Subsystem subsystem, uint64_t maximumNumberOfMicroseconds);
+
+		/**
+		*  @brief
+		*    Return the statistics of a subsystem gathered during the last frame
+		*
+		*  @param[in] subsystem
+		*    Subsystem to return the statistics of
+		*
+		*  @return
+		*    The statistics of the subsystem gathered during the last frame
+		*/
+		inline const SubsystemStatistics& getSubsystemStatistics(Subsystem subsystem) const;
+
+		/**
+		*  @brief
+		*    Return the number of work items all subsystems together deferred to the next frame during the last frame
+		*
+		*  @return
+		*    The number of work items all subsystems together deferred to the next frame during the last frame
+		*/
+		inline uint32_t getNumberOfDeferredWorkItems() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		inline FrameTimeBudget();
+		inline ~FrameTimeBudget();
+		FrameTimeBudget(const FrameTimeBudget&) = delete;
+		FrameTimeBudget& operator=(const FrameTimeBudget&) = delete;
+		inline TimeBudget startSlice(Subsystem subsystem) const;
+		inline void finishSlice(Subsystem subsystem, const TimeBudget& timeBudget);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint64_t			mMaximumNumberOfMicroseconds[NUMBER_OF_SUBSYSTEMS];
+		SubsystemStatistics	mSubsystemStatistics[NUMBER_OF_SUBSYSTEMS];
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/Time/FrameTimeBudget.inl"
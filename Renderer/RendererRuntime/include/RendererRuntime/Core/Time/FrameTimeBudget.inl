@@ -0,0 +1,92 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	inline uint64_t FrameTimeBudget::getMaximumNumberOfMicroseconds(Subsystem subsystem) const
+	{
+		return mMaximumNumberOfMicroseconds[static_cast<uint8_t>(subsystem)];
+	}
+
+	inline void FrameTimeBudget::setMaximumNumberOfMicroseconds(Subsystem subsystem, uint64_t maximumNumberOfMicroseconds)
+	{
+		mMaximumNumberOfMicroseconds[static_cast<uint8_t>(subsystem)] = maximumNumberOfMicroseconds;
+	}
+
+	inline const FrameTimeBudget::SubsystemStatistics& FrameTimeBudget::getSubsystemStatistics(Subsystem subsystem) const
+	{
+		return mSubsystemStatistics[static_cast<uint8_t>(subsystem)];
+	}
+
+	inline uint32_t FrameTimeBudget::getNumberOfDeferredWorkItems() const
+	{
+		uint32_t numberOfDeferredWorkItems = 0;
+		for (const SubsystemStatistics& subsystemStatistics : mSubsystemStatistics)
+		{
+			numberOfDeferredWorkItems += subsystemStatistics.numberOfDeferredWorkItems;
+		}
+		return numberOfDeferredWorkItems;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	inline FrameTimeBudget::FrameTimeBudget()
+	{
+		// Roughly 3 ms out of a 16.6 ms frame at 60 Hz, creating renderer resources and uploading data is usually more expensive than handing over pipeline state objects
+		mMaximumNumberOfMicroseconds[static_cast<uint8_t>(Subsystem::PIPELINE_STATE_COMPILER)] = 1000;
+		mMaximumNumberOfMicroseconds[static_cast<uint8_t>(Subsystem::RESOURCE_STREAMER)] = 2000;
+		for (SubsystemStatistics& subsystemStatistics : mSubsystemStatistics)
+		{
+			subsystemStatistics.numberOfUsedMicroseconds = 0;
+			subsystemStatistics.numberOfDeferredWorkItems = 0;
+		}
+	}
+
+	inline FrameTimeBudget::~FrameTimeBudget()
+	{
+		// Nothing here
+	}
+
+	inline TimeBudget FrameTimeBudget::startSlice(Subsystem subsystem) const
+	{
+		return TimeBudget(mMaximumNumberOfMicroseconds[static_cast<uint8_t>(subsystem)]);
+	}
+
+	inline void FrameTimeBudget::finishSlice(Subsystem subsystem, const TimeBudget& timeBudget)
+	{
+		SubsystemStatistics& subsystemStatistics = mSubsystemStatistics[static_cast<uint8_t>(subsystem)];
+		subsystemStatistics.numberOfUsedMicroseconds = timeBudget.getNumberOfElapsedMicroseconds();
+		subsystemStatistics.numberOfDeferredWorkItems = timeBudget.getNumberOfDeferredWorkItems();
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
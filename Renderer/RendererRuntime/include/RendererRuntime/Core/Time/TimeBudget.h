@@ -17,33 +17,17 @@
  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 \*********************************************************/
 
-
-// TODO(co) Code-style adoptions and extensions
-
-
 //[-------------------------------------------------------]
 //[ Header guard                                          ]
 //[-------------------------------------------------------]
 #pragma once
 
 
-// Disable warnings
-PRAGMA_WARNING_PUSH
-	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'Concurrency::details::_ExceptionHolder': copy constructor was implicitly defined as deleted
-	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'Concurrency::details::_ExceptionHolder': assignment operator was implicitly defined as deleted
-
-
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include "RendererRuntime/Core/GetUninitialized.h"
-
-#include <mutex>
-#include <queue>
-#include <thread>
-#include <vector>
-#include <future>
-#include <functional>
+#include <chrono>
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
 
 
 //[-------------------------------------------------------]
@@ -58,66 +42,49 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Generic usable thread pool to avoid recreation of threads each tick
+	*    Wall clock time budget for synchronous work which can be split across multiple frames
+	*
+	*  @remarks
+	*    The time budget starts running as soon as it's constructed. A subsystem working through a queue checks
+	*    "isExhausted()" after each work item, stops as soon as the time budget is exhausted and leaves the rest
+	*    of its queue for the next frame. The number of work items left behind is reported back via
+	*    "setNumberOfDeferredWorkItems()".
 	*
 	*  @note
-	*    - Meant for data-parallel use-cases
-	*    - Implementation from https://github.com/netromdk/threadpool
+	*    - An unlimited time budget is never exhausted, the elapsed time is still measured
 	*/
-	template <typename RetType> ///< Return type of tasks
-	class ThreadPool
+	class TimeBudget
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
 	public:
-		using Task = std::function<RetType()>;
-		using Callback = std::function<void()>;
-
-
-	private:
-		using TaskQueue = std::queue<Task>;
-		using FutVec = std::vector<std::future<RetType>>;
+		static const uint64_t UNLIMITED_NUMBER_OF_MICROSECONDS = ~static_cast<uint64_t>(0);
 
 
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
 	public:
-		/// Uninitialized number of threads means to use as many threads as there are hardware threads on the system
-		ThreadPool(size_t threads = getUninitialized<size_t>());
-		~ThreadPool();
-
-		void queueTask(const Task &task);
-		void queueTask(Task &&task);
-
-		/// Process all enqueued tasks.
-		/** If no completion callback is defined then it
-		  will block until done, otherwise it returns immediately and the callback
-		  will be invoked when done. */
-		void process(Callback callback = Callback());
-
-		size_t getThreadCount() const { return threads; }
-		FutVec &getFutures() { return futuresDone; }
-
-		size_t getThreadCountAndSplitCount(size_t itemCount, size_t& splitCount) const
-		{
-			size_t threadCount = static_cast<size_t>(std::ceil(itemCount / static_cast<float>(splitCount)));
-			if (threadCount > threads)
-			{
-				// Clamp thread count to maximum threads
-				threadCount = threads;
-
-				// Calculate new package size per thread
-				splitCount = itemCount / threads;
-			}
-			return threadCount;
-		}
+		inline explicit TimeBudget(uint64_t maximumNumberOfMicroseconds = UNLIMITED_NUMBER_OF_MICROSECONDS);
+		inline ~TimeBudget();
+		inline uint64_t getMaximumNumberOfMicroseconds() const;
+		inline bool isUnlimited() const;
+		inline uint64_t getNumberOfElapsedMicroseconds() const;
+		inline bool isExhausted() const;
+		inline uint32_t getNumberOfDeferredWorkItems() const;
+		inline void setNumberOfDeferredWorkItems(uint32_t numberOfDeferredWorkItems);
 
-	private:
-		void _process();
 
-		size_t threads;
-		std::thread thread;
-		std::mutex processMutex;
-		TaskQueue tasks;
-		FutVec futuresDone, futuresPending;
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::chrono::steady_clock::time_point mStartTime;
+		uint64_t							  mMaximumNumberOfMicroseconds;
+		uint32_t							  mNumberOfDeferredWorkItems;	///< Number of work items the subsystem left behind for the next frame
 
 
 	};
@@ -132,8 +99,4 @@ namespace RendererRuntime
 //[-------------------------------------------------------]
 //[ Implementation                                        ]
 //[-------------------------------------------------------]
-#include "RendererRuntime/Core/Thread/ThreadPool.inl"
-
-
-// Reset warning manipulations we did above
-PRAGMA_WARNING_POP
+#include "RendererRuntime/Core/Time/TimeBudget.inl"
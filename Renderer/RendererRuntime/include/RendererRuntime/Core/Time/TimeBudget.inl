@@ -0,0 +1,77 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	inline TimeBudget::TimeBudget(uint64_t maximumNumberOfMicroseconds) :
+		mStartTime(std::chrono::steady_clock::now()),
+		mMaximumNumberOfMicroseconds(maximumNumberOfMicroseconds),
+		mNumberOfDeferredWorkItems(0)
+	{
+		// Nothing here
+	}
+
+	inline TimeBudget::~TimeBudget()
+	{
+		// Nothing here
+	}
+
+	inline uint64_t TimeBudget::getMaximumNumberOfMicroseconds() const
+	{
+		return mMaximumNumberOfMicroseconds;
+	}
+
+	inline bool TimeBudget::isUnlimited() const
+	{
+		return (UNLIMITED_NUMBER_OF_MICROSECONDS == mMaximumNumberOfMicroseconds);
+	}
+
+	inline uint64_t TimeBudget::getNumberOfElapsedMicroseconds() const
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mStartTime).count());
+	}
+
+	inline bool TimeBudget::isExhausted() const
+	{
+		return (!isUnlimited() && getNumberOfElapsedMicroseconds() >= mMaximumNumberOfMicroseconds);
+	}
+
+	inline uint32_t TimeBudget::getNumberOfDeferredWorkItems() const
+	{
+		return mNumberOfDeferredWorkItems;
+	}
+
+	inline void TimeBudget::setNumberOfDeferredWorkItems(uint32_t numberOfDeferredWorkItems)
+	{
+		mNumberOfDeferredWorkItems = numberOfDeferredWorkItems;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
@@ -43,6 +43,7 @@ namespace RendererRuntime
 	class IFileManager;
 	class AssetManager;
 	class ThreadManager;
+	class FrameTimeBudget;
 	class DebugGuiManager;
 	class IRendererRuntime;
 	class ResourceStreamer;
@@ -150,6 +151,18 @@ namespace RendererRuntime
 		*/
 		inline ThreadManager& getThreadManager() const;
 
+		/**
+		*  @brief
+		*    Return the frame time budget instance
+		*
+		*  @return
+		*    The frame time budget instance, do not release the returned instance
+		*
+		*  @remarks
+		*    The frame time budget limits the synchronous work done by "RendererRuntime::IRendererRuntime::update()"
+		*/
+		inline FrameTimeBudget& getFrameTimeBudget() const;
+
 		/**
 		*  @brief
 		*    Return the asset manager instance
@@ -372,6 +385,7 @@ namespace RendererRuntime
 		Renderer::ITextureManager* mTextureManager;	///< The used texture manager instance (we keep a reference to it), always valid
 		IFileManager*			   mFileManager;	///< The used file manager instance, always valid
 		ThreadManager*			   mThreadManager;
+		FrameTimeBudget*		   mFrameTimeBudget;
 		AssetManager*			   mAssetManager;
 		// Resource
 		ResourceStreamer*					mResourceStreamer;
@@ -58,6 +58,11 @@ namespace RendererRuntime
 		return *mThreadManager;
 	}
 
+	inline FrameTimeBudget& IRendererRuntime::getFrameTimeBudget() const
+	{
+		return *mFrameTimeBudget;
+	}
+
 	inline AssetManager& IRendererRuntime::getAssetManager() const
 	{
 		return *mAssetManager;
@@ -148,6 +153,7 @@ namespace RendererRuntime
 		mBufferManager(nullptr),
 		mTextureManager(nullptr),
 		mThreadManager(nullptr),
+		mFrameTimeBudget(nullptr),
 		mAssetManager(nullptr),
 		// Resource
 		mResourceStreamer(nullptr),
@@ -176,6 +182,7 @@ namespace RendererRuntime
 		mBufferManager(nullptr),
 		mTextureManager(nullptr),
 		mThreadManager(nullptr),
+		mFrameTimeBudget(nullptr),
 		mAssetManager(nullptr),
 		// Resource
 		mResourceStreamer(nullptr),
@@ -49,6 +49,7 @@ namespace RendererRuntime
 	class AssetManager;
 	class ThreadManager;
 	class DebugGuiManager;
+	class FrameTimeBudget;
 	class IRendererRuntime;
 	class ResourceStreamer;
 	class IResourceManager;
@@ -109,6 +110,10 @@ namespace RendererRuntime
 		{
 			return *mThreadManager;
 		}
+		inline FrameTimeBudget& getFrameTimeBudget() const
+		{
+			return *mFrameTimeBudget;
+		}
 		inline AssetManager& getAssetManager() const
 		{
 			return *mAssetManager;
@@ -186,6 +191,7 @@ namespace RendererRuntime
 		Renderer::ITextureManager*			mTextureManager;
 		IFileManager*						mFileManager;
 		ThreadManager*						mThreadManager;
+		FrameTimeBudget*					mFrameTimeBudget;
 		AssetManager*						mAssetManager;
 		ResourceStreamer*					mResourceStreamer;
 		TextureResourceManager*				mTextureResourceManager;
@@ -106,9 +106,14 @@ namespace RendererRuntime
 
 		/**
 		*  @brief
-		*    Free all used indirect buffers
+		*    Inform the indirect buffer manager that a frame has ended
+		*
+		*  @note
+		*    - Must be called after the command buffers of the frame have been submitted
+		*    - The indirect buffers used by the frame are kept in use while the frame is in flight, they're only reused after
+		*      "RendererRuntime::IndirectBufferManager::NUMBER_OF_FRAMES_IN_FLIGHT" further frames have ended so the GPU is done reading them
 		*/
-		void freeAllUsedIndirectBuffers();
+		void frameEnded();
 
 
 	//[-------------------------------------------------------]
@@ -123,6 +128,8 @@ namespace RendererRuntime
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
+		static const uint32_t NUMBER_OF_FRAMES_IN_FLIGHT = 3;	///< Maximum number of frames the GPU is lagging behind, the renderer has no fences so used indirect buffers are only reused after this number of frames
+
 		struct IndirectBuffer
 		{
 			Renderer::IIndirectBuffer* indirectBuffer;
@@ -142,7 +149,9 @@ namespace RendererRuntime
 		const IRendererRuntime&   mRendererRuntime;
 		Renderer::IBufferManager& mBufferManager;
 		IndirectBuffers			  mFreeIndirectBuffers;
-		IndirectBuffers			  mUsedIndirectBuffers;
+		IndirectBuffers			  mUsedIndirectBuffers;									///< Indirect buffers used by the current frame
+		IndirectBuffers			  mInFlightIndirectBuffers[NUMBER_OF_FRAMES_IN_FLIGHT];	///< Indirect buffers used by the frames in flight, ring buffer
+		uint32_t				  mInFlightFrameIndex;									///< Index of the oldest frame in flight inside "mInFlightIndirectBuffers"
 
 
 	};
@@ -29,6 +29,8 @@
 //[-------------------------------------------------------]
 #include "RendererRuntime/Core/StringId.h"
 #include "RendererRuntime/Core/NonCopyable.h"
+#include "RendererRuntime/RenderQueue/Renderable.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
 
 #include <vector>
 
@@ -36,14 +38,16 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace Renderer
 {
 	class IRenderTarget;
 	class CommandBuffer;
+	class IIndirectBuffer;
 }
 namespace RendererRuntime
 {
-	class Renderable;
+	class Transform;
 	class IRendererRuntime;
 	class RenderableManager;
 	class CompositorContextData;
@@ -82,6 +86,12 @@ namespace RendererRuntime
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class ::RuntimeBenchmark;	// Measures the render queue sorting
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -108,8 +118,61 @@ namespace RendererRuntime
 		inline uint8_t getMaximumRenderQueueIndex() const;
 		void clear();
 		void addRenderablesFromRenderableManager(const RenderableManager& renderableManager, bool castShadows = false);
+
+		/**
+		*  @brief
+		*    Add the renderables of multiple renderable managers, split into chunks which are processed by the job scheduler worker threads
+		*
+		*  @param[in] renderableManagers
+		*    Renderable managers to add, must stay valid until this method returns
+		*  @param[in] numberOfRenderableManagers
+		*    Number of renderable managers
+		*  @param[in] castShadows
+		*    "true" to only add shadow casting renderable managers and renderables (e.g. for shadow map rendering), else only the renderable managers inside the camera frustum are added
+		*
+		*  @note
+		*    - Each chunk is queued into its own chunk local queues which are merged in chunk order afterwards, so the result is identical to adding the renderable managers one after another regardless of the number of worker threads
+		*/
+		void addRenderablesFromRenderableManagers(const RenderableManager* const* renderableManagers, uint32_t numberOfRenderableManagers, bool castShadows = false);
 		void fillCommandBuffer(const Renderer::IRenderTarget& renderTarget, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, Renderer::CommandBuffer& commandBuffer);
 
+		/**
+		*  @brief
+		*    Return the number of draw calls emitted by the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		*
+		*  @return
+		*    The number of draw calls emitted by the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		*/
+		inline uint32_t getNumberOfDrawCalls() const;
+
+		/**
+		*  @brief
+		*    Return the number of draw calls saved by automatic instancing during the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		*
+		*  @return
+		*    The number of draw calls saved by automatic instancing during the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		*
+		*  @remarks
+		*    Directly following queued renderables using the same vertex array, index range and material are drawn using a single instanced draw call.
+		*    Each additional instance of such an instanced draw call counts as one merged draw call.
+		*/
+		inline uint32_t getNumberOfMergedDrawCalls() const;
+
+		/**
+		*  @brief
+		*    Return the number of draw calls saved by multi-draw indirect batching during the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		*
+		*  @return
+		*    The number of draw calls saved by multi-draw indirect batching during the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		*
+		*  @remarks
+		*    Directly following draw calls which share the vertex array, primitive topology, material technique and pipeline state and which don't need
+		*    per-draw instance data are issued using a single multi-draw indirect draw call. Each additional draw of such a multi-draw indirect draw call
+		*    counts as one batched draw call. Draw calls needing per-draw instance data aren't batched because the draw ID used by the shaders to access
+		*    the instance uniform buffer restarts at zero for each draw of a multi-draw indirect draw call.
+		*/
+		inline uint32_t getNumberOfBatchedDrawCalls() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -117,6 +180,67 @@ namespace RendererRuntime
 	private:
 		RenderQueue(const RenderQueue&) = delete;
 		RenderQueue& operator=(const RenderQueue&) = delete;
+		struct Queue;
+		void sortQueue(Queue& queue);
+		typedef std::vector<Queue> Queues;
+		void queueRenderablesFromRenderableManager(const RenderableManager& renderableManager, bool castShadows, Queues& queues) const;
+		static void queueRenderablesJob(void* userData, uint32_t firstIndex, uint32_t numberOfIndices);
+
+		/**
+		*  @brief
+		*    Return the draw packet of a renderable, resolve and cache it inside the renderable if required
+		*
+		*  @param[in] renderable
+		*    Renderable to return the draw packet for
+		*  @param[in] materialTechniqueId
+		*    ID of the material technique to use
+		*  @param[out] drawPacket
+		*    Receives the draw packet, only valid if "true" is returned
+		*
+		*  @return
+		*    "true" if all went fine, "false" if the renderable can't be drawn using the given material technique right now
+		*
+		*  @note
+		*    - The same renderable can be part of multiple render queues recorded by multiple threads at the same time, so the draw packets
+		*      cached inside the renderable are guarded by the renderable manager and a copy is returned instead of a reference into the cache
+		*/
+		bool getDrawPacket(const Renderable& renderable, MaterialTechniqueId materialTechniqueId, Renderable::DrawPacket& drawPacket);
+
+		/**
+		*  @brief
+		*    Add the draw of a renderable to the pending multi-draw indirect batch
+		*
+		*  @param[in] renderable
+		*    Renderable to draw, must have indices
+		*  @param[out] commandBuffer
+		*    Command buffer to fill
+		*/
+		void addIndirectDraw(const Renderable& renderable, Renderer::CommandBuffer& commandBuffer);
+
+		/**
+		*  @brief
+		*    Issue the pending multi-draw indirect batch, if there's one
+		*
+		*  @param[out] commandBuffer
+		*    Command buffer to fill
+		*
+		*  @note
+		*    - Must be called before any command changing the state used by the pending draws is added to the command buffer
+		*/
+		void flushIndirectDrawBatch(Renderer::CommandBuffer& commandBuffer);
+
+		/**
+		*  @brief
+		*    Upload the gathered draw arguments into the current indirect buffer and release the indirect buffer for filling
+		*
+		*  @param[out] commandBuffer
+		*    Command buffer to fill, must be the command buffer the multi-draw indirect draw calls using the current indirect buffer were recorded into
+		*
+		*  @note
+		*    - The draw arguments are written into the copy command recorded before the first multi-draw indirect draw call using the current indirect buffer, the
+		*      renderer copies them when the command buffer is executed so recording doesn't touch renderer resources and can be done by any thread
+		*/
+		void uploadIndirectDrawArguments(Renderer::CommandBuffer& commandBuffer);
 
 
 	//[-------------------------------------------------------]
@@ -143,16 +267,43 @@ namespace RendererRuntime
 		};
 		typedef std::vector<QueuedRenderable> QueuedRenderables;
 
+		struct SortedQueuedRenderable
+		{
+			uint64_t sortingKey;			///< Key used for sorting, copied from the queued renderable for cache efficient sorting
+			uint32_t queuedRenderableIndex;	///< Index of the queued renderable
+
+			inline SortedQueuedRenderable() :
+				sortingKey(0),
+				queuedRenderableIndex(0)
+			{}
+			inline SortedQueuedRenderable(uint64_t _sortingKey, uint32_t _queuedRenderableIndex) :
+				sortingKey(_sortingKey),
+				queuedRenderableIndex(_queuedRenderableIndex)
+			{}
+			inline bool operator < (const SortedQueuedRenderable& sortedQueuedRenderable) const
+			{
+				return (sortingKey < sortedQueuedRenderable.sortingKey);
+			}
+		};
+		typedef std::vector<SortedQueuedRenderable> SortedQueuedRenderables;
+
 		struct Queue
 		{
-			QueuedRenderables queuedRenderables;
-			bool			  sorted;
+			QueuedRenderables		queuedRenderables;			///< Queued renderables in the order they were added
+			QueuedRenderables		previousQueuedRenderables;	///< Queued renderables of the previous frame, used to exploit temporal coherence (renderables are only compared for identity, never dereferenced)
+			SortedQueuedRenderables	sortedQueuedRenderables;	///< Sorting key and queued renderable index pairs, holding the previous frame sorted order until the queue gets sorted
+			bool					sorted;
 
 			Queue() :
 				sorted(false)
 			{}
 		};
-		typedef std::vector<Queue> Queues;
+		typedef std::vector<Queues> ChunkQueues;
+
+		typedef std::vector<uint32_t> QueuedRenderableIndices;
+
+		typedef std::vector<const Transform*> ObjectSpaceToWorldSpaceTransforms;
+		typedef std::vector<uint8_t> IndirectDrawArguments;
 
 
 	//[-------------------------------------------------------]
@@ -166,6 +317,27 @@ namespace RendererRuntime
 		uint8_t					mMaximumRenderQueueIndex;	///< Inclusive
 		bool					mTransparentPass;
 		bool					mDoSort;
+		// Sorting, kept to avoid reallocations
+		SortedQueuedRenderables	mScratchSortedQueuedRenderables;	///< Radix sort ping-pong buffer and temporal coherence kept renderables
+		SortedQueuedRenderables	mNewSortedQueuedRenderables;		///< Temporal coherence renderables which weren't queued during the previous frame
+		QueuedRenderableIndices	mQueuedRenderableIndexByPreviousIndex;
+		QueuedRenderableIndices	mPreviousIndexHashTable;			///< Temporal coherence hash table mapping renderables to their previous queued renderable index, only build if required
+		// Automatic instancing
+		ObjectSpaceToWorldSpaceTransforms mObjectSpaceToWorldSpaceTransforms;	///< Object space to world space transforms of the current run of instanced renderables, kept to avoid reallocations
+		uint32_t				mNumberOfDrawCalls;					///< Number of draw calls emitted by the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		uint32_t				mNumberOfMergedDrawCalls;			///< Number of draw calls saved by automatic instancing during the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		ShaderProperties		mScratchShaderProperties;			///< Shader properties of the currently resolved draw packet, kept to avoid reallocations
+		// Multi-draw indirect batching
+		IndirectDrawArguments	   mIndirectDrawArguments;				///< Draw arguments ("Renderer::DrawInstancedArguments" or "Renderer::DrawIndexedInstancedArguments") of the current indirect buffer, uploaded at once, kept to avoid reallocations
+		Renderer::IIndirectBuffer* mIndirectBuffer;						///< Indirect buffer currently being filled, can be a null pointer, don't destroy the instance
+		uint32_t				   mCopyIndirectBufferDataCommandByteIndex;	///< Command packet byte index of the "Renderer::Command::CopyIndirectBufferData"-command filling the current indirect buffer, only valid if there's a current indirect buffer
+		uint32_t				   mMaximumNumberOfIndirectDraws;		///< Maximum number of draws per indirect buffer during the current "RendererRuntime::RenderQueue::fillCommandBuffer()"-call, less than two if multi-draw indirect batching is disabled
+		uint32_t				   mIndirectDrawBatchOffset;			///< Byte offset of the pending multi-draw indirect batch inside the current indirect buffer
+		uint32_t				   mIndirectDrawBatchNumberOfDraws;		///< Number of draws of the pending multi-draw indirect batch, zero if there's none
+		bool					   mIndirectDrawBatchIndexed;			///< Does the pending multi-draw indirect batch use indexed draws?
+		uint32_t				   mNumberOfBatchedDrawCalls;			///< Number of draw calls saved by multi-draw indirect batching during the last "RendererRuntime::RenderQueue::fillCommandBuffer()"-call
+		// Parallel queuing, kept to avoid reallocations
+		ChunkQueues				mChunkQueues;						///< Chunk local queues, only the queued renderables are used
 
 
 	};
@@ -43,6 +43,21 @@ namespace RendererRuntime
 		return mMaximumRenderQueueIndex;
 	}
 
+	inline uint32_t RenderQueue::getNumberOfDrawCalls() const
+	{
+		return mNumberOfDrawCalls;
+	}
+
+	inline uint32_t RenderQueue::getNumberOfMergedDrawCalls() const
+	{
+		return mNumberOfMergedDrawCalls;
+	}
+
+	inline uint32_t RenderQueue::getNumberOfBatchedDrawCalls() const
+	{
+		return mNumberOfBatchedDrawCalls;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -28,17 +28,23 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Export.h"
+#include "RendererRuntime/Core/StringId.h"
 
 #include <Renderer/Public/Renderer.h>
 
+#include <vector>
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
+	class MaterialTechnique;
 	class RenderableManager;
 	class MaterialResourceManager;
+	class MaterialBlueprintResource;
 }
 
 
@@ -53,6 +59,7 @@ namespace RendererRuntime
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
 	typedef uint32_t MaterialResourceId;	///< POD material resource identifier
+	typedef StringId MaterialTechniqueId;	///< Material technique identifier, internally just a POD "uint32_t", result of hashing the material technique name
 
 
 	//[-------------------------------------------------------]
@@ -72,7 +79,33 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend class MaterialResource;	// Must be able to update cached material data
+		friend class RenderQueue;			// Must be able to cache draw packets
+		friend class MaterialResource;		// Must be able to update cached material data
+		friend class ::RuntimeBenchmark;	// Drops the cached draw packets to measure resolving them
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    64-bit sorting key layout, most significant bits first
+		*
+		*  @remarks
+		*    Opaque:      | Layer (8) | Transparent = 0 (1) | Material blueprint (10) | Pipeline state (10) | Material (10) | Vertex array (10) | Depth (15)           |
+		*    Transparent: | Layer (8) | Transparent = 1 (1) | Inverted depth (15)     | Material blueprint (10) | Pipeline state (10) | Material (10) | Vertex array (10) |
+		*
+		*    The layer is the render queue index. Opaque renderables are sorted by state first to minimize expensive state changes and front-to-back
+		*    inside identical states for occlusion efficiency, transparent renderables are sorted back-to-front first for correct blending. The cached
+		*    renderable sorting key only contains the layer and the state fields (in the lowest bits), the render queue composes the final key by
+		*    incorporating the quantized depth (see "RendererRuntime::RenderQueue::addRenderablesFromRenderableManager()").
+		*/
+		static const uint32_t SORTING_KEY_LAYER_SHIFT		= 56;
+		static const uint32_t SORTING_KEY_TRANSPARENT_SHIFT	= 55;
+		static const uint32_t SORTING_KEY_DEPTH_BITS		= 15;
+		static const uint32_t SORTING_KEY_STATE_BITS		= 40;
+		static const uint64_t SORTING_KEY_STATE_MASK		= (static_cast<uint64_t>(1) << SORTING_KEY_STATE_BITS) - 1;
 
 
 	//[-------------------------------------------------------]
@@ -86,6 +119,13 @@ namespace RendererRuntime
 		//[-------------------------------------------------------]
 		//[ Derived data                                          ]
 		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the precalculated static part of the sorting key
+		*
+		*  @return
+		*    The precalculated static part of the sorting key, layer and state fields only (see "RendererRuntime::Renderable::SORTING_KEY_LAYER_SHIFT")
+		*/
 		inline uint64_t getSortingKey() const;
 
 		//[-------------------------------------------------------]
@@ -122,6 +162,33 @@ namespace RendererRuntime
 		RENDERERRUNTIME_API_EXPORT void unsetMaterialResourceIdInternal();
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Draw packet, the prevalidated result of resolving a material technique of the renderable
+		*
+		*  @remarks
+		*    Resolving a material technique (gathering and optimizing shader properties, pipeline state cache lookup) is too expensive to be
+		*    performed for each draw call, so the render queue caches the result inside the renderable. The cached draw packets are derived
+		*    from the same material data as the sorting key and are hence discarded whenever the sorting key gets recalculated. A renderable
+		*    can be part of multiple render queues recorded by multiple threads, so the cached draw packets are guarded by the mutex of the
+		*    owning renderable manager (see "RendererRuntime::RenderableManager"). The texture
+		*    bindings and the material buffer slot are owned by the material technique itself (see "RendererRuntime::MaterialTechnique").
+		*/
+		struct DrawPacket
+		{
+			MaterialTechniqueId		   materialTechniqueId;
+			MaterialTechnique*		   materialTechnique;			///< Always valid, don't destroy the instance
+			MaterialBlueprintResource* materialBlueprintResource;	///< Always valid, don't destroy the instance
+			Renderer::IPipelineState*  pipelineState;				///< Always valid, the pipeline state cache keeps the pipeline state object alive
+			uint32_t				   pipelineStateGeneration;		///< Pipeline state generation the pipeline state was resolved at, see "RendererRuntime::PipelineStateCacheManager::getPipelineStateGeneration()"
+		};
+		typedef std::vector<DrawPacket> DrawPackets;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -142,6 +209,7 @@ namespace RendererRuntime
 		// Internal data
 		const MaterialResourceManager*	mMaterialResourceManager;
 		int								mMaterialResourceAttachmentIndex;
+		mutable DrawPackets				mDrawPackets;			///< Cached draw packets, usually one per used material technique, filled by the render queue, guarded by the renderable manager draw packets mutex
 
 
 	};
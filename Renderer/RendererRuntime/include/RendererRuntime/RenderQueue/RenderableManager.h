@@ -28,9 +28,11 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Core/Manager.h"
+#include "RendererRuntime/Core/Math/Math.h"
 #include "RendererRuntime/RenderQueue/Renderable.h"
 
 #include <vector>
+#include <mutex>
 
 
 //[-------------------------------------------------------]
@@ -63,6 +65,13 @@ namespace RendererRuntime
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class Renderable;	// Must be able to guard the cached draw packets
+		friend class RenderQueue;	// Must be able to guard the cached draw packets
+
+
 	//[-------------------------------------------------------]
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
@@ -87,11 +96,23 @@ namespace RendererRuntime
 		inline bool isVisible() const;
 		inline void setVisible(bool visible);
 
+		//[-------------------------------------------------------]
+		//[ Bounding                                              ]
+		//[-------------------------------------------------------]
+		inline const glm::vec3& getMinimumBoundingBoxPosition() const;	// Object space
+		inline const glm::vec3& getMaximumBoundingBoxPosition() const;	// Object space
+		inline void setBoundingBoxPosition(const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition);
+		inline const glm::vec3& getBoundingSpherePosition() const;		// Object space
+		inline float getBoundingSphereRadius() const;					// By default the bounding sphere is infinite so the renderable manager is never culled
+		inline void setBoundingSpherePositionRadius(const glm::vec3& boundingSpherePosition, float boundingSphereRadius);
+
 		//[-------------------------------------------------------]
 		//[ Cached data                                           ]
 		//[-------------------------------------------------------]
 		inline float getCachedDistanceToCamera() const;
 		inline void setCachedDistanceToCamera(float distanceToCamera);
+		inline bool getCachedInsideCameraFrustum() const;
+		inline void setCachedInsideCameraFrustum(bool insideCameraFrustum);
 
 		/**
 		*  @brief
@@ -157,11 +178,19 @@ namespace RendererRuntime
 		Renderables		 mRenderables;				///< Renderables
 		const Transform* mTransform;				///< Transform instance, always valid, just shared meaning doesn't own the instance so don't delete it
 		bool			 mVisible;
+		// Bounding
+		glm::vec3		 mMinimumBoundingBoxPosition;	///< Object space
+		glm::vec3		 mMaximumBoundingBoxPosition;	///< Object space
+		glm::vec3		 mBoundingSpherePosition;		///< Object space
+		float			 mBoundingSphereRadius;
 		// Cached data
 		float			 mCachedDistanceToCamera;	///< Cached distance to camera is updated during the culling phase
+		bool			 mCachedInsideCameraFrustum;	///< Cached camera frustum culling result is updated during the culling phase, renderable managers outside the camera frustum might still be gathered as shadow casters
 		uint8_t			 mMinimumRenderQueueIndex;	///< The minimum renderables render queue index (inclusive, set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
 		uint8_t			 mMaximumRenderQueueIndex;	///< The maximum renderables render queue index (inclusive, set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
 		bool			 mCastShadows;				///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "RendererRuntime::RenderableManager::updateCachedRenderablesData()")
+		// Internal data
+		std::mutex		 mDrawPacketsMutex;			///< Mutex guarding the cached draw packets of the renderables, a renderable can be part of multiple render queues recorded by multiple threads at the same time
 
 
 	};
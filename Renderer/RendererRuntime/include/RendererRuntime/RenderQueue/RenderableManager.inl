@@ -66,6 +66,38 @@ namespace RendererRuntime
 		mVisible = visible;
 	}
 
+	inline const glm::vec3& RenderableManager::getMinimumBoundingBoxPosition() const
+	{
+		return mMinimumBoundingBoxPosition;
+	}
+
+	inline const glm::vec3& RenderableManager::getMaximumBoundingBoxPosition() const
+	{
+		return mMaximumBoundingBoxPosition;
+	}
+
+	inline void RenderableManager::setBoundingBoxPosition(const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition)
+	{
+		mMinimumBoundingBoxPosition = minimumBoundingBoxPosition;
+		mMaximumBoundingBoxPosition = maximumBoundingBoxPosition;
+	}
+
+	inline const glm::vec3& RenderableManager::getBoundingSpherePosition() const
+	{
+		return mBoundingSpherePosition;
+	}
+
+	inline float RenderableManager::getBoundingSphereRadius() const
+	{
+		return mBoundingSphereRadius;
+	}
+
+	inline void RenderableManager::setBoundingSpherePositionRadius(const glm::vec3& boundingSpherePosition, float boundingSphereRadius)
+	{
+		mBoundingSpherePosition = boundingSpherePosition;
+		mBoundingSphereRadius = boundingSphereRadius;
+	}
+
 	inline float RenderableManager::getCachedDistanceToCamera() const
 	{
 		return mCachedDistanceToCamera;
@@ -76,6 +108,16 @@ namespace RendererRuntime
 		mCachedDistanceToCamera = distanceToCamera;
 	}
 
+	inline bool RenderableManager::getCachedInsideCameraFrustum() const
+	{
+		return mCachedInsideCameraFrustum;
+	}
+
+	inline void RenderableManager::setCachedInsideCameraFrustum(bool insideCameraFrustum)
+	{
+		mCachedInsideCameraFrustum = insideCameraFrustum;
+	}
+
 	inline uint8_t RenderableManager::getMinimumRenderQueueIndex() const
 	{
 		return mMinimumRenderQueueIndex;
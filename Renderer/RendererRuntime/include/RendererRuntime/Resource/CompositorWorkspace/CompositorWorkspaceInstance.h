@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Core/StringId.h"
+#include "RendererRuntime/Core/Math/FrustumCuller.h"
 #include "RendererRuntime/Resource/IResourceListener.h"
 
 #include <Renderer/Public/Renderer.h>
@@ -36,6 +37,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class LightSceneItem;
@@ -84,6 +86,12 @@ namespace RendererRuntime
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class ::RuntimeBenchmark;	// Measures the culling
+
+
 	//[-------------------------------------------------------]
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
@@ -141,7 +149,8 @@ namespace RendererRuntime
 		void createFramebuffersAndRenderTargetTextures(const Renderer::IRenderTarget& mainRenderTarget);
 		void destroyFramebuffersAndRenderTargetTextures();
 		void clearRenderQueueIndexRangesRenderableManagers();
-		void gatherRenderQueueIndexRangesRenderableManagers(const CameraSceneItem& cameraSceneItem);	// A naive method name would be "culling", this is considered to be an expensive method call
+		void gatherRenderQueueIndexRangesRenderableManagers(const Renderer::IRenderTarget& renderTarget, const CameraSceneItem& cameraSceneItem);	// A naive method name would be "culling", this is considered to be an expensive method call
+		static void cullSceneNodesJob(void* userData, uint32_t firstIndex, uint32_t numberOfIndices);
 
 
 	//[-------------------------------------------------------]
@@ -150,6 +159,13 @@ namespace RendererRuntime
 	private:
 		typedef std::vector<CompositorNodeInstance*> CompositorNodeInstances;
 
+		struct CullingChunk
+		{
+			FrustumCuller	   frustumCuller;		///< Frustum culler holding the bounding spheres of the chunk
+			RenderableManagers renderableManagers;	///< Renderable managers in the order their bounding spheres were added to the frustum culler, after culling only the renderable managers to render are left
+		};
+		typedef std::vector<CullingChunk> CullingChunks;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -169,6 +185,7 @@ namespace RendererRuntime
 		RenderQueueIndexRanges			 mRenderQueueIndexRanges;				///< The render queue index ranges layout is fixed during runtime
 		Renderer::CommandBuffer			 mCommandBuffer;						///< Command buffer
 		CompositorInstancePassShadowMap* mCompositorInstancePassShadowMap;		///< Can be a null pointer, don't destroy the instance
+		CullingChunks					 mCullingChunks;						///< Culling chunks processed in parallel, kept to avoid reallocations, only valid during culling
 
 
 	};
@@ -109,7 +109,7 @@ namespace RendererRuntime
 		RENDERERRUNTIME_API_EXPORT IResource& operator=(IResource&& resource);
 		inline void setResourceManager(IResourceManager* resourceManager);
 		inline void setAssetId(AssetId assetId);
-		void setLoadingState(LoadingState loadingState);
+		RENDERERRUNTIME_API_EXPORT void setLoadingState(LoadingState loadingState);
 
 		//[-------------------------------------------------------]
 		//[ "RendererRuntime::PackedElementManager" management    ]
@@ -100,6 +100,18 @@ namespace RendererRuntime
 		*/
 		virtual ResourceLoaderTypeId getResourceLoaderTypeId() const = 0;
 
+		/**
+		*  @brief
+		*    Return whether or not the load requests of this resource loader must pass the resource streamer stages in the order they were committed
+		*
+		*  @return
+		*    "true" if the load requests must be processed in commit order, else "false" (default) meaning any resource streamer worker thread can process the load requests in parallel
+		*
+		*  @note
+		*    - All load requests requiring ordered loading share a single resource streamer lane, so the commit order is also kept across resource loader types
+		*/
+		inline virtual bool requiresOrderedLoading() const;
+
 		/**
 		*  @brief
 		*    Called when the resource loader has to deserialize (usually from file) the internal data into memory
@@ -133,6 +145,17 @@ namespace RendererRuntime
 		*/
 		virtual bool isFullyLoaded() = 0;
 
+		/**
+		*  @brief
+		*    Called instead of "RendererRuntime::IResourceLoader::onDispatch()" when the load request got cancelled
+		*
+		*  @remarks
+		*    Release everything which has been created for the resource during deserialization or processing and which would have been
+		*    handed over to the resource during dispatch, e.g. renderer resources created asynchronously. The resource loader instance is
+		*    reused afterwards.
+		*/
+		inline virtual void onCancellation();
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
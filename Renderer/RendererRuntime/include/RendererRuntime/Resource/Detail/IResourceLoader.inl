@@ -39,6 +39,21 @@ namespace RendererRuntime
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual RendererRuntime::IResourceLoader methods ]
+	//[-------------------------------------------------------]
+	inline bool IResourceLoader::requiresOrderedLoading() const
+	{
+		// By default, load requests can be processed in parallel
+		return false;
+	}
+
+	inline void IResourceLoader::onCancellation()
+	{
+		// Nothing here
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
@@ -28,20 +28,25 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Core/NonCopyable.h"
+#include "RendererRuntime/Core/Thread/BoundedMpmcQueue.h"
 
 #include <deque>
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include <vector>
 #include <condition_variable>
 
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class ResourceStreamerCheck;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
+	class IFile;
 	class IResource;
+	class TimeBudget;
 	class IResourceLoader;
 	class IRendererRuntime;
 }
@@ -72,6 +77,14 @@ namespace RendererRuntime
 	*    1. Asynchronous deserialization
 	*    2. Asynchronous processing
 	*    3. Synchronous dispatch, e.g. to the renderer backend
+	*
+	*    The asynchronous stages are processed by a configurable number of worker threads each, the stages hand over
+	*    load requests using bounded lock-free queues. Load requests of resource loaders requiring ordered loading pass
+	*    all stages in commit order, see "RendererRuntime::IResourceLoader::requiresOrderedLoading()". All other load
+	*    requests are processed by load priority, emergency load requests first.
+	*
+	*  @note
+	*    - Committing, re-prioritizing, cancelling and dispatching must happen on the thread the resource managers are used on
 	*/
 	class ResourceStreamer : private NonCopyable
 	{
@@ -81,16 +94,39 @@ namespace RendererRuntime
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class RendererRuntimeImpl;
+		friend class ::ResourceStreamerCheck;	// Inspects the in-flight load requests
 
 
 	//[-------------------------------------------------------]
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
+		/**
+		*  @brief
+		*    Load priority, load requests with a higher priority overtake load requests with a lower priority
+		*/
+		enum class LoadPriority : uint8_t
+		{
+			EMERGENCY = 0,	///< The resource is needed right now, e.g. something is blocking until the resource is loaded
+			VISIBLE,		///< The resource is visible or about to be used (default)
+			PREFETCH,		///< The resource is likely to be needed soon
+			BACKGROUND		///< Load the resource when there's nothing else to do
+		};
+		static const uint8_t NUMBER_OF_LOAD_PRIORITIES = 4;
+
 		struct LoadRequest
 		{
 			IResource*		 resource;			///< Must be valid, do not destroy the instance
 			IResourceLoader* resourceLoader;	///< Must be valid, do not destroy the instance
+			LoadPriority	 loadPriority;		///< Load priority, ignored for resource loaders requiring ordered loading
+
+			inline LoadRequest() :
+				resource(nullptr),
+				resourceLoader(nullptr),
+				loadPriority(LoadPriority::VISIBLE)
+			{
+				// Nothing here
+			}
 		};
 
 
@@ -98,7 +134,46 @@ namespace RendererRuntime
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	public:
+		inline uint32_t getNumberOfDeserializationThreads() const;
+		void setNumberOfDeserializationThreads(uint32_t numberOfDeserializationThreads);	// At least one deserialization thread is used
+		inline uint32_t getNumberOfProcessingThreads() const;
+		void setNumberOfProcessingThreads(uint32_t numberOfProcessingThreads);				// At least one processing thread is used
 		void commitLoadRequest(const LoadRequest& loadRequest);
+
+		/**
+		*  @brief
+		*    Change the load priority of a load request which hasn't been dispatched, yet
+		*
+		*  @param[in] resource
+		*    Resource the load request is for
+		*  @param[in] loadPriority
+		*    New load priority
+		*
+		*  @return
+		*    "true" if there's a load request for the given resource which hasn't been dispatched, yet, else "false"
+		*
+		*  @note
+		*    - A raised load priority takes effect inside the current resource streamer stage, a lowered one as soon as the load request enters the next stage
+		*    - Load requests requiring ordered loading stay in their lane
+		*/
+		bool setLoadPriority(const IResource& resource, LoadPriority loadPriority);
+
+		/**
+		*  @brief
+		*    Cancel the load request of a resource which hasn't been dispatched, yet
+		*
+		*  @param[in] resource
+		*    Resource the load request is for, the resource loading state is set back to "RendererRuntime::IResource::LoadingState::UNLOADED"
+		*
+		*  @return
+		*    "true" if there was a load request for the given resource which hasn't been dispatched, yet, else "false"
+		*
+		*  @note
+		*    - A load request which is already inside a resource streamer stage is skipped by all following stages, the resource loader
+		*      instance is released during the next dispatch (see "RendererRuntime::IResourceLoader::onCancellation()")
+		*/
+		bool cancelLoadRequest(const IResource& resource);
+
 		void flushAllQueues();
 
 		/**
@@ -106,51 +181,138 @@ namespace RendererRuntime
 		*    Resource streamer update performing dispatch to e.g. the renderer backend
 		*
 		*  @note
-		*    - Call this once per frame
+		*    - Dispatches everything which is ready, not time budgeted
 		*/
 		void dispatch();
 
+		/**
+		*  @brief
+		*    Resource streamer update performing dispatch to e.g. the renderer backend as long as the given time budget lasts
+		*
+		*  @param[in, out] timeBudget
+		*    Time budget to respect, receives the approximate number of load requests left for the next dispatch
+		*
+		*  @note
+		*    - Call this once per frame
+		*    - Load requests with emergency load priority are always dispatched, even if the time budget is already exhausted
+		*/
+		void dispatch(TimeBudget& timeBudget);
+
 
 	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
+	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		explicit ResourceStreamer(IRendererRuntime& rendererRuntime);
-		~ResourceStreamer();
-		ResourceStreamer(const ResourceStreamer&) = delete;
-		ResourceStreamer& operator=(const ResourceStreamer&) = delete;
-		void deserializationThreadWorker();
-		void processingThreadWorker();
+		/**
+		*  @brief
+		*    Maximum number of load requests inside the asynchronous resource streamer stages and the dispatch queues
+		*
+		*  @note
+		*    - Every queue is able to hold all in-flight load requests, so pushing into a queue never fails
+		*    - Load requests committed while the limit is reached are held back and enter the first stage as soon as there's room again
+		*/
+		static const uint32_t MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS = 1024;
+		static const uint32_t NUMBER_OF_EMERGENCY_IN_FLIGHT_LOAD_REQUESTS = 32;	///< In-flight load requests kept in reserve for emergency load requests, so those never wait for room inside the resource streamer pipeline
+		static const uint8_t  ORDERED_LANE	  = NUMBER_OF_LOAD_PRIORITIES;		///< Lane of load requests requiring ordered loading, the other lanes are the load priorities
+		static const uint8_t  NUMBER_OF_LANES = NUMBER_OF_LOAD_PRIORITIES + 1;
+		enum StageIndex
+		{
+			DESERIALIZATION_STAGE = 0,	///< Resource streamer stage: 1. Asynchronous deserialization
+			PROCESSING_STAGE,			///< Resource streamer stage: 2. Asynchronous processing
+			DISPATCH_STAGE,				///< Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
+			NUMBER_OF_STAGES
+		};
+
+		/**
+		*  @brief
+		*    Load request inside the resource streamer stages
+		*
+		*  @remarks
+		*    Queues don't contain load requests but entries referencing the in-flight load request together with a ticket. Raising the load
+		*    priority pushes a new entry and invalidates the old one by advancing the ticket, so there's no need to remove entries from the
+		*    middle of a lock-free queue. Claiming a load request means flagging the ticket of a popped entry as claimed, this way there's
+		*    exactly one thread working on a load request at a time.
+		*/
+		struct InFlightLoadRequest
+		{
+			LoadRequest			  loadRequest;			///< Only accessed by the owner of the claimed load request, "RendererRuntime::ResourceStreamer::LoadRequest::resource" is a null pointer for free in-flight load requests
+			bool				  ordered;				///< "true" if the load request uses the ordered lane
+			IFile*				  file;					///< File supporting views kept open until the load request has been dispatched since the resource loader might still use the views, can be a null pointer, only accessed by the owner of the claimed load request
+			std::atomic<uint8_t>  stageIndex;			///< "RendererRuntime::ResourceStreamer::StageIndex" of the stage the load request is currently in
+			std::atomic<uint8_t>  loadPriority;			///< Current "RendererRuntime::ResourceStreamer::LoadPriority"
+			std::atomic<uint8_t>  queuedLoadPriority;	///< Highest load priority an entry of the current stage was pushed with
+			std::atomic<bool>	  cancelled;
+			std::atomic<uint32_t> ticket;				///< Ticket of the valid queue entry, the highest bit is set while the load request is claimed
+			std::atomic<uint32_t> numberOfReferences;	///< Number of queue entries referencing the in-flight load request plus one as long as it's in flight, it can be reused as soon as this drops to zero
+		};
+
+		struct QueueEntry
+		{
+			uint32_t inFlightLoadRequestIndex;
+			uint32_t ticket;
+		};
+
+		typedef std::deque<LoadRequest> LoadRequests;
+		typedef BoundedMpmcQueue<QueueEntry, MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS> QueueEntryQueue;
+		typedef BoundedMpmcQueue<uint32_t, MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS> InFlightLoadRequestIndexQueue;
+		typedef std::vector<std::thread> WorkerThreads;
+
+		/**
+		*  @brief
+		*    Resource streamer stage, the asynchronous stages are processed by worker threads
+		*/
+		struct Stage
+		{
+			QueueEntryQueue			laneQueues[NUMBER_OF_LANES];	///< Only the first worker thread processes the ordered lane
+			std::atomic<bool>		shutdownWorkerThreads;
+			std::atomic<uint32_t>	numberOfSleepingWorkerThreads;	///< Producers only need to wake up worker threads if there are sleeping ones
+			std::mutex				mutex;							///< Only used for sending worker threads to sleep and waking them up again
+			std::condition_variable	conditionVariable;
+			WorkerThreads			workerThreads;
+		};
+
+		typedef void (ResourceStreamer::*WorkerThreadFunction)(uint32_t workerThreadIndex);
 
 
 	//[-------------------------------------------------------]
-	//[ Private definitions                                   ]
+	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
-		typedef std::deque<LoadRequest> LoadRequests;
+		explicit ResourceStreamer(IRendererRuntime& rendererRuntime);
+		~ResourceStreamer();
+		ResourceStreamer(const ResourceStreamer&) = delete;
+		ResourceStreamer& operator=(const ResourceStreamer&) = delete;
+		void setNumberOfWorkerThreads(Stage& stage, uint32_t numberOfWorkerThreads, WorkerThreadFunction workerThreadFunction);
+		static uint8_t getLaneByServingIndex(uint8_t servingIndex);
+		bool admitLoadRequest(const LoadRequest& loadRequest);
+		void admitPendingLoadRequests();
+		void pushQueueEntry(uint32_t inFlightLoadRequestIndex, uint32_t ticket);
+		void passToStage(uint32_t inFlightLoadRequestIndex, StageIndex stageIndex);	// Caller must own the claimed load request
+		bool claimLoadRequest(Stage& stage, bool firstWorkerThread, uint32_t& inFlightLoadRequestIndex, uint8_t numberOfServedLanes = NUMBER_OF_LANES);	// Lanes are served in serving index order, "1" means emergency lane only
+		void releaseInFlightLoadRequestReference(uint32_t inFlightLoadRequestIndex);
+		bool waitForLoadRequest(Stage& stage, bool firstWorkerThread, uint32_t& inFlightLoadRequestIndex);	// Returns "false" if the worker thread has to shut down
+		void waitForQueueEntries(Stage& stage, bool firstWorkerThread);	// Returns as soon as there might be something to claim or the worker threads have to shut down
+		void deserializeLoadRequest(uint32_t inFlightLoadRequestIndex);	// Caller must own the claimed load request
+		void processLoadRequest(uint32_t inFlightLoadRequestIndex);		// Caller must own the claimed load request
+		void finishCancelledLoadRequest(const LoadRequest& loadRequest);
+		void deserializationThreadWorker(uint32_t workerThreadIndex);
+		void processingThreadWorker(uint32_t workerThreadIndex);
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IRendererRuntime& mRendererRuntime;	///< Renderer runtime instance, do not destroy the instance
-		// Resource streamer stage: 1. Asynchronous deserialization
-		std::atomic<bool>		  mShutdownDeserializationThread;
-		std::mutex				  mDeserializationMutex;
-		std::condition_variable	  mDeserializationConditionVariable;
-		LoadRequests			  mDeserializationQueue;
-		std::thread				  mDeserializationThread;
-		// Resource streamer stage: 2. Asynchronous processing
-		std::atomic<bool>		  mShutdownProcessingThread;
-		std::mutex				  mProcessingMutex;
-		std::condition_variable	  mProcessingConditionVariable;
-		LoadRequests			  mProcessingQueue;
-		std::thread				  mProcessingThread;
-		// Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
-		std::mutex				  mDispatchMutex;
-		LoadRequests			  mDispatchQueue;
-		LoadRequests			  mFullyLoadedWaitingQueue;
+		IRendererRuntime&			  mRendererRuntime;	///< Renderer runtime instance, do not destroy the instance
+		InFlightLoadRequest			  mInFlightLoadRequests[MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS];
+		InFlightLoadRequestIndexQueue mFreeInFlightLoadRequestIndices;	///< Worker threads dropping the last reference to an outdated queue entry give the in-flight load request back, so this must be thread-safe
+		uint32_t					  mNumberOfInFlightLoadRequests;	///< Number of load requests which entered the first resource streamer stage and haven't been dispatched, yet
+		// Load requests waiting for room inside the resource streamer pipeline
+		LoadRequests				  mPendingLoadRequests[NUMBER_OF_LANES];
+		uint32_t					  mNumberOfPendingLoadRequests;
+		// Resource streamer stages
+		Stage						  mStages[NUMBER_OF_STAGES];
+		LoadRequests				  mFullyLoadedWaitingQueue;
 
 
 	};
@@ -26,9 +26,17 @@ namespace RendererRuntime
 
 
 	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
+	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	// TODO(co)
+	inline uint32_t ResourceStreamer::getNumberOfDeserializationThreads() const
+	{
+		return static_cast<uint32_t>(mStages[DESERIALIZATION_STAGE].workerThreads.size());
+	}
+
+	inline uint32_t ResourceStreamer::getNumberOfProcessingThreads() const
+	{
+		return static_cast<uint32_t>(mStages[PROCESSING_STAGE].workerThreads.size());
+	}
 
 
 //[-------------------------------------------------------]
@@ -35,6 +35,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class Renderable;
@@ -70,10 +71,11 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend class Renderable;	// Must be able to attach/detach itself from the material resource
-		friend MaterialResources;	// Type definition of template class
+		friend class Renderable;			// Must be able to attach/detach itself from the material resource
+		friend MaterialResources;			// Type definition of template class
 		friend class MaterialResourceLoader;
 		friend class MaterialResourceManager;
+		friend class ::RuntimeBenchmark;	// Creates material resources without material blueprint asset
 
 
 	//[-------------------------------------------------------]
@@ -236,6 +238,15 @@ namespace RendererRuntime
 		*/
 		RENDERERRUNTIME_API_EXPORT bool setPropertyByIdInternal(MaterialPropertyId materialPropertyId, const MaterialPropertyValue& materialPropertyValue, MaterialProperty::Usage materialPropertyUsage, bool changeOverwrittenState);
 
+		/**
+		*  @brief
+		*    Recalculate the cached sorting key of all attached renderables, this also discards their cached draw packets
+		*
+		*  @note
+		*    - Must be called after material data influencing the sorting key has been changed (material techniques, render queue index, shader combination properties)
+		*/
+		void calculateAttachedRenderablesSortingKey();
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
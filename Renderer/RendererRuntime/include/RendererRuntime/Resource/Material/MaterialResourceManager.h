@@ -35,6 +35,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class IRendererRuntime;
@@ -68,8 +69,9 @@ namespace RendererRuntime
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class RendererRuntimeImpl;
-		friend class IResource;			// Needed so that inside this classes an static_cast<CompositorNodeResourceManager*>(IResourceManager*) works
-		friend class MaterialResource;	// Needed so that inside this classes an static_cast<CompositorNodeResourceManager*>(IResourceManager*) works
+		friend class IResource;				// Needed so that inside this classes an static_cast<CompositorNodeResourceManager*>(IResourceManager*) works
+		friend class MaterialResource;		// Needed so that inside this classes an static_cast<CompositorNodeResourceManager*>(IResourceManager*) works
+		friend class ::RuntimeBenchmark;	// Creates material resources without material blueprint asset
 
 
 	//[-------------------------------------------------------]
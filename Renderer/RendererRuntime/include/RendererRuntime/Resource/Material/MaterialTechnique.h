@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "RendererRuntime/Resource/Material/MaterialProperty.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/MaterialBufferSlot.h"
+#include "RendererRuntime/Resource/IResourceListener.h"
 
 #include <vector>
 
@@ -64,8 +65,11 @@ namespace RendererRuntime
 	/**
 	*  @brief
 	*    Material technique
+	*
+	*  @note
+	*    - The material technique is a resource listener of its texture resources, the resolved renderer textures are cached as texture bindings so binding the material technique requires no texture resource lookups
 	*/
-	class MaterialTechnique : public MaterialBufferSlot
+	class MaterialTechnique : public MaterialBufferSlot, public IResourceListener
 	{
 
 
@@ -153,6 +157,25 @@ namespace RendererRuntime
 		void fillCommandBuffer(const IRendererRuntime& rendererRuntime, Renderer::CommandBuffer& commandBuffer);
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual RendererRuntime::IResourceListener methods ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual void onLoadingStateChange(const IResource& resource) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct TextureBinding
+		{
+			uint32_t			  rootParameterIndex;
+			Renderer::ITexturePtr texturePtr;
+		};
+		typedef std::vector<TextureBinding> TextureBindings;
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -167,6 +190,21 @@ namespace RendererRuntime
 		*/
 		void scheduleForShaderUniformUpdate();
 
+		/**
+		*  @brief
+		*    Release the textures and the cached texture bindings
+		*/
+		void releaseTextures();
+
+		/**
+		*  @brief
+		*    Gather the texture bindings and connect the material technique to the used texture resources
+		*
+		*  @param[in] rendererRuntime
+		*    Renderer runtime to use
+		*/
+		void gatherTextureBindings(const IRendererRuntime& rendererRuntime);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -175,6 +213,8 @@ namespace RendererRuntime
 		MaterialTechniqueId			mMaterialTechniqueId;			///< Material technique ID
 		MaterialBlueprintResourceId	mMaterialBlueprintResourceId;	///< Material blueprint resource ID, can be set to uninitialized value
 		mutable Textures			mTextures;
+		TextureBindings				mTextureBindings;				///< Cached texture bindings, only textures which are ready are listed
+		bool						mTextureBindingsDirty;			///< Set by texture resource loading state changes, the texture bindings are gathered again before the next usage
 
 
 	};
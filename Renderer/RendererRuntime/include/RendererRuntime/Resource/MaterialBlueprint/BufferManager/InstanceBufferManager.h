@@ -30,6 +30,8 @@
 #include "RendererRuntime/Core/Manager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
 
+#include <mutex>
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -80,6 +82,28 @@ namespace RendererRuntime
 		*/
 		~InstanceBufferManager();
 
+		/**
+		*  @brief
+		*    Begin a frame
+		*
+		*  @note
+		*    - Inside a frame, the instance texture buffer data of all draw calls is packed into one frame-wide instance texture buffer which is
+		*      uploaded only once by "RendererRuntime::InstanceBufferManager::endFrame()", each draw call addresses its range by the instance texture buffer start index
+		*    - Outside a frame or if the frame-wide instance texture buffer is full, the instance texture buffer data is copied into the command buffer per draw call,
+		*      this per draw call instance texture buffer is a separate texture buffer which gets bound per draw call so the frame-wide instance texture buffer data isn't overwritten
+		*/
+		void beginFrame();
+
+		/**
+		*  @brief
+		*    End a frame by uploading the packed frame-wide instance texture buffer data
+		*
+		*  @note
+		*    - Must be called after all command buffers of the frame have been recorded and before they're submitted to the renderer
+		*    - The uploaded data is only valid until the next frame begins, so command buffers recorded inside a frame can't be submitted again in a later frame
+		*/
+		void endFrame();
+
 		/**
 		*  @brief
 		*    Fill the instance buffer
@@ -90,16 +114,26 @@ namespace RendererRuntime
 		*    Instance uniform buffer instance to use, can be a null pointer
 		*  @param[in] instanceTextureBuffer
 		*    Instance texture buffer instance to use, can be a null pointer
-		*  @param[in] objectSpaceToWorldSpaceTransform
-		*    Object space to world space transform
+		*  @param[in] objectSpaceToWorldSpaceTransforms
+		*    Object space to world space transform of each instance, must be valid
+		*  @param[in] numberOfInstances
+		*    Number of instances, must be at least one (more than one for automatic instancing)
 		*  @param[in] materialTechnique
 		*    Used material technique
 		*  @param[out] commandBuffer
 		*    Command buffer to fill
+		*
+		*  @return
+		*    Number of instances which were filled into the instance buffer, can be less than the given number of instances if the instance buffer is full
+		*    in which case the caller has to fill the remaining instances by another call after issuing the draw call
+		*
+		*  @note
+		*    - Instance "n" uses the instance uniform buffer array element "n", so an instanced draw call must use the instance ID to access its data
+		*    - Thread safe, so command buffers can be recorded by multiple threads; each draw call gets its own range inside the frame-wide instance texture buffer so the filled data of multiple threads doesn't interfere
 		*/
-		void fillBuffer(PassBufferManager* passBufferManager, const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer,
-						const MaterialBlueprintResource::TextureBuffer* instanceTextureBuffer, const Transform& objectSpaceToWorldSpaceTransform,
-						MaterialTechnique& materialTechnique, Renderer::CommandBuffer& commandBuffer);
+		uint32_t fillBuffer(PassBufferManager* passBufferManager, const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer,
+							const MaterialBlueprintResource::TextureBuffer* instanceTextureBuffer, const Transform* const* objectSpaceToWorldSpaceTransforms,
+							uint32_t numberOfInstances, MaterialTechnique& materialTechnique, Renderer::CommandBuffer& commandBuffer);
 
 		/**
 		*  @brief
@@ -134,9 +168,14 @@ namespace RendererRuntime
 	private:
 		IRendererRuntime&		  mRendererRuntime;	///< Renderer runtime instance to use
 		Renderer::IUniformBuffer* mUniformBuffer;	///< Uniform buffer instance, always valid
-		Renderer::ITextureBuffer* mTextureBuffer;	///< Texture buffer instance, always valid
+		Renderer::ITextureBuffer* mTextureBuffer;	///< Frame-wide texture buffer instance, always valid
+		Renderer::ITextureBuffer* mDrawTextureBuffer;	///< Per draw call texture buffer instance, always valid
 		ScratchBuffer			  mUniformScratchBuffer;
-		ScratchBuffer			  mTextureScratchBuffer;
+		ScratchBuffer			  mTextureScratchBuffer;				///< Per draw call texture scratch buffer, used outside a frame or if the frame-wide texture scratch buffer is full
+		ScratchBuffer			  mFrameTextureScratchBuffer;			///< Frame-wide texture scratch buffer, uploaded once per frame
+		bool					  mFrameStarted;						///< "true" between "RendererRuntime::InstanceBufferManager::beginFrame()" and "RendererRuntime::InstanceBufferManager::endFrame()"
+		uint32_t				  mFrameTextureBufferNumberOfInstances;	///< Number of instances inside the frame-wide texture scratch buffer
+		std::mutex				  mMutex;								///< Mutex guarding the scratch buffers and the material blueprint resource listener instance scope, required for multi-threaded command buffer recording
 
 
 	};
@@ -34,13 +34,16 @@
 #include <Renderer/Public/Renderer.h>
 
 #include <map>
+#include <atomic>
+#include <mutex>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class PipelineStateCacheManagerCheck;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class ShaderProperties;
@@ -111,6 +114,8 @@ namespace RendererRuntime
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class MaterialBlueprintResource;	// Is creating and using a program cache manager instance
+		friend class PipelineStateCompiler;		// Must be able to announce asynchronous compiled pipeline state objects
+		friend class ::PipelineStateCacheManagerCheck;	// Counts the pipeline state caches
 
 
 	//[-------------------------------------------------------]
@@ -147,9 +152,48 @@ namespace RendererRuntime
 		*    Allow emergency synchronous compilation if no fallback could be found? This will result in a runtime hiccup instead of graphics artifacts.
 		*
 		*  @return
-		*    The requested pipeline state cache instance, null pointer on error, do not destroy the instance
+		*    The requested pipeline state object, null pointer on error, the pipeline state cache keeps the pipeline state object alive so don't release it
+		*
+		*  @note
+		*    - Thread safe, so command buffers can be recorded by multiple threads
+		*    - No smart pointer is returned by intent, the reference counter of renderer resources isn't thread safe
+		*/
+		Renderer::IPipelineState* getPipelineStateCacheByCombination(const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], bool allowEmergencySynchronousCompilation);
+
+		/**
+		*  @brief
+		*    Return whether or not a pipeline state cache is still using fallback data while the pipeline state compiler is working on it
+		*
+		*  @param[in] pipelineStateSignatureId
+		*    Pipeline state signature ID of the pipeline state cache
+		*
+		*  @return
+		*    "true" if the pipeline state cache is still using fallback data, else "false" (also if there's no such pipeline state cache)
+		*/
+		bool isPipelineStateCacheUsingFallback(PipelineStateSignatureId pipelineStateSignatureId);
+
+		/**
+		*  @brief
+		*    Return the number of fallback hits
+		*
+		*  @return
+		*    The number of times a fallback pipeline state was found while the pipeline state compiler was working asynchronously, useful for tuning the visual importance of shader properties
 		*/
-		Renderer::IPipelineStatePtr getPipelineStateCacheByCombination(const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], bool allowEmergencySynchronousCompilation);
+		inline uint32_t getNumberOfFallbackHits() const;
+
+		/**
+		*  @brief
+		*    Return the pipeline state generation
+		*
+		*  @return
+		*    The pipeline state generation, changes each time a previously returned pipeline state object might no longer be the current one
+		*
+		*  @remarks
+		*    Pipeline state objects returned by "RendererRuntime::PipelineStateCacheManager::getPipelineStateCacheByCombination()" can be cached by the
+		*    caller as long as the pipeline state generation doesn't change. The generation changes when an asynchronous compiled pipeline state object
+		*    replaces a fallback and when the cache is cleared.
+		*/
+		inline uint32_t getPipelineStateGeneration() const;
 
 		/**
 		*  @brief
@@ -167,21 +211,57 @@ namespace RendererRuntime
 		PipelineStateCacheManager(const PipelineStateCacheManager&) = delete;
 		PipelineStateCacheManager& operator=(const PipelineStateCacheManager&) = delete;
 
+		/**
+		*  @brief
+		*    Return a pipeline state cache by its pipeline state signature ID
+		*
+		*  @param[in] pipelineStateSignatureId
+		*    Pipeline state signature ID of the pipeline state cache to return
+		*
+		*  @return
+		*    The pipeline state cache, null pointer if there's no such pipeline state cache
+		*
+		*  @note
+		*    - The caller must hold the mutex
+		*/
+		PipelineStateCache* findPipelineStateCache(PipelineStateSignatureId pipelineStateSignatureId) const;
+
+		/**
+		*  @brief
+		*    Insert a pipeline state cache, the pipeline state cache manager takes over the ownership
+		*
+		*  @param[in] pipelineStateCache
+		*    Pipeline state cache to insert, its pipeline state signature ID must not be used by an already inserted pipeline state cache
+		*
+		*  @note
+		*    - The caller must hold the mutex
+		*/
+		void insertPipelineStateCache(PipelineStateCache& pipelineStateCache);
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		typedef std::unordered_map<PipelineStateSignatureId, PipelineStateCache*> PipelineStateCacheByPipelineStateSignatureId;
+		struct PipelineStateCacheSlot
+		{
+			PipelineStateSignatureId pipelineStateSignatureId;
+			PipelineStateCache*		 pipelineStateCache;	///< Null pointer for an empty slot
+		};
+		typedef std::vector<PipelineStateCacheSlot> PipelineStateCacheSlots;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		MaterialBlueprintResource&					 mMaterialBlueprintResource;	///< Owner material blueprint resource
-		ProgramCacheManager							 mProgramCacheManager;
-		PipelineStateCacheByPipelineStateSignatureId mPipelineStateCacheByPipelineStateSignatureId;
+		MaterialBlueprintResource&	mMaterialBlueprintResource;		///< Owner material blueprint resource
+		ProgramCacheManager			mProgramCacheManager;
+		PipelineStateCacheSlots		mPipelineStateCacheSlots;		///< Open addressing hash table using linear probing, keyed by the pipeline state signature ID, the number of slots is zero or a power of two
+		uint32_t					mNumberOfPipelineStateCaches;	///< Number of used slots inside "mPipelineStateCacheSlots"
+		std::mutex					mMutex;							///< Mutex guarding the pipeline state caches, required for multi-threaded command buffer recording
+		std::atomic<uint32_t>		mNumberOfFallbackHits;			///< Number of fallback pipeline state hits, see "RendererRuntime::PipelineStateCacheManager::getNumberOfFallbackHits()"
+		std::atomic<uint32_t>		mPipelineStateGeneration;		///< Pipeline state generation, see "RendererRuntime::PipelineStateCacheManager::getPipelineStateGeneration()"
 
 
 	};
@@ -44,13 +44,26 @@ namespace RendererRuntime
 		return mProgramCacheManager;
 	}
 
+	inline uint32_t PipelineStateCacheManager::getNumberOfFallbackHits() const
+	{
+		return mNumberOfFallbackHits;
+	}
+
+	inline uint32_t PipelineStateCacheManager::getPipelineStateGeneration() const
+	{
+		return mPipelineStateGeneration;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	inline PipelineStateCacheManager::PipelineStateCacheManager(MaterialBlueprintResource& materialBlueprintResource) :
 		mMaterialBlueprintResource(materialBlueprintResource),
-		mProgramCacheManager(*this)
+		mProgramCacheManager(*this),
+		mNumberOfPipelineStateCaches(0),
+		mNumberOfFallbackHits(0),
+		mPipelineStateGeneration(0)
 	{
 		// Nothing here
 	}
@@ -48,6 +48,7 @@ namespace Renderer
 }
 namespace RendererRuntime
 {
+	class TimeBudget;
 	class ShaderCache;
 	class IRendererRuntime;
 	class PipelineStateCache;
@@ -95,13 +96,29 @@ namespace RendererRuntime
 	public:
 		inline bool isAsynchronousCompilationEnabled() const;
 		void setAsynchronousCompilationEnabled(bool enabled);
+		inline uint32_t getNumberOfBuilderThreads() const;
+		void setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads);
 		inline uint32_t getNumberOfCompilerThreads() const;
 		void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads);
 		inline void flushBuilderQueue();
 		inline void flushCompilerQueue();
 		inline void flushAllQueues();
+
+		/**
+		*  @brief
+		*    Synchronous dispatch of all compiled pipeline state objects
+		*/
 		void dispatch();
 
+		/**
+		*  @brief
+		*    Synchronous dispatch of compiled pipeline state objects as long as the given time budget lasts
+		*
+		*  @param[in, out] timeBudget
+		*    Time budget to respect, receives the number of compiled pipeline state objects left for the next dispatch
+		*/
+		void dispatch(TimeBudget& timeBudget);
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
@@ -114,6 +131,7 @@ namespace RendererRuntime
 			// Internal
 			ShaderCache*			  shaderCache[NUMBER_OF_SHADER_TYPES];
 			std::string				  shaderSourceCode[NUMBER_OF_SHADER_TYPES];
+			std::vector<uint8_t>	  shaderBytecode[NUMBER_OF_SHADER_TYPES];	///< Persistent shader bytecode to use instead of shader source code
 			Renderer::IPipelineState* pipelineStateObject;
 
 			explicit CompilerRequest(PipelineStateCache& _pipelineStateCache) :
@@ -133,11 +151,13 @@ namespace RendererRuntime
 				{
 					shaderCache[i]		= compilerRequest.shaderCache[i];
 					shaderSourceCode[i] = compilerRequest.shaderSourceCode[i];
+					shaderBytecode[i]	= compilerRequest.shaderBytecode[i];
 				}
 			}
 			CompilerRequest& operator=(const CompilerRequest&) = delete;
 		};
 
+		typedef std::vector<std::thread> BuilderThreads;
 		typedef std::vector<std::thread> CompilerThreads;
 		typedef std::deque<CompilerRequest> CompilerRequests;
 
@@ -163,6 +183,7 @@ namespace RendererRuntime
 	private:
 		IRendererRuntime& mRendererRuntime;	///< Renderer runtime instance, do not destroy the instance
 		bool			  mAsynchronousCompilationEnabled;
+		uint32_t		  mNumberOfBuilderThreads;
 		uint32_t		  mNumberOfCompilerThreads;
 
 		// Asynchronous building (moderate cost)
@@ -170,7 +191,7 @@ namespace RendererRuntime
 		std::mutex				mBuilderMutex;
 		std::condition_variable	mBuilderConditionVariable;
 		CompilerRequests		mBuilderQueue;
-		std::thread				mBuilderThread;
+		BuilderThreads			mBuilderThreads;
 
 		// Asynchronous compilation (nuts cost)
 		std::atomic<bool>		mShutdownCompilerThread;
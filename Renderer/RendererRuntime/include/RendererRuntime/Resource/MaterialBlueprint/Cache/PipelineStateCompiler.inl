@@ -33,6 +33,11 @@ namespace RendererRuntime
 		return mAsynchronousCompilationEnabled;
 	}
 
+	inline uint32_t PipelineStateCompiler::getNumberOfBuilderThreads() const
+	{
+		return mNumberOfBuilderThreads;
+	}
+
 	inline uint32_t PipelineStateCompiler::getNumberOfCompilerThreads() const
 	{
 		return mNumberOfCompilerThreads;
@@ -73,6 +73,32 @@ namespace RendererRuntime
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Generate a pipeline state signature ID without creating a pipeline state signature instance
+		*
+		*  @param[in] materialBlueprintResource
+		*    Material blueprint resource to use
+		*  @param[in] shaderProperties
+		*    Shader properties to use, you should ensure that this shader properties are already optimized by using e.g. "RendererRuntime::MaterialBlueprintResource::optimizeShaderProperties()"
+		*  @param[in] dynamicShaderPieces
+		*    Dynamic via C++ generated shader pieces to use
+		*  @param[out] shaderCombinationId
+		*    Receives the shader combination ID per shader type, uninitialized for shader types not used by the material blueprint resource
+		*
+		*  @return
+		*    The pipeline state signature ID, identical to the one of a pipeline state signature instance constructed from the same input data
+		*
+		*  @note
+		*    - Only hashes the given input data, no memory allocations are involved, used for pipeline state cache lookups
+		*/
+		static PipelineStateSignatureId generatePipelineStateSignatureId(const MaterialBlueprintResource& materialBlueprintResource, const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], ShaderCombinationId shaderCombinationId[NUMBER_OF_SHADER_TYPES]);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
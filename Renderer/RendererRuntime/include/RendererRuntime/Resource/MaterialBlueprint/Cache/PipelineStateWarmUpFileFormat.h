@@ -18,7 +18,16 @@
 \*********************************************************/
 
 
-// TODO(co) Code-style adoptions and extensions
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
 
 
 //[-------------------------------------------------------]
@@ -28,92 +37,50 @@ namespace RendererRuntime
 {
 
 
-	template <typename RetType>
-	ThreadPool<RetType>::ThreadPool(size_t threads)
-	{
-		if (isUninitialized(threads))
-		{
-			threads = std::thread::hardware_concurrency();
-		}
-		if (threads == 0)
-		{
-			threads = 1;
-		}
-		this->threads = threads;
-	}
-
-	template <typename RetType>
-	ThreadPool<RetType>::~ThreadPool()
-	{
-		// If thread is running then wait for it to complete
-		if (thread.joinable())
-		{
-			thread.join();
-		}
-	}
-
-	template <typename RetType>
-	void ThreadPool<RetType>::queueTask(const Task &task)
-	{
-		tasks.push(task);
-	}
-
-	template <typename RetType>
-	void ThreadPool<RetType>::queueTask(Task &&task)
+	// -> Pipeline state warm-up file format content:
+	//    - Persistent cache file header, see "RendererRuntime::PersistentCacheFile"
+	//    - Pipeline state warm-up header
+	//    - Payload
+	//      - Material blueprint entries, each followed by its shader combinations
+	//        - Shader combination entries, each followed by its shader properties
+	namespace v1PipelineStateWarmUp
 	{
-		tasks.emplace(std::move(task));
-	}
 
-	template <typename RetType>
-	void ThreadPool<RetType>::process(Callback callback)
-	{
-		if (callback)
-		{
-			thread = std::thread([&]{
-				_process();
-				callback();
-			});
-		}
-		else
-		{
-			_process();
-		}
-	}
-
-	template <typename RetType>
-	void ThreadPool<RetType>::_process()
-	{
-		std::lock_guard<std::mutex> lock(processMutex);
-		futuresDone.clear();
 
-		while (!tasks.empty())
-		{
-			const size_t taskAmount = tasks.size();
-			const size_t amount = (threads > taskAmount ? taskAmount : threads);
+		//[-------------------------------------------------------]
+		//[ Definitions                                           ]
+		//[-------------------------------------------------------]
+		static const uint32_t FORMAT_TYPE	 = StringId("PipelineStateWarmUp");
+		static const uint32_t FORMAT_VERSION = 1;
 
-			for (size_t i = 0; i < amount; ++i)
+		#pragma pack(push)
+		#pragma pack(1)
+			struct Header
 			{
-				auto task = tasks.front();
-				tasks.pop();
+				uint32_t numberOfMaterialBlueprints;
+			};
 
-				auto future = std::async(std::launch::async, [=] {
-					return task();
-					});
-				futuresPending.emplace_back(std::move(future));
-			}
+			struct MaterialBlueprintHeader
+			{
+				uint32_t materialBlueprintAssetId;
+				uint32_t numberOfShaderCombinations;
+			};
 
-			for (auto &future : futuresPending)
+			struct ShaderCombinationHeader
 			{
-				future.wait();
-				futuresDone.emplace_back(std::move(future));
-			}
+				uint32_t numberOfShaderProperties;
+			};
 
-			futuresPending.clear();
-		}
-	}
+			struct ShaderProperty
+			{
+				uint32_t shaderPropertyId;
+				int32_t  value;
+			};
+		#pragma pack(pop)
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
+	} // v1PipelineStateWarmUp
 } // RendererRuntime
@@ -0,0 +1,265 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Export.h"
+#include "RendererRuntime/Core/Manager.h"
+#include "RendererRuntime/Core/StringId.h"
+#include "RendererRuntime/Core/File/PersistentCacheFile.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+	class IFile;
+	class MaterialBlueprintResource;
+	class MaterialBlueprintResourceManager;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef StringId AssetId;	///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset type>/<asset category>/<asset name>"
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/*
+	*  @brief
+	*    Pipeline state warm-up manager
+	*
+	*  @remarks
+	*    Records the shader combinations each material blueprint actually requested and persists this warm-up list. During the next run, the recorded
+	*    shader combinations are requested as soon as the material blueprint has been loaded. When using asynchronous pipeline state compilation,
+	*    the pipeline state compiler threads are working on them while the loading continues, so the fallback pipeline state caches and emergency
+	*    synchronous compilations are avoided during steady state rendering.
+	*
+	*    Dynamic shader pieces aren't recorded, they're not filled by the renderer runtime, yet.
+	*
+	*  @see
+	*    - See "RendererRuntime::PipelineStateCacheManager" for additional information
+	*/
+	class PipelineStateWarmUpManager : private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class MaterialBlueprintResourceManager;	// Is creating and using a pipeline state warm-up manager instance
+		friend class PipelineStateCacheManager;			// Is recording the requested shader combinations
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the owner material blueprint resource manager
+		*
+		*  @return
+		*    The owner material blueprint resource manager
+		*/
+		inline MaterialBlueprintResourceManager& getMaterialBlueprintResourceManager() const;
+
+		/**
+		*  @brief
+		*    Load the warm-up list by using the given filename, the file is also used to write back the warm-up list
+		*
+		*  @param[in] filename
+		*    ASCII name of the warm-up list file, never ever a null pointer and always finished by a terminating zero
+		*
+		*  @note
+		*    - Should be called during startup after the asset packages have been added, the material blueprints inside the warm-up list are loaded and warmed up at once
+		*    - A missing or corrupted file results in an empty warm-up list which is written back later on
+		*    - Changes are written back by "RendererRuntime::MaterialBlueprintResourceManager::update()" as soon as no new shader combinations are recorded, as well as during shutdown
+		*/
+		RENDERERRUNTIME_API_EXPORT void loadWarmUpListByFilename(const char* filename);
+
+		/**
+		*  @brief
+		*    Write back the warm-up list to the file given to "RendererRuntime::PipelineStateWarmUpManager::loadWarmUpListByFilename()", if there are unsaved changes
+		*/
+		RENDERERRUNTIME_API_EXPORT void saveDirtyWarmUpList();
+
+		/**
+		*  @brief
+		*    Load the warm-up list from the given file
+		*
+		*  @param[in] file
+		*    File to read from
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (corrupted file, the warm-up list is left empty in this case)
+		*/
+		RENDERERRUNTIME_API_EXPORT bool loadWarmUpList(IFile& file);
+
+		/**
+		*  @brief
+		*    Save the warm-up list into the given file
+		*
+		*  @param[in] file
+		*    File to write into
+		*/
+		RENDERERRUNTIME_API_EXPORT void saveWarmUpList(IFile& file);
+
+		/**
+		*  @brief
+		*    Request all recorded shader combinations of the given material blueprint resource
+		*
+		*  @param[in] materialBlueprintResource
+		*    Fully loaded material blueprint resource to warm up
+		*
+		*  @note
+		*    - Called automatically as soon as a material blueprint resource has been loaded
+		*    - The shader combinations precompiled by the renderer toolkit are requested as well, see "RendererRuntime::MaterialBlueprintResource::getPrecompiledShaderCombinations()"
+		*    - Recorded shader properties which are no longer shader combination properties of the material blueprint are ignored
+		*/
+		void warmUpMaterialBlueprintResource(MaterialBlueprintResource& materialBlueprintResource);
+
+		/**
+		*  @brief
+		*    Return the number of shader combinations requested by the warm-up
+		*
+		*  @return
+		*    The number of shader combinations requested by the warm-up
+		*/
+		inline uint32_t getNumberOfWarmUpShaderCombinations() const;
+
+		/**
+		*  @brief
+		*    Return the number of shader combinations requested by the warm-up which are still compiled by the pipeline state compiler
+		*
+		*  @return
+		*    The number of shader combinations requested by the warm-up which are still compiled by the pipeline state compiler, zero means the warm-up is finished
+		*
+		*  @note
+		*    - Together with "RendererRuntime::PipelineStateWarmUpManager::getNumberOfWarmUpShaderCombinations()" this can be used to e.g. show a loading progress
+		*    - Not thread safe, call it from the thread calling "RendererRuntime::PipelineStateCompiler::dispatch()"
+		*/
+		RENDERERRUNTIME_API_EXPORT uint32_t getNumberOfPendingWarmUpShaderCombinations();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<ShaderProperties::SortedPropertyVector> ShaderCombinations;
+		typedef std::unordered_map<uint32_t, ShaderCombinations>	ShaderCombinationsByMaterialBlueprintAssetId;	///< Key = POD material blueprint asset ID
+		typedef std::unordered_set<uint32_t>						ShaderCombinationIds;
+		typedef std::unordered_set<uint32_t>						PipelineStateSignatureIds;
+		typedef std::vector<std::pair<uint32_t, uint32_t>>			PendingPipelineStateCaches;						///< POD material blueprint resource ID and pipeline state signature ID pairs
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit PipelineStateWarmUpManager(MaterialBlueprintResourceManager& materialBlueprintResourceManager);
+		~PipelineStateWarmUpManager();
+		PipelineStateWarmUpManager(const PipelineStateWarmUpManager&) = delete;
+		PipelineStateWarmUpManager& operator=(const PipelineStateWarmUpManager&) = delete;
+		void update();
+
+		/**
+		*  @brief
+		*    Record a requested shader combination of a material blueprint
+		*
+		*  @param[in] materialBlueprintAssetId
+		*    Asset ID of the material blueprint
+		*  @param[in] shaderProperties
+		*    Shader properties of the requested shader combination
+		*
+		*  @note
+		*    - Thread safe, so command buffers can be recorded by multiple threads
+		*/
+		void addShaderCombination(AssetId materialBlueprintAssetId, const ShaderProperties& shaderProperties);
+
+		/**
+		*  @brief
+		*    Request the pipeline state caches of the given shader combinations
+		*
+		*  @param[in] materialBlueprintResource
+		*    Fully loaded material blueprint resource to request the pipeline state caches from
+		*  @param[in] shaderCombinations
+		*    Shader combinations to request, shader properties which are no shader combination properties of the material blueprint are ignored
+		*  @param[in, out] pipelineStateSignatureIds
+		*    Pipeline state signature IDs already requested by the current warm-up, shader combinations resulting in one of them are skipped
+		*/
+		void requestShaderCombinations(MaterialBlueprintResource& materialBlueprintResource, const ShaderCombinations& shaderCombinations, PipelineStateSignatureIds& pipelineStateSignatureIds);
+
+		// The caller must lock the mutex
+		bool insertShaderCombination(AssetId materialBlueprintAssetId, const ShaderProperties::SortedPropertyVector& sortedPropertyVector);
+		static uint32_t calculateShaderCombinationId(AssetId materialBlueprintAssetId, const ShaderProperties::SortedPropertyVector& sortedPropertyVector);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		MaterialBlueprintResourceManager&			 mMaterialBlueprintResourceManager;			///< Owner material blueprint resource manager
+		ShaderCombinationsByMaterialBlueprintAssetId mShaderCombinationsByMaterialBlueprintAssetId;
+		ShaderCombinationIds						 mShaderCombinationIds;						///< Used to detect already recorded shader combinations, result of hashing the material blueprint asset ID and the shader properties
+		std::mutex									 mMutex;									///< Mutex guarding the warm-up list, required for multi-threaded command buffer recording
+		PersistentCacheFile							 mWarmUpListFile;							///< Warm-up list file, each newly recorded shader combination is a change
+		// Warm-up progress
+		uint32_t									 mNumberOfWarmUpShaderCombinations;			///< Number of shader combinations requested by the warm-up
+		PendingPipelineStateCaches					 mPendingPipelineStateCaches;				///< Pipeline state caches requested by the warm-up which might still use fallback data
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateWarmUpManager.inl"
@@ -0,0 +1,205 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Export.h"
+#include "RendererRuntime/Core/Manager.h"
+#include "RendererRuntime/Core/File/PersistentCacheFile.h"
+
+#include <Renderer/Public/Renderer.h>
+
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+	class IFile;
+	class MaterialBlueprintResourceManager;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/*
+	*  @brief
+	*    Program binary cache manager
+	*
+	*  @remarks
+	*    Persistent implementation of the renderer program binary cache interface. Renderer backends which are able to receive the binary of linked
+	*    programs (e.g. OpenGL with "GL_ARB_get_program_binary") store them inside the program binary cache, during the next run the program binaries
+	*    are used instead of compiling and linking the shader source codes. The program binary IDs are calculated by the renderer backend and already
+	*    include the graphics driver, so program binaries of another graphics driver are simply never requested.
+	*
+	*  @see
+	*    - See "Renderer::IProgramBinaryCache" for additional information
+	*/
+	class ProgramBinaryCacheManager : public Renderer::IProgramBinaryCache, private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class MaterialBlueprintResourceManager;	// Is creating and using a program binary cache manager instance
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the owner material blueprint resource manager
+		*
+		*  @return
+		*    The owner material blueprint resource manager
+		*/
+		inline MaterialBlueprintResourceManager& getMaterialBlueprintResourceManager() const;
+
+		/**
+		*  @brief
+		*    Load the program binary cache by using the given filename and set it as renderer program binary cache, the file is also used to write back the program binary cache
+		*
+		*  @param[in] filename
+		*    ASCII name of the program binary cache file, never ever a null pointer and always finished by a terminating zero
+		*
+		*  @note
+		*    - Must be called during startup before any shader has been created, else the already created programs are not cached
+		*    - A missing or corrupted file results in an empty program binary cache which is written back later on
+		*    - Changes are written back by "RendererRuntime::MaterialBlueprintResourceManager::update()" as soon as no new program binaries are added, as well as during shutdown
+		*/
+		RENDERERRUNTIME_API_EXPORT void loadProgramBinaryCacheByFilename(const char* filename);
+
+		/**
+		*  @brief
+		*    Write back the program binary cache to the file given to "RendererRuntime::ProgramBinaryCacheManager::loadProgramBinaryCacheByFilename()", if there are unsaved changes
+		*/
+		RENDERERRUNTIME_API_EXPORT void saveDirtyProgramBinaryCache();
+
+		/**
+		*  @brief
+		*    Load the program binary cache from the given file
+		*
+		*  @param[in] file
+		*    File to read from
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (corrupted file, the program binary cache is left empty in this case)
+		*
+		*  @note
+		*    - Previously returned program binary pointers are invalidated
+		*/
+		RENDERERRUNTIME_API_EXPORT bool loadProgramBinaryCache(IFile& file);
+
+		/**
+		*  @brief
+		*    Save the program binary cache into the given file
+		*
+		*  @param[in] file
+		*    File to write into
+		*/
+		RENDERERRUNTIME_API_EXPORT void saveProgramBinaryCache(IFile& file);
+
+		/**
+		*  @brief
+		*    Return the number of program binaries
+		*
+		*  @return
+		*    The number of program binaries
+		*/
+		RENDERERRUNTIME_API_EXPORT uint32_t getNumberOfProgramBinaries();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IProgramBinaryCache methods  ]
+	//[-------------------------------------------------------]
+	public:
+		virtual const uint8_t* getProgramBinary(uint64_t programBinaryId, uint32_t& binaryFormat, uint32_t& numberOfBytes) override;
+		virtual void setProgramBinary(uint64_t programBinaryId, uint32_t binaryFormat, const uint8_t* binary, uint32_t numberOfBytes) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct ProgramBinary
+		{
+			uint32_t			 binaryFormat;
+			std::vector<uint8_t> binary;
+		};
+		typedef std::unordered_map<uint64_t, ProgramBinary> ProgramBinaries;	///< Key = program binary ID
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit ProgramBinaryCacheManager(MaterialBlueprintResourceManager& materialBlueprintResourceManager);
+		virtual ~ProgramBinaryCacheManager();
+		ProgramBinaryCacheManager(const ProgramBinaryCacheManager&) = delete;
+		ProgramBinaryCacheManager& operator=(const ProgramBinaryCacheManager&) = delete;
+		void update();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		MaterialBlueprintResourceManager& mMaterialBlueprintResourceManager;		///< Owner material blueprint resource manager
+		ProgramBinaries					  mProgramBinaries;
+		std::mutex						  mMutex;									///< Mutex guarding the program binaries, the renderer might create programs by using multiple threads
+		PersistentCacheFile				  mProgramBinaryCacheFile;					///< Program binary cache file, each program binary handed over by the renderer is a change
+		bool							  mRegistered;								///< "true" if this is the renderer program binary cache, else "false"
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/ProgramBinaryCacheManager.inl"
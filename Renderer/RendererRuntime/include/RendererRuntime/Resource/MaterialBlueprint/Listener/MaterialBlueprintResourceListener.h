@@ -93,7 +93,7 @@ namespace RendererRuntime
 		RENDERERRUNTIME_API_EXPORT virtual bool fillPassValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes) override;
 		inline virtual void beginFillMaterial() override;
 		inline virtual bool fillMaterialValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes) override;
-		inline virtual void beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique) override;
+		inline virtual void beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique, uint32_t instanceTextureBufferStartIndex) override;
 		RENDERERRUNTIME_API_EXPORT virtual bool fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes) override;
 
 
@@ -113,6 +113,7 @@ namespace RendererRuntime
 		// Instance
 		const Transform*   mObjectSpaceToWorldSpaceTransform;
 		MaterialTechnique* mMaterialTechnique;
+		uint32_t		   mInstanceTextureBufferStartIndex;	///< Instance texture buffer start index (in texel) of the instance, changes per instance when automatic instancing is used
 
 
 	};
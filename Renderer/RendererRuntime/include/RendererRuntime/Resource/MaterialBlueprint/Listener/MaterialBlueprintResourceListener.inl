@@ -43,7 +43,8 @@ namespace RendererRuntime
 		mNearZ(0.0f),
 		mFarZ(0.0f),
 		mObjectSpaceToWorldSpaceTransform(nullptr),
-		mMaterialTechnique(nullptr)
+		mMaterialTechnique(nullptr),
+		mInstanceTextureBufferStartIndex(0)
 	{
 		// Nothing here
 	}
@@ -93,7 +94,7 @@ namespace RendererRuntime
 		return false;
 	}
 
-	inline void MaterialBlueprintResourceListener::beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique)
+	inline void MaterialBlueprintResourceListener::beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique, uint32_t instanceTextureBufferStartIndex)
 	{
 		// Remember the pass data memory address of the current scope
 		// TODO(co) Rethink the evil const-cast on here
@@ -102,6 +103,7 @@ namespace RendererRuntime
 		// Remember the instance data of the current scope
 		mObjectSpaceToWorldSpaceTransform = &objectSpaceToWorldSpaceTransform;
 		mMaterialTechnique				  = &materialTechnique;
+		mInstanceTextureBufferStartIndex  = instanceTextureBufferStartIndex;
 	}
 
 
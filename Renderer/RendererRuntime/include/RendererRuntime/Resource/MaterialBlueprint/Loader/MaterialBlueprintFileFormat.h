@@ -48,6 +48,9 @@ namespace RendererRuntime
 	//      - Uniform buffers
 	//      - Sampler states
 	//      - Textures
+	//    - Precompiled shader combinations
+	//      - Number of shader properties per shader combination
+	//      - Shader properties of all shader combinations
 	namespace v1MaterialBlueprint
 	{
 
@@ -56,7 +59,7 @@ namespace RendererRuntime
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static const uint32_t FORMAT_TYPE	 = StringId("MaterialBlueprint");
-		static const uint32_t FORMAT_VERSION = 1;
+		static const uint32_t FORMAT_VERSION = 2;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -71,6 +74,8 @@ namespace RendererRuntime
 				uint32_t numberOfTextureBuffers;
 				uint32_t numberOfSamplerStates;
 				uint32_t numberOfTextures;
+				uint32_t numberOfPrecompiledShaderCombinations;
+				uint32_t numberOfPrecompiledShaderCombinationProperties;
 			};
 
 			struct RootSignatureHeader
@@ -39,6 +39,8 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class PipelineStateCacheManagerCheck;	// "Example/ExampleRuntimeCheck"
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class PassBufferManager;
@@ -102,6 +104,8 @@ namespace RendererRuntime
 		friend class MaterialResourceLoader;		// TODO(co) Decent material resource list management inside the material blueprint resource (link, unlink etc.) - remove this
 		friend class MaterialResourceManager;		// TODO(co) Remove
 		friend class MaterialBufferManager;			// TODO(co) Remove. Decent material technique list management inside the material blueprint resource (link, unlink etc.)
+		friend class ::PipelineStateCacheManagerCheck;	// Creates material blueprint resources without loading them
+		friend class ::RuntimeBenchmark;				// Creates material blueprint resources without loading them
 
 
 	//[-------------------------------------------------------]
@@ -123,6 +127,8 @@ namespace RendererRuntime
 			LIGHT			///< Light buffer usage for texture buffer only
 		};
 
+		typedef std::vector<ShaderPropertyId> ShaderPropertyIds;
+		typedef std::vector<ShaderProperties::SortedPropertyVector> ShaderCombinations;
 		typedef std::vector<MaterialProperty> UniformBufferElementProperties;
 
 		struct UniformBuffer
@@ -229,6 +235,19 @@ namespace RendererRuntime
 		*/
 		inline int32_t getVisualImportanceOfShaderProperty(ShaderPropertyId shaderPropertyId) const;
 
+		/**
+		*  @brief
+		*    Return the fallback chain
+		*
+		*  @return
+		*    The non-mandatory shader properties in the order they're sacrificed when finding a fallback pipeline state, ascending visual importance
+		*
+		*  @note
+		*    - Derived once from the visual importance of the shader properties when the material blueprint is loaded
+		*    - Shader properties without visual importance entry aren't part of the fallback chain, they have the visual importance 0
+		*/
+		inline const ShaderPropertyIds& getFallbackChain() const;
+
 		/**
 		*  @brief
 		*    Return the maximum integer value (inclusive) of a shader property
@@ -238,6 +257,19 @@ namespace RendererRuntime
 		*/
 		inline int32_t getMaximumIntegerValueOfShaderProperty(ShaderPropertyId shaderPropertyId) const;
 
+		/**
+		*  @brief
+		*    Return the precompiled shader combinations
+		*
+		*  @return
+		*    The optimized shader combinations the renderer toolkit found to be reachable by the material blueprint property ranges and the materials referencing the material blueprint
+		*
+		*  @note
+		*    - Requested by "RendererRuntime::PipelineStateWarmUpManager" as soon as the material blueprint has been loaded, so runtime shader combination generation is the exception
+		*    - Empty if the material blueprint asset compiler option "PrecompileShaderCombinations" isn't used
+		*/
+		inline const ShaderCombinations& getPrecompiledShaderCombinations() const;
+
 		/**
 		*  @brief
 		*    Optimize the given shader properties
@@ -455,6 +487,15 @@ namespace RendererRuntime
 		void initializeElement(MaterialBlueprintResourceId materialBlueprintResourceId);
 		void deinitializeElement();
 
+		/**
+		*  @brief
+		*    Derive the fallback chain from the visual importance of the shader properties
+		*
+		*  @remarks
+		*    Non-mandatory shader properties are ordered by ascending visual importance, ties are ordered by ascending shader property ID
+		*/
+		void calculateFallbackChain();
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -464,6 +505,8 @@ namespace RendererRuntime
 		MaterialProperties					 mMaterialProperties;
 		ShaderProperties					 mVisualImportanceOfShaderProperties;		///< Every shader property known to the material blueprint has a visual importance entry in here
 		ShaderProperties					 mMaximumIntegerValueOfShaderProperties;	///< The maximum integer value (inclusive) of a shader property
+		ShaderPropertyIds					 mFallbackChain;							///< Non-mandatory shader properties in the order they're sacrificed when finding a fallback pipeline state
+		ShaderCombinations					 mPrecompiledShaderCombinations;			///< Shader combinations enumerated by the renderer toolkit, requested as soon as the material blueprint has been loaded
 		Renderer::VertexAttributes			 mVertexAttributes;
 		Renderer::IRootSignaturePtr			 mRootSignaturePtr;							///< Root signature, can be a null pointer
 		Renderer::PipelineState				 mPipelineState;
@@ -43,11 +43,21 @@ namespace RendererRuntime
 		return mVisualImportanceOfShaderProperties.getPropertyValueUnsafe(shaderPropertyId);
 	}
 
+	inline const MaterialBlueprintResource::ShaderPropertyIds& MaterialBlueprintResource::getFallbackChain() const
+	{
+		return mFallbackChain;
+	}
+
 	inline int32_t MaterialBlueprintResource::getMaximumIntegerValueOfShaderProperty(ShaderPropertyId shaderPropertyId) const
 	{
 		return mMaximumIntegerValueOfShaderProperties.getPropertyValueUnsafe(shaderPropertyId);
 	}
 
+	inline const MaterialBlueprintResource::ShaderCombinations& MaterialBlueprintResource::getPrecompiledShaderCombinations() const
+	{
+		return mPrecompiledShaderCombinations;
+	}
+
 	inline const Renderer::VertexAttributes& MaterialBlueprintResource::getVertexAttributes() const
 	{
 		return mVertexAttributes;
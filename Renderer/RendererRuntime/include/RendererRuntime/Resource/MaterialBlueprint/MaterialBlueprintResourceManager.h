@@ -30,11 +30,15 @@
 #include "RendererRuntime/Core/PackedElementManager.h"
 #include "RendererRuntime/Resource/Detail/IResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateWarmUpManager.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/ProgramBinaryCacheManager.h"
 
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class PipelineStateCacheManagerCheck;	// "Example/ExampleRuntimeCheck"
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class IRendererRuntime;
@@ -71,6 +75,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 		friend class RendererRuntimeImpl;
 		friend class IResource;	// Needed so that inside this classes an static_cast<CompositorNodeResourceManager*>(IResourceManager*) works
+		friend class ::PipelineStateCacheManagerCheck;	// Creates material blueprint resources without loading them
+		friend class ::RuntimeBenchmark;				// Creates material blueprint resources without loading them
 
 
 	//[-------------------------------------------------------]
@@ -96,6 +102,8 @@ namespace RendererRuntime
 
 		inline InstanceBufferManager& getInstanceBufferManager() const;
 		inline LightBufferManager& getLightBufferManager() const;
+		inline PipelineStateWarmUpManager& getPipelineStateWarmUpManager();
+		inline ProgramBinaryCacheManager& getProgramBinaryCacheManager();
 
 
 	//[-------------------------------------------------------]
@@ -129,6 +137,8 @@ namespace RendererRuntime
 		MaterialProperties					mGlobalMaterialProperties;			///< Global material properties
 		InstanceBufferManager*				mInstanceBufferManager;				///< Instance buffer manager, always valid in a sane none-legacy environment
 		LightBufferManager*					mLightBufferManager;				///< Light buffer manager, always valid in a sane none-legacy environment
+		PipelineStateWarmUpManager			mPipelineStateWarmUpManager;
+		ProgramBinaryCacheManager			mProgramBinaryCacheManager;
 
 
 	};
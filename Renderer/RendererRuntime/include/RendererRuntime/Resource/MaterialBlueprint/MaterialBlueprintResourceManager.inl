@@ -69,6 +69,16 @@ namespace RendererRuntime
 		return *mLightBufferManager;
 	}
 
+	inline PipelineStateWarmUpManager& MaterialBlueprintResourceManager::getPipelineStateWarmUpManager()
+	{
+		return mPipelineStateWarmUpManager;
+	}
+
+	inline ProgramBinaryCacheManager& MaterialBlueprintResourceManager::getProgramBinaryCacheManager()
+	{
+		return mProgramBinaryCacheManager;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RendererRuntime::IResourceManager methods ]
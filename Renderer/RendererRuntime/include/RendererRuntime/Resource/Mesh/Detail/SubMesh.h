@@ -27,6 +27,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "RendererRuntime/Core/Math/Math.h"
+
 #include <Renderer/Public/Renderer.h>
 
 
@@ -75,6 +77,14 @@ namespace RendererRuntime
 		inline uint32_t getStartIndexLocation() const;
 		inline uint32_t getNumberOfIndices() const;
 
+		//[-------------------------------------------------------]
+		//[ Bounding                                              ]
+		//[-------------------------------------------------------]
+		inline const glm::vec3& getMinimumBoundingBoxPosition() const;	// Object space
+		inline const glm::vec3& getMaximumBoundingBoxPosition() const;	// Object space
+		inline const glm::vec3& getBoundingSpherePosition() const;		// Object space
+		inline float getBoundingSphereRadius() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -84,6 +94,11 @@ namespace RendererRuntime
 		Renderer::PrimitiveTopology mPrimitiveTopology;
 		uint32_t					mStartIndexLocation;
 		uint32_t					mNumberOfIndices;
+		// Bounding
+		glm::vec3					mMinimumBoundingBoxPosition;	///< Object space
+		glm::vec3					mMaximumBoundingBoxPosition;	///< Object space
+		glm::vec3					mBoundingSpherePosition;		///< Object space
+		float						mBoundingSphereRadius;
 
 
 	};
@@ -38,7 +38,11 @@ namespace RendererRuntime
 		mMaterialResourceId(getUninitialized<MaterialResourceId>()),
 		mPrimitiveTopology(Renderer::PrimitiveTopology::UNKNOWN),
 		mStartIndexLocation(0),
-		mNumberOfIndices(0)
+		mNumberOfIndices(0),
+		mMinimumBoundingBoxPosition(Math::ZERO_VECTOR),
+		mMaximumBoundingBoxPosition(Math::ZERO_VECTOR),
+		mBoundingSpherePosition(Math::ZERO_VECTOR),
+		mBoundingSphereRadius(0.0f)
 	{
 		// Nothing here
 	}
@@ -47,7 +51,11 @@ namespace RendererRuntime
 		mMaterialResourceId(materialResourceId),
 		mPrimitiveTopology(primitiveTopology),
 		mStartIndexLocation(startIndexLocation),
-		mNumberOfIndices(numberOfIndices)
+		mNumberOfIndices(numberOfIndices),
+		mMinimumBoundingBoxPosition(Math::ZERO_VECTOR),
+		mMaximumBoundingBoxPosition(Math::ZERO_VECTOR),
+		mBoundingSpherePosition(Math::ZERO_VECTOR),
+		mBoundingSphereRadius(0.0f)
 	{
 		// Nothing here
 	}
@@ -61,7 +69,11 @@ namespace RendererRuntime
 		mMaterialResourceId(subMesh.mMaterialResourceId),
 		mPrimitiveTopology(subMesh.mPrimitiveTopology),
 		mStartIndexLocation(subMesh.mStartIndexLocation),
-		mNumberOfIndices(subMesh.mNumberOfIndices)
+		mNumberOfIndices(subMesh.mNumberOfIndices),
+		mMinimumBoundingBoxPosition(subMesh.mMinimumBoundingBoxPosition),
+		mMaximumBoundingBoxPosition(subMesh.mMaximumBoundingBoxPosition),
+		mBoundingSpherePosition(subMesh.mBoundingSpherePosition),
+		mBoundingSphereRadius(subMesh.mBoundingSphereRadius)
 	{
 		// Nothing here
 	}
@@ -72,6 +84,10 @@ namespace RendererRuntime
 		mPrimitiveTopology	= subMesh.mPrimitiveTopology;
 		mStartIndexLocation = subMesh.mStartIndexLocation;
 		mNumberOfIndices	= subMesh.mNumberOfIndices;
+		mMinimumBoundingBoxPosition = subMesh.mMinimumBoundingBoxPosition;
+		mMaximumBoundingBoxPosition = subMesh.mMaximumBoundingBoxPosition;
+		mBoundingSpherePosition		= subMesh.mBoundingSpherePosition;
+		mBoundingSphereRadius		= subMesh.mBoundingSphereRadius;
 
 		// Done
 		return *this;
@@ -97,6 +113,26 @@ namespace RendererRuntime
 		return mNumberOfIndices;
 	}
 
+	inline const glm::vec3& SubMesh::getMinimumBoundingBoxPosition() const
+	{
+		return mMinimumBoundingBoxPosition;
+	}
+
+	inline const glm::vec3& SubMesh::getMaximumBoundingBoxPosition() const
+	{
+		return mMaximumBoundingBoxPosition;
+	}
+
+	inline const glm::vec3& SubMesh::getBoundingSpherePosition() const
+	{
+		return mBoundingSpherePosition;
+	}
+
+	inline float SubMesh::getBoundingSphereRadius() const
+	{
+		return mBoundingSphereRadius;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
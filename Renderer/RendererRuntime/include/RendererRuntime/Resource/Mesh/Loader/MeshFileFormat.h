@@ -56,7 +56,7 @@ namespace RendererRuntime
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static const uint32_t FORMAT_TYPE	 = StringId("Mesh");
-		static const uint32_t FORMAT_VERSION = 1;
+		static const uint32_t FORMAT_VERSION = 2;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -65,6 +65,11 @@ namespace RendererRuntime
 				// Format
 				uint32_t formatType;
 				uint16_t formatVersion;
+				// Bounding, object space axis aligned bounding box (AABB) and bounding sphere
+				float	 minimumBoundingBoxPosition[3];
+				float	 maximumBoundingBoxPosition[3];
+				float	 boundingSpherePosition[3];
+				float	 boundingSphereRadius;
 				// Vertex and index data
 				uint8_t  numberOfBytesPerVertex;
 				uint32_t numberOfVertices;
@@ -81,6 +86,11 @@ namespace RendererRuntime
 				uint8_t  primitiveTopology;	// "Renderer::PrimitiveTopology"-type
 				uint32_t startIndexLocation;
 				uint32_t numberOfIndices;
+				// Bounding, object space axis aligned bounding box (AABB) and bounding sphere
+				float	 minimumBoundingBoxPosition[3];
+				float	 maximumBoundingBoxPosition[3];
+				float	 boundingSpherePosition[3];
+				float	 boundingSphereRadius;
 			};
 		#pragma pack(pop)
 
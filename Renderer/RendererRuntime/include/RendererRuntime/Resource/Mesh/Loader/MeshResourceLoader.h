@@ -86,6 +86,7 @@ namespace RendererRuntime
 		inline virtual void onProcessing() override;
 		virtual bool onDispatch() override;
 		virtual bool isFullyLoaded() override;
+		virtual void onCancellation() override;
 
 
 	//[-------------------------------------------------------]
@@ -111,13 +112,15 @@ namespace RendererRuntime
 		// Temporary data
 		// Temporary vertex buffer
 		uint32_t mNumberOfVertexBufferDataBytes;
-		uint32_t mNumberOfUsedVertexBufferDataBytes;
-		uint8_t* mVertexBufferData;
+		uint32_t	   mNumberOfUsedVertexBufferDataBytes;
+		uint8_t*	   mVertexBufferData;
+		const uint8_t* mUsedVertexBufferData;	///< Either "mVertexBufferData" or a view of the file, see "RendererRuntime::IFile::readView()"
 		// Temporary index buffer
-		uint32_t mNumberOfIndexBufferDataBytes;
-		uint32_t mNumberOfUsedIndexBufferDataBytes;
-		uint8_t* mIndexBufferData;
-		uint8_t  mIndexBufferFormat;	// "Renderer::IndexBufferFormat", don't want to include the header in here
+		uint32_t	   mNumberOfIndexBufferDataBytes;
+		uint32_t	   mNumberOfUsedIndexBufferDataBytes;
+		uint8_t*	   mIndexBufferData;
+		const uint8_t* mUsedIndexBufferData;	///< Either "mIndexBufferData" or a view of the file
+		uint8_t		   mIndexBufferFormat;		// "Renderer::IndexBufferFormat", don't want to include the header in here
 		// Temporary vertex attributes
 		uint32_t				   mNumberOfVertexAttributes;
 		uint32_t				   mNumberOfUsedVertexAttributes;
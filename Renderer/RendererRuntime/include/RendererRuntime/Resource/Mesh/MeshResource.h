@@ -100,6 +100,16 @@ namespace RendererRuntime
 		inline const SubMeshes& getSubMeshes() const;
 		inline SubMeshes& getSubMeshes();
 
+		//[-------------------------------------------------------]
+		//[ Bounding                                              ]
+		//[-------------------------------------------------------]
+		inline const glm::vec3& getMinimumBoundingBoxPosition() const;	// Object space
+		inline const glm::vec3& getMaximumBoundingBoxPosition() const;	// Object space
+		inline void setBoundingBoxPosition(const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition);
+		inline const glm::vec3& getBoundingSpherePosition() const;		// Object space
+		inline float getBoundingSphereRadius() const;
+		inline void setBoundingSpherePositionRadius(const glm::vec3& boundingSpherePosition, float boundingSphereRadius);
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -125,6 +135,11 @@ namespace RendererRuntime
 		uint32_t				  mNumberOfIndices;		///< Number of indices
 		Renderer::IVertexArrayPtr mVertexArray;			///< Vertex array object (VAO), can be a null pointer
 		SubMeshes				  mSubMeshes;			///< Sub-meshes
+		// Bounding
+		glm::vec3				  mMinimumBoundingBoxPosition;	///< Object space
+		glm::vec3				  mMaximumBoundingBoxPosition;	///< Object space
+		glm::vec3				  mBoundingSpherePosition;		///< Object space
+		float					  mBoundingSphereRadius;
 
 
 	};
@@ -68,13 +68,49 @@ namespace RendererRuntime
 		return mSubMeshes;
 	}
 
+	inline const glm::vec3& MeshResource::getMinimumBoundingBoxPosition() const
+	{
+		return mMinimumBoundingBoxPosition;
+	}
+
+	inline const glm::vec3& MeshResource::getMaximumBoundingBoxPosition() const
+	{
+		return mMaximumBoundingBoxPosition;
+	}
+
+	inline void MeshResource::setBoundingBoxPosition(const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition)
+	{
+		mMinimumBoundingBoxPosition = minimumBoundingBoxPosition;
+		mMaximumBoundingBoxPosition = maximumBoundingBoxPosition;
+	}
+
+	inline const glm::vec3& MeshResource::getBoundingSpherePosition() const
+	{
+		return mBoundingSpherePosition;
+	}
+
+	inline float MeshResource::getBoundingSphereRadius() const
+	{
+		return mBoundingSphereRadius;
+	}
+
+	inline void MeshResource::setBoundingSpherePositionRadius(const glm::vec3& boundingSpherePosition, float boundingSphereRadius)
+	{
+		mBoundingSpherePosition = boundingSpherePosition;
+		mBoundingSphereRadius = boundingSphereRadius;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	inline MeshResource::MeshResource() :
 		mNumberOfVertices(0),
-		mNumberOfIndices(0)
+		mNumberOfIndices(0),
+		mMinimumBoundingBoxPosition(Math::ZERO_VECTOR),
+		mMaximumBoundingBoxPosition(Math::ZERO_VECTOR),
+		mBoundingSpherePosition(Math::ZERO_VECTOR),
+		mBoundingSphereRadius(0.0f)
 	{
 		// Nothing here
 	}
@@ -107,6 +143,10 @@ namespace RendererRuntime
 		mNumberOfIndices = 0;
 		mVertexArray = nullptr;
 		mSubMeshes.clear();
+		mMinimumBoundingBoxPosition = Math::ZERO_VECTOR;
+		mMaximumBoundingBoxPosition = Math::ZERO_VECTOR;
+		mBoundingSpherePosition = Math::ZERO_VECTOR;
+		mBoundingSphereRadius = 0.0f;
 
 		// Call base implementation
 		IResource::deinitializeElement();
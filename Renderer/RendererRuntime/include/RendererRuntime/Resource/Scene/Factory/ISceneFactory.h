@@ -34,6 +34,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class Transform;
@@ -73,6 +74,7 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 		friend class SceneResourceManager;	// Needs to create scene resource instances
 		friend class ISceneResource;		// Needs to create scene node and scene item instances
+		friend class ::RuntimeBenchmark;	// Creates a scene resource without scene asset
 
 
 	//[-------------------------------------------------------]
@@ -85,6 +85,33 @@ namespace RendererRuntime
 		inline float getFarZ() const;
 		inline void setFarZ(float farZ);
 
+		/**
+		*  @brief
+		*    Return the world space to view space matrix
+		*
+		*  @return
+		*    The custom world space to view space matrix if there's one, else the one calculated using the transform of the parent scene node
+		*
+		*  @note
+		*    - Used for rendering as well as for culling, so both are using the same camera
+		*/
+		RENDERERRUNTIME_API_EXPORT glm::mat4 getWorldSpaceToViewSpaceMatrix() const;
+
+		/**
+		*  @brief
+		*    Return the view space to clip space matrix
+		*
+		*  @param[in] aspectRatio
+		*    Aspect ratio of the render target rendered into
+		*
+		*  @return
+		*    The custom view space to clip space matrix if there's one, else the perspective projection calculated using FOV Y, near z and far z
+		*
+		*  @note
+		*    - Used for rendering as well as for culling, so both are using the same camera
+		*/
+		RENDERERRUNTIME_API_EXPORT glm::mat4 getViewSpaceToClipSpaceMatrix(float aspectRatio) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public RendererRuntime::ISceneItem methods            ]
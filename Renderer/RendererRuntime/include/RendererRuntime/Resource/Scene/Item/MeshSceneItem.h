@@ -32,6 +32,12 @@
 #include "RendererRuntime/RenderQueue/RenderableManager.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -56,7 +62,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend class SceneFactory;	// Needs to be able to create scene item instances
+		friend class SceneFactory;			// Needs to be able to create scene item instances
+		friend class ::RuntimeBenchmark;	// Fills the renderable manager without a mesh resource
 
 
 	//[-------------------------------------------------------]
@@ -65,6 +65,11 @@ namespace RendererRuntime
 		*    Receives the processed code
 		*
 		*  @return processed string
+		*
+		*  @note
+		*    - Thread safe, several shader builder threads can preprocess at once
+		*    - Preprocessed source codes are cached by content, so source code resulting from different shader combinations is only preprocessed once
+		*    - MojoShader's internal allocations are served by a per-thread memory arena which is reused by the following calls of the thread
 		*/
 		static void preprocess(std::string& source, std::string& result);
 
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "RendererRuntime/Core/NonCopyable.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 #include <map>
 #include <string>
@@ -37,6 +38,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class ShaderBuilderCheck;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class ShaderBlueprintResource;
@@ -66,11 +68,19 @@ namespace RendererRuntime
 	*
 	*  @notes
 	*   - Heavily basing on the OGRE 2.1 HLMS shader builder which is directly part of the OGRE class "Ogre::Hlms". So for syntax, have a look into the OGRE 2.1 documentation.
+	*   - Shader blueprints and shader pieces are compiled into shader templates when being loaded, building a shader combination
+	*     only evaluates the shader template instructions into a single output buffer (the result is identical to parsing the source code)
 	*/
 	class ShaderBuilder : private NonCopyable
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class ::ShaderBuilderCheck;	// Compares evaluating the shader templates with parsing the source code
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -104,12 +114,66 @@ namespace RendererRuntime
 		const std::string& createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties);
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Compile shader blueprint or shader piece source code into a shader template
+		*
+		*  @param[in] sourceCode
+		*    Shader blueprint or shader piece ASCII source code to compile
+		*  @param[out] shaderTemplate
+		*    Receives the compiled shader template, invalid if the source code uses syntax which can only be handled by parsing the source code
+		*/
+		static void compileShaderTemplate(const std::string& sourceCode, ShaderTemplate& shaderTemplate);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Shader template instruction with all property dependent decisions already made
+		*/
+		struct ResolvedInstruction
+		{
+			ShaderTemplate::InstructionType	 type;
+			uint32_t						 value;		///< Number of characters for text, pass number for counter values, number of instructions to skip for pieces, piece name ID for piece insertions
+			const char*						 text;		///< Only used by text
+			const ShaderTemplate::Operation* operation;	///< Only used by counters
+		};
+		typedef std::vector<ResolvedInstruction> ResolvedInstructions;
+
+		struct ResolvedPiece
+		{
+			StringId pieceId;
+			uint32_t firstResolvedInstruction;
+			uint32_t numberOfResolvedInstructions;
+		};
+		typedef std::vector<ResolvedPiece> ResolvedPieces;	///< There are only a few pieces, a linear search is fine and doesn't need memory allocations
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		static bool compileShaderTemplateInstructions(ShaderTemplate& shaderTemplate, size_t& position, const std::string& counterVariable, bool insideForEach, bool insidePiece, bool insideBlock);
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
 		ShaderBuilder(const ShaderBuilder&) = delete;
 		ShaderBuilder& operator=(const ShaderBuilder&) = delete;
+		bool createSourceCodeByShaderTemplates(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties);
+		void createSourceCodeByParsing(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties);
+		bool resolveShaderTemplateInstructions(const ShaderTemplate& shaderTemplate, uint32_t firstInstruction, uint32_t numberOfInstructions, int32_t passNumber);
+		bool isLastResolvedInstruction(size_t resolvedInstructionIndex, size_t resolvedInstructionEnd) const;
+		bool writeResolvedInstructions(size_t firstResolvedInstruction, size_t numberOfResolvedInstructions, uint32_t pieceInsertionDepth, ShaderTemplate::InstructionType& lastInstructionType);
 		bool parseMath(const std::string& inBuffer, std::string& outBuffer);
 		bool parseForEach(const std::string& inBuffer, std::string& outBuffer) const;
 		bool parseProperties(std::string& inBuffer, std::string& outBuffer) const;
@@ -123,10 +187,12 @@ namespace RendererRuntime
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ShaderProperties	mShaderProperties;
-		DynamicShaderPieces	mDynamicShaderPieces;
-		std::string			mInString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
-		std::string			mOutString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
+		ShaderProperties		mShaderProperties;
+		DynamicShaderPieces		mDynamicShaderPieces;
+		ResolvedInstructions	mResolvedInstructions;	///< Could be a local variable, but when making it to a member we reduce memory allocations
+		ResolvedPieces			mResolvedPieces;
+		std::string				mInString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
+		std::string				mOutString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
 
 
 	};
@@ -32,6 +32,12 @@
 #include <Renderer/Public/Renderer.h>
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class ShaderCacheManagerCheck;	// "Example/ExampleRuntimeCheck"
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -57,6 +63,7 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 		friend class ShaderCacheManager;	// Is creating and managing shader cache instances
 		friend class PipelineStateCompiler;	// Is creating shader cache instances
+		friend class ::ShaderCacheManagerCheck;	// Is creating shader cache instances
 
 
 	//[-------------------------------------------------------]
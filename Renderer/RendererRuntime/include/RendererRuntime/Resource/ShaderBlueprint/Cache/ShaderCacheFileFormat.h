@@ -0,0 +1,85 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <inttypes.h>	// For uint32_t, uint64_t etc.
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	// -> Shader cache file format content:
+	//    - Persistent cache file header, see "RendererRuntime::PersistentCacheFile"
+	//    - Shader cache header
+	//    - Payload
+	//      - Shader cache entries (shader cache ID to shader source code ID mapping)
+	//      - Shader bytecode entries, each followed by the shader bytecode
+	namespace v1ShaderCache
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Definitions                                           ]
+		//[-------------------------------------------------------]
+		static const uint32_t FORMAT_TYPE	 = StringId("ShaderCache");
+		static const uint32_t FORMAT_VERSION = 1;
+
+		#pragma pack(push)
+		#pragma pack(1)
+			struct Header
+			{
+				uint32_t rendererNameId;			///< Shader bytecode is renderer specific, result of hashing the renderer name
+				uint32_t shaderLanguageNameId;		///< Shader bytecode is shader language specific, result of hashing the shader language name
+				uint32_t numberOfShaderCaches;
+				uint32_t numberOfShaderBytecodes;
+			};
+
+			struct ShaderCacheHeader
+			{
+				uint32_t shaderCacheId;
+				uint32_t shaderSourceCodeId;
+				uint32_t shaderAssetsId;			///< Result of hashing the shader blueprint and included shader piece source codes, used to detect outdated entries
+			};
+
+			struct ShaderBytecodeHeader
+			{
+				uint32_t shaderSourceCodeId;
+				uint32_t numberOfBytes;
+			};
+		#pragma pack(pop)
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+	} // v1ShaderCache
+} // RendererRuntime
@@ -27,23 +27,32 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "RendererRuntime/Export.h"
 #include "RendererRuntime/Core/Manager.h"
+#include "RendererRuntime/Core/File/PersistentCacheFile.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderType.h"
 
 #include <mutex>
+#include <future>
+#include <vector>
 #include <unordered_map>
 
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class ShaderCacheManagerCheck;	// "Example/ExampleRuntimeCheck"
 namespace Renderer
 {
+	class IShader;
 	class IShaderLanguage;
+	struct VertexAttributes;
 }
 namespace RendererRuntime
 {
+	class IFile;
 	class ShaderCache;
+	class ShaderBlueprintResource;
 	class PipelineStateSignature;
 	class MaterialBlueprintResource;
 	class ShaderBlueprintResourceManager;
@@ -71,6 +80,11 @@ namespace RendererRuntime
 	*  @brief
 	*    Shader cache manager
 	*
+	*  @remarks
+	*    The shader cache manager can persist its content in order to avoid shader building and compilation on the next run:
+	*    - Shader cache ID to shader source code ID mapping, entries are ignored if the shader blueprint or included shader pieces have changed
+	*    - Shader bytecode by shader source code ID, only if the renderer backend supports shader bytecode (see "Renderer::IShader::getShaderBytecode()")
+	*
 	*  @see
 	*    - See "RendererRuntime::PipelineStateCacheManager" for additional information
 	*/
@@ -83,6 +97,7 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 		friend class ShaderBlueprintResourceManager;	// Is creating and using a shader cache manager instance
 		friend class PipelineStateCompiler;				// Is tightly interacting with the shader cache manager
+		friend class ::ShaderCacheManagerCheck;			// Stresses the in-flight shader cache handling
 
 
 	//[-------------------------------------------------------]
@@ -113,24 +128,87 @@ namespace RendererRuntime
 		*
 		*  @return
 		*    The shader cache, null pointer on error
+		*
+		*  @note
+		*    - Thread safe, the shader source code is build and the shader is created without holding the mutex so multiple threads can work in parallel
+		*    - Concurrent requests for one and the same shader cache wait for the request which is already working on it instead of doing the work twice
 		*/
 		ShaderCache* getShaderCache(const PipelineStateSignature& pipelineStateSignature, const MaterialBlueprintResource& materialBlueprintResource, Renderer::IShaderLanguage& shaderLanguage, ShaderType shaderType);
 
 		/**
 		*  @brief
 		*    Clear the shader cache manager
+		*
+		*  @note
+		*    - The persistent shader cache data is kept
 		*/
 		void clearCache();
 
+		/**
+		*  @brief
+		*    Load the persistent shader cache by using the given filename, the file is also used to write back the persistent shader cache
+		*
+		*  @param[in] filename
+		*    ASCII name of the persistent shader cache file, never ever a null pointer and always finished by a terminating zero
+		*
+		*  @note
+		*    - Should be called during startup, before any shader cache has been requested
+		*    - A missing, outdated or corrupted file results in an empty persistent shader cache which is written back later on
+		*    - Changes are written back by "RendererRuntime::ShaderBlueprintResourceManager::update()" as soon as no new shader caches are added, as well as during shutdown
+		*/
+		RENDERERRUNTIME_API_EXPORT void loadCacheByFilename(const char* filename);
+
+		/**
+		*  @brief
+		*    Write back the persistent shader cache to the file given to "RendererRuntime::ShaderCacheManager::loadCacheByFilename()", if there are unsaved changes
+		*/
+		RENDERERRUNTIME_API_EXPORT void saveDirtyCache();
+
+		/**
+		*  @brief
+		*    Load the persistent shader cache from the given file
+		*
+		*  @param[in] file
+		*    File to read from
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (outdated or corrupted file, the persistent shader cache is left empty in this case)
+		*/
+		RENDERERRUNTIME_API_EXPORT bool loadCache(IFile& file);
+
+		/**
+		*  @brief
+		*    Save the persistent shader cache into the given file
+		*
+		*  @param[in] file
+		*    File to write into
+		*
+		*  @note
+		*    - The shader bytecode of shader caches with an already compiled shader is gathered during saving
+		*/
+		RENDERERRUNTIME_API_EXPORT void saveCache(IFile& file);
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
-		inline explicit ShaderCacheManager(ShaderBlueprintResourceManager& shaderBlueprintResourceManager);
-		inline ~ShaderCacheManager();
+		explicit ShaderCacheManager(ShaderBlueprintResourceManager& shaderBlueprintResourceManager);
+		~ShaderCacheManager();
 		ShaderCacheManager(const ShaderCacheManager&) = delete;
 		ShaderCacheManager& operator=(const ShaderCacheManager&) = delete;
+		void update();
+
+		// In-flight shader caches, the caller must lock the mutex
+		bool findOrBeginShaderCache(ShaderCacheId shaderCacheId, std::unique_lock<std::mutex>& mutexLock, std::promise<ShaderCache*>& shaderCachePromise, ShaderCache*& shaderCache);
+		void endShaderCache(ShaderCacheId shaderCacheId, std::promise<ShaderCache*>& shaderCachePromise, ShaderCache* shaderCache);
+
+		// Persistent shader cache, the caller must lock the mutex
+		ShaderSourceCodeId getPersistentShaderSourceCodeId(ShaderCacheId shaderCacheId, uint32_t shaderAssetsId) const;
+		const std::vector<uint8_t>* getPersistentShaderBytecode(ShaderSourceCodeId shaderSourceCodeId) const;
+		void addPersistentShaderCache(ShaderCacheId shaderCacheId, ShaderSourceCodeId shaderSourceCodeId, uint32_t shaderAssetsId);
+		uint32_t calculateShaderAssetsId(const ShaderBlueprintResource& shaderBlueprintResource) const;
+		static Renderer::IShader* createShaderFromBytecode(Renderer::IShaderLanguage& shaderLanguage, ShaderType shaderType, const Renderer::VertexAttributes& vertexAttributes, const std::vector<uint8_t>& shaderBytecode);
 
 
 	//[-------------------------------------------------------]
@@ -139,6 +217,15 @@ namespace RendererRuntime
 	private:
 		typedef std::unordered_map<ShaderCacheId, ShaderCache*>		 ShaderCacheByShaderCacheId;
 		typedef std::unordered_map<ShaderSourceCodeId, ShaderCache*> ShaderCacheByShaderSourceCodeId;
+		typedef std::unordered_map<ShaderCacheId, std::shared_future<ShaderCache*>> InFlightShaderCacheByShaderCacheId;
+
+		struct PersistentShaderCache
+		{
+			ShaderSourceCodeId shaderSourceCodeId;
+			uint32_t		   shaderAssetsId;	///< Result of hashing the shader blueprint and included shader piece source codes
+		};
+		typedef std::unordered_map<ShaderCacheId, PersistentShaderCache>		  PersistentShaderCacheByShaderCacheId;
+		typedef std::unordered_map<ShaderSourceCodeId, std::vector<uint8_t>> ShaderBytecodeByShaderSourceCodeId;
 
 
 	//[-------------------------------------------------------]
@@ -148,7 +235,12 @@ namespace RendererRuntime
 		ShaderBlueprintResourceManager& mShaderBlueprintResourceManager;	///< Owner shader blueprint resource manager
 		ShaderCacheByShaderCacheId		mShaderCacheByShaderCacheId;		///< Manages the shader cache instances
 		ShaderCacheByShaderSourceCodeId	mShaderCacheByShaderSourceCodeId;	///< Just references shader cache instances, doesn't own the instances
-		std::mutex						mMutex;								///< Mutex due to "RendererRuntime::PipelineStateCompiler" interaction, no too fine granular lock/unlock required because usually it's only asynchronous or synchronous processing, not both at one and the same time
+		InFlightShaderCacheByShaderCacheId mInFlightShaderCacheByShaderCacheId;	///< Shader caches which are currently worked on outside the mutex, the future delivers the resulting shader cache (null pointer on error)
+		std::mutex						mMutex;								///< Mutex guarding the data, due to "RendererRuntime::PipelineStateCompiler" interaction, it's never locked while building shader source code or creating shaders
+		// Persistent shader cache
+		PersistentShaderCacheByShaderCacheId mPersistentShaderCacheByShaderCacheId;
+		ShaderBytecodeByShaderSourceCodeId	 mShaderBytecodeByShaderSourceCodeId;
+		PersistentCacheFile					 mCacheFile;							///< Persistent shader cache file, a change is also added if there's shader bytecode which couldn't be gathered yet
 
 
 	};
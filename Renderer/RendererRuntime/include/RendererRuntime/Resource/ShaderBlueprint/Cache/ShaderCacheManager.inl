@@ -33,22 +33,6 @@ namespace RendererRuntime
 		return mShaderBlueprintResourceManager;
 	}
 
-
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
-	inline ShaderCacheManager::ShaderCacheManager(ShaderBlueprintResourceManager& shaderBlueprintResourceManager) :
-		mShaderBlueprintResourceManager(shaderBlueprintResourceManager)
-	{
-		// Nothing here
-	}
-
-	inline ShaderCacheManager::~ShaderCacheManager()
-	{
-		clearCache();
-	}
-
-
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -187,6 +187,18 @@ namespace RendererRuntime
 		*/
 		RENDERERRUNTIME_API_EXPORT void setPropertyValue(ShaderPropertyId shaderPropertyId, int32_t value);
 
+		/**
+		*  @brief
+		*    Remove a shader property
+		*
+		*  @param[in] shaderPropertyId
+		*    ID of the shader property to remove
+		*
+		*  @return
+		*    "true" if the shader property was removed, "false" if there's no such shader property
+		*/
+		RENDERERRUNTIME_API_EXPORT bool removePropertyValue(ShaderPropertyId shaderPropertyId);
+
 		/**
 		*  @brief
 		*    Set property values by using a given shader properties instance
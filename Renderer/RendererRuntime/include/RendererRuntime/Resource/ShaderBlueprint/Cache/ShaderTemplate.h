@@ -0,0 +1,212 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Core/StringId.h"
+
+#include <string>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Shader template, shader blueprint or shader piece source code compiled into a compact instruction program
+	*
+	*  @remarks
+	*    Parsing the shader source code once when loading the resource means the shader builder no longer has to run
+	*    its string based find and replace passes for every shader combination. The property independent work like
+	*    locating blocks, parsing directive arguments and expressions as well as hashing property and piece names is
+	*    done upfront, building a shader combination only walks the instructions.
+	*
+	*  @note
+	*    - Shader source code using syntax the shader template compiler can't map one-to-one onto the shader builder
+	*      result (syntax errors, nested "@foreach", "@piece" inside "@piece", unknown "@" directives etc.) results
+	*      in an invalid shader template, the shader builder then falls back to parsing the shader source code
+	*/
+	class ShaderTemplate
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class ShaderBuilder;	// Compiles and evaluates shader templates
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		enum class InstructionType : uint8_t
+		{
+			TEXT,			///< Text to copy, "value" is the source code offset, "size" the number of characters
+			COUNTER_VALUE,	///< "@<counter variable>" inside a "@foreach"-block, replaced by the current pass number
+			FOREACH,		///< "@foreach(<count>, <counter variable>, <start>)", "value" is the for each index, "size" the number of instructions inside the block
+			PROPERTY,		///< "@property(<expression>)", "value" is the index of the first expression node, "size" the number of instructions inside the block
+			PIECE,			///< "@piece(<name>)", "value" is the piece name ID, "size" the number of instructions inside the block
+			INSERT_PIECE,	///< "@insertpiece(<name>)", "value" is the piece name ID
+			COUNTER			///< "@counter", "@value", "@set", "@add", "@sub", "@mul", "@div", "@mod", "@min" or "@max", "value" is the counter operation index
+		};
+		struct Instruction
+		{
+			InstructionType type;
+			uint32_t		value;
+			uint32_t		size;
+		};
+		typedef std::vector<Instruction> Instructions;
+
+		/**
+		*  @brief
+		*    Operand which is either a number or a shader property value
+		*/
+		struct Operand
+		{
+			bool	 isProperty;
+			int32_t	 number;
+			StringId propertyId;
+		};
+
+		/**
+		*  @brief
+		*    "@pset"-like math operation or "@counter"-like counter operation
+		*/
+		struct Operation
+		{
+			uint8_t	 operationIndex;	///< Index inside the math respectively counter operation table of the shader builder
+			StringId destinationPropertyId;
+			StringId sourcePropertyId;
+			Operand	 operand;			///< Unused by "@counter" and "@value"
+		};
+		typedef std::vector<Operation> Operations;
+
+		struct ForEach
+		{
+			Operand count;
+			bool	hasStart;
+			Operand start;
+		};
+		typedef std::vector<ForEach> ForEaches;
+
+		enum class ExpressionType : uint8_t
+		{
+			OPERATOR_OR,	///< "||"
+			OPERATOR_AND,	///< "&&"
+			OBJECT,			///< "(...)"
+			VARIABLE		///< Shader property
+		};
+		/**
+		*  @brief
+		*    "@property"-expression node, the nodes of an expression are stored in pre-order
+		*/
+		struct ExpressionNode
+		{
+			ExpressionType type;
+			bool		   negated;
+			StringId	   propertyId;			///< Only used by variables
+			uint32_t	   numberOfChildren;	///< Number of direct children, only used by objects
+		};
+		typedef std::vector<ExpressionNode> ExpressionNodes;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline ShaderTemplate();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~ShaderTemplate();
+
+		/**
+		*  @brief
+		*    Return whether or not the shader template was compiled successfully
+		*
+		*  @return
+		*    "true" if the shader template is valid, else "false" (the shader builder then has to parse the shader source code)
+		*/
+		inline bool isValid() const;
+
+		/**
+		*  @brief
+		*    Return the source code the text instructions are referencing
+		*
+		*  @return
+		*    The source code with all math operations already stripped
+		*/
+		inline const std::string& getSourceCode() const;
+
+		/**
+		*  @brief
+		*    Clear the shader template
+		*/
+		inline void clear();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		bool			mValid;
+		std::string		mSourceCode;		///< Source code with all math operations stripped, referenced by the text instructions
+		Operations		mMathOperations;	///< Math operations in the order they're applied before evaluating the instructions
+		Operations		mCounterOperations;
+		ForEaches		mForEaches;
+		ExpressionNodes	mExpressionNodes;
+		Instructions	mInstructions;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.inl"
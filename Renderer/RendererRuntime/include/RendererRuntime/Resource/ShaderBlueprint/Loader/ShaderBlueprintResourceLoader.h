@@ -72,6 +72,7 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	public:
 		inline virtual ResourceLoaderTypeId getResourceLoaderTypeId() const override;
+		inline virtual bool requiresOrderedLoading() const override;
 		virtual void onDeserialization(IFile& file) override;
 		inline virtual void onProcessing() override;
 		virtual bool onDispatch() override;
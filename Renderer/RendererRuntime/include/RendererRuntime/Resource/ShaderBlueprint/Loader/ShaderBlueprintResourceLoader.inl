@@ -33,6 +33,12 @@ namespace RendererRuntime
 		return TYPE_ID;
 	}
 
+	inline bool ShaderBlueprintResourceLoader::requiresOrderedLoading() const
+	{
+		// Dispatch after previously committed shader pieces, else a hot-reload would clear the caches before the updated shader piece source code is in place
+		return true;
+	}
+
 	inline void ShaderBlueprintResourceLoader::onProcessing()
 	{
 		// Nothing here
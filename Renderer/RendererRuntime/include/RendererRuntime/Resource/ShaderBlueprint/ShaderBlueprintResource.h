@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "RendererRuntime/Resource/Detail/IResource.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 #include <string>
 
@@ -36,6 +37,9 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class PipelineStateCacheManagerCheck;	// "Example/ExampleRuntimeCheck"
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
+class ShaderBuilderCheck;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class ShaderBlueprintResource;
@@ -75,6 +79,9 @@ namespace RendererRuntime
 		friend ShaderBlueprintResources;	// Type definition of template class
 		friend class ShaderBlueprintResourceLoader;
 		friend class ShaderBlueprintResourceManager;
+		friend class ::PipelineStateCacheManagerCheck;	// Creates shader blueprint resources without loading them
+		friend class ::ShaderBuilderCheck;				// Creates shader blueprint resources without loading them
+		friend class ::RuntimeBenchmark;				// Creates shader blueprint resources without loading them
 
 
 	//[-------------------------------------------------------]
@@ -115,6 +122,15 @@ namespace RendererRuntime
 		*/
 		inline const std::string& getShaderSourceCode() const;
 
+		/**
+		*  @brief
+		*    Return the shader template
+		*
+		*  @return
+		*    The shader template compiled from the shader source code
+		*/
+		inline const ShaderTemplate& getShaderTemplate() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -139,6 +155,7 @@ namespace RendererRuntime
 		IncludeShaderPieceResourceIds mIncludeShaderPieceResourceIds;
 		ShaderProperties			  mReferencedShaderProperties;	// Directly use "RendererRuntime::ShaderProperties" to keep things simple, although we don't need a shader property value
 		std::string					  mShaderSourceCode;
+		ShaderTemplate				  mShaderTemplate;
 
 
 	};
@@ -43,6 +43,11 @@ namespace RendererRuntime
 		return mShaderSourceCode;
 	}
 
+	inline const ShaderTemplate& ShaderBlueprintResource::getShaderTemplate() const
+	{
+		return mShaderTemplate;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -77,6 +82,7 @@ namespace RendererRuntime
 		mIncludeShaderPieceResourceIds.clear();
 		mReferencedShaderProperties.clear();
 		mShaderSourceCode.clear();
+		mShaderTemplate.clear();
 
 		// Call base implementation
 		IResource::deinitializeElement();
@@ -36,6 +36,9 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class PipelineStateCacheManagerCheck;	// "Example/ExampleRuntimeCheck"
+class RuntimeBenchmark;	// "Example/ExampleRuntimeCheck"
+class ShaderBuilderCheck;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class IRendererRuntime;
@@ -73,6 +76,9 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 		friend class RendererRuntimeImpl;
  		friend class ShaderBuilder;	// Needed so that inside this classes an static_cast<CompositorNodeResourceManager*>(IResourceManager*) works
+		friend class ::PipelineStateCacheManagerCheck;	// Creates shader blueprint resources without loading them
+		friend class ::ShaderBuilderCheck;				// Creates shader blueprint resources without loading them
+		friend class ::RuntimeBenchmark;				// Creates shader blueprint resources without loading them
 
 
 	//[-------------------------------------------------------]
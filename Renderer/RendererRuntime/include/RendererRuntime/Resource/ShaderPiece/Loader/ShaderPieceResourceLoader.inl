@@ -33,6 +33,12 @@ namespace RendererRuntime
 		return TYPE_ID;
 	}
 
+	inline bool ShaderPieceResourceLoader::requiresOrderedLoading() const
+	{
+		// Shader blueprint load requests committed after this one must see the updated shader piece source code
+		return true;
+	}
+
 	inline void ShaderPieceResourceLoader::onProcessing()
 	{
 		// Nothing here
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererRuntime/Resource/Detail/IResource.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 #include <string>
 
@@ -35,6 +36,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class ShaderBuilderCheck;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class ShaderPieceResource;
@@ -73,6 +75,7 @@ namespace RendererRuntime
 		friend ShaderPieceResources;	// Type definition of template class
 		friend class ShaderPieceResourceLoader;
 		friend class ShaderPieceResourceManager;
+		friend class ::ShaderBuilderCheck;	// Creates shader piece resources without loading them
 
 
 	//[-------------------------------------------------------]
@@ -88,6 +91,15 @@ namespace RendererRuntime
 		*/
 		inline const std::string& getShaderSourceCode() const;
 
+		/**
+		*  @brief
+		*    Return the shader template
+		*
+		*  @return
+		*    The shader template compiled from the shader source code
+		*/
+		inline const ShaderTemplate& getShaderTemplate() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -109,7 +121,8 @@ namespace RendererRuntime
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		std::string mShaderSourceCode;
+		std::string	   mShaderSourceCode;
+		ShaderTemplate mShaderTemplate;
 
 
 	};
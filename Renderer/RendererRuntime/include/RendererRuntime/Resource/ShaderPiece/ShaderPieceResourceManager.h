@@ -36,6 +36,7 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class ShaderBuilderCheck;	// "Example/ExampleRuntimeCheck"
 namespace RendererRuntime
 {
 	class IRendererRuntime;
@@ -72,6 +73,7 @@ namespace RendererRuntime
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class RendererRuntimeImpl;
+		friend class ::ShaderBuilderCheck;	// Creates shader piece resources without loading them
 
 
 	//[-------------------------------------------------------]
@@ -79,6 +79,7 @@ namespace RendererRuntime
 		virtual void onProcessing() override;
 		virtual bool onDispatch() override;
 		inline virtual bool isFullyLoaded() override;
+		virtual void onCancellation() override;
 
 
 	//[-------------------------------------------------------]
@@ -104,8 +105,9 @@ namespace RendererRuntime
 		uint8_t  mTextureFormat;	// "Renderer::TextureFormat", don't want to include the header in here
 		// Temporary file data
 		uint32_t mNumberOfFileDataBytes;
-		uint32_t mNumberOfUsedFileDataBytes;
-		uint8_t* mFileData;
+		uint32_t	   mNumberOfUsedFileDataBytes;
+		uint8_t*	   mFileData;
+		const uint8_t* mUsedFileData;	///< Either "mFileData" or a view of the file, see "RendererRuntime::IFile::readView()"
 		// Temporary image data
 		uint32_t mNumberOfImageDataBytes;
 		uint32_t mNumberOfUsedImageDataBytes;
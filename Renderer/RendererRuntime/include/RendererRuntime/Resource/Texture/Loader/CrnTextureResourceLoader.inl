@@ -53,6 +53,7 @@ namespace RendererRuntime
 		mNumberOfFileDataBytes(0),
 		mNumberOfUsedFileDataBytes(0),
 		mFileData(nullptr),
+		mUsedFileData(nullptr),
 		mNumberOfImageDataBytes(0),
 		mNumberOfUsedImageDataBytes(0),
 		mImageData(nullptr)
@@ -41,6 +41,9 @@ namespace RendererRuntime
 	inline void TextureResource::setTexture(Renderer::ITexture& texture)
 	{
 		mTexture = &texture;
+
+		// Tell the resource listeners about the changed renderer texture, e.g. material techniques are caching their texture bindings
+		setLoadingState(getLoadingState());
 	}
 
 
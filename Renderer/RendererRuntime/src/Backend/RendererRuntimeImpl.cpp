@@ -25,6 +25,7 @@
 #include "RendererRuntime/Backend/RendererRuntimeImpl.h"
 #include "RendererRuntime/Asset/AssetManager.h"
 #include "RendererRuntime/Core/Thread/ThreadManager.h"
+#include "RendererRuntime/Core/Time/FrameTimeBudget.h"
 #include "RendererRuntime/Resource/Detail/ResourceStreamer.h"
 #include "RendererRuntime/Resource/Mesh/MeshResourceManager.h"
 #include "RendererRuntime/Resource/Scene/SceneResourceManager.h"
@@ -84,6 +85,7 @@ namespace RendererRuntime
 
 		// Create the core manager instances
 		mThreadManager = new ThreadManager();
+		mFrameTimeBudget = new FrameTimeBudget();
 		mAssetManager = new AssetManager(*this);
 
 		// Create the resource manager instances
@@ -157,6 +159,7 @@ namespace RendererRuntime
 
 		// Destroy the core manager instances
 		delete mAssetManager;
+		delete mFrameTimeBudget;
 		delete mThreadManager;
 
 		// Release the texture and buffer manager instance
@@ -197,9 +200,16 @@ namespace RendererRuntime
 			}
 		}
 
-		// Pipeline state compiler and resource streamer update
-		mPipelineStateCompiler->dispatch();
-		mResourceStreamer->dispatch();
+		{ // Pipeline state compiler and resource streamer update, each one only gets its slice of the frame time budget
+			TimeBudget timeBudget = mFrameTimeBudget->startSlice(FrameTimeBudget::Subsystem::PIPELINE_STATE_COMPILER);
+			mPipelineStateCompiler->dispatch(timeBudget);
+			mFrameTimeBudget->finishSlice(FrameTimeBudget::Subsystem::PIPELINE_STATE_COMPILER, timeBudget);
+		}
+		{
+			TimeBudget timeBudget = mFrameTimeBudget->startSlice(FrameTimeBudget::Subsystem::RESOURCE_STREAMER);
+			mResourceStreamer->dispatch(timeBudget);
+			mFrameTimeBudget->finishSlice(FrameTimeBudget::Subsystem::RESOURCE_STREAMER, timeBudget);
+		}
 
 		// Inform the individual resource manager instances
 		const size_t numberOfResourceManagers = mResourceManagers.size();
@@ -0,0 +1,132 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/PrecompiledHeader.h"
+#include "RendererRuntime/Core/File/PersistentCacheFile.h"
+#include "RendererRuntime/Core/File/IFile.h"
+#include "RendererRuntime/Core/File/IFileManager.h"
+#include "RendererRuntime/Core/Math/Math.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	IFile* PersistentCacheFile::openFile(const char* filename)
+	{
+		assert(nullptr != filename);
+		mFilename = filename;
+		return mFileManager.openFile(filename);
+	}
+
+	IFile* PersistentCacheFile::createFileForWriteBack()
+	{
+		if (mFilename.empty() || !isDirty())
+		{
+			return nullptr;
+		}
+		IFile* file = mFileManager.createFile(mFilename.c_str());
+		if (nullptr == file)
+		{
+			// Disable write back, the file can't be created (e.g. read-only file system) and there's no point in failing over and over again
+			mFilename.clear();
+		}
+		return file;
+	}
+
+	void PersistentCacheFile::closeFile(IFile& file) const
+	{
+		mFileManager.closeFile(file);
+	}
+
+	bool PersistentCacheFile::read(IFile& file, void* formatHeader, uint32_t numberOfFormatHeaderBytes, std::vector<uint8_t>& payload) const
+	{
+		assert(nullptr != formatHeader);
+
+		// Read in the header and ensure the format is known and the file is complete
+		const size_t numberOfBytes = file.getNumberOfBytes();
+		if (numberOfBytes < sizeof(Header))
+		{
+			return false;
+		}
+		Header header;
+		file.read(&header, sizeof(Header));
+		if (mFormatType != header.formatType || mFormatVersion != header.formatVersion ||
+			numberOfBytes - sizeof(Header) != header.numberOfBytes || header.numberOfBytes < numberOfFormatHeaderBytes)
+		{
+			return false;
+		}
+
+		// Read in the format specific header and payload, each one in a single burst
+		file.read(formatHeader, numberOfFormatHeaderBytes);
+		const uint32_t numberOfPayloadBytes = header.numberOfBytes - numberOfFormatHeaderBytes;
+		payload.resize(numberOfPayloadBytes);
+		if (numberOfPayloadBytes > 0)
+		{
+			file.read(payload.data(), numberOfPayloadBytes);
+		}
+
+		// Validate the content
+		const uint32_t checksum = Math::calculateFNV1a(static_cast<const uint8_t*>(formatHeader), numberOfFormatHeaderBytes);
+		return (Math::calculateFNV1a(payload.data(), numberOfPayloadBytes, checksum) == header.checksum);
+	}
+
+	void PersistentCacheFile::write(IFile& file, const void* formatHeader, uint32_t numberOfFormatHeaderBytes, const std::vector<uint8_t>& payload)
+	{
+		assert(nullptr != formatHeader);
+		const uint32_t numberOfPayloadBytes = static_cast<uint32_t>(payload.size());
+		const uint32_t checksum = Math::calculateFNV1a(static_cast<const uint8_t*>(formatHeader), numberOfFormatHeaderBytes);
+		const Header header =
+		{
+			mFormatType,
+			mFormatVersion,
+			numberOfFormatHeaderBytes + numberOfPayloadBytes,
+			Math::calculateFNV1a(payload.data(), numberOfPayloadBytes, checksum)
+		};
+		file.write(&header, sizeof(Header));
+		file.write(formatHeader, numberOfFormatHeaderBytes);
+		if (numberOfPayloadBytes > 0)
+		{
+			file.write(payload.data(), numberOfPayloadBytes);
+		}
+		setInSync();
+	}
+
+	bool PersistentCacheFile::isWriteBackDue()
+	{
+		const uint32_t numberOfChanges = mNumberOfChanges;
+		const bool writeBackDue = (numberOfChanges > 0 && numberOfChanges == mNumberOfChangesAtLastUpdate);
+		mNumberOfChangesAtLastUpdate = writeBackDue ? 0 : numberOfChanges;
+		return writeBackDue;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
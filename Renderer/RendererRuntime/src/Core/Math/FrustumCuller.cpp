@@ -0,0 +1,198 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/PrecompiledHeader.h"
+#include "RendererRuntime/Core/Math/FrustumCuller.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RENDERERRUNTIME_FRUSTUMCULLER_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define RENDERERRUNTIME_FRUSTUMCULLER_NEON
+	#include <arm_neon.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Test a batch of four bounding spheres against the frustum planes
+		*
+		*  @return
+		*    Bit mask with the bit of each bounding sphere set which is at least partly inside the frustum
+		*/
+		inline uint32_t cullBatch(const float planes[6][4], const float* positionsX, const float* positionsY, const float* positionsZ, const float* radii)
+		{
+			#if defined(RENDERERRUNTIME_FRUSTUMCULLER_SSE2)
+				const __m128 x = _mm_loadu_ps(positionsX);
+				const __m128 y = _mm_loadu_ps(positionsY);
+				const __m128 z = _mm_loadu_ps(positionsZ);
+				const __m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radii));
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (int i = 0; i < 6; ++i)
+				{
+					// Signed distance of the bounding sphere centers to the plane, outside if it's smaller than the negative radius
+					const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(planes[i][0])), _mm_mul_ps(y, _mm_set1_ps(planes[i][1]))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(planes[i][2])), _mm_set1_ps(planes[i][3])));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+				}
+				return static_cast<uint32_t>(_mm_movemask_ps(inside));
+			#elif defined(RENDERERRUNTIME_FRUSTUMCULLER_NEON)
+				const float32x4_t x = vld1q_f32(positionsX);
+				const float32x4_t y = vld1q_f32(positionsY);
+				const float32x4_t z = vld1q_f32(positionsZ);
+				const float32x4_t negativeRadius = vnegq_f32(vld1q_f32(radii));
+				uint32x4_t inside = vdupq_n_u32(~0u);
+				for (int i = 0; i < 6; ++i)
+				{
+					// Signed distance of the bounding sphere centers to the plane, outside if it's smaller than the negative radius
+					float32x4_t distance = vdupq_n_f32(planes[i][3]);
+					distance = vmlaq_n_f32(distance, x, planes[i][0]);
+					distance = vmlaq_n_f32(distance, y, planes[i][1]);
+					distance = vmlaq_n_f32(distance, z, planes[i][2]);
+					inside = vandq_u32(inside, vcgeq_f32(distance, negativeRadius));
+				}
+				static const uint32_t BITS[4] = { 1, 2, 4, 8 };
+				const uint32x4_t bits = vandq_u32(inside, vld1q_u32(BITS));
+				const uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+				return vget_lane_u32(vpadd_u32(sum, sum), 0);
+			#else
+				uint32_t mask = 0;
+				for (int j = 0; j < 4; ++j)
+				{
+					bool inside = true;
+					for (int i = 0; i < 6 && inside; ++i)
+					{
+						// Signed distance of the bounding sphere center to the plane, outside if it's smaller than the negative radius
+						inside = (positionsX[j] * planes[i][0] + positionsY[j] * planes[i][1] + positionsZ[j] * planes[i][2] + planes[i][3] >= -radii[j]);
+					}
+					if (inside)
+					{
+						mask |= (1u << j);
+					}
+				}
+				return mask;
+			#endif
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void FrustumCuller::setWorldSpaceToClipSpaceMatrix(const glm::mat4& worldSpaceToClipSpaceMatrix)
+	{
+		// Extract the frustum planes as described in "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix" by Gil Gribb and Klaus Hartmann
+		// -> GLM matrices are column major, so "m[column][row]"
+		const glm::mat4& m = worldSpaceToClipSpaceMatrix;
+		for (int i = 0; i < 4; ++i)
+		{
+			mPlanes[0][i] = m[i][3] + m[i][0];	// Left
+			mPlanes[1][i] = m[i][3] - m[i][0];	// Right
+			mPlanes[2][i] = m[i][3] + m[i][1];	// Bottom
+			mPlanes[3][i] = m[i][3] - m[i][1];	// Top
+			mPlanes[4][i] = m[i][3] + m[i][2];	// Near
+			mPlanes[5][i] = m[i][3] - m[i][2];	// Far
+		}
+
+		// Normalize the planes so the plane equation results in signed distances which can be compared against bounding sphere radii
+		for (uint32_t i = 0; i < NUMBER_OF_PLANES; ++i)
+		{
+			const float length = std::sqrt(mPlanes[i][0] * mPlanes[i][0] + mPlanes[i][1] * mPlanes[i][1] + mPlanes[i][2] * mPlanes[i][2]);
+			if (length > 0.0f)
+			{
+				const float inverseLength = 1.0f / length;
+				mPlanes[i][0] *= inverseLength;
+				mPlanes[i][1] *= inverseLength;
+				mPlanes[i][2] *= inverseLength;
+				mPlanes[i][3] *= inverseLength;
+			}
+		}
+	}
+
+	uint32_t FrustumCuller::cullBoundingSpheres()
+	{
+		// Pad the SoA arrays to a multiple of the batch size, the padding results are ignored
+		const uint32_t numberOfPaddedBoundingSpheres = (mNumberOfBoundingSpheres + BATCH_SIZE - 1) & ~(BATCH_SIZE - 1);
+		mPositionsX.resize(numberOfPaddedBoundingSpheres, 0.0f);
+		mPositionsY.resize(numberOfPaddedBoundingSpheres, 0.0f);
+		mPositionsZ.resize(numberOfPaddedBoundingSpheres, 0.0f);
+		mRadii.resize(numberOfPaddedBoundingSpheres, 0.0f);
+		mVisibilityFlags.resize(numberOfPaddedBoundingSpheres);
+
+		// Test the bounding spheres batch wise
+		uint32_t numberOfVisibleBoundingSpheres = 0;
+		for (uint32_t i = 0; i < numberOfPaddedBoundingSpheres; i += BATCH_SIZE)
+		{
+			const uint32_t mask = ::detail::cullBatch(mPlanes, &mPositionsX[i], &mPositionsY[i], &mPositionsZ[i], &mRadii[i]);
+			for (uint32_t j = 0; j < BATCH_SIZE; ++j)
+			{
+				const uint8_t visible = static_cast<uint8_t>((mask >> j) & 1);
+				mVisibilityFlags[i + j] = visible;
+				if (i + j < mNumberOfBoundingSpheres)
+				{
+					numberOfVisibleBoundingSpheres += visible;
+				}
+			}
+		}
+
+		// Remove the padding again so further bounding spheres can be added
+		mPositionsX.resize(mNumberOfBoundingSpheres);
+		mPositionsY.resize(mNumberOfBoundingSpheres);
+		mPositionsZ.resize(mNumberOfBoundingSpheres);
+		mRadii.resize(mNumberOfBoundingSpheres);
+
+		// Done
+		return numberOfVisibleBoundingSpheres;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
@@ -0,0 +1,410 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/PrecompiledHeader.h"
+#include "RendererRuntime/Core/Thread/JobScheduler.h"
+#include "RendererRuntime/Core/Platform/PlatformManager.h"
+
+// TODO(co) Can we do something about the warning which does not involve using "std::thread"-pointers?
+PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_SPINS_BEFORE_SLEEPING = 64;	///< Number of unsuccessful job lookups a worker thread performs before going to sleep
+		static const uint32_t NUMBER_OF_JOBS_PER_THREAD		  = 4;	///< "RendererRuntime::JobScheduler::parallelFor()" creates up to this number of jobs per thread for load balancing
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		thread_local void* CurrentWorker = nullptr;	///< "RendererRuntime::JobScheduler::Worker" instance of the current thread, null pointer if the current thread is no worker thread
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		// Xorshift random number generator, see https://en.wikipedia.org/wiki/Xorshift
+		inline uint32_t xorshift32(uint32_t& state)
+		{
+			uint32_t x = state;
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			state = x;
+			return x;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void JobScheduler::setNumberOfWorkerThreads(uint32_t numberOfWorkerThreads)
+	{
+		// Sanity checks
+		assert(!isWorkerThread() && "A job scheduler worker thread can't change the number of worker threads");
+		assert(0 == mNumberOfQueuedJobs && "The number of worker threads can't be changed while there are jobs in flight");
+
+		// At least one worker thread is used
+		if (0 == numberOfWorkerThreads)
+		{
+			numberOfWorkerThreads = 1;
+		}
+		if (getNumberOfWorkerThreads() != numberOfWorkerThreads)
+		{
+			stopWorkerThreads();
+			startWorkerThreads(numberOfWorkerThreads);
+		}
+	}
+
+	bool JobScheduler::isWorkerThread() const
+	{
+		return (nullptr != getCurrentWorker());
+	}
+
+	void JobScheduler::addJob(JobFunction jobFunction, void* userData, JobCounter* jobCounter, uint32_t firstIndex, uint32_t numberOfIndices)
+	{
+		assert(nullptr != jobFunction);
+
+		// The job counter must be incremented before the job can be executed
+		if (nullptr != jobCounter)
+		{
+			jobCounter->mNumberOfPendingJobs.fetch_add(1, std::memory_order_relaxed);
+		}
+		pushJob(getCurrentWorker(), Job{jobFunction, userData, jobCounter, firstIndex, numberOfIndices});
+		notifyNewJobs(1);
+	}
+
+	uint32_t JobScheduler::parallelFor(JobFunction jobFunction, void* userData, uint32_t numberOfIndices, uint32_t minimumNumberOfIndicesPerJob, JobCounter& jobCounter)
+	{
+		assert(nullptr != jobFunction);
+		if (0 == numberOfIndices)
+		{
+			// Nothing to do
+			return 0;
+		}
+		if (0 == minimumNumberOfIndicesPerJob)
+		{
+			minimumNumberOfIndicesPerJob = 1;
+		}
+
+		// Calculate the number of jobs: Enough jobs to allow for load balancing, but not too many so the job overhead doesn't eat up the gain
+		const uint32_t maximumNumberOfJobs = (getNumberOfWorkerThreads() + 1) * ::detail::NUMBER_OF_JOBS_PER_THREAD;
+		uint32_t numberOfJobs = (numberOfIndices + minimumNumberOfIndicesPerJob - 1) / minimumNumberOfIndicesPerJob;
+		if (numberOfJobs > maximumNumberOfJobs)
+		{
+			numberOfJobs = maximumNumberOfJobs;
+		}
+
+		// Distribute the indices evenly, the first jobs are getting one additional index if the indices can't be distributed evenly
+		const uint32_t numberOfIndicesPerJob = numberOfIndices / numberOfJobs;
+		const uint32_t numberOfRemainingIndices = numberOfIndices % numberOfJobs;
+		jobCounter.mNumberOfPendingJobs.fetch_add(numberOfJobs, std::memory_order_relaxed);
+		Worker* worker = getCurrentWorker();
+		uint32_t firstIndex = 0;
+		for (uint32_t i = 0; i < numberOfJobs; ++i)
+		{
+			const uint32_t numberOfJobIndices = numberOfIndicesPerJob + ((i < numberOfRemainingIndices) ? 1u : 0u);
+			pushJob(worker, Job{jobFunction, userData, &jobCounter, firstIndex, numberOfJobIndices});
+			firstIndex += numberOfJobIndices;
+		}
+		assert(firstIndex == numberOfIndices);
+		notifyNewJobs(numberOfJobs);
+
+		// Done
+		return numberOfJobs;
+	}
+
+	void JobScheduler::waitForCounter(const JobCounter& jobCounter)
+	{
+		// Wait-while-helping: Instead of blocking the calling thread, execute pending jobs until the job counter reaches zero
+		Worker* worker = getCurrentWorker();
+		while (!jobCounter.isDone())
+		{
+			if (!tryExecuteJob(worker))
+			{
+				// There's currently nothing we can do to help, the remaining jobs are already in execution
+				std::this_thread::yield();
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	JobScheduler::JobScheduler(uint32_t numberOfWorkerThreads) :
+		mShutdownWorkerThreads(false),
+		mNumberOfQueuedJobs(0),
+		mNumberOfSleepingWorkerThreads(0),
+		mNumberOfExternalJobs(0)
+	{
+		// By default, use one worker thread per hardware thread minus the main thread which is helping out while waiting
+		if (isUninitialized(numberOfWorkerThreads))
+		{
+			const uint32_t numberOfHardwareThreads = std::thread::hardware_concurrency();
+			numberOfWorkerThreads = (numberOfHardwareThreads > 1) ? (numberOfHardwareThreads - 1) : 1;
+		}
+		if (0 == numberOfWorkerThreads)
+		{
+			numberOfWorkerThreads = 1;
+		}
+		startWorkerThreads(numberOfWorkerThreads);
+	}
+
+	JobScheduler::~JobScheduler()
+	{
+		stopWorkerThreads();
+
+		// Sanity check
+		assert(mExternalJobs.empty() && "There are still unprocessed jobs inside the job scheduler");
+	}
+
+	void JobScheduler::startWorkerThreads(uint32_t numberOfWorkerThreads)
+	{
+		// Create all workers before starting the worker threads since worker threads are stealing jobs from each other
+		assert(mWorkers.empty());
+		mShutdownWorkerThreads = false;
+		mWorkers.reserve(numberOfWorkerThreads);
+		for (uint32_t i = 0; i < numberOfWorkerThreads; ++i)
+		{
+			mWorkers.push_back(new Worker(*this, i));
+		}
+		for (Worker* worker : mWorkers)
+		{
+			worker->thread = std::thread(&JobScheduler::workerThreadWorker, this, worker);
+		}
+	}
+
+	void JobScheduler::stopWorkerThreads()
+	{
+		// Worker threads shutdown
+		{
+			std::lock_guard<std::mutex> sleepMutexLock(mSleepMutex);
+			mShutdownWorkerThreads = true;
+		}
+		mSleepConditionVariable.notify_all();
+		for (Worker* worker : mWorkers)
+		{
+			worker->thread.join();
+			delete worker;
+		}
+		mWorkers.clear();
+	}
+
+	JobScheduler::Worker* JobScheduler::getCurrentWorker() const
+	{
+		// The current worker is thread local, but there might be multiple job scheduler instances
+		Worker* worker = static_cast<Worker*>(::detail::CurrentWorker);
+		return (nullptr != worker && &worker->jobScheduler == this) ? worker : nullptr;
+	}
+
+	void JobScheduler::pushJob(Worker* worker, const Job& job)
+	{
+		// Announce the job before it becomes visible so the number of queued jobs can't underflow
+		mNumberOfQueuedJobs.fetch_add(1);
+
+		// Worker threads are using their own lock-free work stealing queue
+		if (nullptr != worker)
+		{
+			const uint32_t jobPoolIndex = worker->nextJobIndex & (MAXIMUM_NUMBER_OF_JOBS_PER_THREAD - 1);
+			if (!worker->jobPoolSlotInUse[jobPoolIndex].load(std::memory_order_acquire))
+			{
+				Job& jobPoolJob = worker->jobPool[jobPoolIndex];
+				jobPoolJob = job;
+				worker->jobPoolSlotInUse[jobPoolIndex].store(true, std::memory_order_relaxed);
+				if (worker->workStealingQueue.push(&jobPoolJob))
+				{
+					++worker->nextJobIndex;
+					return;
+				}
+				worker->jobPoolSlotInUse[jobPoolIndex].store(false, std::memory_order_relaxed);
+			}
+		}
+
+		// Other threads, or worker threads with too many jobs in flight, are using the shared queue
+		std::lock_guard<std::mutex> externalJobsMutexLock(mExternalJobsMutex);
+		mExternalJobs.push_back(job);
+		mNumberOfExternalJobs.fetch_add(1, std::memory_order_release);
+	}
+
+	void JobScheduler::notifyNewJobs(uint32_t numberOfNewJobs)
+	{
+		// Wake up sleeping worker threads, if there are any
+		// -> The sleeping worker threads counter is incremented while holding the sleep mutex, so locking it here ensures the wakeup isn't lost
+		if (mNumberOfSleepingWorkerThreads.load() > 0)
+		{
+			{
+				std::lock_guard<std::mutex> sleepMutexLock(mSleepMutex);
+			}
+			if (1 == numberOfNewJobs)
+			{
+				mSleepConditionVariable.notify_one();
+			}
+			else
+			{
+				mSleepConditionVariable.notify_all();
+			}
+		}
+	}
+
+	bool JobScheduler::tryGetJob(Worker* worker, Job& job)
+	{
+		// First try: Our own work stealing queue (LIFO, the data is most likely still inside the cache)
+		if (nullptr != worker)
+		{
+			Job* ownJob = worker->workStealingQueue.pop();
+			if (nullptr != ownJob)
+			{
+				job = *ownJob;
+				worker->jobPoolSlotInUse[ownJob - worker->jobPool].store(false, std::memory_order_release);
+				mNumberOfQueuedJobs.fetch_sub(1);
+				return true;
+			}
+		}
+
+		// Second try: Jobs added by threads which aren't worker threads
+		if (mNumberOfExternalJobs.load(std::memory_order_acquire) > 0)
+		{
+			std::lock_guard<std::mutex> externalJobsMutexLock(mExternalJobsMutex);
+			if (!mExternalJobs.empty())
+			{
+				job = mExternalJobs.front();
+				mExternalJobs.pop_front();
+				mNumberOfExternalJobs.fetch_sub(1, std::memory_order_relaxed);
+				mNumberOfQueuedJobs.fetch_sub(1);
+				return true;
+			}
+		}
+
+		// Third try: Steal from other worker threads, start with a random victim to spread the stealing pressure
+		const uint32_t numberOfWorkers = static_cast<uint32_t>(mWorkers.size());
+		uint32_t randomState = (nullptr != worker) ? worker->randomState : static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+		const uint32_t firstVictimIndex = ::detail::xorshift32(randomState) % numberOfWorkers;
+		if (nullptr != worker)
+		{
+			worker->randomState = randomState;
+		}
+		for (uint32_t i = 0; i < numberOfWorkers; ++i)
+		{
+			Worker* victim = mWorkers[(firstVictimIndex + i) % numberOfWorkers];
+			if (victim != worker)
+			{
+				Job* stolenJob = victim->workStealingQueue.steal();
+				if (nullptr != stolenJob)
+				{
+					job = *stolenJob;
+					victim->jobPoolSlotInUse[stolenJob - victim->jobPool].store(false, std::memory_order_release);
+					mNumberOfQueuedJobs.fetch_sub(1);
+					return true;
+				}
+			}
+		}
+
+		// No job found
+		return false;
+	}
+
+	bool JobScheduler::tryExecuteJob(Worker* worker)
+	{
+		Job job;
+		if (tryGetJob(worker, job))
+		{
+			// Do the work
+			job.jobFunction(job.userData, job.firstIndex, job.numberOfIndices);
+
+			// Tell the job counter that we're done
+			if (nullptr != job.jobCounter)
+			{
+				job.jobCounter->mNumberOfPendingJobs.fetch_sub(1, std::memory_order_release);
+			}
+
+			// Done
+			return true;
+		}
+
+		// No job executed
+		return false;
+	}
+
+	void JobScheduler::workerThreadWorker(Worker* worker)
+	{
+		RENDERER_RUNTIME_SET_CURRENT_THREAD_DEBUG_NAME("JS: Worker", "Renderer runtime: Job scheduler worker thread");
+		::detail::CurrentWorker = worker;
+
+		uint32_t numberOfSpins = 0;
+		while (!mShutdownWorkerThreads)
+		{
+			if (tryExecuteJob(worker))
+			{
+				numberOfSpins = 0;
+			}
+			else if (numberOfSpins < ::detail::NUMBER_OF_SPINS_BEFORE_SLEEPING)
+			{
+				// Give other threads a chance, maybe there's work for us in a moment
+				++numberOfSpins;
+				std::this_thread::yield();
+			}
+			else
+			{
+				// There's nothing to do, go to sleep until new jobs are added
+				std::unique_lock<std::mutex> sleepMutexLock(mSleepMutex);
+				++mNumberOfSleepingWorkerThreads;
+				mSleepConditionVariable.wait(sleepMutexLock, [this]() { return (mNumberOfQueuedJobs.load() > 0 || mShutdownWorkerThreads); });
+				--mNumberOfSleepingWorkerThreads;
+				numberOfSpins = 0;
+			}
+		}
+
+		::detail::CurrentWorker = nullptr;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
@@ -39,7 +39,8 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	IndirectBufferManager::IndirectBufferManager(const IRendererRuntime& rendererRuntime) :
 		mRendererRuntime(rendererRuntime),
-		mBufferManager(rendererRuntime.getBufferManager())
+		mBufferManager(rendererRuntime.getBufferManager()),
+		mInFlightFrameIndex(0)
 	{
 		// Nothing here
 	}
@@ -58,6 +59,13 @@ namespace RendererRuntime
 		{
 			indirectBuffer.indirectBuffer->releaseReference();
 		}
+		for (IndirectBuffers& inFlightIndirectBuffers : mInFlightIndirectBuffers)
+		{
+			for (IndirectBuffer& indirectBuffer : inFlightIndirectBuffers)
+			{
+				indirectBuffer.indirectBuffer->releaseReference();
+			}
+		}
 	}
 
 	Renderer::IIndirectBuffer* IndirectBufferManager::getIndirectBuffer(uint32_t maximumNumberOfDrawCalls)
@@ -100,10 +108,16 @@ namespace RendererRuntime
 		return indirectBuffer;
 	}
 
-	void IndirectBufferManager::freeAllUsedIndirectBuffers()
+	void IndirectBufferManager::frameEnded()
 	{
-		mFreeIndirectBuffers.insert(mFreeIndirectBuffers.end(), mUsedIndirectBuffers.begin(), mUsedIndirectBuffers.end());
-		mUsedIndirectBuffers.clear();
+		// The oldest frame in flight has been retired by the GPU, so its indirect buffers can be reused
+		IndirectBuffers& inFlightIndirectBuffers = mInFlightIndirectBuffers[mInFlightFrameIndex];
+		mFreeIndirectBuffers.insert(mFreeIndirectBuffers.end(), inFlightIndirectBuffers.begin(), inFlightIndirectBuffers.end());
+		inFlightIndirectBuffers.clear();
+
+		// The ended frame is now in flight, swap to keep the allocated vector memory
+		inFlightIndirectBuffers.swap(mUsedIndirectBuffers);
+		mInFlightFrameIndex = (mInFlightFrameIndex + 1) % NUMBER_OF_FRAMES_IN_FLIGHT;
 	}
 
 
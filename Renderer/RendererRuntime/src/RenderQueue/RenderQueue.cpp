@@ -32,6 +32,7 @@
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/InstanceBufferManager.h"
 #include "RendererRuntime/Core/Math/Transform.h"
+#include "RendererRuntime/Core/Thread/ThreadManager.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
 #include <algorithm>
@@ -49,12 +50,44 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		const int DepthBits = 15;
+		const int DepthBits = RendererRuntime::Renderable::SORTING_KEY_DEPTH_BITS;
+		const uint64_t DepthMask = (static_cast<uint64_t>(1) << DepthBits) - 1;
+		const uint32_t RadixBits = 8;
+		const uint32_t RadixSize = 1u << RadixBits;
+		const uint32_t NumberOfRadixPasses = 64 / RadixBits;
+		const size_t   MinimumNumberOfElementsForRadixSort = 64;	///< Below this number of elements a stable insertion sort is faster than the radix sort
+		const size_t   MaximumNumberOfInsertionSortMovesPerElement = 4;	///< Temporal coherence: Budget of the fix up insertion sort, exceeding it means the order churned too much and a full sort is cheaper
+		const size_t   MaximumChurnDivisor = 4;	///< Temporal coherence: If more than 1/n of the renderables were inserted or removed since the previous frame a full sort is performed
+		const uint32_t InvalidIndex = ~0u;
+		const uint32_t NumberOfRenderableManagersPerChunk = 256;	///< Parallel queuing: Fixed chunk size so the chunk layout and hence the result doesn't depend on the number of worker threads
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct QueueRenderablesJobData
+		{
+			RendererRuntime::RenderQueue*						renderQueue;
+			const RendererRuntime::RenderableManager* const*	renderableManagers;
+			uint32_t											numberOfRenderableManagers;
+			bool												castShadows;
+		};
 
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
+		// Automatic instancing: Renderables can be drawn by using a single instanced draw call if they only differ in their transform
+		inline bool canBeInstanced(const RendererRuntime::Renderable& renderable, const RendererRuntime::Renderable& otherRenderable)
+		{
+			return (renderable.getVertexArrayPtr().getPointer() == otherRenderable.getVertexArrayPtr().getPointer() &&
+					renderable.getPrimitiveTopology() == otherRenderable.getPrimitiveTopology() &&
+					renderable.getDrawIndexed() == otherRenderable.getDrawIndexed() &&
+					renderable.getStartIndexLocation() == otherRenderable.getStartIndexLocation() &&
+					renderable.getNumberOfIndices() == otherRenderable.getNumberOfIndices() &&
+					renderable.getMaterialResourceId() == otherRenderable.getMaterialResourceId());
+		}
+
 		// Flip the float to deal with negative & positive numbers
 		// - See "Rough sorting by depth" - http://aras-p.info/blog/2014/01/16/rough-sorting-by-depth/
 		inline uint32_t floatFlip(uint32_t f)
@@ -75,6 +108,103 @@ namespace
 			return (f2i.i >> (32 - DepthBits));	// Take highest n-bits
 		}
 
+		// Fibonacci hashing of the renderable address used for the temporal coherence hash table, the highest bits of the product are the well distributed ones
+		inline uint32_t getRenderableHashTableIndex(const RendererRuntime::Renderable* renderable, uint32_t numberOfHashTableBits)
+		{
+			return static_cast<uint32_t>((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(renderable)) * 0x9E3779B97F4A7C15ull) >> (64 - numberOfHashTableBits));
+		}
+
+		// Stable insertion sort of elements by their 64-bit "sortingKey", adaptive meaning nearly sorted input is sorted in nearly linear time
+		// -> Returns "false" if the given maximum number of element moves has been exceeded, the elements are left in a valid but only partially sorted order in this case
+		template <typename ELEMENT_TYPE>
+		bool insertionSortBySortingKey(std::vector<ELEMENT_TYPE>& elements, size_t maximumNumberOfMoves)
+		{
+			const size_t numberOfElements = elements.size();
+			size_t numberOfMoves = 0;
+			for (size_t i = 1; i < numberOfElements; ++i)
+			{
+				if (elements[i - 1].sortingKey > elements[i].sortingKey)
+				{
+					const ELEMENT_TYPE element = elements[i];
+					size_t j = i;
+					for (; j > 0 && elements[j - 1].sortingKey > element.sortingKey; --j)
+					{
+						elements[j] = elements[j - 1];
+					}
+					elements[j] = element;
+					numberOfMoves += i - j;
+					if (numberOfMoves > maximumNumberOfMoves)
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		// Stable sort of elements by their 64-bit "sortingKey"
+		// -> Least significant digit (LSD) radix sort, byte by byte, using the given scratch buffer as ping-pong buffer
+		// -> Passes in which all keys share the same digit are skipped, which is common for the layer and transparent bits since those are identical inside a queue
+		template <typename ELEMENT_TYPE>
+		void radixSortBySortingKey(std::vector<ELEMENT_TYPE>& elements, std::vector<ELEMENT_TYPE>& scratchElements)
+		{
+			const size_t numberOfElements = elements.size();
+			if (numberOfElements < MinimumNumberOfElementsForRadixSort)
+			{
+				insertionSortBySortingKey(elements, ~static_cast<size_t>(0));
+				return;
+			}
+
+			// Build the histograms of all passes at once
+			uint32_t histograms[NumberOfRadixPasses][RadixSize] = {};
+			for (const ELEMENT_TYPE& element : elements)
+			{
+				const uint64_t sortingKey = element.sortingKey;
+				for (uint32_t pass = 0; pass < NumberOfRadixPasses; ++pass)
+				{
+					++histograms[pass][(sortingKey >> (pass * RadixBits)) & (RadixSize - 1)];
+				}
+			}
+
+			// Scatter
+			scratchElements.resize(numberOfElements);
+			ELEMENT_TYPE* source = elements.data();
+			ELEMENT_TYPE* destination = scratchElements.data();
+			for (uint32_t pass = 0; pass < NumberOfRadixPasses; ++pass)
+			{
+				uint32_t* histogram = histograms[pass];
+				const uint32_t shift = pass * RadixBits;
+
+				// Skip the pass if all elements share the same digit
+				if (histogram[(source[0].sortingKey >> shift) & (RadixSize - 1)] == numberOfElements)
+				{
+					continue;
+				}
+
+				// Exclusive prefix sum: Turn the digit counts into destination offsets
+				uint32_t offset = 0;
+				for (uint32_t digit = 0; digit < RadixSize; ++digit)
+				{
+					const uint32_t count = histogram[digit];
+					histogram[digit] = offset;
+					offset += count;
+				}
+
+				// Stable scatter into the destination buffer
+				for (size_t i = 0; i < numberOfElements; ++i)
+				{
+					destination[histogram[(source[i].sortingKey >> shift) & (RadixSize - 1)]++] = source[i];
+				}
+				std::swap(source, destination);
+			}
+
+			// Ensure the result ends up in the given elements
+			if (source != elements.data())
+			{
+				elements.swap(scratchElements);
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -99,7 +229,16 @@ namespace RendererRuntime
 		mMinimumRenderQueueIndex(minimumRenderQueueIndex),
 		mMaximumRenderQueueIndex(maximumRenderQueueIndex),
 		mTransparentPass(transparentPass),
-		mDoSort(doSort)
+		mDoSort(doSort),
+		mNumberOfDrawCalls(0),
+		mNumberOfMergedDrawCalls(0),
+		mIndirectBuffer(nullptr),
+		mCopyIndirectBufferDataCommandByteIndex(0),
+		mMaximumNumberOfIndirectDraws(0),
+		mIndirectDrawBatchOffset(0),
+		mIndirectDrawBatchNumberOfDraws(0),
+		mIndirectDrawBatchIndexed(false),
+		mNumberOfBatchedDrawCalls(0)
 	{
 		assert(mMaximumRenderQueueIndex >= mMinimumRenderQueueIndex);
 		mQueues.resize(static_cast<size_t>(mMaximumRenderQueueIndex - mMinimumRenderQueueIndex + 1));
@@ -109,6 +248,16 @@ namespace RendererRuntime
 	{
 		for (Queue& queue : mQueues)
 		{
+			// Keep the queued renderables and their sorted order as previous frame data to exploit temporal coherence
+			if (queue.sorted)
+			{
+				queue.previousQueuedRenderables.swap(queue.queuedRenderables);
+			}
+			else
+			{
+				queue.previousQueuedRenderables.clear();
+				queue.sortedQueuedRenderables.clear();
+			}
 			queue.queuedRenderables.clear();
 			queue.sorted = false;
 		}
@@ -116,34 +265,48 @@ namespace RendererRuntime
 
 	void RenderQueue::addRenderablesFromRenderableManager(const RenderableManager& renderableManager, bool castShadows)
 	{
-		// Sanity check
-		assert(renderableManager.isVisible());
-
-		// Quantize the cached distance to camera
-		const uint32_t quantizedDepth = ::detail::depthToBits(renderableManager.getCachedDistanceToCamera());
+		queueRenderablesFromRenderableManager(renderableManager, castShadows, mQueues);
+	}
 
-		// Register the renderables inside our renderables queue
-		for (const Renderable& renderable : renderableManager.getRenderables())
+	void RenderQueue::addRenderablesFromRenderableManagers(const RenderableManager* const* renderableManagers, uint32_t numberOfRenderableManagers, bool castShadows)
+	{
+		const uint32_t numberOfChunks = (numberOfRenderableManagers + ::detail::NumberOfRenderableManagersPerChunk - 1) / ::detail::NumberOfRenderableManagersPerChunk;
+		if (numberOfChunks <= 1)
 		{
-			if (!castShadows || renderable.getCastShadows())
+			// Not worth the job overhead, directly queue into the render queue
+			for (uint32_t i = 0; i < numberOfRenderableManagers; ++i)
 			{
-				// It's valid if one or more renderables inside a renderable manager don't fall into the range processed by this render queue
-				// -> At least one renderable should fall into the range processed by this render queue or the render queue is used wrong
-				const uint8_t renderQueueIndex = renderable.getRenderQueueIndex();
-				if (renderQueueIndex >= mMinimumRenderQueueIndex && renderQueueIndex <= mMaximumRenderQueueIndex)
+				const RenderableManager& renderableManager = *renderableManagers[i];
+				if (castShadows ? renderableManager.getCastShadows() : renderableManager.getCachedInsideCameraFrustum())
 				{
-					// Get the precalculated static part of the sorting key
-					// -> Sort renderables back-to-front (for transparency) or front-to-back (for occlusion efficiency)
-					// TODO(co) Depending on "mTransparentPass" the sorting key is used
-					uint64_t sortingKey = renderable.getSortingKey();
-
-					// The quantized depth is a dynamic part which is set now
-					sortingKey = quantizedDepth;	// TODO(co) Just bits influenced
-
-					// Register the renderable inside our renderables queue
-					Queue& queue = mQueues[static_cast<size_t>(renderQueueIndex - mMinimumRenderQueueIndex)];
-					assert(!queue.sorted);	// Ensure render queue is still in filling state and not already in rendering state
-					queue.queuedRenderables.emplace_back(renderable, sortingKey);
+					queueRenderablesFromRenderableManager(renderableManager, castShadows, mQueues);
+				}
+			}
+		}
+		else
+		{
+			// Each chunk is queued into its own chunk local queues
+			if (mChunkQueues.size() < numberOfChunks)
+			{
+				mChunkQueues.resize(numberOfChunks, Queues(mQueues.size()));
+			}
+			::detail::QueueRenderablesJobData queueRenderablesJobData = { this, renderableManagers, numberOfRenderableManagers, castShadows };
+			JobScheduler& jobScheduler = mRendererRuntime.getThreadManager().getJobScheduler();
+			JobCounter jobCounter;
+			jobScheduler.parallelFor(&RenderQueue::queueRenderablesJob, &queueRenderablesJobData, numberOfChunks, 1, jobCounter);
+			jobScheduler.waitForCounter(jobCounter);
+
+			// Merge the chunk local queues in chunk order, the result is identical to a serial processing
+			const size_t numberOfQueues = mQueues.size();
+			for (size_t queueIndex = 0; queueIndex < numberOfQueues; ++queueIndex)
+			{
+				Queue& queue = mQueues[queueIndex];
+				assert(!queue.sorted);	// Ensure render queue is still in filling state and not already in rendering state
+				for (uint32_t chunkIndex = 0; chunkIndex < numberOfChunks; ++chunkIndex)
+				{
+					QueuedRenderables& chunkQueuedRenderables = mChunkQueues[chunkIndex][queueIndex].queuedRenderables;
+					queue.queuedRenderables.insert(queue.queuedRenderables.end(), chunkQueuedRenderables.begin(), chunkQueuedRenderables.end());
+					chunkQueuedRenderables.clear();
 				}
 			}
 		}
@@ -154,9 +317,8 @@ namespace RendererRuntime
 		// Begin debug event
 		COMMAND_BEGIN_DEBUG_EVENT_FUNCTION(commandBuffer)
 
-		// TODO(co) This is just a dummy implementation. For example automatic instancing has to be incorporated as well as more efficient buffer management.
+		// TODO(co) This is just a dummy implementation. For example more efficient buffer management has to be incorporated.
 
-		const MaterialResources& materialResources = mRendererRuntime.getMaterialResourceManager().getMaterialResources();
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRendererRuntime.getMaterialBlueprintResourceManager();
 		InstanceBufferManager& instanceBufferManager = materialBlueprintResourceManager.getInstanceBufferManager();
 		LightBufferManager& lightBufferManager = materialBlueprintResourceManager.getLightBufferManager();
@@ -165,6 +327,25 @@ namespace RendererRuntime
 		Renderer::IVertexArray* currentVertexArray = nullptr;
 		Renderer::PrimitiveTopology currentPrimitiveTopology = Renderer::PrimitiveTopology::UNKNOWN;
 		Renderer::IPipelineState* currentPipelineState = nullptr;
+		const MaterialTechnique* currentMaterialTechnique = nullptr;
+
+		// Automatic instancing requires instanced draw calls, else each renderable gets its own draw call
+		// -> The shaders pick the per-instance data by using the instance ID, Direct3D 9 has none and hence doesn't report draw instanced support
+		const Renderer::Capabilities& capabilities = mRendererRuntime.getRenderer().getCapabilities();
+		const bool drawInstanced = capabilities.drawInstanced;
+		mNumberOfDrawCalls = 0;
+		mNumberOfMergedDrawCalls = 0;
+		mNumberOfBatchedDrawCalls = 0;
+
+		// Multi-draw indirect batching requires indirect buffer support, the indirect buffers don't need to hold more draws than there are queued renderables
+		{
+			size_t numberOfQueuedRenderables = 0;
+			for (const Queue& queue : mQueues)
+			{
+				numberOfQueuedRenderables += queue.queuedRenderables.size();
+			}
+			mMaximumNumberOfIndirectDraws = static_cast<uint32_t>(std::min(numberOfQueuedRenderables, static_cast<size_t>(capabilities.maximumIndirectBufferSize / sizeof(Renderer::DrawIndexedInstancedArguments))));
+		}
 
 		// Process all render queues
 		// -> When adding renderables from renderable manager we could build up a minimum/maximum used render queue index to sometimes reduce
@@ -178,29 +359,46 @@ namespace RendererRuntime
 				// Sort queued renderables
 				if (!queue.sorted && mDoSort)
 				{
-					// TODO(co) Exploit temporal coherence across frames then use insertion sorts as explained by L. Spiro in
-					// http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/?view=findpost&p=5181408
-					// Keep a list of sorted indices from the previous frame (one per camera).
-					// If we have the sorted list "5, 1, 4, 3, 2, 0":
-					// * If it grew from last frame, append: 5, 1, 4, 3, 2, 0, 6, 7 and use insertion sort.
-					// * If it's the same, leave it as is, and use insertion sort just in case.
-					// * If it's shorter, reset the indices 0, 1, 2, 3, 4; probably use quicksort or other generic sort
-					// TODO(co) Use radix sort? ( https://www.quora.com/What-is-the-most-efficient-way-to-sort-a-million-32-bit-integers )
-					std::sort(queuedRenderables.begin(), queuedRenderables.end());
+					sortQueue(queue);
 					queue.sorted = true;
 				}
 
 				// Inject queued renderables into the renderer
-				for (const QueuedRenderable& queuedRenderable : queuedRenderables)
+				const SortedQueuedRenderables& sortedQueuedRenderables = queue.sortedQueuedRenderables;
+				const size_t numberOfQueuedRenderables = queuedRenderables.size();
+				for (size_t i = 0, nextIndex = 0; i < numberOfQueuedRenderables; i = nextIndex)
 				{
+					const QueuedRenderable& queuedRenderable = queue.sorted ? queuedRenderables[sortedQueuedRenderables[i].queuedRenderableIndex] : queuedRenderables[i];
 					assert(nullptr != queuedRenderable.renderable);
 					const Renderable& renderable = *queuedRenderable.renderable;
+
+					// Automatic instancing: Gather the run of directly following queued renderables which only differ in their transform
+					// -> Thanks to the sorting key layout, renderables using the same material and vertex array are usually next to each other
+					mObjectSpaceToWorldSpaceTransforms.clear();
+					mObjectSpaceToWorldSpaceTransforms.push_back(&renderable.getRenderableManager().getTransform());
+					nextIndex = i + 1;
+					if (drawInstanced)
+					{
+						while (nextIndex < numberOfQueuedRenderables)
+						{
+							const QueuedRenderable& nextQueuedRenderable = queue.sorted ? queuedRenderables[sortedQueuedRenderables[nextIndex].queuedRenderableIndex] : queuedRenderables[nextIndex];
+							assert(nullptr != nextQueuedRenderable.renderable);
+							if (!::detail::canBeInstanced(renderable, *nextQueuedRenderable.renderable))
+							{
+								break;
+							}
+							mObjectSpaceToWorldSpaceTransforms.push_back(&nextQueuedRenderable.renderable->getRenderableManager().getTransform());
+							++nextIndex;
+						}
+					}
+
 					Renderer::IVertexArrayPtr vertexArrayPtr = renderable.getVertexArrayPtr();
 					if (nullptr != vertexArrayPtr)
 					{
 						// Setup input assembly (IA): Set the used vertex array
 						if (currentVertexArray != vertexArrayPtr)
 						{
+							flushIndirectDrawBatch(commandBuffer);
 							currentVertexArray = vertexArrayPtr;
 							Renderer::Command::SetVertexArray::create(commandBuffer, currentVertexArray);
 						}
@@ -208,124 +406,94 @@ namespace RendererRuntime
 						// Setup input assembly (IA): Set the primitive topology used for draw calls
 						if (currentPrimitiveTopology != renderable.getPrimitiveTopology())
 						{
+							flushIndirectDrawBatch(commandBuffer);
 							currentPrimitiveTopology = renderable.getPrimitiveTopology();
 							Renderer::Command::SetPrimitiveTopology::create(commandBuffer, currentPrimitiveTopology);
 						}
 
-						// Material resource
-						const MaterialResource* materialResource = materialResources.tryGetElementById(renderable.getMaterialResourceId());
-						if (nullptr != materialResource)
+						// Draw packet: The resolved material technique, material blueprint resource and pipeline state are cached inside the renderable
+						Renderable::DrawPacket drawPacket;
+						if (getDrawPacket(renderable, materialTechniqueId, drawPacket))
 						{
-							MaterialTechnique* materialTechnique = materialResource->getMaterialTechniqueById(materialTechniqueId);
-							if (nullptr != materialTechnique)
+							MaterialBlueprintResource* materialBlueprintResource = drawPacket.materialBlueprintResource;
+							MaterialTechnique* materialTechnique = drawPacket.materialTechnique;
+							Renderer::IPipelineState* pipelineState = drawPacket.pipelineState;
+
+							// Expensive state change: Handle material blueprint resource switches
+							// -> Render queue should be sorted by material blueprint resource first to reduce those expensive state changes
+							if (compositorContextData.mCurrentlyBoundMaterialBlueprintResource != materialBlueprintResource)
 							{
-								MaterialBlueprintResource* materialBlueprintResource = static_cast<MaterialBlueprintResource*>(materialBlueprintResourceManager.tryGetResourceByResourceId(materialTechnique->getMaterialBlueprintResourceId()));
-								if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
-								{
-									// TODO(co) Pass shader properties (later on we cache as much as possible of this work inside the renderable)
-									ShaderProperties shaderProperties;
-									DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES];
-									{ // Gather shader properties from static material properties generating shader combinations
-										const MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector = materialResource->getSortedPropertyVector();
-										const size_t numberOfMaterialProperties = sortedMaterialPropertyVector.size();
-										for (size_t i = 0; i < numberOfMaterialProperties; ++i)
-										{
-											const MaterialProperty& materialProperty = sortedMaterialPropertyVector[i];
-											if (materialProperty.getUsage() == MaterialProperty::Usage::SHADER_COMBINATION)
-											{
-												switch (materialProperty.getValueType())
-												{
-													case MaterialPropertyValue::ValueType::BOOLEAN:
-														shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getBooleanValue());
-														break;
-
-													case MaterialPropertyValue::ValueType::INTEGER:
-														shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getIntegerValue());
-														break;
-
-													case MaterialPropertyValue::ValueType::UNKNOWN:
-													case MaterialPropertyValue::ValueType::INTEGER_2:
-													case MaterialPropertyValue::ValueType::INTEGER_3:
-													case MaterialPropertyValue::ValueType::INTEGER_4:
-													case MaterialPropertyValue::ValueType::FLOAT:
-													case MaterialPropertyValue::ValueType::FLOAT_2:
-													case MaterialPropertyValue::ValueType::FLOAT_3:
-													case MaterialPropertyValue::ValueType::FLOAT_4:
-													case MaterialPropertyValue::ValueType::FLOAT_3_3:
-													case MaterialPropertyValue::ValueType::FLOAT_4_4:
-													case MaterialPropertyValue::ValueType::FILL_MODE:
-													case MaterialPropertyValue::ValueType::CULL_MODE:
-													case MaterialPropertyValue::ValueType::CONSERVATIVE_RASTERIZATION_MODE:
-													case MaterialPropertyValue::ValueType::DEPTH_WRITE_MASK:
-													case MaterialPropertyValue::ValueType::STENCIL_OP:
-													case MaterialPropertyValue::ValueType::COMPARISON_FUNC:
-													case MaterialPropertyValue::ValueType::BLEND:
-													case MaterialPropertyValue::ValueType::BLEND_OP:
-													case MaterialPropertyValue::ValueType::FILTER_MODE:
-													case MaterialPropertyValue::ValueType::TEXTURE_ADDRESS_MODE:
-													case MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID:
-													default:
-														assert(false);	// TODO(co) Error handling
-														break;
-												}
-											}
-										}
+								flushIndirectDrawBatch(commandBuffer);
+								compositorContextData.mCurrentlyBoundMaterialBlueprintResource = materialBlueprintResource;
+
+								// Fill the pass buffer manager
+								{ // TODO(co) Just a dummy usage for now
+									PassBufferManager* passBufferManager = materialBlueprintResource->getPassBufferManager();
+									if (nullptr != passBufferManager)
+									{
+										passBufferManager->resetCurrentPassBuffer();
+										passBufferManager->fillBuffer(renderTarget, compositorContextData);
 									}
-									materialBlueprintResource->optimizeShaderProperties(shaderProperties);
+								}
+
+								// Bind the material blueprint resource and instance and light buffer manager to the used renderer
+								materialBlueprintResource->fillCommandBuffer(commandBuffer);
+								instanceBufferManager.fillCommandBuffer(*materialBlueprintResource, commandBuffer);
+								lightBufferManager.fillCommandBuffer(*materialBlueprintResource, commandBuffer);
+
+								// The material technique must be bound again after the material blueprint resource has been bound
+								currentMaterialTechnique = nullptr;
+							}
+
+							// Cheap state change: Bind the material technique to the used renderer
+							if (currentMaterialTechnique != materialTechnique)
+							{
+								flushIndirectDrawBatch(commandBuffer);
+								currentMaterialTechnique = materialTechnique;
+								materialTechnique->fillCommandBuffer(mRendererRuntime, commandBuffer);
+							}
+
+							// Set the used pipeline state object (PSO)
+							if (currentPipelineState != pipelineState)
+							{
+								flushIndirectDrawBatch(commandBuffer);
+								currentPipelineState = pipelineState;
+								Renderer::Command::SetPipelineState::create(commandBuffer, currentPipelineState);
+							}
 
-									Renderer::IPipelineStatePtr pipelineStatePtr = materialBlueprintResource->getPipelineStateCacheManager().getPipelineStateCacheByCombination(shaderProperties, dynamicShaderPieces, false);
-									if (nullptr != pipelineStatePtr)
+							// Fill the instance buffer manager and render the specified geometric primitive, based on indexing into an array of vertices
+							// -> Without instance uniform buffer there's no per-instance data, so each renderable of the run gets its own draw call
+							// -> Please note that it's valid that there are no indices, for example "RendererRuntime::CompositorInstancePassDebugGui" is using the render queue only to set the material resource blueprint
+							// -> Without per-draw instance data the draw calls can be gathered into a multi-draw indirect batch
+							const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer = materialBlueprintResource->getInstanceUniformBuffer();
+							const uint32_t numberOfRunRenderables = static_cast<uint32_t>(mObjectSpaceToWorldSpaceTransforms.size());
+							if (nullptr == instanceUniformBuffer && 0 != renderable.getNumberOfIndices() && mMaximumNumberOfIndirectDraws > 1)
+							{
+								for (uint32_t instance = 0; instance < numberOfRunRenderables; ++instance)
+								{
+									addIndirectDraw(renderable, commandBuffer);
+								}
+								continue;
+							}
+							flushIndirectDrawBatch(commandBuffer);
+							for (uint32_t instance = 0; instance < numberOfRunRenderables;)
+							{
+								const uint32_t numberOfInstances = (nullptr != instanceUniformBuffer) ? (numberOfRunRenderables - instance) : 1;
+								const uint32_t numberOfFilledInstances = instanceBufferManager.fillBuffer(materialBlueprintResource->getPassBufferManager(), instanceUniformBuffer, materialBlueprintResource->getInstanceTextureBuffer(), &mObjectSpaceToWorldSpaceTransforms[instance], numberOfInstances, *materialTechnique, commandBuffer);
+								if (0 != renderable.getNumberOfIndices())
+								{
+									if (renderable.getDrawIndexed())
+									{
+										Renderer::Command::DrawIndexed::create(commandBuffer, renderable.getNumberOfIndices(), numberOfFilledInstances, renderable.getStartIndexLocation());
+									}
+									else
 									{
-										// Expensive state change: Handle material blueprint resource switches
-										// -> Render queue should be sorted by material blueprint resource first to reduce those expensive state changes
-										if (compositorContextData.mCurrentlyBoundMaterialBlueprintResource != materialBlueprintResource)
-										{
-											compositorContextData.mCurrentlyBoundMaterialBlueprintResource = materialBlueprintResource;
-
-											// Fill the pass buffer manager
-											{ // TODO(co) Just a dummy usage for now
-												PassBufferManager* passBufferManager = materialBlueprintResource->getPassBufferManager();
-												if (nullptr != passBufferManager)
-												{
-													passBufferManager->resetCurrentPassBuffer();
-													passBufferManager->fillBuffer(renderTarget, compositorContextData);
-												}
-											}
-
-											// Bind the material blueprint resource and instance and light buffer manager to the used renderer
-											materialBlueprintResource->fillCommandBuffer(commandBuffer);
-											instanceBufferManager.fillCommandBuffer(*materialBlueprintResource, commandBuffer);
-											lightBufferManager.fillCommandBuffer(*materialBlueprintResource, commandBuffer);
-										}
-
-										// Cheap state change: Bind the material technique to the used renderer
-										materialTechnique->fillCommandBuffer(mRendererRuntime, commandBuffer);
-
-										// Set the used pipeline state object (PSO)
-										if (currentPipelineState != pipelineStatePtr)
-										{
-											currentPipelineState = pipelineStatePtr;
-											Renderer::Command::SetPipelineState::create(commandBuffer, currentPipelineState);
-										}
-
-										// Fill the instance buffer manager
-										instanceBufferManager.fillBuffer(materialBlueprintResource->getPassBufferManager(), materialBlueprintResource->getInstanceUniformBuffer(), materialBlueprintResource->getInstanceTextureBuffer(), renderable.getRenderableManager().getTransform(), *materialTechnique, commandBuffer);
-
-										// Render the specified geometric primitive, based on indexing into an array of vertices
-										// -> Please note that it's valid that there are no indices, for example "RendererRuntime::CompositorInstancePassDebugGui" is using the render queue only to set the material resource blueprint
-										if (0 != renderable.getNumberOfIndices())
-										{
-											if (renderable.getDrawIndexed())
-											{
-												Renderer::Command::DrawIndexed::create(commandBuffer, renderable.getNumberOfIndices(), 1, renderable.getStartIndexLocation());
-											}
-											else
-											{
-												Renderer::Command::Draw::create(commandBuffer, renderable.getNumberOfIndices(), 1, renderable.getStartIndexLocation());
-											}
-										}
+										Renderer::Command::Draw::create(commandBuffer, renderable.getNumberOfIndices(), numberOfFilledInstances, renderable.getStartIndexLocation());
 									}
+									++mNumberOfDrawCalls;
+									mNumberOfMergedDrawCalls += numberOfFilledInstances - 1;
 								}
+								instance += numberOfFilledInstances;
 							}
 						}
 					}
@@ -333,11 +501,455 @@ namespace RendererRuntime
 			}
 		}
 
+		// Issue the last multi-draw indirect batch and upload the draw arguments of the last indirect buffer
+		flushIndirectDrawBatch(commandBuffer);
+		uploadIndirectDrawArguments(commandBuffer);
+
 		// End debug event
 		COMMAND_END_DEBUG_EVENT(commandBuffer)
 	}
 
 
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RenderQueue::queueRenderablesFromRenderableManager(const RenderableManager& renderableManager, bool castShadows, Queues& queues) const
+	{
+		// Sanity check
+		assert(renderableManager.isVisible());
+
+		// Quantize the cached distance to camera
+		// -> Sort renderables back-to-front (for transparency) or front-to-back (for occlusion efficiency)
+		// -> See "RendererRuntime::Renderable::SORTING_KEY_LAYER_SHIFT" for the sorting key layout
+		const uint64_t quantizedDepth = ::detail::depthToBits(renderableManager.getCachedDistanceToCamera());
+		const uint64_t dynamicSortingKey = mTransparentPass ? ((static_cast<uint64_t>(1) << Renderable::SORTING_KEY_TRANSPARENT_SHIFT) | ((::detail::DepthMask - quantizedDepth) << Renderable::SORTING_KEY_STATE_BITS)) : quantizedDepth;
+		const uint32_t stateShift = mTransparentPass ? 0 : Renderable::SORTING_KEY_DEPTH_BITS;
+
+		// Register the renderables inside our renderables queue
+		for (const Renderable& renderable : renderableManager.getRenderables())
+		{
+			if (!castShadows || renderable.getCastShadows())
+			{
+				// It's valid if one or more renderables inside a renderable manager don't fall into the range processed by this render queue
+				// -> At least one renderable should fall into the range processed by this render queue or the render queue is used wrong
+				const uint8_t renderQueueIndex = renderable.getRenderQueueIndex();
+				if (renderQueueIndex >= mMinimumRenderQueueIndex && renderQueueIndex <= mMaximumRenderQueueIndex)
+				{
+					// Compose the sorting key using the precalculated static part, the quantized depth is a dynamic part which is set now
+					const uint64_t staticSortingKey = renderable.getSortingKey();
+					const uint64_t sortingKey = (staticSortingKey & ~Renderable::SORTING_KEY_STATE_MASK) | ((staticSortingKey & Renderable::SORTING_KEY_STATE_MASK) << stateShift) | dynamicSortingKey;
+
+					// Register the renderable inside our renderables queue
+					Queue& queue = queues[static_cast<size_t>(renderQueueIndex - mMinimumRenderQueueIndex)];
+					assert(!queue.sorted);	// Ensure render queue is still in filling state and not already in rendering state
+					queue.queuedRenderables.emplace_back(renderable, sortingKey);
+				}
+			}
+		}
+	}
+
+	void RenderQueue::queueRenderablesJob(void* userData, uint32_t firstIndex, uint32_t numberOfIndices)
+	{
+		// Each index is a chunk of renderable managers
+		const ::detail::QueueRenderablesJobData& queueRenderablesJobData = *static_cast<const ::detail::QueueRenderablesJobData*>(userData);
+		RenderQueue& renderQueue = *queueRenderablesJobData.renderQueue;
+		const bool castShadows = queueRenderablesJobData.castShadows;
+		for (uint32_t chunkIndex = firstIndex; chunkIndex < firstIndex + numberOfIndices; ++chunkIndex)
+		{
+			Queues& queues = renderQueue.mChunkQueues[chunkIndex];
+			const uint32_t firstRenderableManager = chunkIndex * ::detail::NumberOfRenderableManagersPerChunk;
+			const uint32_t lastRenderableManager = std::min(firstRenderableManager + ::detail::NumberOfRenderableManagersPerChunk, queueRenderablesJobData.numberOfRenderableManagers);
+			for (uint32_t i = firstRenderableManager; i < lastRenderableManager; ++i)
+			{
+				const RenderableManager& renderableManager = *queueRenderablesJobData.renderableManagers[i];
+				if (castShadows ? renderableManager.getCastShadows() : renderableManager.getCachedInsideCameraFrustum())
+				{
+					renderQueue.queueRenderablesFromRenderableManager(renderableManager, castShadows, queues);
+				}
+			}
+		}
+	}
+
+	void RenderQueue::sortQueue(Queue& queue)
+	{
+		// Exploit temporal coherence across frames then use insertion sorts as explained by L. Spiro in
+		// http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/?view=findpost&p=5181408
+		// -> The sorted order of the previous frame is kept by renderable identity
+		// -> Renderables which were already queued during the previous frame are placed in their previous order and an adaptive insertion
+		//    sort fixes up the order which changed due to e.g. camera movement. New renderables are sorted on their own and merged in,
+		//    removed renderables are dropped. If too much changed, a full radix sort is performed instead.
+		const QueuedRenderables& queuedRenderables = queue.queuedRenderables;
+		const QueuedRenderables& previousQueuedRenderables = queue.previousQueuedRenderables;
+		SortedQueuedRenderables& sortedQueuedRenderables = queue.sortedQueuedRenderables;	// Still holding the sorted order of the previous frame
+		const uint32_t numberOfQueuedRenderables = static_cast<uint32_t>(queuedRenderables.size());
+		const uint32_t numberOfPreviousQueuedRenderables = static_cast<uint32_t>(previousQueuedRenderables.size());
+		bool sorted = false;
+		if (numberOfPreviousQueuedRenderables > 0 && numberOfQueuedRenderables >= ::detail::MinimumNumberOfElementsForRadixSort)
+		{
+			// Map the previous queued renderables to the current queued renderables
+			// -> Renderables are usually queued in nearly the same order each frame and inserted or removed renderables only shift the following
+			//    ones, so the renderable at the expected previous index (tracking the shift) is checked first
+			// -> Only if this fails, a hash table mapping the previous queued renderables to their previous index is build and used
+			//    (open addressing with linear probing, load factor <= 0.5, stores indices only to keep it small)
+			const uint32_t maximumChurn = numberOfQueuedRenderables / ::detail::MaximumChurnDivisor;
+			mQueuedRenderableIndexByPreviousIndex.assign(numberOfPreviousQueuedRenderables, ::detail::InvalidIndex);
+			mNewSortedQueuedRenderables.clear();
+			int64_t shift = 0;
+			uint32_t numberOfHashTableBits = 0;
+			uint32_t numberOfHashTableLookups = 0;
+			uint32_t numberOfKeptRenderables = 0;
+			uint32_t i = 0;
+			for (; i < numberOfQueuedRenderables && mNewSortedQueuedRenderables.size() <= maximumChurn && numberOfHashTableLookups <= maximumChurn; ++i)
+			{
+				const QueuedRenderable& queuedRenderable = queuedRenderables[i];
+				const int64_t expectedPreviousIndex = static_cast<int64_t>(i) + shift;
+				uint32_t previousIndex = ::detail::InvalidIndex;
+				if (expectedPreviousIndex >= 0 && expectedPreviousIndex < numberOfPreviousQueuedRenderables && previousQueuedRenderables[static_cast<size_t>(expectedPreviousIndex)].renderable == queuedRenderable.renderable)
+				{
+					previousIndex = static_cast<uint32_t>(expectedPreviousIndex);
+				}
+				else
+				{
+					// Build the hash table, if not already done
+					if (0 == numberOfHashTableBits)
+					{
+						numberOfHashTableBits = 1;
+						while ((1u << numberOfHashTableBits) < numberOfPreviousQueuedRenderables * 2)
+						{
+							++numberOfHashTableBits;
+						}
+						const uint32_t hashTableMask = (1u << numberOfHashTableBits) - 1;
+						mPreviousIndexHashTable.assign(static_cast<size_t>(hashTableMask) + 1, ::detail::InvalidIndex);
+						for (uint32_t index = 0; index < numberOfPreviousQueuedRenderables; ++index)
+						{
+							uint32_t hashTableIndex = ::detail::getRenderableHashTableIndex(previousQueuedRenderables[index].renderable, numberOfHashTableBits);
+							while (::detail::InvalidIndex != mPreviousIndexHashTable[hashTableIndex])
+							{
+								hashTableIndex = (hashTableIndex + 1) & hashTableMask;
+							}
+							mPreviousIndexHashTable[hashTableIndex] = index;
+						}
+					}
+
+					// Hash table lookup
+					++numberOfHashTableLookups;
+					const uint32_t hashTableMask = (1u << numberOfHashTableBits) - 1;
+					uint32_t hashTableIndex = ::detail::getRenderableHashTableIndex(queuedRenderable.renderable, numberOfHashTableBits);
+					while (::detail::InvalidIndex != mPreviousIndexHashTable[hashTableIndex])
+					{
+						const uint32_t index = mPreviousIndexHashTable[hashTableIndex];
+						if (previousQueuedRenderables[index].renderable == queuedRenderable.renderable)
+						{
+							// Found, the following renderables are expected to be shifted in the same way
+							previousIndex = index;
+							shift = static_cast<int64_t>(previousIndex) - static_cast<int64_t>(i);
+							break;
+						}
+						hashTableIndex = (hashTableIndex + 1) & hashTableMask;
+					}
+				}
+
+				// The same renderable might have been queued multiple times, only the first one is considered to be kept
+				if (::detail::InvalidIndex != previousIndex && ::detail::InvalidIndex == mQueuedRenderableIndexByPreviousIndex[previousIndex])
+				{
+					mQueuedRenderableIndexByPreviousIndex[previousIndex] = i;
+					++numberOfKeptRenderables;
+				}
+				else
+				{
+					mNewSortedQueuedRenderables.emplace_back(queuedRenderable.sortingKey, i);
+				}
+			}
+
+			// Only use the previous order if all queued renderables have been mapped and the number of inserted and removed renderables is in a reasonable range
+			// -> If the mapping has been stopped early because the queue order changed too much, the unmapped renderables would be lost, so a full sort is required
+			const uint32_t churn = (numberOfQueuedRenderables - numberOfKeptRenderables) + (numberOfPreviousQueuedRenderables - numberOfKeptRenderables);
+			if (numberOfQueuedRenderables == i && churn <= maximumChurn)
+			{
+				// Kept renderables in their previous order, using the current sorting keys
+				mScratchSortedQueuedRenderables.clear();
+				mScratchSortedQueuedRenderables.reserve(numberOfKeptRenderables);
+				for (const SortedQueuedRenderable& previousSortedQueuedRenderable : sortedQueuedRenderables)
+				{
+					const uint32_t queuedRenderableIndex = mQueuedRenderableIndexByPreviousIndex[previousSortedQueuedRenderable.queuedRenderableIndex];
+					if (::detail::InvalidIndex != queuedRenderableIndex)
+					{
+						mScratchSortedQueuedRenderables.emplace_back(queuedRenderables[queuedRenderableIndex].sortingKey, queuedRenderableIndex);
+					}
+				}
+				assert(mScratchSortedQueuedRenderables.size() == numberOfKeptRenderables);
+
+				// Fix up the order of the kept renderables
+				if (::detail::insertionSortBySortingKey(mScratchSortedQueuedRenderables, numberOfKeptRenderables * ::detail::MaximumNumberOfInsertionSortMovesPerElement))
+				{
+					// Sort the new renderables on their own and merge both sorted runs, kept renderables first on equal sorting keys for stability
+					::detail::radixSortBySortingKey(mNewSortedQueuedRenderables, sortedQueuedRenderables);
+					sortedQueuedRenderables.resize(numberOfQueuedRenderables);
+					std::merge(mScratchSortedQueuedRenderables.cbegin(), mScratchSortedQueuedRenderables.cend(), mNewSortedQueuedRenderables.cbegin(), mNewSortedQueuedRenderables.cend(), sortedQueuedRenderables.begin());
+					sorted = true;
+				}
+			}
+		}
+
+		// Full sort, also used if the order churned too much
+		if (!sorted)
+		{
+			sortedQueuedRenderables.resize(numberOfQueuedRenderables);
+			for (uint32_t i = 0; i < numberOfQueuedRenderables; ++i)
+			{
+				SortedQueuedRenderable& sortedQueuedRenderable = sortedQueuedRenderables[i];
+				sortedQueuedRenderable.sortingKey			 = queuedRenderables[i].sortingKey;
+				sortedQueuedRenderable.queuedRenderableIndex = i;
+			}
+			::detail::radixSortBySortingKey(sortedQueuedRenderables, mScratchSortedQueuedRenderables);
+		}
+	}
+
+	bool RenderQueue::getDrawPacket(const Renderable& renderable, MaterialTechniqueId materialTechniqueId, Renderable::DrawPacket& drawPacket)
+	{
+		// Use the cached draw packet, if it's still valid
+		// -> There's usually only a single or a few cached draw packets per renderable, so a linear search is sufficient
+		// -> The pipeline state generation changes e.g. when asynchronous pipeline state compilation replaced a fallback pipeline state object
+		// -> The lock is only held for the lookup, the expensive resolving below is done without it
+		std::mutex& drawPacketsMutex = renderable.getRenderableManager().mDrawPacketsMutex;
+		{
+			std::lock_guard<std::mutex> drawPacketsMutexLock(drawPacketsMutex);
+			for (const Renderable::DrawPacket& cachedDrawPacket : renderable.mDrawPackets)
+			{
+				if (cachedDrawPacket.materialTechniqueId == materialTechniqueId)
+				{
+					MaterialBlueprintResource* materialBlueprintResource = cachedDrawPacket.materialBlueprintResource;
+					if (IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState() && cachedDrawPacket.pipelineStateGeneration == materialBlueprintResource->getPipelineStateCacheManager().getPipelineStateGeneration())
+					{
+						drawPacket = cachedDrawPacket;
+						return true;
+					}
+					break;
+				}
+			}
+		}
+
+		// Material resource
+		const MaterialResource* materialResource = mRendererRuntime.getMaterialResourceManager().getMaterialResources().tryGetElementById(renderable.getMaterialResourceId());
+		if (nullptr == materialResource)
+		{
+			return false;
+		}
+		MaterialTechnique* materialTechnique = materialResource->getMaterialTechniqueById(materialTechniqueId);
+		if (nullptr == materialTechnique)
+		{
+			return false;
+		}
+		MaterialBlueprintResource* materialBlueprintResource = static_cast<MaterialBlueprintResource*>(mRendererRuntime.getMaterialBlueprintResourceManager().tryGetResourceByResourceId(materialTechnique->getMaterialBlueprintResourceId()));
+		if (nullptr == materialBlueprintResource || IResource::LoadingState::LOADED != materialBlueprintResource->getLoadingState())
+		{
+			return false;
+		}
+
+		// Shader combination input, kept to avoid allocations
+		ShaderProperties& shaderProperties = mScratchShaderProperties;
+		shaderProperties.clear();
+		{ // Gather shader properties from static material properties generating shader combinations
+			const MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector = materialResource->getSortedPropertyVector();
+			const size_t numberOfMaterialProperties = sortedMaterialPropertyVector.size();
+			for (size_t i = 0; i < numberOfMaterialProperties; ++i)
+			{
+				const MaterialProperty& materialProperty = sortedMaterialPropertyVector[i];
+				if (materialProperty.getUsage() == MaterialProperty::Usage::SHADER_COMBINATION)
+				{
+					switch (materialProperty.getValueType())
+					{
+						case MaterialPropertyValue::ValueType::BOOLEAN:
+							shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getBooleanValue());
+							break;
+
+						case MaterialPropertyValue::ValueType::INTEGER:
+							shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), materialProperty.getIntegerValue());
+							break;
+
+						case MaterialPropertyValue::ValueType::UNKNOWN:
+						case MaterialPropertyValue::ValueType::INTEGER_2:
+						case MaterialPropertyValue::ValueType::INTEGER_3:
+						case MaterialPropertyValue::ValueType::INTEGER_4:
+						case MaterialPropertyValue::ValueType::FLOAT:
+						case MaterialPropertyValue::ValueType::FLOAT_2:
+						case MaterialPropertyValue::ValueType::FLOAT_3:
+						case MaterialPropertyValue::ValueType::FLOAT_4:
+						case MaterialPropertyValue::ValueType::FLOAT_3_3:
+						case MaterialPropertyValue::ValueType::FLOAT_4_4:
+						case MaterialPropertyValue::ValueType::FILL_MODE:
+						case MaterialPropertyValue::ValueType::CULL_MODE:
+						case MaterialPropertyValue::ValueType::CONSERVATIVE_RASTERIZATION_MODE:
+						case MaterialPropertyValue::ValueType::DEPTH_WRITE_MASK:
+						case MaterialPropertyValue::ValueType::STENCIL_OP:
+						case MaterialPropertyValue::ValueType::COMPARISON_FUNC:
+						case MaterialPropertyValue::ValueType::BLEND:
+						case MaterialPropertyValue::ValueType::BLEND_OP:
+						case MaterialPropertyValue::ValueType::FILTER_MODE:
+						case MaterialPropertyValue::ValueType::TEXTURE_ADDRESS_MODE:
+						case MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID:
+						default:
+							assert(false);	// TODO(co) Error handling
+							break;
+					}
+				}
+			}
+		}
+		materialBlueprintResource->optimizeShaderProperties(shaderProperties);
+
+		// Resolve the pipeline state, get the pipeline state generation first so a concurrent change results in an outdated draw packet instead of a wrong one
+		PipelineStateCacheManager& pipelineStateCacheManager = materialBlueprintResource->getPipelineStateCacheManager();
+		const uint32_t pipelineStateGeneration = pipelineStateCacheManager.getPipelineStateGeneration();
+		const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES];
+		Renderer::IPipelineState* pipelineState = pipelineStateCacheManager.getPipelineStateCacheByCombination(shaderProperties, dynamicShaderPieces, false);
+		if (nullptr == pipelineState)
+		{
+			return false;
+		}
+
+		// Cache the draw packet, another thread might have cached it in the meantime in which case it's just updated
+		drawPacket = { materialTechniqueId, materialTechnique, materialBlueprintResource, pipelineState, pipelineStateGeneration };
+		std::lock_guard<std::mutex> drawPacketsMutexLock(drawPacketsMutex);
+		Renderable::DrawPackets& drawPackets = renderable.mDrawPackets;
+		Renderable::DrawPackets::iterator iterator = drawPackets.begin();
+		while (iterator != drawPackets.end() && iterator->materialTechniqueId != materialTechniqueId)
+		{
+			++iterator;
+		}
+		if (iterator != drawPackets.end())
+		{
+			*iterator = drawPacket;
+		}
+		else
+		{
+			drawPackets.push_back(drawPacket);
+		}
+		return true;
+	}
+
+	void RenderQueue::addIndirectDraw(const Renderable& renderable, Renderer::CommandBuffer& commandBuffer)
+	{
+		// All draws of a multi-draw indirect batch must be either indexed or not indexed
+		const bool drawIndexed = renderable.getDrawIndexed();
+		if (0 != mIndirectDrawBatchNumberOfDraws && mIndirectDrawBatchIndexed != drawIndexed)
+		{
+			flushIndirectDrawBatch(commandBuffer);
+		}
+
+		// Start filling a new indirect buffer if the current one is full
+		const size_t numberOfBytes = drawIndexed ? sizeof(Renderer::DrawIndexedInstancedArguments) : sizeof(Renderer::DrawInstancedArguments);
+		if (mIndirectDrawArguments.size() + numberOfBytes > mMaximumNumberOfIndirectDraws * sizeof(Renderer::DrawIndexedInstancedArguments))
+		{
+			flushIndirectDrawBatch(commandBuffer);
+			uploadIndirectDrawArguments(commandBuffer);
+		}
+
+		// Start a new multi-draw indirect batch, if required
+		if (0 == mIndirectDrawBatchNumberOfDraws)
+		{
+			mIndirectDrawBatchOffset = static_cast<uint32_t>(mIndirectDrawArguments.size());
+			mIndirectDrawBatchIndexed = drawIndexed;
+		}
+
+		// Append the draw arguments
+		const size_t offset = mIndirectDrawArguments.size();
+		mIndirectDrawArguments.resize(offset + numberOfBytes);
+		if (drawIndexed)
+		{
+			const Renderer::DrawIndexedInstancedArguments drawIndexedInstancedArguments(renderable.getNumberOfIndices(), 1, renderable.getStartIndexLocation(), 0, 0);
+			memcpy(&mIndirectDrawArguments[offset], &drawIndexedInstancedArguments, numberOfBytes);
+		}
+		else
+		{
+			const Renderer::DrawInstancedArguments drawInstancedArguments(renderable.getNumberOfIndices(), 1, renderable.getStartIndexLocation(), 0);
+			memcpy(&mIndirectDrawArguments[offset], &drawInstancedArguments, numberOfBytes);
+		}
+		++mIndirectDrawBatchNumberOfDraws;
+	}
+
+	void RenderQueue::flushIndirectDrawBatch(Renderer::CommandBuffer& commandBuffer)
+	{
+		if (0 != mIndirectDrawBatchNumberOfDraws)
+		{
+			// Get an indirect buffer when it's used for the first time
+			// -> The draw arguments are copied into the indirect buffer by a command recorded right before the first multi-draw indirect draw call using the indirect buffer
+			// -> The draw arguments are only known after all draws using the indirect buffer were gathered, so the auxiliary memory of the copy command is reserved now and filled by "RendererRuntime::RenderQueue::uploadIndirectDrawArguments()"
+			if (mIndirectDrawBatchNumberOfDraws > 1 && nullptr == mIndirectBuffer)
+			{
+				mIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(mMaximumNumberOfIndirectDraws);
+				if (nullptr != mIndirectBuffer)
+				{
+					mCopyIndirectBufferDataCommandByteIndex = commandBuffer.getNumberOfUsedBytes();
+					Renderer::Command::CopyIndirectBufferData* copyIndirectBufferDataCommand = commandBuffer.addCommand<Renderer::Command::CopyIndirectBufferData>(mMaximumNumberOfIndirectDraws * sizeof(Renderer::DrawIndexedInstancedArguments));
+					copyIndirectBufferDataCommand->indirectBuffer = mIndirectBuffer;
+					copyIndirectBufferDataCommand->numberOfBytes  = 0;
+					copyIndirectBufferDataCommand->data			  = nullptr;
+				}
+				else
+				{
+					// Error! Fall back to direct draw calls.
+					assert(false);
+				}
+			}
+
+			if (mIndirectDrawBatchNumberOfDraws > 1 && nullptr != mIndirectBuffer)
+			{
+				// Issue a single multi-draw indirect draw call
+				if (mIndirectDrawBatchIndexed)
+				{
+					Renderer::Command::DrawIndexed::create(commandBuffer, *mIndirectBuffer, mIndirectDrawBatchOffset, mIndirectDrawBatchNumberOfDraws);
+				}
+				else
+				{
+					Renderer::Command::Draw::create(commandBuffer, *mIndirectBuffer, mIndirectDrawBatchOffset, mIndirectDrawBatchNumberOfDraws);
+				}
+				mNumberOfBatchedDrawCalls += mIndirectDrawBatchNumberOfDraws - 1;
+				++mNumberOfDrawCalls;
+			}
+			else
+			{
+				// A single draw doesn't benefit from an indirect draw call, so issue direct draw calls and drop their draw arguments again
+				const uint8_t* drawArguments = &mIndirectDrawArguments[mIndirectDrawBatchOffset];
+				for (uint32_t i = 0; i < mIndirectDrawBatchNumberOfDraws; ++i)
+				{
+					if (mIndirectDrawBatchIndexed)
+					{
+						const Renderer::DrawIndexedInstancedArguments& drawIndexedInstancedArguments = *reinterpret_cast<const Renderer::DrawIndexedInstancedArguments*>(drawArguments);
+						Renderer::Command::DrawIndexed::create(commandBuffer, drawIndexedInstancedArguments.indexCountPerInstance, drawIndexedInstancedArguments.instanceCount, drawIndexedInstancedArguments.startIndexLocation, drawIndexedInstancedArguments.baseVertexLocation, drawIndexedInstancedArguments.startInstanceLocation);
+						drawArguments += sizeof(Renderer::DrawIndexedInstancedArguments);
+					}
+					else
+					{
+						const Renderer::DrawInstancedArguments& drawInstancedArguments = *reinterpret_cast<const Renderer::DrawInstancedArguments*>(drawArguments);
+						Renderer::Command::Draw::create(commandBuffer, drawInstancedArguments.vertexCountPerInstance, drawInstancedArguments.instanceCount, drawInstancedArguments.startVertexLocation, drawInstancedArguments.startInstanceLocation);
+						drawArguments += sizeof(Renderer::DrawInstancedArguments);
+					}
+				}
+				mIndirectDrawArguments.resize(mIndirectDrawBatchOffset);
+				mNumberOfDrawCalls += mIndirectDrawBatchNumberOfDraws;
+			}
+			mIndirectDrawBatchNumberOfDraws = 0;
+		}
+	}
+
+	void RenderQueue::uploadIndirectDrawArguments(Renderer::CommandBuffer& commandBuffer)
+	{
+		// Fill the auxiliary memory reserved by the copy command, the indirect buffer is filled when the command buffer is executed
+		// -> The indirect buffer manager only reuses the indirect buffer after the frames in flight have ended, so the GPU is done with it by then
+		assert(0 == mIndirectDrawBatchNumberOfDraws);
+		if (nullptr != mIndirectBuffer)
+		{
+			Renderer::Command::CopyIndirectBufferData* copyIndirectBufferDataCommand = commandBuffer.getCommand<Renderer::Command::CopyIndirectBufferData>(mCopyIndirectBufferDataCommandByteIndex);
+			assert(copyIndirectBufferDataCommand->indirectBuffer == mIndirectBuffer);
+			assert(mIndirectDrawArguments.size() <= mMaximumNumberOfIndirectDraws * sizeof(Renderer::DrawIndexedInstancedArguments));
+			copyIndirectBufferDataCommand->numberOfBytes = static_cast<uint32_t>(mIndirectDrawArguments.size());
+			memcpy(Renderer::CommandPacketHelper::getAuxiliaryMemory(copyIndirectBufferDataCommand), mIndirectDrawArguments.data(), mIndirectDrawArguments.size());
+			mIndirectBuffer = nullptr;
+		}
+		mIndirectDrawArguments.clear();
+	}
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
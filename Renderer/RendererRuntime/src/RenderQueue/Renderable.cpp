@@ -26,6 +26,7 @@
 #include "RendererRuntime/RenderQueue/RenderableManager.h"
 #include "RendererRuntime/Resource/Material/MaterialResourceManager.h"
 #include "RendererRuntime/Core/SwizzleVectorElementRemove.h"
+#include "RendererRuntime/Core/Math/Math.h"
 
 
 //[-------------------------------------------------------]
@@ -37,12 +38,28 @@ namespace
 	{
 
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t STATE_FIELD_BITS = RendererRuntime::Renderable::SORTING_KEY_STATE_BITS / 4;	///< Material blueprint, pipeline state, material and vertex array
+		static const uint32_t STATE_FIELD_MASK = (1u << STATE_FIELD_BITS) - 1;
+
+
 		//[-------------------------------------------------------]
 		//[ Global variables                                      ]
 		//[-------------------------------------------------------]
 		RendererRuntime::RenderableManager NullRenderableManager;
 
 
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		inline uint32_t foldHash(uint32_t hash)
+		{
+			return ((hash ^ (hash >> STATE_FIELD_BITS) ^ (hash >> (2 * STATE_FIELD_BITS)) ^ (hash >> (3 * STATE_FIELD_BITS))) & STATE_FIELD_MASK);
+		}
+
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -77,7 +94,7 @@ namespace RendererRuntime
 		mMaterialResourceManager(nullptr),
 		mMaterialResourceAttachmentIndex(getUninitialized<int>())
 	{
-		// Nothing here
+		calculateSortingKey();
 	}
 
 	Renderable::Renderable(RenderableManager& renderableManager, const Renderer::IVertexArrayPtr& vertexArrayPtr, Renderer::PrimitiveTopology primitiveTopology, bool drawIndexed, uint32_t startIndexLocation, uint32_t numberOfIndices, const MaterialResourceManager& materialResourceManager, MaterialResourceId materialResourceId) :
@@ -188,10 +205,61 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	void Renderable::calculateSortingKey()
 	{
-		// TODO(co) Implement me, "mVertexArrayPtr" and "mMaterialResourceId" have an influence
+		// The cached draw packets are derived from the same data as the sorting key
+		{
+			std::lock_guard<std::mutex> drawPacketsMutexLock(mRenderableManager.mDrawPacketsMutex);
+			mDrawPackets.clear();
+		}
+
+		// Gather the state fields, see "RendererRuntime::Renderable::SORTING_KEY_LAYER_SHIFT" for the sorting key layout
+		// -> The state fields are only used to group renderables with identical states together, so folded hashes are sufficient
+		uint32_t materialBlueprintBits = 0;
+		uint32_t pipelineStateBits = 0;
+		uint32_t materialBits = 0;
+		if (isInitialized(mMaterialResourceId))
+		{
+			const MaterialResource* materialResource = mMaterialResourceManager->getMaterialResources().tryGetElementById(mMaterialResourceId);
+			if (nullptr != materialResource)
+			{
+				// Material blueprint: Material techniques are sorted by ID, so renderables using the same set of material blueprints get the same value
+				uint32_t hash = Math::FNV1a_INITIAL_HASH;
+				for (const MaterialTechnique* materialTechnique : materialResource->getSortedMaterialTechniqueVector())
+				{
+					const MaterialBlueprintResourceId materialBlueprintResourceId = materialTechnique->getMaterialBlueprintResourceId();
+					hash = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&materialBlueprintResourceId), sizeof(MaterialBlueprintResourceId), hash);
+				}
+				materialBlueprintBits = ::detail::foldHash(hash);
+
+				// Pipeline state: The static material properties generating shader combinations select the pipeline state inside the material blueprint
+				hash = Math::FNV1a_INITIAL_HASH;
+				for (const MaterialProperty& materialProperty : materialResource->getSortedPropertyVector())
+				{
+					if (materialProperty.getUsage() == MaterialProperty::Usage::SHADER_COMBINATION)
+					{
+						const uint32_t combination[2] =
+						{
+							materialProperty.getMaterialPropertyId(),
+							static_cast<uint32_t>((materialProperty.getValueType() == MaterialPropertyValue::ValueType::BOOLEAN) ? materialProperty.getBooleanValue() : materialProperty.getIntegerValue())
+						};
+						hash = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(combination), sizeof(combination), hash);
+					}
+				}
+				pipelineStateBits = ::detail::foldHash(hash);
+
+				// Material
+				materialBits = ::detail::foldHash(mMaterialResourceId);
+			}
+		}
+		const uintptr_t vertexArray = reinterpret_cast<uintptr_t>(mVertexArrayPtr.getPointer());
+		const uint32_t vertexArrayBits = (nullptr != mVertexArrayPtr) ? ::detail::foldHash(Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&vertexArray), sizeof(uintptr_t))) : 0;
 
-		// The quantized depth is a dynamic part which can't be set inside the cached sorting key (see "RendererRuntime::RenderQueue::addRenderablesFromRenderableManager()")
-		mSortingKey = getUninitialized<uint64_t>();
+		// Compose the cached sorting key
+		// -> The quantized depth and the transparent flag are dynamic parts which can't be set inside the cached sorting key (see "RendererRuntime::RenderQueue::addRenderablesFromRenderableManager()")
+		mSortingKey = (static_cast<uint64_t>(mRenderQueueIndex) << SORTING_KEY_LAYER_SHIFT) |
+					  (static_cast<uint64_t>(materialBlueprintBits) << (3 * ::detail::STATE_FIELD_BITS)) |
+					  (static_cast<uint64_t>(pipelineStateBits) << (2 * ::detail::STATE_FIELD_BITS)) |
+					  (static_cast<uint64_t>(materialBits) << ::detail::STATE_FIELD_BITS) |
+					  vertexArrayBits;
 	}
 
 	void Renderable::unsetMaterialResourceIdInternal()
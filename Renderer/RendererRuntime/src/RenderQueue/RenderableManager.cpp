@@ -25,6 +25,8 @@
 #include "RendererRuntime/RenderQueue/RenderableManager.h"
 #include "RendererRuntime/Core/Math/Transform.h"
 
+#include <limits>
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -61,7 +63,12 @@ namespace RendererRuntime
 	RenderableManager::RenderableManager() :
 		mTransform(&::detail::IdentityTransform),
 		mVisible(true),
+		mMinimumBoundingBoxPosition(-std::numeric_limits<float>::max()),
+		mMaximumBoundingBoxPosition(std::numeric_limits<float>::max()),
+		mBoundingSpherePosition(Math::ZERO_VECTOR),
+		mBoundingSphereRadius(std::numeric_limits<float>::max()),
 		mCachedDistanceToCamera(getUninitialized<float>()),
+		mCachedInsideCameraFrustum(true),
 		mMinimumRenderQueueIndex(0),
 		mMaximumRenderQueueIndex(0),
 		mCastShadows(false)
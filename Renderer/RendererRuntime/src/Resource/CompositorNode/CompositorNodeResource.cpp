@@ -40,8 +40,10 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	void CompositorNodeResource::enforceFullyLoaded()
 	{
-		// TODO(co) Implement more efficient solution: We need to extend "Runtime::ResourceStreamer" to request emergency immediate processing of requested resources
+		// The caller is blocking until the compositor node is loaded, so its load request must overtake everything else
+		// TODO(co) Implement more efficient solution: Don't busy wait for the resource streamer
 		ResourceStreamer& resourceStreamer = getResourceManager<CompositorNodeResourceManager>().getRendererRuntime().getResourceStreamer();
+		resourceStreamer.setLoadPriority(*this, ResourceStreamer::LoadPriority::EMERGENCY);
 		while (IResource::LoadingState::LOADED != getLoadingState())
 		{
 			using namespace std::chrono_literals;
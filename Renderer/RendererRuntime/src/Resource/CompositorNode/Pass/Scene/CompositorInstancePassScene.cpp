@@ -25,6 +25,7 @@
 #include "RendererRuntime/Resource/CompositorNode/Pass/Scene/CompositorInstancePassScene.h"
 #include "RendererRuntime/Resource/CompositorNode/Pass/Scene/CompositorResourcePassScene.h"
 #include "RendererRuntime/Resource/CompositorNode/CompositorNodeInstance.h"
+#include "RendererRuntime/RenderQueue/RenderableManager.h"
 
 
 //[-------------------------------------------------------]
@@ -52,14 +53,13 @@ namespace RendererRuntime
 		COMMAND_BEGIN_DEBUG_EVENT_FUNCTION(commandBuffer)
 
 		// Fill command buffer
+		// -> The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
+		//    cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
+		//    really worth to do so since the render queue only considers renderables inside the render queue range anyway.
+		// -> Renderable managers outside the camera frustum are only gathered as potential shadow casters and are rejected by the render queue
 		assert(nullptr != mRenderQueueIndexRange);
-		for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
-		{
-			// The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
-			// cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
-			// really worth to do so since the render queue only considers renderables inside the render queue range anyway.
-			mRenderQueue.addRenderablesFromRenderableManager(*renderableManager);
-		}
+		const CompositorWorkspaceInstance::RenderableManagers& renderableManagers = mRenderQueueIndexRange->renderableManagers;
+		mRenderQueue.addRenderablesFromRenderableManagers(renderableManagers.data(), static_cast<uint32_t>(renderableManagers.size()));
 		mRenderQueue.fillCommandBuffer(renderTarget, static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId(), compositorContextData, commandBuffer);
 
 		// End debug event
@@ -81,17 +81,12 @@ namespace RendererRuntime
 				COMMAND_BEGIN_DEBUG_EVENT_FUNCTION(commandBuffer)
 
 				// Fill command buffer
+				// -> The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
+				//    cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
+				//    really worth to do so since the render queue only considers renderables inside the render queue range anyway.
 				assert(nullptr != mRenderQueueIndexRange);
-				for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
-				{
-					// The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
-					// cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
-					// really worth to do so since the render queue only considers renderables inside the render queue range anyway.
-					if (renderableManager->getCastShadows())
-					{
-						mRenderQueue.addRenderablesFromRenderableManager(*renderableManager, true);
-					}
-				}
+				const CompositorWorkspaceInstance::RenderableManagers& renderableManagers = mRenderQueueIndexRange->renderableManagers;
+				mRenderQueue.addRenderablesFromRenderableManagers(renderableManagers.data(), static_cast<uint32_t>(renderableManagers.size()), true);
 				mRenderQueue.fillCommandBuffer(renderTarget, static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId(), compositorContextData, commandBuffer);
 
 				// End debug event
@@ -33,6 +33,7 @@
 #include "RendererRuntime/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
 #include "RendererRuntime/Resource/CompositorNode/Pass/ShadowMap/CompositorInstancePassShadowMap.h"
 #include "RendererRuntime/Resource/CompositorNode/Pass/ShadowMap/CompositorResourcePassShadowMap.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/InstanceBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/Scene/ISceneResource.h"
@@ -42,11 +43,49 @@
 #include "RendererRuntime/RenderQueue/IndirectBufferManager.h"
 #include "RendererRuntime/Core/Renderer/FramebufferManager.h"
 #include "RendererRuntime/Core/Renderer/RenderTargetTextureManager.h"
+#include "RendererRuntime/Core/Math/Transform.h"
+#include "RendererRuntime/Core/Thread/ThreadManager.h"
+#include "RendererRuntime/Vr/IVrManager.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
 #include <algorithm>
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t NUMBER_OF_SCENE_NODES_PER_CULLING_CHUNK = 128;	///< Scene nodes are culled in chunks of this fixed size, independent of the number of worker threads
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct CullingJobData
+		{
+			RendererRuntime::CompositorWorkspaceInstance*		  compositorWorkspaceInstance;
+			const RendererRuntime::ISceneResource::SceneNodes*	  sceneNodes;
+			glm::vec3											  cameraPosition;
+			glm::mat4											  worldSpaceToClipSpaceMatrix;
+			bool												  frustumCulling;
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -175,10 +214,14 @@ namespace RendererRuntime
 			Renderer::IRenderer& renderer = renderTarget.getRenderer();
 			if (renderer.beginScene())
 			{
+				// Begin the frame of the instance buffer manager, the instance data of all passes is packed into one frame-wide buffer
+				InstanceBufferManager& instanceBufferManager = mRendererRuntime.getMaterialBlueprintResourceManager().getInstanceBufferManager();
+				instanceBufferManager.beginFrame();
+
 				if (nullptr != cameraSceneItem)
 				{
 					// Gather render queue index ranges renderable managers
-					gatherRenderQueueIndexRangesRenderableManagers(*cameraSceneItem);
+					gatherRenderQueueIndexRangesRenderableManagers(renderTarget, *cameraSceneItem);
 
 					// Fill the light buffer manager
 					mRendererRuntime.getMaterialBlueprintResourceManager().getLightBufferManager().fillBuffer(cameraSceneItem->getSceneResource(), mCommandBuffer);
@@ -205,6 +248,9 @@ namespace RendererRuntime
 				// End debug event
 				COMMAND_END_DEBUG_EVENT(mCommandBuffer)
 
+				// Upload the frame-wide instance data before the command buffer using it is executed
+				instanceBufferManager.endFrame();
+
 				// Submit command buffer to the renderer backend
 				mCommandBuffer.submitAndClear(renderer);
 
@@ -218,7 +264,7 @@ namespace RendererRuntime
 				{
 					compositorNodeInstance->frameEnded();
 				}
-				mIndirectBufferManager.freeAllUsedIndirectBuffers();
+				mIndirectBufferManager.frameEnded();
 			}
 
 			// In case the render target is a swap chain, present the content of the current back buffer
@@ -426,47 +472,144 @@ namespace RendererRuntime
 		}
 	}
 
-	void CompositorWorkspaceInstance::gatherRenderQueueIndexRangesRenderableManagers(const CameraSceneItem& cameraSceneItem)
+	void CompositorWorkspaceInstance::gatherRenderQueueIndexRangesRenderableManagers(const Renderer::IRenderTarget& renderTarget, const CameraSceneItem& cameraSceneItem)
 	{
-		// TODO(co) This is just a dummy implementation, has to use high level culling including e.g. multi-threaded culling
-		const glm::vec3& cameraPosition = cameraSceneItem.getParentSceneNodeSafe().getTransform().position;
-
-		// Loop through all scene nodes and add renderables to the render queue
-		const ISceneResource::SceneNodes& sceneNodes = cameraSceneItem.getSceneResource().getSceneNodes();
-		const size_t numberOfSceneNodes = sceneNodes.size();
-		for (size_t sceneNodeIndex = 0; sceneNodeIndex < numberOfSceneNodes; ++sceneNodeIndex)
+		// TODO(co) This is just a dummy implementation, has to use high level culling like e.g. hierarchical or occlusion culling
+		const Transform& cameraTransform = cameraSceneItem.getParentSceneNodeSafe().getTransform();
+		::detail::CullingJobData cullingJobData;
+		cullingJobData.compositorWorkspaceInstance = this;
+		cullingJobData.sceneNodes = &cameraSceneItem.getSceneResource().getSceneNodes();
+		cullingJobData.cameraPosition = cameraTransform.position;
+
+		// Setup the camera frustum
+		// -> The camera scene item calculates the same matrices as used inside "RendererRuntime::MaterialBlueprintResourceListener::beginFillPass()"
+		// -> When the VR-manager is running each eye has its own frustum, so there's no frustum culling for now (TODO(co) Cull against a frustum enclosing both eyes)
+		cullingJobData.frustumCulling = !mRendererRuntime.getVrManager().isRunning();
+		if (cullingJobData.frustumCulling)
 		{
-			const ISceneNode* sceneNode = sceneNodes[sceneNodeIndex];
+			uint32_t renderTargetWidth  = 1;
+			uint32_t renderTargetHeight = 1;
+			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			const float aspectRatio = static_cast<float>(renderTargetWidth) / renderTargetHeight;
+			cullingJobData.worldSpaceToClipSpaceMatrix = cameraSceneItem.getViewSpaceToClipSpaceMatrix(aspectRatio) * cameraSceneItem.getWorldSpaceToViewSpaceMatrix();
+		}
 
-			// Calculate the distance to the camera
-			const float distanceToCamera = glm::distance(cameraPosition, sceneNode->getTransform().position);
+		// Cull fixed size chunks of scene nodes, in parallel if there's more than a single chunk
+		const uint32_t numberOfSceneNodes = static_cast<uint32_t>(cullingJobData.sceneNodes->size());
+		const uint32_t numberOfCullingChunks = (numberOfSceneNodes + ::detail::NUMBER_OF_SCENE_NODES_PER_CULLING_CHUNK - 1) / ::detail::NUMBER_OF_SCENE_NODES_PER_CULLING_CHUNK;
+		if (mCullingChunks.size() < numberOfCullingChunks)
+		{
+			mCullingChunks.resize(numberOfCullingChunks);
+		}
+		if (numberOfCullingChunks > 1)
+		{
+			JobScheduler& jobScheduler = mRendererRuntime.getThreadManager().getJobScheduler();
+			JobCounter jobCounter;
+			jobScheduler.parallelFor(&CompositorWorkspaceInstance::cullSceneNodesJob, &cullingJobData, numberOfCullingChunks, 1, jobCounter);
+			jobScheduler.waitForCounter(jobCounter);
+		}
+		else if (numberOfCullingChunks > 0)
+		{
+			cullSceneNodesJob(&cullingJobData, 0, 1);
+		}
 
-			// Loop through all scene items attached to the current scene node
-			const ISceneNode::AttachedSceneItems& attachedSceneItems = sceneNode->getAttachedSceneItems();
-			const size_t numberOfAttachedSceneItems = attachedSceneItems.size();
-			for (size_t attachedSceneItemIndex = 0; attachedSceneItemIndex < numberOfAttachedSceneItems; ++attachedSceneItemIndex)
+		// Assign the remaining renderable managers to the render queue index ranges, in chunk order so the result is identical to a serial culling
+		for (uint32_t cullingChunkIndex = 0; cullingChunkIndex < numberOfCullingChunks; ++cullingChunkIndex)
+		{
+			RenderableManagers& renderableManagers = mCullingChunks[cullingChunkIndex].renderableManagers;
+			for (RenderableManager* renderableManager : renderableManagers)
 			{
-				const ISceneItem* sceneItem = attachedSceneItems[attachedSceneItemIndex];
-				if (sceneItem->getSceneItemTypeId() == MeshSceneItem::TYPE_ID)
+				// A renderable manager can be inside multiple render queue index ranges
+				for (RenderQueueIndexRange& renderQueueIndexRange : mRenderQueueIndexRanges)
 				{
-					RenderableManager& renderableManager = const_cast<RenderableManager&>(static_cast<const MeshSceneItem*>(sceneItem)->getRenderableManager());	// TODO(co) Get rid of the evil const-cast
-					if (renderableManager.isVisible())
+					// We only need to check the minimum render queue index to figure out whether or not the renderable manager falls into this render queue index range
+					const uint8_t minimumRenderQueueIndex = renderableManager->getMinimumRenderQueueIndex();
+					if (minimumRenderQueueIndex >= renderQueueIndexRange.minimumRenderQueueIndex && minimumRenderQueueIndex <= renderQueueIndexRange.maximumRenderQueueIndex)
 					{
-						renderableManager.setCachedDistanceToCamera(distanceToCamera);
+						renderQueueIndexRange.renderableManagers.push_back(renderableManager);
+					}
+				}
+			}
+			renderableManagers.clear();
+		}
+	}
+
+	void CompositorWorkspaceInstance::cullSceneNodesJob(void* userData, uint32_t firstIndex, uint32_t numberOfIndices)
+	{
+		// Each index is a chunk of scene nodes, a chunk is only touched by a single job
+		const ::detail::CullingJobData& cullingJobData = *static_cast<const ::detail::CullingJobData*>(userData);
+		const ISceneResource::SceneNodes& sceneNodes = *cullingJobData.sceneNodes;
+		const glm::vec3& cameraPosition = cullingJobData.cameraPosition;
+		const uint32_t numberOfSceneNodes = static_cast<uint32_t>(sceneNodes.size());
+		for (uint32_t cullingChunkIndex = firstIndex; cullingChunkIndex < firstIndex + numberOfIndices; ++cullingChunkIndex)
+		{
+			CullingChunk& cullingChunk = cullingJobData.compositorWorkspaceInstance->mCullingChunks[cullingChunkIndex];
+			FrustumCuller& frustumCuller = cullingChunk.frustumCuller;
+			RenderableManagers& renderableManagers = cullingChunk.renderableManagers;
+			if (cullingJobData.frustumCulling)
+			{
+				frustumCuller.setWorldSpaceToClipSpaceMatrix(cullingJobData.worldSpaceToClipSpaceMatrix);
+			}
+			frustumCuller.clearBoundingSpheres();
+			renderableManagers.clear();
+
+			// Loop through the scene nodes of the chunk and gather the world space bounding spheres of the visible renderable managers
+			const uint32_t firstSceneNodeIndex = cullingChunkIndex * ::detail::NUMBER_OF_SCENE_NODES_PER_CULLING_CHUNK;
+			const uint32_t lastSceneNodeIndex = std::min(firstSceneNodeIndex + ::detail::NUMBER_OF_SCENE_NODES_PER_CULLING_CHUNK, numberOfSceneNodes);
+			for (uint32_t sceneNodeIndex = firstSceneNodeIndex; sceneNodeIndex < lastSceneNodeIndex; ++sceneNodeIndex)
+			{
+				const ISceneNode* sceneNode = sceneNodes[sceneNodeIndex];
+
+				// Calculate the distance to the camera
+				const float distanceToCamera = glm::distance(cameraPosition, sceneNode->getTransform().position);
 
-						// A renderable manager can be inside multiple render queue index ranges
-						for (RenderQueueIndexRange& renderQueueIndexRange : mRenderQueueIndexRanges)
+				// Loop through all scene items attached to the current scene node
+				const ISceneNode::AttachedSceneItems& attachedSceneItems = sceneNode->getAttachedSceneItems();
+				const size_t numberOfAttachedSceneItems = attachedSceneItems.size();
+				for (size_t attachedSceneItemIndex = 0; attachedSceneItemIndex < numberOfAttachedSceneItems; ++attachedSceneItemIndex)
+				{
+					const ISceneItem* sceneItem = attachedSceneItems[attachedSceneItemIndex];
+					if (sceneItem->getSceneItemTypeId() == MeshSceneItem::TYPE_ID)
+					{
+						RenderableManager& renderableManager = const_cast<RenderableManager&>(static_cast<const MeshSceneItem*>(sceneItem)->getRenderableManager());	// TODO(co) Get rid of the evil const-cast
+						if (renderableManager.isVisible())
 						{
-							// We only need to check the minimum render queue index to figure out whether or not the renderable manager falls into this render queue index range
-							const uint8_t minimumRenderQueueIndex = renderableManager.getMinimumRenderQueueIndex();
-							if (minimumRenderQueueIndex >= renderQueueIndexRange.minimumRenderQueueIndex && minimumRenderQueueIndex <= renderQueueIndexRange.maximumRenderQueueIndex)
-							{
-								renderQueueIndexRange.renderableManagers.push_back(&renderableManager);
-							}
+							renderableManager.setCachedDistanceToCamera(distanceToCamera);
+
+							// Transform the object space bounding sphere into world space, non-uniform scale is handled by using the largest scale component
+							const Transform& transform = renderableManager.getTransform();
+							const glm::vec3 absoluteScale = glm::abs(transform.scale);
+							frustumCuller.addBoundingSphere(transform.position + transform.rotation * (transform.scale * renderableManager.getBoundingSpherePosition()), renderableManager.getBoundingSphereRadius() * std::max(absoluteScale.x, std::max(absoluteScale.y, absoluteScale.z)));
+							renderableManagers.push_back(&renderableManager);
 						}
 					}
 				}
 			}
+
+			// Batched frustum culling of all gathered bounding spheres
+			if (cullingJobData.frustumCulling)
+			{
+				frustumCuller.cullBoundingSpheres();
+			}
+
+			// Only keep the renderable managers to render, order is preserved
+			const size_t numberOfRenderableManagers = renderableManagers.size();
+			size_t numberOfKeptRenderableManagers = 0;
+			for (size_t i = 0; i < numberOfRenderableManagers; ++i)
+			{
+				RenderableManager* renderableManager = renderableManagers[i];
+				const bool insideCameraFrustum = (!cullingJobData.frustumCulling || frustumCuller.isBoundingSphereVisible(static_cast<uint32_t>(i)));
+				renderableManager->setCachedInsideCameraFrustum(insideCameraFrustum);
+
+				// Renderable managers outside the camera frustum might still cast shadows into it, so shadow casters are kept
+				// -> Compositor instance passes not rendering shadow maps skip renderable managers outside the camera frustum
+				if (insideCameraFrustum || renderableManager->getCastShadows())
+				{
+					renderableManagers[numberOfKeptRenderableManagers] = renderableManager;
+					++numberOfKeptRenderableManagers;
+				}
+			}
+			renderableManagers.resize(numberOfKeptRenderableManagers);
 		}
 	}
 
@@ -27,10 +27,33 @@
 #include "RendererRuntime/Resource/Detail/IResourceManager.h"
 #include "RendererRuntime/Core/Platform/PlatformManager.h"
 #include "RendererRuntime/Core/File/IFileManager.h"
+#include "RendererRuntime/Core/File/IFile.h"
+#include "RendererRuntime/Core/Time/TimeBudget.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
-// TODO(co) Can we do something about the warning which does not involve using "std::thread"-pointers?
-PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t CLAIMED_TICKET_FLAG = 0x80000000u;	///< Set inside the ticket of an in-flight load request while a thread is working on it
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -43,6 +66,18 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
+	void ResourceStreamer::setNumberOfDeserializationThreads(uint32_t numberOfDeserializationThreads)
+	{
+		// Without a single deserialization thread, load requests would get stuck
+		setNumberOfWorkerThreads(mStages[DESERIALIZATION_STAGE], std::max(numberOfDeserializationThreads, 1u), &ResourceStreamer::deserializationThreadWorker);
+	}
+
+	void ResourceStreamer::setNumberOfProcessingThreads(uint32_t numberOfProcessingThreads)
+	{
+		// Without a single processing thread, load requests would get stuck
+		setNumberOfWorkerThreads(mStages[PROCESSING_STAGE], std::max(numberOfProcessingThreads, 1u), &ResourceStreamer::processingThreadWorker);
+	}
+
 	void ResourceStreamer::commitLoadRequest(const LoadRequest& loadRequest)
 	{
 		// Update the resource loading state
@@ -50,69 +85,179 @@ namespace RendererRuntime
 
 		// Push the load request into the queue of the first resource streamer pipeline stage
 		// -> Resource streamer stage: 1. Asynchronous deserialization
-		std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-		mDeserializationQueue.push_back(loadRequest);
-		deserializationMutexLock.unlock();
-		mDeserializationConditionVariable.notify_one();
+		// -> If there's no room inside the resource streamer pipeline or other load requests of the same lane are already waiting for room, queue up behind them
+		LoadRequests& pendingLoadRequests = mPendingLoadRequests[loadRequest.resourceLoader->requiresOrderedLoading() ? ORDERED_LANE : static_cast<uint8_t>(loadRequest.loadPriority)];
+		if (!pendingLoadRequests.empty() || !admitLoadRequest(loadRequest))
+		{
+			pendingLoadRequests.push_back(loadRequest);
+			++mNumberOfPendingLoadRequests;
+		}
 	}
 
-	void ResourceStreamer::flushAllQueues()
+	bool ResourceStreamer::setLoadPriority(const IResource& resource, LoadPriority loadPriority)
 	{
-		bool everythingFlushed = false;
-		do
+		const uint8_t newLoadPriority = static_cast<uint8_t>(loadPriority);
+
+		// Pending load request? Those are moved to the end of the pending queue of the new load priority.
+		for (uint8_t lane = 0; lane < NUMBER_OF_LANES; ++lane)
 		{
-			{ // Process
-				{ // Resource streamer stage: 1. Asynchronous deserialization
-					std::lock_guard<std::mutex> deserializationMutexLock(mDeserializationMutex);
-					everythingFlushed = mDeserializationQueue.empty();
+			LoadRequests& pendingLoadRequests = mPendingLoadRequests[lane];
+			for (LoadRequests::iterator iterator = pendingLoadRequests.begin(); iterator != pendingLoadRequests.end(); ++iterator)
+			{
+				if (iterator->resource == &resource)
+				{
+					iterator->loadPriority = loadPriority;
+					if (ORDERED_LANE != lane && newLoadPriority != lane)
+					{
+						mPendingLoadRequests[newLoadPriority].push_back(*iterator);
+						pendingLoadRequests.erase(iterator);
+
+						// Emergency load requests don't wait for the next dispatch
+						if (LoadPriority::EMERGENCY == loadPriority)
+						{
+							admitPendingLoadRequests();
+						}
+					}
+					return true;
 				}
+			}
+		}
 
-				// Resource streamer stage: 2. Asynchronous processing
-				if (everythingFlushed)
+		// In-flight load request?
+		for (uint32_t inFlightLoadRequestIndex = 0; inFlightLoadRequestIndex < MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS; ++inFlightLoadRequestIndex)
+		{
+			InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[inFlightLoadRequestIndex];
+			if (inFlightLoadRequest.loadRequest.resource == &resource)
+			{
+				inFlightLoadRequest.loadPriority = newLoadPriority;
+
+				// A raised load priority takes effect inside the current stage: Push a new queue entry and invalidate the old one by advancing the ticket
+				// -> Not possible while a thread is working on the load request, the new load priority is used as soon as the load request enters the next stage
+				// -> Each stage has at most one queue entry per lane and in-flight load request, so the queues can't overflow
+				if (!inFlightLoadRequest.ordered)
 				{
-					std::lock_guard<std::mutex> processingMutexLock(mProcessingMutex);
-					everythingFlushed = mProcessingQueue.empty();
+					uint32_t ticket = inFlightLoadRequest.ticket.load(std::memory_order_acquire);
+					while (0 == (ticket & ::detail::CLAIMED_TICKET_FLAG) && newLoadPriority < inFlightLoadRequest.queuedLoadPriority.load(std::memory_order_relaxed))
+					{
+						if (inFlightLoadRequest.ticket.compare_exchange_weak(ticket, ticket + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+						{
+							inFlightLoadRequest.queuedLoadPriority.store(newLoadPriority, std::memory_order_relaxed);
+							pushQueueEntry(inFlightLoadRequestIndex, ticket + 1);
+							break;
+						}
+					}
 				}
+				return true;
+			}
+		}
+
+		// There's no load request for the given resource which hasn't been dispatched, yet
+		return false;
+	}
 
-				// Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
-				if (everythingFlushed)
+	bool ResourceStreamer::cancelLoadRequest(const IResource& resource)
+	{
+		// Pending load request? Those haven't been touched by any resource streamer stage, yet.
+		for (LoadRequests& pendingLoadRequests : mPendingLoadRequests)
+		{
+			for (LoadRequests::iterator iterator = pendingLoadRequests.begin(); iterator != pendingLoadRequests.end(); ++iterator)
+			{
+				if (iterator->resource == &resource)
 				{
-					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-					everythingFlushed = mDispatchQueue.empty();
+					const LoadRequest loadRequest = *iterator;
+					pendingLoadRequests.erase(iterator);
+					--mNumberOfPendingLoadRequests;
+					finishCancelledLoadRequest(loadRequest);
+					return true;
 				}
 			}
+		}
+
+		// In-flight load request? The following resource streamer stages will skip it, the next dispatch finishes it.
+		for (InFlightLoadRequest& inFlightLoadRequest : mInFlightLoadRequests)
+		{
+			if (inFlightLoadRequest.loadRequest.resource == &resource)
+			{
+				inFlightLoadRequest.cancelled = true;
+				return true;
+			}
+		}
+
+		// There's no load request for the given resource which hasn't been dispatched, yet
+		return false;
+	}
+
+	void ResourceStreamer::flushAllQueues()
+	{
+		// A load request which has been taken out of a queue by a worker thread isn't finished, yet, so don't look at the queues but at the number of in-flight load requests
+		for (;;)
+		{
 			dispatch();
+			if (0 == mNumberOfPendingLoadRequests && 0 == mNumberOfInFlightLoadRequests)
+			{
+				// Everything flushed
+				break;
+			}
 
-			// Wait for a moment to not totally pollute the CPU
-			if (!everythingFlushed)
+			// Instead of idling, lend the worker threads a hand, load requests which are nearly done first
+			// -> The ordered lane is left to the first worker thread of a stage, so load requests requiring ordered loading stay in order
+			uint32_t inFlightLoadRequestIndex = 0;
+			if (claimLoadRequest(mStages[PROCESSING_STAGE], false, inFlightLoadRequestIndex))
+			{
+				processLoadRequest(inFlightLoadRequestIndex);
+			}
+			else if (claimLoadRequest(mStages[DESERIALIZATION_STAGE], false, inFlightLoadRequestIndex))
+			{
+				deserializeLoadRequest(inFlightLoadRequestIndex);
+			}
+			else if (0 != mNumberOfInFlightLoadRequests)
 			{
-				using namespace std::chrono_literals;
-				std::this_thread::sleep_for(1ms);
+				// Nothing to help with, sleep until a worker thread passes a load request on to the dispatch stage
+				waitForQueueEntries(mStages[DISPATCH_STAGE], true);
 			}
-		} while (!everythingFlushed);
+			else
+			{
+				// Pending load requests are waiting for in-flight load requests which are still referenced by outdated queue entries, the worker threads are about to give them back
+				std::this_thread::yield();
+			}
+		}
 	}
 
 	void ResourceStreamer::dispatch()
 	{
+		TimeBudget timeBudget;
+		dispatch(timeBudget);
+	}
+
+	void ResourceStreamer::dispatch(TimeBudget& timeBudget)
+	{
+		// Let pending load requests enter the resource streamer pipeline as soon as there's room again
+		admitPendingLoadRequests();
+
 		// Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
 
-		// Continue as long as there's a load request left inside the queue
-		bool stillInTimeBudget = true;	// TODO(co) Add a maximum time budget so we're not blocking too long (the show must go on)
-		while (stillInTimeBudget)
+		// Continue as long as there's a load request left inside the queues, once the time budget is exhausted only emergency load requests are left for this frame (the show must go on)
+		uint8_t numberOfServedLanes = NUMBER_OF_LANES;
+		uint32_t inFlightLoadRequestIndex = 0;
+		while (claimLoadRequest(mStages[DISPATCH_STAGE], true, inFlightLoadRequestIndex, numberOfServedLanes))
 		{
-			// Get the load request
-			std::unique_lock<std::mutex> dispatchMutexLock(mDispatchMutex);
-			if (mDispatchQueue.empty())
-			{
-				break;
-			}
-			LoadRequest loadRequest = mDispatchQueue.front();
-			mDispatchQueue.pop_front();
-			dispatchMutexLock.unlock();
+			// The load request leaves the resource streamer pipeline
+			InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[inFlightLoadRequestIndex];
+			const LoadRequest loadRequest = inFlightLoadRequest.loadRequest;
+			const bool cancelled = inFlightLoadRequest.cancelled;
+			IFile* file = inFlightLoadRequest.file;
+			inFlightLoadRequest.loadRequest.resource = nullptr;
+			inFlightLoadRequest.file = nullptr;
+			releaseInFlightLoadRequestReference(inFlightLoadRequestIndex);
+			--mNumberOfInFlightLoadRequests;
 
 			// Do the work
 			IResourceLoader* resourceLoader = loadRequest.resourceLoader;
-			if (resourceLoader->onDispatch())
+			if (cancelled)
+			{
+				finishCancelledLoadRequest(loadRequest);
+			}
+			else if (resourceLoader->onDispatch())
 			{
 				// Load request is finished now
 
@@ -126,6 +271,28 @@ namespace RendererRuntime
 			{
 				mFullyLoadedWaitingQueue.push_back(loadRequest);
 			}
+
+			// Views of the file are no longer needed
+			if (nullptr != file)
+			{
+				mRendererRuntime.getFileManager().closeFile(*file);
+			}
+
+			// Emergency lane only from now on?
+			if (NUMBER_OF_LANES == numberOfServedLanes && timeBudget.isExhausted())
+			{
+				numberOfServedLanes = 1;
+			}
+		}
+		if (NUMBER_OF_LANES != numberOfServedLanes)
+		{
+			// Queue entries outdated by re-prioritization are counted as well, so this is just an approximation
+			uint32_t numberOfDeferredLoadRequests = 0;
+			for (uint8_t servingIndex = numberOfServedLanes; servingIndex < NUMBER_OF_LANES; ++servingIndex)
+			{
+				numberOfDeferredLoadRequests += mStages[DISPATCH_STAGE].laneQueues[getLaneByServingIndex(servingIndex)].getApproximateNumberOfElements();
+			}
+			timeBudget.setNumberOfDeferredWorkItems(numberOfDeferredLoadRequests);
 		}
 
 		// Check fully loaded waiting queue
@@ -160,100 +327,340 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	ResourceStreamer::ResourceStreamer(IRendererRuntime& rendererRuntime) :
 		mRendererRuntime(rendererRuntime),
-		mShutdownDeserializationThread(false),
-		mDeserializationThread(&ResourceStreamer::deserializationThreadWorker, this),
-		mShutdownProcessingThread(false),
-		mProcessingThread(&ResourceStreamer::processingThreadWorker, this)
+		mNumberOfInFlightLoadRequests(0),
+		mNumberOfPendingLoadRequests(0)
 	{
-		// Nothing here
+		// All in-flight load requests are free
+		for (uint32_t i = 0; i < MAXIMUM_NUMBER_OF_IN_FLIGHT_LOAD_REQUESTS; ++i)
+		{
+			InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[i];
+			inFlightLoadRequest.ordered = false;
+			inFlightLoadRequest.file = nullptr;
+			inFlightLoadRequest.stageIndex = DESERIALIZATION_STAGE;
+			inFlightLoadRequest.loadPriority = 0;
+			inFlightLoadRequest.queuedLoadPriority = 0;
+			inFlightLoadRequest.cancelled = false;
+			inFlightLoadRequest.ticket = 0;
+			inFlightLoadRequest.numberOfReferences = 0;
+			mFreeInFlightLoadRequestIndices.push(i);
+		}
+		for (Stage& stage : mStages)
+		{
+			stage.shutdownWorkerThreads = false;
+			stage.numberOfSleepingWorkerThreads = 0;
+		}
+
+		// Deserialization is mostly waiting for file data while processing is computation heavy, so use more processing threads on machines with many cores
+		setNumberOfDeserializationThreads(2);
+		setNumberOfProcessingThreads(std::max(std::thread::hardware_concurrency() / 2, 2u));
 	}
 
 	ResourceStreamer::~ResourceStreamer()
 	{
-		// Deserialization thread and processing thread shutdown
-		mShutdownDeserializationThread = true;
-		mShutdownProcessingThread = true;
-		mDeserializationConditionVariable.notify_one();
-		mProcessingConditionVariable.notify_one();
-		mDeserializationThread.join();
-		mProcessingThread.join();
+		// Deserialization threads and processing threads shutdown
+		setNumberOfWorkerThreads(mStages[DESERIALIZATION_STAGE], 0, &ResourceStreamer::deserializationThreadWorker);
+		setNumberOfWorkerThreads(mStages[PROCESSING_STAGE], 0, &ResourceStreamer::processingThreadWorker);
 	}
 
-	void ResourceStreamer::deserializationThreadWorker()
+	void ResourceStreamer::setNumberOfWorkerThreads(Stage& stage, uint32_t numberOfWorkerThreads, WorkerThreadFunction workerThreadFunction)
 	{
-		RENDERER_RUNTIME_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 1", "Renderer runtime: Resource streamer stage: 1. Asynchronous deserialization");
+		if (stage.workerThreads.size() != numberOfWorkerThreads)
+		{
+			// Worker threads shutdown, the worker threads are waiting with a predicate so the flag must be set while holding the mutex
+			// -> Load requests which are still inside the queues are picked up by the new worker threads
+			{
+				std::lock_guard<std::mutex> stageMutexLock(stage.mutex);
+				stage.shutdownWorkerThreads = true;
+			}
+			stage.conditionVariable.notify_all();
+			for (std::thread& thread : stage.workerThreads)
+			{
+				thread.join();
+			}
 
-		// Resource streamer stage: 1. Asynchronous deserialization
-		while (!mShutdownDeserializationThread)
+			// Create the worker threads, the first worker thread is the only one processing load requests requiring ordered loading
+			stage.workerThreads.clear();
+			stage.workerThreads.reserve(numberOfWorkerThreads);
+			stage.shutdownWorkerThreads = false;
+			for (uint32_t i = 0; i < numberOfWorkerThreads; ++i)
+			{
+				stage.workerThreads.push_back(std::thread(workerThreadFunction, this, i));
+			}
+		}
+	}
+
+	uint8_t ResourceStreamer::getLaneByServingIndex(uint8_t servingIndex)
+	{
+		// Emergency load requests are served first, followed by the ordered lane since e.g. material blueprints depend on the shader blueprints inside it
+		switch (servingIndex)
+		{
+			case 0:
+				return static_cast<uint8_t>(LoadPriority::EMERGENCY);
+
+			case 1:
+				return ORDERED_LANE;
+
+			default:
+				return static_cast<uint8_t>(servingIndex - 1);
+		}
+	}
+
+	bool ResourceStreamer::admitLoadRequest(const LoadRequest& loadRequest)
+	{
+		// Is there room inside the resource streamer pipeline? Only emergency load requests are allowed to use the reserve.
+		uint32_t inFlightLoadRequestIndex = 0;
+		const bool emergency = (LoadPriority::EMERGENCY == loadRequest.loadPriority && !loadRequest.resourceLoader->requiresOrderedLoading());
+		if ((emergency || mFreeInFlightLoadRequestIndices.getApproximateNumberOfElements() > NUMBER_OF_EMERGENCY_IN_FLIGHT_LOAD_REQUESTS) && mFreeInFlightLoadRequestIndices.pop(inFlightLoadRequestIndex))
 		{
-			// Continue as long as there's a load request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-			mDeserializationConditionVariable.wait(deserializationMutexLock);
-			while (!mDeserializationQueue.empty() && !mShutdownDeserializationThread)
+			// Setup the in-flight load request, no other thread is referencing it
+			InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[inFlightLoadRequestIndex];
+			inFlightLoadRequest.loadRequest = loadRequest;
+			inFlightLoadRequest.ordered = loadRequest.resourceLoader->requiresOrderedLoading();
+			inFlightLoadRequest.stageIndex.store(DESERIALIZATION_STAGE, std::memory_order_relaxed);
+			inFlightLoadRequest.loadPriority.store(static_cast<uint8_t>(loadRequest.loadPriority), std::memory_order_relaxed);
+			inFlightLoadRequest.queuedLoadPriority.store(static_cast<uint8_t>(loadRequest.loadPriority), std::memory_order_relaxed);
+			inFlightLoadRequest.cancelled.store(false, std::memory_order_relaxed);
+			inFlightLoadRequest.numberOfReferences.store(1, std::memory_order_relaxed);
+			const uint32_t ticket = (inFlightLoadRequest.ticket.load(std::memory_order_relaxed) + 1) & ~::detail::CLAIMED_TICKET_FLAG;
+			inFlightLoadRequest.ticket.store(ticket, std::memory_order_release);
+			++mNumberOfInFlightLoadRequests;
+
+			// Push the load request into the queue of the first resource streamer pipeline stage
+			// -> Resource streamer stage: 1. Asynchronous deserialization
+			pushQueueEntry(inFlightLoadRequestIndex, ticket);
+			return true;
+		}
+
+		// No room, the load request has to wait
+		return false;
+	}
+
+	void ResourceStreamer::admitPendingLoadRequests()
+	{
+		for (uint8_t servingIndex = 0; servingIndex < NUMBER_OF_LANES && 0 != mNumberOfPendingLoadRequests; ++servingIndex)
+		{
+			LoadRequests& pendingLoadRequests = mPendingLoadRequests[getLaneByServingIndex(servingIndex)];
+			while (!pendingLoadRequests.empty() && admitLoadRequest(pendingLoadRequests.front()))
 			{
-				// Get the load request
-				LoadRequest loadRequest = mDeserializationQueue.front();
-				mDeserializationQueue.pop_front();
-				deserializationMutexLock.unlock();
-
-				{ // Do the work
-					IFileManager& fileManager = mRendererRuntime.getFileManager();
-					IFile* file = fileManager.openFile(loadRequest.resourceLoader->getAsset().assetFilename);
-					if (nullptr != file)
-					{
-						loadRequest.resourceLoader->onDeserialization(*file);
-						fileManager.closeFile(*file);
-					}
-					else
+				pendingLoadRequests.pop_front();
+				--mNumberOfPendingLoadRequests;
+			}
+		}
+	}
+
+	void ResourceStreamer::pushQueueEntry(uint32_t inFlightLoadRequestIndex, uint32_t ticket)
+	{
+		InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[inFlightLoadRequestIndex];
+		Stage& stage = mStages[inFlightLoadRequest.stageIndex.load(std::memory_order_relaxed)];
+		const uint8_t lane = inFlightLoadRequest.ordered ? ORDERED_LANE : inFlightLoadRequest.queuedLoadPriority.load(std::memory_order_relaxed);
+
+		// The queue entry references the in-flight load request until it has been popped
+		++inFlightLoadRequest.numberOfReferences;
+		const QueueEntry queueEntry = { inFlightLoadRequestIndex, ticket };
+		if (!stage.laneQueues[lane].push(queueEntry))
+		{
+			// Error! The number of in-flight load requests is limited to the queue capacity, so this should never ever happen.
+			assert(false);
+		}
+
+		// Wake up a sleeping worker thread, if there's one
+		// -> The fence pairs with the one of sleeping worker threads: Either the worker thread sees the new queue entry or we see the worker thread sleeping
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (0 != stage.numberOfSleepingWorkerThreads.load(std::memory_order_relaxed))
+		{
+			{ // Worker threads can't be between predicate check and sleep while we're holding the mutex
+				std::lock_guard<std::mutex> stageMutexLock(stage.mutex);
+			}
+			if (ORDERED_LANE == lane)
+			{
+				// Only the first worker thread processes load requests requiring ordered loading, make sure it's woken up
+				stage.conditionVariable.notify_all();
+			}
+			else
+			{
+				stage.conditionVariable.notify_one();
+			}
+		}
+	}
+
+	void ResourceStreamer::passToStage(uint32_t inFlightLoadRequestIndex, StageIndex stageIndex)
+	{
+		// The stage index must be visible before the ticket releases the claim, re-prioritization reads the stage index after seeing an unclaimed ticket
+		InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[inFlightLoadRequestIndex];
+		inFlightLoadRequest.stageIndex.store(static_cast<uint8_t>(stageIndex), std::memory_order_relaxed);
+		inFlightLoadRequest.queuedLoadPriority.store(inFlightLoadRequest.loadPriority.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		const uint32_t ticket = (inFlightLoadRequest.ticket.load(std::memory_order_relaxed) + 1) & ~::detail::CLAIMED_TICKET_FLAG;
+		inFlightLoadRequest.ticket.store(ticket, std::memory_order_release);
+		pushQueueEntry(inFlightLoadRequestIndex, ticket);
+	}
+
+	bool ResourceStreamer::claimLoadRequest(Stage& stage, bool firstWorkerThread, uint32_t& inFlightLoadRequestIndex, uint8_t numberOfServedLanes)
+	{
+		for (uint8_t servingIndex = 0; servingIndex < numberOfServedLanes; ++servingIndex)
+		{
+			const uint8_t lane = getLaneByServingIndex(servingIndex);
+			if (ORDERED_LANE == lane && !firstWorkerThread)
+			{
+				continue;
+			}
+			QueueEntry queueEntry;
+			while (stage.laneQueues[lane].pop(queueEntry))
+			{
+				// Only the queue entry with the current ticket is valid, outdated ones are left behind by re-prioritization
+				uint32_t expectedTicket = queueEntry.ticket;
+				const bool claimed = mInFlightLoadRequests[queueEntry.inFlightLoadRequestIndex].ticket.compare_exchange_strong(expectedTicket, queueEntry.ticket | ::detail::CLAIMED_TICKET_FLAG, std::memory_order_acq_rel, std::memory_order_relaxed);
+				releaseInFlightLoadRequestReference(queueEntry.inFlightLoadRequestIndex);
+				if (claimed)
+				{
+					inFlightLoadRequestIndex = queueEntry.inFlightLoadRequestIndex;
+					return true;
+				}
+			}
+		}
+
+		// Nothing to do
+		return false;
+	}
+
+	void ResourceStreamer::releaseInFlightLoadRequestReference(uint32_t inFlightLoadRequestIndex)
+	{
+		if (1 == mInFlightLoadRequests[inFlightLoadRequestIndex].numberOfReferences.fetch_sub(1))
+		{
+			// The in-flight load request is free again
+			if (!mFreeInFlightLoadRequestIndices.push(inFlightLoadRequestIndex))
+			{
+				// Error! There can't be more free in-flight load requests than in-flight load requests, so this should never ever happen.
+				assert(false);
+			}
+		}
+	}
+
+	bool ResourceStreamer::waitForLoadRequest(Stage& stage, bool firstWorkerThread, uint32_t& inFlightLoadRequestIndex)
+	{
+		while (!stage.shutdownWorkerThreads)
+		{
+			// Get the load request
+			if (claimLoadRequest(stage, firstWorkerThread, inFlightLoadRequestIndex))
+			{
+				return true;
+			}
+
+			// The queues are empty, go to sleep
+			waitForQueueEntries(stage, firstWorkerThread);
+		}
+
+		// Shutdown
+		return false;
+	}
+
+	void ResourceStreamer::waitForQueueEntries(Stage& stage, bool firstWorkerThread)
+	{
+		// The sleeping thread counter tells "RendererRuntime::ResourceStreamer::pushQueueEntry()" to wake us up again
+		std::unique_lock<std::mutex> stageMutexLock(stage.mutex);
+		++stage.numberOfSleepingWorkerThreads;
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		stage.conditionVariable.wait(stageMutexLock, [&stage, firstWorkerThread]()
+			{
+				if (stage.shutdownWorkerThreads)
+				{
+					return true;
+				}
+				for (uint8_t lane = 0; lane < NUMBER_OF_LANES; ++lane)
+				{
+					if ((ORDERED_LANE != lane || firstWorkerThread) && 0 != stage.laneQueues[lane].getApproximateNumberOfElements())
 					{
-						// Error! This is horrible, now we've got a zombie inside the resource streamer. We could let it crash, but maybe the zombie won't directly eat brains.
-						assert(false);
+						return true;
 					}
 				}
+				return false;
+			}
+		);
+		--stage.numberOfSleepingWorkerThreads;
+	}
 
-				{ // Push the load request into the queue of the next resource streamer pipeline stage
-				  // -> Resource streamer stage: 2. Asynchronous processing
-					std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-					mProcessingQueue.push_back(loadRequest);
-					processingMutexLock.unlock();
-					mProcessingConditionVariable.notify_one();
+	void ResourceStreamer::deserializeLoadRequest(uint32_t inFlightLoadRequestIndex)
+	{
+		// Do the work, cancelled load requests are just passed through
+		InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[inFlightLoadRequestIndex];
+		if (!inFlightLoadRequest.cancelled.load(std::memory_order_relaxed))
+		{
+			IFileManager& fileManager = mRendererRuntime.getFileManager();
+			IResourceLoader* resourceLoader = inFlightLoadRequest.loadRequest.resourceLoader;
+			IFile* file = fileManager.openFile(resourceLoader->getAsset().assetFilename);
+			if (nullptr != file)
+			{
+				resourceLoader->onDeserialization(*file);
+				if (file->supportsViews())
+				{
+					// The resource loader might use views of the file up to and including the dispatch
+					inFlightLoadRequest.file = file;
 				}
-
-				// We're ready for the next round
-				deserializationMutexLock.lock();
+				else
+				{
+					fileManager.closeFile(*file);
+				}
+			}
+			else
+			{
+				// Error! This is horrible, now we've got a zombie inside the resource streamer. We could let it crash, but maybe the zombie won't directly eat brains.
+				assert(false);
 			}
 		}
+
+		// Push the load request into the queue of the next resource streamer pipeline stage
+		// -> Resource streamer stage: 2. Asynchronous processing
+		passToStage(inFlightLoadRequestIndex, PROCESSING_STAGE);
+	}
+
+	void ResourceStreamer::processLoadRequest(uint32_t inFlightLoadRequestIndex)
+	{
+		// Do the work, cancelled load requests are just passed through
+		const InFlightLoadRequest& inFlightLoadRequest = mInFlightLoadRequests[inFlightLoadRequestIndex];
+		if (!inFlightLoadRequest.cancelled.load(std::memory_order_relaxed))
+		{
+			inFlightLoadRequest.loadRequest.resourceLoader->onProcessing();
+		}
+
+		// Push the load request into the queue of the next resource streamer pipeline stage
+		// -> Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
+		// -> Load requests requiring ordered loading are only passed on by the first processing thread, so they stay in order
+		passToStage(inFlightLoadRequestIndex, DISPATCH_STAGE);
+	}
+
+	void ResourceStreamer::finishCancelledLoadRequest(const LoadRequest& loadRequest)
+	{
+		// Give the resource loader the chance to release what it already created for the resource
+		IResourceLoader* resourceLoader = loadRequest.resourceLoader;
+		resourceLoader->onCancellation();
+
+		// Update the resource loading state
+		loadRequest.resource->setLoadingState(IResource::LoadingState::UNLOADED);
+
+		// Release the resource loader instance
+		resourceLoader->getResourceManager().releaseResourceLoaderInstance(*resourceLoader);
+	}
+
+	void ResourceStreamer::deserializationThreadWorker(uint32_t workerThreadIndex)
+	{
+		RENDERER_RUNTIME_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 1", "Renderer runtime: Resource streamer stage: 1. Asynchronous deserialization");
+
+		// Resource streamer stage: 1. Asynchronous deserialization
+		uint32_t inFlightLoadRequestIndex = 0;
+		while (waitForLoadRequest(mStages[DESERIALIZATION_STAGE], (0 == workerThreadIndex), inFlightLoadRequestIndex))
+		{
+			deserializeLoadRequest(inFlightLoadRequestIndex);
+		}
 	}
 
-	void ResourceStreamer::processingThreadWorker()
+	void ResourceStreamer::processingThreadWorker(uint32_t workerThreadIndex)
 	{
 		RENDERER_RUNTIME_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 2", "Renderer runtime: Resource streamer stage: 2. Asynchronous processing");
 
 		// Resource streamer stage: 2. Asynchronous processing
-		while (!mShutdownProcessingThread)
+		uint32_t inFlightLoadRequestIndex = 0;
+		while (waitForLoadRequest(mStages[PROCESSING_STAGE], (0 == workerThreadIndex), inFlightLoadRequestIndex))
 		{
-			// Continue as long as there's a load request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-			mProcessingConditionVariable.wait(processingMutexLock);
-			while (!mProcessingQueue.empty() && !mShutdownProcessingThread)
-			{
-				// Get the load request
-				LoadRequest loadRequest = mProcessingQueue.front();
-				mProcessingQueue.pop_front();
-				processingMutexLock.unlock();
-
-				// Do the work
-				loadRequest.resourceLoader->onProcessing();
-
-				{ // Push the load request into the queue of the next resource streamer pipeline stage
-				  // -> Resource streamer stage: 3. Synchronous dispatch to e.g. the renderer backend
-					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-					mDispatchQueue.push_back(loadRequest);
-				}
-
-				// We're ready for the next round
-				processingMutexLock.lock();
-			}
+			processLoadRequest(inFlightLoadRequestIndex);
 		}
 	}
 
@@ -119,6 +119,9 @@ namespace RendererRuntime
 			}
 		}
 
+		// The material techniques have an influence on the sorting key of renderables which might already be attached to the material resource
+		mMaterialResource->calculateAttachedRenderablesSortingKey();
+
 		// Fully loaded
 		return true;
 	}
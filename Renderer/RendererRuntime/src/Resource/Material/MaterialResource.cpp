@@ -131,6 +131,9 @@ namespace RendererRuntime
 				// Don't touch the child material resources, but reset everything else
 				mMaterialProperties.removeAllProperties();
 			}
+
+			// The material techniques and material properties have been changed
+			calculateAttachedRenderablesSortingKey();
 		}
 	}
 
@@ -147,6 +150,9 @@ namespace RendererRuntime
 			delete materialTechnique;
 		}
 		mSortedMaterialTechniqueVector.clear();
+
+		// Attached renderables might have cached the destroyed material techniques
+		calculateAttachedRenderablesSortingKey();
 	}
 
 	void MaterialResource::releaseTextures()
@@ -154,7 +160,7 @@ namespace RendererRuntime
 		// TODO(co) Cleanup
 		for (MaterialTechnique* materialTechnique : mSortedMaterialTechniqueVector)
 		{
-			materialTechnique->mTextures.clear();
+			materialTechnique->releaseTextures();
 		}
 	}
 
@@ -249,6 +255,7 @@ namespace RendererRuntime
 
 				case MaterialProperty::Usage::SHADER_COMBINATION:
 					// TODO(co)
+					calculateAttachedRenderablesSortingKey();
 					break;
 
 				case MaterialProperty::Usage::RASTERIZER_STATE:
@@ -280,6 +287,7 @@ namespace RendererRuntime
 						for (Renderable* renderable : mAttachedRenderables)
 						{
 							renderable->mRenderQueueIndex = static_cast<uint8_t>(renderQueueIndex);
+							renderable->calculateSortingKey();
 
 							// In here we don't care about the fact that one and the same renderable manager instance might
 							// update cached renderables data. It's not performance critical in here and resolving this will
@@ -333,8 +341,17 @@ namespace RendererRuntime
 		return false;
 	}
 
+	void MaterialResource::calculateAttachedRenderablesSortingKey()
+	{
+		for (Renderable* renderable : mAttachedRenderables)
+		{
+			renderable->calculateSortingKey();
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 } // RendererRuntime
+
@@ -43,7 +43,8 @@ namespace RendererRuntime
 	MaterialTechnique::MaterialTechnique(MaterialTechniqueId materialTechniqueId, MaterialResource& materialResource, MaterialBlueprintResourceId materialBlueprintResourceId) :
 		MaterialBufferSlot(materialResource),
 		mMaterialTechniqueId(materialTechniqueId),
-		mMaterialBlueprintResourceId(materialBlueprintResourceId)
+		mMaterialBlueprintResourceId(materialBlueprintResourceId),
+		mTextureBindingsDirty(true)
 	{
 		MaterialBufferManager* materialBufferManager = getMaterialBufferManager();
 		if (nullptr != materialBufferManager)
@@ -120,29 +121,29 @@ namespace RendererRuntime
 		}
 
 		{ // Graphics root descriptor table: Set textures
-			const Textures& textures = getTextures(rendererRuntime);
-			const size_t numberOfTextures = textures.size();
-			const TextureResources& textureResources = rendererRuntime.getTextureResourceManager().getTextureResources();
-			for (size_t i = 0; i < numberOfTextures; ++i)
+			// -> The texture bindings are only gathered again after a texture resource loading state change, so usually there are no texture resource lookups in here
+			if (mTextureBindingsDirty)
 			{
-				const Texture& texture = textures[i];
-
-				// Due to background texture loading, some textures might not be ready, yet
-				// TODO(co) Add dummy textures so rendering also works when textures are not ready, yet
-				const TextureResource* textureResource  = textureResources.tryGetElementById(texture.textureResourceId);
-				if (nullptr != textureResource)
-				{
-					Renderer::ITexturePtr texturePtr = textureResource->getTexture();
-					if (nullptr != texturePtr)
-					{
-						Renderer::Command::SetGraphicsRootDescriptorTable::create(commandBuffer, texture.rootParameterIndex, texturePtr);
-					}
-				}
+				gatherTextureBindings(rendererRuntime);
+			}
+			for (const TextureBinding& textureBinding : mTextureBindings)
+			{
+				Renderer::Command::SetGraphicsRootDescriptorTable::create(commandBuffer, textureBinding.rootParameterIndex, textureBinding.texturePtr);
 			}
 		}
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual RendererRuntime::IResourceListener methods ]
+	//[-------------------------------------------------------]
+	void MaterialTechnique::onLoadingStateChange(const IResource&)
+	{
+		// The renderer texture of a texture resource might have been changed, gather the texture bindings again before the next usage
+		mTextureBindingsDirty = true;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -162,6 +163,43 @@ namespace RendererRuntime
 		}
 	}
 
+	void MaterialTechnique::releaseTextures()
+	{
+		disconnectFromAllResources();
+		mTextures.clear();
+		mTextureBindings.clear();
+		mTextureBindingsDirty = true;
+	}
+
+	void MaterialTechnique::gatherTextureBindings(const IRendererRuntime& rendererRuntime)
+	{
+		mTextureBindings.clear();
+		const Textures& textures = getTextures(rendererRuntime);
+		const size_t numberOfTextures = textures.size();
+		const TextureResources& textureResources = rendererRuntime.getTextureResourceManager().getTextureResources();
+		for (size_t i = 0; i < numberOfTextures; ++i)
+		{
+			const Texture& texture = textures[i];
+
+			// Due to background texture loading, some textures might not be ready, yet
+			// -> Connecting to the texture resource ensures that we're informed as soon as the renderer texture changes
+			// TODO(co) Add dummy textures so rendering also works when textures are not ready, yet
+			TextureResource* textureResource = textureResources.tryGetElementById(texture.textureResourceId);
+			if (nullptr != textureResource)
+			{
+				textureResource->connectResourceListener(*this);
+				Renderer::ITexturePtr texturePtr = textureResource->getTexture();
+				if (nullptr != texturePtr)
+				{
+					mTextureBindings.push_back(TextureBinding{texture.rootParameterIndex, texturePtr});
+				}
+			}
+		}
+
+		// Connecting to the texture resources above also informed us about their current loading states, the texture bindings are now up-to-date
+		mTextureBindingsDirty = false;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -47,8 +47,11 @@ namespace
 		static uint32_t DEFAULT_UNIFORM_BUFFER_NUMBER_OF_BYTES = 64 * 1024;		// 64 KiB
 
 		// TODO(co) Add support for persistent mapped buffers. For now, the big picture has to be OK so first focus on that.
-		static uint32_t DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES = 64 * 1024;	// 64 KiB
-		// static uint32_t DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES = 512 * 1024;	// 512 KiB
+		static uint32_t DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES		 = 64 * 1024;	// 64 KiB, per draw call
+		static uint32_t DEFAULT_FRAME_TEXTURE_BUFFER_NUMBER_OF_BYTES = 512 * 1024;	// 512 KiB, frame-wide
+
+		static const uint32_t NUMBER_OF_TEXTURE_BUFFER_TEXELS_PER_INSTANCE = 3;	// "POSITION_ROTATION_SCALE"-semantic: xyz position, xyzw rotation, xyz scale
+		static const uint32_t NUMBER_OF_TEXTURE_BUFFER_BYTES_PER_INSTANCE  = sizeof(float) * 4 * NUMBER_OF_TEXTURE_BUFFER_TEXELS_PER_INSTANCE;
 
 
 //[-------------------------------------------------------]
@@ -71,7 +74,10 @@ namespace RendererRuntime
 	InstanceBufferManager::InstanceBufferManager(IRendererRuntime& rendererRuntime) :
 		mRendererRuntime(rendererRuntime),
 		mUniformBuffer(nullptr),
-		mTextureBuffer(nullptr)
+		mTextureBuffer(nullptr),
+		mDrawTextureBuffer(nullptr),
+		mFrameStarted(false),
+		mFrameTextureBufferNumberOfInstances(0)
 	{
 		Renderer::IBufferManager& bufferManager = rendererRuntime.getBufferManager();
 
@@ -80,10 +86,16 @@ namespace RendererRuntime
 		mUniformBuffer = bufferManager.createUniformBuffer(static_cast<uint32_t>(mUniformScratchBuffer.size()), nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
 		RENDERER_SET_RESOURCE_DEBUG_NAME(mUniformBuffer, "Instance buffer manager")
 
-		// Create texture buffer instance
-		mTextureScratchBuffer.resize(std::min(rendererRuntime.getRenderer().getCapabilities().maximumTextureBufferSize, ::detail::DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES));
-		mTextureBuffer = bufferManager.createTextureBuffer(static_cast<uint32_t>(mTextureScratchBuffer.size()), Renderer::TextureFormat::R32G32B32A32F, nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
-		RENDERER_SET_RESOURCE_DEBUG_NAME(mTextureBuffer, "Instance buffer manager")
+		// Create texture buffer instances
+		// -> One texture buffer is filled once per frame, the other one per draw call outside a frame or if the frame-wide texture scratch buffer is full
+		// -> Separate texture buffers so the per draw call copies don't overwrite the frame-wide data still used by other draw calls
+		const uint32_t maximumTextureBufferSize = rendererRuntime.getRenderer().getCapabilities().maximumTextureBufferSize;
+		mTextureScratchBuffer.resize(std::min(maximumTextureBufferSize, ::detail::DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES));
+		mFrameTextureScratchBuffer.resize(std::min(maximumTextureBufferSize, ::detail::DEFAULT_FRAME_TEXTURE_BUFFER_NUMBER_OF_BYTES));
+		mTextureBuffer = bufferManager.createTextureBuffer(static_cast<uint32_t>(mFrameTextureScratchBuffer.size()), Renderer::TextureFormat::R32G32B32A32F, nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
+		RENDERER_SET_RESOURCE_DEBUG_NAME(mTextureBuffer, "Instance buffer manager frame")
+		mDrawTextureBuffer = bufferManager.createTextureBuffer(static_cast<uint32_t>(mTextureScratchBuffer.size()), Renderer::TextureFormat::R32G32B32A32F, nullptr, Renderer::BufferUsage::DYNAMIC_DRAW);
+		RENDERER_SET_RESOURCE_DEBUG_NAME(mDrawTextureBuffer, "Instance buffer manager draw")
 	}
 
 	InstanceBufferManager::~InstanceBufferManager()
@@ -91,125 +103,195 @@ namespace RendererRuntime
 		// Release uniform and texture buffer instances
 		mUniformBuffer->releaseReference();
 		mTextureBuffer->releaseReference();
+		mDrawTextureBuffer->releaseReference();
+	}
+
+	void InstanceBufferManager::beginFrame()
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		assert(!mFrameStarted);	// Frames can't be nested
+		mFrameStarted = true;
+		mFrameTextureBufferNumberOfInstances = 0;
 	}
 
-	void InstanceBufferManager::fillBuffer(PassBufferManager* passBufferManager, const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer, const MaterialBlueprintResource::TextureBuffer*, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique, Renderer::CommandBuffer& commandBuffer)
+	void InstanceBufferManager::endFrame()
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		assert(mFrameStarted);	// "RendererRuntime::InstanceBufferManager::beginFrame()" must be called first
+		mFrameStarted = false;
+
+		// Upload the packed frame-wide texture scratch buffer at once
+		if (0 != mFrameTextureBufferNumberOfInstances)
+		{
+			mTextureBuffer->copyDataFrom(mFrameTextureBufferNumberOfInstances * ::detail::NUMBER_OF_TEXTURE_BUFFER_BYTES_PER_INSTANCE, mFrameTextureScratchBuffer.data());
+		}
+	}
+
+	uint32_t InstanceBufferManager::fillBuffer(PassBufferManager* passBufferManager, const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer, const MaterialBlueprintResource::TextureBuffer* instanceTextureBuffer, const Transform* const* objectSpaceToWorldSpaceTransforms, uint32_t numberOfInstances, MaterialTechnique& materialTechnique, Renderer::CommandBuffer& commandBuffer)
+	{
+		// Sanity checks
+		assert(nullptr != objectSpaceToWorldSpaceTransforms);
+		assert(numberOfInstances > 0);
+
 		// TODO(co) This is just a placeholder implementation until "RendererRuntime::InstanceBufferManager" is ready
 
 		// TODO(co) Currently uniform buffer is required, but some material blueprints (usually compositor related) don't have uniform buffers
 		if (nullptr == instanceUniformBuffer)
 		{
-			return;
+			return numberOfInstances;
 		}
-
-		// TODO(co) Implement automatic instancing
-		assert(1 == instanceUniformBuffer->numberOfElements);
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRendererRuntime.getMaterialBlueprintResourceManager();
 		const MaterialProperties& globalMaterialProperties = materialBlueprintResourceManager.getGlobalMaterialProperties();
-
 		IMaterialBlueprintResourceListener& materialBlueprintResourceListener = materialBlueprintResourceManager.getMaterialBlueprintResourceListener();
 		static const PassBufferManager::PassData passData = {};
-		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData() : passData, objectSpaceToWorldSpaceTransform, materialTechnique);
-
-		// Update the uniform scratch buffer
+		const PassBufferManager::PassData& currentPassData = (nullptr != passBufferManager) ? passBufferManager->getPassData() : passData;
+
+		// Inside a frame, the instance texture buffer data is appended to the frame-wide texture scratch buffer which is uploaded only once per frame
+		// -> If the frame-wide texture scratch buffer is full, fall back to copying the instance texture buffer data into the command buffer per draw call
+		const uint32_t maximumNumberOfFrameTextureBufferInstances = static_cast<uint32_t>(mFrameTextureScratchBuffer.size() / ::detail::NUMBER_OF_TEXTURE_BUFFER_BYTES_PER_INSTANCE);
+		const bool packIntoFrame = (mFrameStarted && mFrameTextureBufferNumberOfInstances < maximumNumberOfFrameTextureBufferInstances);
+		const uint32_t firstTextureBufferInstance = packIntoFrame ? mFrameTextureBufferNumberOfInstances : 0;
+		uint8_t* textureScratchBuffer = packIntoFrame ? mFrameTextureScratchBuffer.data() : mTextureScratchBuffer.data();
+
+		// Automatic instancing: Each instance gets its own instance uniform buffer array element as well as its own instance texture buffer range
+		// -> Fill as many instances as fit into the uniform and texture scratch buffers, the caller is responsible for issuing further draw calls for the remaining instances
+		const uint32_t maximumNumberOfTextureBufferInstances = packIntoFrame ? (maximumNumberOfFrameTextureBufferInstances - firstTextureBufferInstance) : static_cast<uint32_t>(mTextureScratchBuffer.size() / ::detail::NUMBER_OF_TEXTURE_BUFFER_BYTES_PER_INSTANCE);
+		const uint8_t* scratchUniformBufferEnd = mUniformScratchBuffer.data() + mUniformScratchBuffer.size();
 		uint8_t* scratchUniformBufferPointer = mUniformScratchBuffer.data();
+		float* scratchTextureBufferPointer = reinterpret_cast<float*>(textureScratchBuffer + firstTextureBufferInstance * ::detail::NUMBER_OF_TEXTURE_BUFFER_BYTES_PER_INSTANCE);
+		size_t uniformBufferElementNumberOfBytes = 0;	// Only known after the first instance has been filled
+		uint32_t numberOfFilledInstances = 0;
+		for (; numberOfFilledInstances < numberOfInstances && numberOfFilledInstances < maximumNumberOfTextureBufferInstances; ++numberOfFilledInstances)
 		{
-			const MaterialBlueprintResource::UniformBufferElementProperties& uniformBufferElementProperties = instanceUniformBuffer->uniformBufferElementProperties;
-			const size_t numberOfUniformBufferElementProperties = uniformBufferElementProperties.size();
-			for (size_t i = 0, numberOfPackageBytes = 0; i < numberOfUniformBufferElementProperties; ++i)
+			// Stop if the instance uniform buffer element doesn't fit into the uniform scratch buffer anymore
+			if (scratchUniformBufferPointer + uniformBufferElementNumberOfBytes > scratchUniformBufferEnd)
 			{
-				const MaterialProperty& uniformBufferElementProperty = uniformBufferElementProperties[i];
-
-				// Get value type number of bytes
-				const uint32_t valueTypeNumberOfBytes = uniformBufferElementProperty.getValueTypeNumberOfBytes(uniformBufferElementProperty.getValueType());
+				break;
+			}
+			const Transform& objectSpaceToWorldSpaceTransform = *objectSpaceToWorldSpaceTransforms[numberOfFilledInstances];
+			materialBlueprintResourceListener.beginFillInstance(currentPassData, objectSpaceToWorldSpaceTransform, materialTechnique, (firstTextureBufferInstance + numberOfFilledInstances) * ::detail::NUMBER_OF_TEXTURE_BUFFER_TEXELS_PER_INSTANCE);
 
-				// Handling of packing rules for uniform variables (see "Reference for HLSL - Shader Models vs Shader Profiles - Shader Model 4 - Packing Rules for Constant Variables" at https://msdn.microsoft.com/en-us/library/windows/desktop/bb509632%28v=vs.85%29.aspx )
-				if (0 != numberOfPackageBytes && numberOfPackageBytes + valueTypeNumberOfBytes > 16)
+			// Update the uniform scratch buffer
+			uint8_t* scratchUniformBufferElementPointer = scratchUniformBufferPointer;
+			{
+				const MaterialBlueprintResource::UniformBufferElementProperties& uniformBufferElementProperties = instanceUniformBuffer->uniformBufferElementProperties;
+				const size_t numberOfUniformBufferElementProperties = uniformBufferElementProperties.size();
+				for (size_t i = 0, numberOfPackageBytes = 0; i < numberOfUniformBufferElementProperties; ++i)
 				{
-					// Move the scratch buffer pointer to the location of the next aligned package and restart the package bytes counter
-					scratchUniformBufferPointer += 4 * 4 - numberOfPackageBytes;
-					numberOfPackageBytes = 0;
-				}
-				numberOfPackageBytes += valueTypeNumberOfBytes % 16;
+					const MaterialProperty& uniformBufferElementProperty = uniformBufferElementProperties[i];
 
-				// Copy the property value into the scratch buffer
-				const MaterialProperty::Usage usage = uniformBufferElementProperty.getUsage();
-				if (MaterialProperty::Usage::INSTANCE_REFERENCE == usage)	// Most likely the case, so check this first
-				{
-					if (!materialBlueprintResourceListener.fillInstanceValue(uniformBufferElementProperty.getReferenceValue(), scratchUniformBufferPointer, valueTypeNumberOfBytes))
+					// Get value type number of bytes
+					const uint32_t valueTypeNumberOfBytes = uniformBufferElementProperty.getValueTypeNumberOfBytes(uniformBufferElementProperty.getValueType());
+
+					// Handling of packing rules for uniform variables (see "Reference for HLSL - Shader Models vs Shader Profiles - Shader Model 4 - Packing Rules for Constant Variables" at https://msdn.microsoft.com/en-us/library/windows/desktop/bb509632%28v=vs.85%29.aspx )
+					if (0 != numberOfPackageBytes && numberOfPackageBytes + valueTypeNumberOfBytes > 16)
 					{
-						// Error, can't resolve reference
-						assert(false);
+						// Move the scratch buffer pointer to the location of the next aligned package and restart the package bytes counter
+						scratchUniformBufferPointer += 4 * 4 - numberOfPackageBytes;
+						numberOfPackageBytes = 0;
 					}
-				}
-				else if (MaterialProperty::Usage::GLOBAL_REFERENCE == usage)
-				{
-					// Referencing a global material property inside an instance uniform buffer doesn't make really sense performance wise, but don't forbid it
+					numberOfPackageBytes += valueTypeNumberOfBytes % 16;
 
-					// Figure out the global material property value
-					const MaterialProperty* materialProperty = globalMaterialProperties.getPropertyById(uniformBufferElementProperty.getReferenceValue());
-					if (nullptr != materialProperty)
+					// Copy the property value into the scratch buffer
+					const MaterialProperty::Usage usage = uniformBufferElementProperty.getUsage();
+					if (MaterialProperty::Usage::INSTANCE_REFERENCE == usage)	// Most likely the case, so check this first
+					{
+						if (!materialBlueprintResourceListener.fillInstanceValue(uniformBufferElementProperty.getReferenceValue(), scratchUniformBufferPointer, valueTypeNumberOfBytes))
+						{
+							// Error, can't resolve reference
+							assert(false);
+						}
+					}
+					else if (MaterialProperty::Usage::GLOBAL_REFERENCE == usage)
 					{
-						// TODO(co) Error handling: Usage mismatch, value type mismatch etc.
-						memcpy(scratchUniformBufferPointer, materialProperty->getData(), valueTypeNumberOfBytes);
+						// Referencing a global material property inside an instance uniform buffer doesn't make really sense performance wise, but don't forbid it
+
+						// Figure out the global material property value
+						const MaterialProperty* materialProperty = globalMaterialProperties.getPropertyById(uniformBufferElementProperty.getReferenceValue());
+						if (nullptr != materialProperty)
+						{
+							// TODO(co) Error handling: Usage mismatch, value type mismatch etc.
+							memcpy(scratchUniformBufferPointer, materialProperty->getData(), valueTypeNumberOfBytes);
+						}
+						else
+						{
+							// Error, can't resolve reference
+							assert(false);
+						}
+					}
+					else if (!uniformBufferElementProperty.isReferenceUsage())	// TODO(co) Performance: Think about such tests, the toolkit should already take care of this so we have well known verified runtime data
+					{
+						// Referencing a static uniform buffer element property inside an instance uniform buffer doesn't make really sense performance wise, but don't forbid it
+
+						// Just copy over the property value
+						memcpy(scratchUniformBufferPointer, uniformBufferElementProperty.getData(), valueTypeNumberOfBytes);
 					}
 					else
 					{
-						// Error, can't resolve reference
+						// Error, invalid property
 						assert(false);
 					}
-				}
-				else if (!uniformBufferElementProperty.isReferenceUsage())	// TODO(co) Performance: Think about such tests, the toolkit should already take care of this so we have well known verified runtime data
-				{
-					// Referencing a static uniform buffer element property inside an instance uniform buffer doesn't make really sense performance wise, but don't forbid it
 
-					// Just copy over the property value
-					memcpy(scratchUniformBufferPointer, uniformBufferElementProperty.getData(), valueTypeNumberOfBytes);
-				}
-				else
-				{
-					// Error, invalid property
-					assert(false);
+					// Next property
+					scratchUniformBufferPointer += valueTypeNumberOfBytes;
 				}
 
-				// Next property
-				scratchUniformBufferPointer += valueTypeNumberOfBytes;
+				// Array elements always start at a 16 byte boundary
+				uniformBufferElementNumberOfBytes = (static_cast<size_t>(scratchUniformBufferPointer - scratchUniformBufferElementPointer) + 15) & ~static_cast<size_t>(15);
+				scratchUniformBufferPointer = scratchUniformBufferElementPointer + uniformBufferElementNumberOfBytes;
 			}
-		}
 
-		// Update the texture scratch buffer
-		float* scratchTextureBufferPointer = reinterpret_cast<float*>(mTextureScratchBuffer.data());
-		{
-			// TODO(co) Check "InstanceTextureBuffer" value
+			// Update the texture scratch buffer
+			{
+				// TODO(co) Check "InstanceTextureBuffer" value
 
-			{ // "POSITION_ROTATION_SCALE"-semantic
-				// xyz position
-				memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.position), sizeof(float) * 3);
-				scratchTextureBufferPointer += 4;
+				{ // "POSITION_ROTATION_SCALE"-semantic
+					// xyz position
+					memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.position), sizeof(float) * 3);
+					scratchTextureBufferPointer += 4;
 
-				// xyzw rotation
-				memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.rotation), sizeof(float) * 4);
-				scratchTextureBufferPointer += 4;
+					// xyzw rotation
+					memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.rotation), sizeof(float) * 4);
+					scratchTextureBufferPointer += 4;
 
-				// xyz scale
-				memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.scale), sizeof(float) * 3);
-				scratchTextureBufferPointer += 4;
-			}
+					// xyz scale
+					memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.scale), sizeof(float) * 3);
+					scratchTextureBufferPointer += 4;
+				}
 
-			// "OBJECT_SPACE_TO_WORLD_SPACE_MATRIX"-semantic
-			/*
-			glm::mat4 objectSpaceToWorldSpaceMatrix;
-			objectSpaceToWorldSpaceTransform.getAsMatrix(objectSpaceToWorldSpaceMatrix);
-			objectSpaceToWorldSpaceMatrix = glm::transpose(objectSpaceToWorldSpaceMatrix);
-			memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceMatrix), sizeof(float) * 4 * 4);
-			*/
+				// "OBJECT_SPACE_TO_WORLD_SPACE_MATRIX"-semantic
+				/*
+				glm::mat4 objectSpaceToWorldSpaceMatrix;
+				objectSpaceToWorldSpaceTransform.getAsMatrix(objectSpaceToWorldSpaceMatrix);
+				objectSpaceToWorldSpaceMatrix = glm::transpose(objectSpaceToWorldSpaceMatrix);
+				memcpy(scratchTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceMatrix), sizeof(float) * 4 * 4);
+				*/
+			}
 		}
+		assert(numberOfFilledInstances > 0);
 
-		// Update the uniform and texture buffer by using our scratch buffer
+		// Update the uniform buffer by using our scratch buffer
+		// -> The instance uniform buffer is indexed by the draw ID which starts at zero for each draw call, so it can't be packed frame-wide
 		Renderer::Command::CopyUniformBufferData::create(commandBuffer, mUniformBuffer, static_cast<uint32_t>(scratchUniformBufferPointer - mUniformScratchBuffer.data()), mUniformScratchBuffer.data());
-		Renderer::Command::CopyTextureBufferData::create(commandBuffer, mTextureBuffer, static_cast<uint32_t>(reinterpret_cast<uint8_t*>(scratchTextureBufferPointer) - mTextureScratchBuffer.data()), mTextureScratchBuffer.data());
+
+		// Update the texture buffer by using our scratch buffer, or just reserve the range inside the frame-wide texture scratch buffer
+		if (packIntoFrame)
+		{
+			mFrameTextureBufferNumberOfInstances += numberOfFilledInstances;
+		}
+		else if (nullptr != instanceTextureBuffer)
+		{
+			// The per draw call texture buffer replaces the frame-wide texture buffer bound by "RendererRuntime::InstanceBufferManager::fillCommandBuffer()"
+			// -> Once a frame fell back to per draw call copies all following draw calls of the frame do so as well, so there's no need to bind the frame-wide texture buffer again
+			// -> Like the instance uniform buffer, the per draw call texture buffer is always written at its beginning, each copy only has to stay valid for the following draw call
+			Renderer::Command::SetGraphicsRootDescriptorTable::create(commandBuffer, instanceTextureBuffer->rootParameterIndex, mDrawTextureBuffer);
+			Renderer::Command::CopyTextureBufferData::create(commandBuffer, mDrawTextureBuffer, numberOfFilledInstances * ::detail::NUMBER_OF_TEXTURE_BUFFER_BYTES_PER_INSTANCE, mTextureScratchBuffer.data());
+		}
+
+		// Done
+		return numberOfFilledInstances;
 	}
 
 	void InstanceBufferManager::fillCommandBuffer(const MaterialBlueprintResource& materialBlueprintResource, Renderer::CommandBuffer& commandBuffer)
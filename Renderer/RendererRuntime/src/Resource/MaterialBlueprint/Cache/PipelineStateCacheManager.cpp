@@ -26,9 +26,34 @@
 #include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateSignature.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCompiler.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateCache.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateWarmUpManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const uint32_t MINIMUM_NUMBER_OF_PIPELINE_STATE_CACHE_SLOTS = 64;	///< Must be a power of two
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -40,20 +65,23 @@ namespace RendererRuntime
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	Renderer::IPipelineStatePtr PipelineStateCacheManager::getPipelineStateCacheByCombination(const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], bool allowEmergencySynchronousCompilation)
+	Renderer::IPipelineState* PipelineStateCacheManager::getPipelineStateCacheByCombination(const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], bool allowEmergencySynchronousCompilation)
 	{
 		// TODO(co) Asserts whether or not e.g. the material resource is using the owning material resource blueprint
 		assert(IResource::LoadingState::LOADED == mMaterialBlueprintResource.getLoadingState());
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 
-		// Generate the pipeline state signature
-		const PipelineStateSignature pipelineStateSignature(mMaterialBlueprintResource, shaderProperties, dynamicShaderPieces);	// TODO(co) Optimization: There are allocations for vector and map involved in here, we might want to get rid of those
+		// Generate the pipeline state signature ID
+		// -> Only hashing, no pipeline state signature instance with its copies of the shader properties and dynamic shader pieces is created for lookups
+		ShaderCombinationId shaderCombinationId[NUMBER_OF_SHADER_TYPES];
+		const PipelineStateSignatureId pipelineStateSignatureId = PipelineStateSignature::generatePipelineStateSignatureId(mMaterialBlueprintResource, shaderProperties, dynamicShaderPieces, shaderCombinationId);
 		{
-			PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(pipelineStateSignature.getPipelineStateSignatureId());
-			if (iterator != mPipelineStateCacheByPipelineStateSignatureId.cend())
+			const PipelineStateCache* pipelineStateCache = findPipelineStateCache(pipelineStateSignatureId);
+			if (nullptr != pipelineStateCache)
 			{
 				// There's already a pipeline state cache for the pipeline state signature ID
 				// -> We don't care whether or not the pipeline state cache is currently using fallback data due to asynchronous complication
-				return iterator->second->getPipelineStateObjectPtr();
+				return pipelineStateCache->mPipelineStateObjectPtr.getPointer();
 			}
 		}
 
@@ -73,57 +101,63 @@ namespace RendererRuntime
 			// do this by reducing the shader properties set until we find something, hopefully. In case no fallback can be found we have to switch to synchronous processing.
 
 			// Start with the full shader properties and then clear one shader property after another
+			// -> The order in which shader properties are sacrificed was derived from their visual importance when the material blueprint was loaded, so each step is just a removal and a hash probe
+			// -> Shader properties without visual importance entry have the visual importance 0, they're merged into the fallback chain with ties ordered by ascending shader property ID
 			ShaderProperties fallbackShaderProperties(shaderProperties);	// TODO(co) Optimization: There are allocations for vector involved in here, we might want to get rid of this
-			ShaderProperties::SortedPropertyVector& sortedFallbackPropertyVector = fallbackShaderProperties.getSortedPropertyVector();
-			while (nullptr == fallbackPipelineStateCache && !sortedFallbackPropertyVector.empty())
+			const MaterialBlueprintResource::ShaderPropertyIds& fallbackChain = mMaterialBlueprintResource.getFallbackChain();
+			const ShaderProperties::SortedPropertyVector& sortedPropertyVector = shaderProperties.getSortedPropertyVector();
+			MaterialBlueprintResource::ShaderPropertyIds::const_iterator fallbackChainIterator = fallbackChain.begin();
+			ShaderProperties::SortedPropertyVector::const_iterator propertyIterator = sortedPropertyVector.begin();
+			for (;;)
 			{
-				{ // Remove a fallback shader property
-					// Find the most useless shader property, we're going to sacrifice it
-					ShaderProperties::SortedPropertyVector::iterator worstHitShaderPropertyIterator = sortedFallbackPropertyVector.end();
-					int32_t worstHitVisualImportanceOfShaderProperty = getUninitialized<int32_t>();
-					ShaderProperties::SortedPropertyVector::iterator iterator = sortedFallbackPropertyVector.begin();
-					while (iterator != sortedFallbackPropertyVector.end())
+				// Skip requested shader properties with a visual importance other than 0, they're either mandatory or part of the fallback chain
+				// -> Requested shader properties with an explicit visual importance of 0 are part of the fallback chain as well, the second removal attempt is skipped below
+				while (sortedPropertyVector.end() != propertyIterator && 0 != mMaterialBlueprintResource.getVisualImportanceOfShaderProperty(propertyIterator->shaderPropertyId))
+				{
+					++propertyIterator;
+				}
+
+				// Find the most useless shader property, we're going to sacrifice it
+				// -> Lower visual importance value = lower probability that someone will miss the shader property
+				ShaderPropertyId shaderPropertyId;
+				if (fallbackChain.end() != fallbackChainIterator)
+				{
+					const int32_t visualImportanceOfShaderProperty = mMaterialBlueprintResource.getVisualImportanceOfShaderProperty(*fallbackChainIterator);
+					if (sortedPropertyVector.end() == propertyIterator || visualImportanceOfShaderProperty < 0 || (0 == visualImportanceOfShaderProperty && *fallbackChainIterator < propertyIterator->shaderPropertyId))
 					{
-						// Do not remove mandatory shader combination shader properties, at least not inside this pass
-						const int32_t visualImportanceOfShaderProperty = mMaterialBlueprintResource.getVisualImportanceOfShaderProperty(iterator->shaderPropertyId);
-						if (MaterialBlueprintResource::MANDATORY_SHADER_PROPERTY != visualImportanceOfShaderProperty)
-						{
-							if (isInitialized(worstHitVisualImportanceOfShaderProperty))
-							{
-								// Lower visual importance value = lower probability that someone will miss the shader property
-								if (worstHitVisualImportanceOfShaderProperty > visualImportanceOfShaderProperty)
-								{
-									worstHitVisualImportanceOfShaderProperty = visualImportanceOfShaderProperty;
-									worstHitShaderPropertyIterator = iterator;
-								}
-							}
-							else
-							{
-								worstHitShaderPropertyIterator = iterator;
-								worstHitVisualImportanceOfShaderProperty = visualImportanceOfShaderProperty;
-							}
-						}
-
-						// Next shader property on the to-kill-list, please
-						++iterator;
+						shaderPropertyId = *fallbackChainIterator;
+						++fallbackChainIterator;
 					}
-
-					// Sacrifice our victim
-					if (sortedFallbackPropertyVector.end() == worstHitShaderPropertyIterator)
+					else
 					{
-						// No chance, no goats left
-						break;
+						shaderPropertyId = propertyIterator->shaderPropertyId;
+						++propertyIterator;
 					}
-					sortedFallbackPropertyVector.erase(worstHitShaderPropertyIterator);
+				}
+				else if (sortedPropertyVector.end() != propertyIterator)
+				{
+					shaderPropertyId = propertyIterator->shaderPropertyId;
+					++propertyIterator;
+				}
+				else
+				{
+					// No chance, no goats left
+					break;
 				}
 
-				// Generate the current fallback pipeline state signature
-				PipelineStateSignature fallbackPipelineStateSignature(mMaterialBlueprintResource, fallbackShaderProperties, dynamicShaderPieces);	// TODO(co) Optimization: There are allocations for vector and map involved in here, we might want to get rid of those
-				PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(fallbackPipelineStateSignature.getPipelineStateSignatureId());
-				if (iterator != mPipelineStateCacheByPipelineStateSignatureId.cend())
+				// Sacrifice our victim, if it's part of the requested shader properties at all
+				if (!fallbackShaderProperties.removePropertyValue(shaderPropertyId))
 				{
-					// We don't care whether or not the pipeline state cache is currently using fallback data due to asynchronous complication
-					fallbackPipelineStateCache = iterator->second;
+					continue;
+				}
+
+				// Generate the current fallback pipeline state signature ID
+				// -> We don't care whether or not the pipeline state cache is currently using fallback data due to asynchronous complication
+				fallbackPipelineStateCache = findPipelineStateCache(PipelineStateSignature::generatePipelineStateSignatureId(mMaterialBlueprintResource, fallbackShaderProperties, dynamicShaderPieces, shaderCombinationId));
+				if (nullptr != fallbackPipelineStateCache)
+				{
+					++mNumberOfFallbackHits;
+					break;
 				}
 			}
 
@@ -133,20 +167,16 @@ namespace RendererRuntime
 			//    might not involve our first born.
 			if (!allowEmergencySynchronousCompilation && nullptr == fallbackPipelineStateCache)
 			{
-				// TODO(co) Optimization: There are allocations for vector and map involved in here, we might want to get rid of those
+				// We don't care whether or not the pipeline state cache is currently using fallback data due to asynchronous complication
 				fallbackShaderProperties.clear();
-				PipelineStateCacheByPipelineStateSignatureId::const_iterator iterator = mPipelineStateCacheByPipelineStateSignatureId.find(PipelineStateSignature(mMaterialBlueprintResource, fallbackShaderProperties, dynamicShaderPieces).getPipelineStateSignatureId());
-				if (iterator != mPipelineStateCacheByPipelineStateSignatureId.cend())
-				{
-					// We don't care whether or not the pipeline state cache is currently using fallback data due to asynchronous complication
-					fallbackPipelineStateCache = iterator->second;
-				}
+				fallbackPipelineStateCache = findPipelineStateCache(PipelineStateSignature::generatePipelineStateSignatureId(mMaterialBlueprintResource, fallbackShaderProperties, dynamicShaderPieces, shaderCombinationId));
 			}
 		}
 
 		// Create the new pipeline state cache instance
-		PipelineStateCache* pipelineStateCache = new PipelineStateCache(pipelineStateSignature);
-		mPipelineStateCacheByPipelineStateSignatureId.emplace(pipelineStateSignature.getPipelineStateSignatureId(), pipelineStateCache);
+		PipelineStateCache* pipelineStateCache = new PipelineStateCache(PipelineStateSignature(mMaterialBlueprintResource, shaderProperties, dynamicShaderPieces));
+		assert(pipelineStateCache->getPipelineStateSignature().getPipelineStateSignatureId() == pipelineStateSignatureId);
+		insertPipelineStateCache(*pipelineStateCache);
 
 		// If we've got a fallback pipeline state cache then commit the asynchronous pipeline state compiler request now, else we must proceed synchronous (risk of notable runtime hiccups)
 		if (nullptr != fallbackPipelineStateCache)
@@ -162,18 +192,86 @@ namespace RendererRuntime
 			pipelineStateCompiler.instantSynchronousCompilerRequest(mMaterialBlueprintResource, *pipelineStateCache);
 		}
 
+		// Record the shader combination so it can be warmed up during the next run
+		mMaterialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getPipelineStateWarmUpManager().addShaderCombination(mMaterialBlueprintResource.getAssetId(), shaderProperties);
+
 		// Done
-		// TODO(co) Mark material cache as dirty
-		return pipelineStateCache->getPipelineStateObjectPtr();
+		return pipelineStateCache->mPipelineStateObjectPtr.getPointer();
+	}
+
+	bool PipelineStateCacheManager::isPipelineStateCacheUsingFallback(PipelineStateSignatureId pipelineStateSignatureId)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		const PipelineStateCache* pipelineStateCache = findPipelineStateCache(pipelineStateSignatureId);
+		return (nullptr != pipelineStateCache && pipelineStateCache->isUsingFallback());
 	}
 
 	void PipelineStateCacheManager::clearCache()
 	{
-		for (auto& pipelineStateCacheElement : mPipelineStateCacheByPipelineStateSignatureId)
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		for (PipelineStateCacheSlot& pipelineStateCacheSlot : mPipelineStateCacheSlots)
+		{
+			delete pipelineStateCacheSlot.pipelineStateCache;
+			pipelineStateCacheSlot.pipelineStateCache = nullptr;
+		}
+		mNumberOfPipelineStateCaches = 0;
+		++mPipelineStateGeneration;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	PipelineStateCache* PipelineStateCacheManager::findPipelineStateCache(PipelineStateSignatureId pipelineStateSignatureId) const
+	{
+		if (!mPipelineStateCacheSlots.empty())
+		{
+			// The pipeline state signature ID is already a FNV-1a hash, so the lower bits can be used directly as slot index
+			const uint32_t slotMask = static_cast<uint32_t>(mPipelineStateCacheSlots.size()) - 1;
+			uint32_t slotIndex = pipelineStateSignatureId & slotMask;
+			while (nullptr != mPipelineStateCacheSlots[slotIndex].pipelineStateCache)
+			{
+				if (mPipelineStateCacheSlots[slotIndex].pipelineStateSignatureId == pipelineStateSignatureId)
+				{
+					return mPipelineStateCacheSlots[slotIndex].pipelineStateCache;
+				}
+				slotIndex = (slotIndex + 1) & slotMask;
+			}
+		}
+
+		// There's no such pipeline state cache
+		return nullptr;
+	}
+
+	void PipelineStateCacheManager::insertPipelineStateCache(PipelineStateCache& pipelineStateCache)
+	{
+		// Keep the load factor at or below 50% so probe sequences stay short, growing the hash table is rare and only happens when a new pipeline state cache is created
+		if ((mNumberOfPipelineStateCaches + 1) * 2 > mPipelineStateCacheSlots.size())
+		{
+			PipelineStateCacheSlots pipelineStateCacheSlots(std::max(static_cast<size_t>(::detail::MINIMUM_NUMBER_OF_PIPELINE_STATE_CACHE_SLOTS), mPipelineStateCacheSlots.size() * 2), PipelineStateCacheSlot{getUninitialized<PipelineStateSignatureId>(), nullptr});
+			std::swap(mPipelineStateCacheSlots, pipelineStateCacheSlots);
+			mNumberOfPipelineStateCaches = 0;
+			for (const PipelineStateCacheSlot& pipelineStateCacheSlot : pipelineStateCacheSlots)
+			{
+				if (nullptr != pipelineStateCacheSlot.pipelineStateCache)
+				{
+					insertPipelineStateCache(*pipelineStateCacheSlot.pipelineStateCache);
+				}
+			}
+		}
+
+		// Linear probing for a free slot
+		const PipelineStateSignatureId pipelineStateSignatureId = pipelineStateCache.getPipelineStateSignature().getPipelineStateSignatureId();
+		assert(nullptr == findPipelineStateCache(pipelineStateSignatureId));
+		const uint32_t slotMask = static_cast<uint32_t>(mPipelineStateCacheSlots.size()) - 1;
+		uint32_t slotIndex = pipelineStateSignatureId & slotMask;
+		while (nullptr != mPipelineStateCacheSlots[slotIndex].pipelineStateCache)
 		{
-			delete pipelineStateCacheElement.second;
+			slotIndex = (slotIndex + 1) & slotMask;
 		}
-		mPipelineStateCacheByPipelineStateSignatureId.clear();
+		mPipelineStateCacheSlots[slotIndex].pipelineStateSignatureId = pipelineStateSignatureId;
+		mPipelineStateCacheSlots[slotIndex].pipelineStateCache = &pipelineStateCache;
+		++mNumberOfPipelineStateCaches;
 	}
 
 
@@ -30,6 +30,7 @@
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCache.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "RendererRuntime/Core/Platform/PlatformManager.h"
+#include "RendererRuntime/Core/Time/TimeBudget.h"
 #include "RendererRuntime/IRendererRuntime.h"
 #include "RendererRuntime/Core/Math/Math.h"
 
@@ -103,6 +104,33 @@ namespace RendererRuntime
 		}
 	}
 
+	void PipelineStateCompiler::setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads)
+	{
+		if (mNumberOfBuilderThreads != numberOfBuilderThreads)
+		{
+			// Builder threads shutdown, the builder threads are waiting with a predicate so the flag must be set while holding the mutex
+			{
+				std::lock_guard<std::mutex> builderMutexLock(mBuilderMutex);
+				mShutdownBuilderThread = true;
+			}
+			mBuilderConditionVariable.notify_all();
+			for (std::thread& thread : mBuilderThreads)
+			{
+				thread.join();
+			}
+
+			// Create the builder threads building the shader source code, each builder thread works on its own shader combination
+			mNumberOfBuilderThreads = numberOfBuilderThreads;
+			mBuilderThreads.clear();
+			mBuilderThreads.reserve(mNumberOfBuilderThreads);
+			mShutdownBuilderThread = false;
+			for (uint32_t i = 0; i < mNumberOfBuilderThreads; ++i)
+			{
+				mBuilderThreads.push_back(std::thread(&PipelineStateCompiler::builderThreadWorker, this));
+			}
+		}
+	}
+
 	void PipelineStateCompiler::setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads)
 	{
 		if (mNumberOfCompilerThreads != numberOfCompilerThreads)
@@ -128,9 +156,14 @@ namespace RendererRuntime
 	}
 
 	void PipelineStateCompiler::dispatch()
+	{
+		TimeBudget timeBudget;
+		dispatch(timeBudget);
+	}
+
+	void PipelineStateCompiler::dispatch(TimeBudget& timeBudget)
 	{
 		// Synchronous dispatch
-		// TODO(co) Add maximum dispatch time budget
 		// TODO(co) More clever mutex usage in order to reduce pipeline state compiler stalls due to synchronization
 		std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
 		while (!mDispatchQueue.empty())
@@ -143,7 +176,21 @@ namespace RendererRuntime
 			PipelineStateCache& pipelineStateCache = compilerRequest.pipelineStateCache;
 			pipelineStateCache.mPipelineStateObjectPtr = compilerRequest.pipelineStateObject;
 			pipelineStateCache.mIsUsingFallback = false;
+
+			// Invalidate pipeline state objects cached by the users of the pipeline state cache manager, they might still reference the fallback
+			MaterialBlueprintResource* materialBlueprintResource = mRendererRuntime.getMaterialBlueprintResourceManager().getMaterialBlueprintResources().tryGetElementById(pipelineStateCache.getPipelineStateSignature().getMaterialBlueprintResourceId());
+			if (nullptr != materialBlueprintResource)
+			{
+				++materialBlueprintResource->getPipelineStateCacheManager().mPipelineStateGeneration;
+			}
+
+			// The fallback pipeline state object is still usable, so the rest can wait for the next frame if we're running out of time
+			if (timeBudget.isExhausted())
+			{
+				break;
+			}
 		}
+		timeBudget.setNumberOfDeferredWorkItems(static_cast<uint32_t>(mDispatchQueue.size()));
 	}
 
 
@@ -153,21 +200,20 @@ namespace RendererRuntime
 	PipelineStateCompiler::PipelineStateCompiler(IRendererRuntime& rendererRuntime) :
 		mRendererRuntime(rendererRuntime),
 		mAsynchronousCompilationEnabled(false),
+		mNumberOfBuilderThreads(0),
 		mNumberOfCompilerThreads(0),
 		mShutdownBuilderThread(false),
-		mBuilderThread(&PipelineStateCompiler::builderThreadWorker, this),
 		mShutdownCompilerThread(false)
 	{
 		// Create and start the threads
+		setNumberOfBuilderThreads(2);
 		setNumberOfCompilerThreads(2);
 	}
 
 	PipelineStateCompiler::~PipelineStateCompiler()
 	{
-		// Builder thread shutdown
-		mShutdownBuilderThread = true;
-		mBuilderConditionVariable.notify_one();
-		mBuilderThread.join();
+		// Builder threads shutdown
+		setNumberOfBuilderThreads(0);
 
 		// Compiler threads shutdown
 		setNumberOfCompilerThreads(0);
@@ -230,8 +276,9 @@ namespace RendererRuntime
 		while (!mShutdownBuilderThread)
 		{
 			// Continue as long as there's a compiler request left inside the queue, if it's empty go to sleep
+			// -> There are multiple builder threads, so don't go to sleep if there's still work left
 			std::unique_lock<std::mutex> builderMutexLock(mBuilderMutex);
-			mBuilderConditionVariable.wait(builderMutexLock);
+			mBuilderConditionVariable.wait(builderMutexLock, [this]() { return !mBuilderQueue.empty() || mShutdownBuilderThread; });
 			while (!mBuilderQueue.empty() && !mShutdownBuilderThread)
 			{
 				// Get the compiler request
@@ -253,48 +300,78 @@ namespace RendererRuntime
 							// Get the shader cache identifier, often but not always identical to the shader combination ID
 							const ShaderCacheId shaderCacheId = pipelineStateSignature.getShaderCombinationId(shaderType);
 
-							// Does the shader cache already exist?
+							// Does the shader cache already exist or is another builder thread already working on it?
 							ShaderCache* shaderCache = nullptr;
 							std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
-							ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
-							if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
-							{
-								shaderCache = shaderCacheIdIterator->second;
-							}
-							else
+							std::promise<ShaderCache*> shaderCachePromise;
+							if (!shaderCacheManager.findOrBeginShaderCache(shaderCacheId, shaderCacheManagerMutexLock, shaderCachePromise, shaderCache))
 							{
 								// Try to create the new program cache instance
 								const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResources.tryGetElementById(shaderBlueprintResourceId);
 								if (nullptr != shaderBlueprintResource)
 								{
-									// Build the shader source code
-									const std::string& sourceCode = shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResource, pipelineStateSignature.getShaderProperties());
-									if (sourceCode.empty())
-									{
-										// TODO(co) Error handling
-										assert(false);
-									}
-									else
+									// Try to use the persistent shader cache, on success there's no need to build the shader source code
+									const uint32_t shaderAssetsId = shaderCacheManager.calculateShaderAssetsId(*shaderBlueprintResource);
+									const ShaderSourceCodeId persistentShaderSourceCodeId = shaderCacheManager.getPersistentShaderSourceCodeId(shaderCacheId, shaderAssetsId);
+									if (isInitialized(persistentShaderSourceCodeId))
 									{
-										// Generate the shader source code ID
-										// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
-										// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
-										const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
-										ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-										if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend() && nullptr != shaderSourceCodeIdIterator->second->getShaderPtr().getPointer())
+										ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(persistentShaderSourceCodeId);
+										if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
 										{
-											// Reuse already existing shader instance
-											// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
+											// Reuse already existing shader instance, the shader cache master might not have finished processing yet
 											shaderCache = new ShaderCache(shaderCacheId, shaderSourceCodeIdIterator->second);
 											shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
 										}
 										else
 										{
-											// Create the new shader cache instance
-											shaderCache = new ShaderCache(shaderCacheId);
-											shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-											shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCache);
-											compilerRequest.shaderSourceCode[i] = sourceCode;
+											// Create the new shader cache instance, the shader is created by using the persistent shader bytecode
+											const std::vector<uint8_t>* shaderBytecode = shaderCacheManager.getPersistentShaderBytecode(persistentShaderSourceCodeId);
+											if (nullptr != shaderBytecode)
+											{
+												shaderCache = new ShaderCache(shaderCacheId);
+												shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+												shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(persistentShaderSourceCodeId, shaderCache);
+												compilerRequest.shaderBytecode[i] = *shaderBytecode;
+											}
+										}
+									}
+
+									// Build the shader source code, if required
+									// -> The shader source code is build without holding the shader cache manager mutex so the builder threads can work in parallel
+									if (nullptr == shaderCache)
+									{
+										shaderCacheManagerMutexLock.unlock();
+										const std::string& sourceCode = shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResource, pipelineStateSignature.getShaderProperties());
+										if (sourceCode.empty())
+										{
+											// TODO(co) Error handling
+											assert(false);
+											shaderCacheManagerMutexLock.lock();
+										}
+										else
+										{
+											// Generate the shader source code ID
+											// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
+											// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
+											const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
+											shaderCacheManagerMutexLock.lock();
+											ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
+											if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
+											{
+												// Reuse already existing shader instance, the shader cache master might not have finished processing yet
+												// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
+												shaderCache = new ShaderCache(shaderCacheId, shaderSourceCodeIdIterator->second);
+												shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+											}
+											else
+											{
+												// Create the new shader cache instance
+												shaderCache = new ShaderCache(shaderCacheId);
+												shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+												shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCache);
+												compilerRequest.shaderSourceCode[i] = sourceCode;
+											}
+											shaderCacheManager.addPersistentShaderCache(shaderCacheId, shaderSourceCodeId, shaderAssetsId);
 										}
 									}
 								}
@@ -303,6 +380,9 @@ namespace RendererRuntime
 									// TODO(co) Error handling
 									assert(false);
 								}
+
+								// Tell everyone waiting for the shader cache about the result
+								shaderCacheManager.endShaderCache(shaderCacheId, shaderCachePromise, shaderCache);
 							}
 							compilerRequest.shaderCache[i] = shaderCache;
 						}
@@ -328,6 +408,7 @@ namespace RendererRuntime
 		if (nullptr != shaderLanguage)
 		{
 			const MaterialBlueprintResources& materialBlueprintResources = mRendererRuntime.getMaterialBlueprintResourceManager().getMaterialBlueprintResources();
+			ShaderCacheManager& shaderCacheManager = mRendererRuntime.getShaderBlueprintResourceManager().getShaderCacheManager();
 			RENDERER_RUNTIME_SET_CURRENT_THREAD_DEBUG_NAME("PSC: Stage 2", "Renderer runtime: Pipeline state compiler stage: 2. Asynchronous shader compilation");
 			while (!mShutdownCompilerThread)
 			{
@@ -354,10 +435,20 @@ namespace RendererRuntime
 							{
 								// The shader instance is not ready, do we need to compile it right now or is this the job of a shader cache master?
 								const std::string& shaderSourceCode = compilerRequest.shaderSourceCode[i];
-								if (shaderSourceCode.empty())
+								const std::vector<uint8_t>& shaderBytecode = compilerRequest.shaderBytecode[i];
+								if (!shaderBytecode.empty())
 								{
-									// We're not aware of any shader source code but we need a shader cache, so, there must be a shader cache master we need to wait for
-									assert(nullptr != shaderCache->getMasterShaderCache());
+									// Create the shader instance by using the persistent shader bytecode
+									Renderer::IShader* shader = ShaderCacheManager::createShaderFromBytecode(*shaderLanguage, static_cast<ShaderType>(i), materialBlueprintResources.getElementById(compilerRequest.pipelineStateCache.getPipelineStateSignature().getMaterialBlueprintResourceId()).getVertexAttributes(), shaderBytecode);
+									assert(nullptr != shader);	// TODO(co) Error handling
+									RENDERER_SET_RESOURCE_DEBUG_NAME(shader, "Pipeline state compiler")
+									std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+									shaderCache->mShaderPtr = shaders[i] = shader;
+								}
+								else if (shaderSourceCode.empty())
+								{
+									// We're not aware of any shader source code but we need a shader cache, so, there must be a shader cache master or another
+									// compiler request which received the shader source code because its builder thread was the first one working on the shader cache
 									needToWaitForShaderCache = true;
 								}
 								else
@@ -389,7 +480,16 @@ namespace RendererRuntime
 									}
 									assert(nullptr != shader);	// TODO(co) Error handling
 									RENDERER_SET_RESOURCE_DEBUG_NAME(shader, "Pipeline state compiler")
+
+									// The shader bytecode of the new shader needs to be gathered by the persistent shader cache, renderer backends without shader bytecode have nothing to gather
+									uint32_t numberOfShaderBytecodeBytes = 0;
+									const bool hasShaderBytecode = (nullptr != shader && nullptr != shader->getShaderBytecode(numberOfShaderBytecodeBytes) && numberOfShaderBytecodeBytes > 0);
+									std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
 									shaderCache->mShaderPtr = shaders[i] = shader;
+									if (hasShaderBytecode)
+									{
+										shaderCacheManager.mCacheFile.addChange();
+									}
 								}
 							}
 						}
@@ -45,9 +45,10 @@ namespace
 		{
 			RendererRuntime::ShaderCombinationId shaderCombinationId(RendererRuntime::Math::FNV1a_INITIAL_HASH);
 
-			{ // Apply shader blueprint resource ID
-				const RendererRuntime::ShaderBlueprintResourceId shaderBlueprintResourceId = shaderBlueprintResource.getId();
-				shaderCombinationId = RendererRuntime::Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&shaderBlueprintResourceId), sizeof(uint32_t), shaderCombinationId);
+			{ // Apply shader blueprint asset ID
+				// -> Unlike the shader blueprint resource ID, the asset ID is identical across runs which is required by the persistent shader cache
+				const RendererRuntime::AssetId shaderBlueprintAssetId = shaderBlueprintResource.getAssetId();
+				shaderCombinationId = RendererRuntime::Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&shaderBlueprintAssetId), sizeof(uint32_t), shaderCombinationId);
 			}
 
 			// Apply shader properties
@@ -98,32 +99,49 @@ namespace RendererRuntime
 
 
 	//[-------------------------------------------------------]
-	//[ Public methods                                        ]
+	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
-	PipelineStateSignature::PipelineStateSignature(const MaterialBlueprintResource& materialBlueprintResource, const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES]) :
-		mMaterialBlueprintResourceId(materialBlueprintResource.getId()),
-		mShaderProperties(shaderProperties),
-		mPipelineStateSignatureId(Math::FNV1a_INITIAL_HASH),
-		mShaderCombinationId{getUninitialized<ShaderCombinationId>(), getUninitialized<ShaderCombinationId>(), getUninitialized<ShaderCombinationId>(), getUninitialized<ShaderCombinationId>(), getUninitialized<ShaderCombinationId>()}
+	PipelineStateSignatureId PipelineStateSignature::generatePipelineStateSignatureId(const MaterialBlueprintResource& materialBlueprintResource, const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES], ShaderCombinationId shaderCombinationId[NUMBER_OF_SHADER_TYPES])
 	{
-		// Before doing anything else: Copy the dynamic shader properties because they're an important part of the pipeline state signature
-		for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES; ++i)
-		{
-			mDynamicShaderPieces[i] = dynamicShaderPieces[i];
-		}
-
 		// TODO(co) We need to be DirectX 12 ready: Rasterizer state, depth stencil state and blend state are not considered yet. So, for now pipeline state cache = program cache.
-		mPipelineStateSignatureId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&mMaterialBlueprintResourceId), sizeof(uint32_t), mPipelineStateSignatureId);
+		const MaterialBlueprintResourceId materialBlueprintResourceId = materialBlueprintResource.getId();
+		PipelineStateSignatureId pipelineStateSignatureId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&materialBlueprintResourceId), sizeof(uint32_t), Math::FNV1a_INITIAL_HASH);
 		const ShaderBlueprintResources& shaderBlueprintResources = materialBlueprintResource.getResourceManager<MaterialBlueprintResourceManager>().getRendererRuntime().getShaderBlueprintResourceManager().getShaderBlueprintResources();
 		for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES; ++i)
 		{
 			const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResources.tryGetElementById(materialBlueprintResource.getShaderBlueprintResourceId(static_cast<ShaderType>(i)));
 			if (nullptr != shaderBlueprintResource)
 			{
-				const uint32_t hash = mShaderCombinationId[i] = ::detail::generateShaderCombinationId(*shaderBlueprintResource, mShaderProperties, mDynamicShaderPieces[i]);
-				mPipelineStateSignatureId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&hash), sizeof(uint32_t), mPipelineStateSignatureId);
+				const uint32_t hash = shaderCombinationId[i] = ::detail::generateShaderCombinationId(*shaderBlueprintResource, shaderProperties, dynamicShaderPieces[i]);
+				pipelineStateSignatureId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&hash), sizeof(uint32_t), pipelineStateSignatureId);
+			}
+			else
+			{
+				setUninitialized(shaderCombinationId[i]);
 			}
 		}
+
+		// Done
+		return pipelineStateSignatureId;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	PipelineStateSignature::PipelineStateSignature(const MaterialBlueprintResource& materialBlueprintResource, const ShaderProperties& shaderProperties, const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES]) :
+		mMaterialBlueprintResourceId(materialBlueprintResource.getId()),
+		mShaderProperties(shaderProperties),
+		mPipelineStateSignatureId(getUninitialized<PipelineStateSignatureId>())
+	{
+		// Copy the dynamic shader properties because they're an important part of the pipeline state signature
+		for (uint8_t i = 0; i < NUMBER_OF_SHADER_TYPES; ++i)
+		{
+			mDynamicShaderPieces[i] = dynamicShaderPieces[i];
+		}
+
+		// Generate the derived data
+		mPipelineStateSignatureId = generatePipelineStateSignatureId(materialBlueprintResource, mShaderProperties, mDynamicShaderPieces, mShaderCombinationId);
 	}
 
 	PipelineStateSignature::PipelineStateSignature(const PipelineStateSignature& pipelineStateSignature) :
@@ -0,0 +1,339 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/PrecompiledHeader.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateWarmUpManager.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateWarmUpFileFormat.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateSignature.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
+#include "RendererRuntime/Core/File/IFile.h"
+#include "RendererRuntime/Core/Math/Math.h"
+#include "RendererRuntime/IRendererRuntime.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void PipelineStateWarmUpManager::loadWarmUpListByFilename(const char* filename)
+	{
+		// Without warm-up list file there's nothing recorded yet, the material blueprints get loaded on demand as usual
+		IFile* file = mWarmUpListFile.openFile(filename);
+		if (nullptr != file)
+		{
+			loadWarmUpList(*file);
+			mWarmUpListFile.closeFile(*file);
+		}
+
+		// Gather the material blueprint asset IDs, loading a material blueprint might record new shader combinations
+		std::vector<AssetId> materialBlueprintAssetIds;
+		{
+			std::unique_lock<std::mutex> mutexLock(mMutex);
+			materialBlueprintAssetIds.reserve(mShaderCombinationsByMaterialBlueprintAssetId.size());
+			for (const auto& shaderCombinationsElement : mShaderCombinationsByMaterialBlueprintAssetId)
+			{
+				materialBlueprintAssetIds.push_back(shaderCombinationsElement.first);
+			}
+		}
+
+		// Load the material blueprints inside the warm-up list, this automatically warms them up
+		// -> Already loaded material blueprints must be warmed up explicitly
+		const MaterialBlueprintResources& materialBlueprintResources = mMaterialBlueprintResourceManager.getMaterialBlueprintResources();
+		for (AssetId materialBlueprintAssetId : materialBlueprintAssetIds)
+		{
+			bool alreadyLoaded = false;
+			const uint32_t numberOfElements = materialBlueprintResources.getNumberOfElements();
+			for (uint32_t i = 0; i < numberOfElements; ++i)
+			{
+				if (materialBlueprintResources.getElementByIndex(i).getAssetId() == materialBlueprintAssetId)
+				{
+					alreadyLoaded = true;
+					break;
+				}
+			}
+			const MaterialBlueprintResourceId materialBlueprintResourceId = mMaterialBlueprintResourceManager.loadMaterialBlueprintResourceByAssetId(materialBlueprintAssetId);
+			if (alreadyLoaded && isInitialized(materialBlueprintResourceId))
+			{
+				warmUpMaterialBlueprintResource(materialBlueprintResources.getElementById(materialBlueprintResourceId));
+			}
+		}
+	}
+
+	void PipelineStateWarmUpManager::saveDirtyWarmUpList()
+	{
+		IFile* file = mWarmUpListFile.createFileForWriteBack();
+		if (nullptr != file)
+		{
+			saveWarmUpList(*file);
+			mWarmUpListFile.closeFile(*file);
+		}
+	}
+
+	bool PipelineStateWarmUpManager::loadWarmUpList(IFile& file)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		mShaderCombinationsByMaterialBlueprintAssetId.clear();
+		mShaderCombinationIds.clear();
+
+		// Shader combinations are renderer independent, so there's nothing to check beside the file itself
+		v1PipelineStateWarmUp::Header header;
+		std::vector<uint8_t> payload;
+		if (!mWarmUpListFile.read(file, &header, sizeof(v1PipelineStateWarmUp::Header), payload))
+		{
+			return false;
+		}
+
+		// Material blueprints and their shader combinations
+		const uint8_t* currentPayload = payload.data();
+		const uint8_t* payloadEnd = currentPayload + payload.size();
+		ShaderProperties::SortedPropertyVector sortedPropertyVector;
+		for (uint32_t materialBlueprintIndex = 0; materialBlueprintIndex < header.numberOfMaterialBlueprints; ++materialBlueprintIndex)
+		{
+			v1PipelineStateWarmUp::MaterialBlueprintHeader materialBlueprintHeader;
+			if (static_cast<size_t>(payloadEnd - currentPayload) < sizeof(v1PipelineStateWarmUp::MaterialBlueprintHeader))
+			{
+				return false;
+			}
+			memcpy(&materialBlueprintHeader, currentPayload, sizeof(v1PipelineStateWarmUp::MaterialBlueprintHeader));
+			currentPayload += sizeof(v1PipelineStateWarmUp::MaterialBlueprintHeader);
+			for (uint32_t shaderCombinationIndex = 0; shaderCombinationIndex < materialBlueprintHeader.numberOfShaderCombinations; ++shaderCombinationIndex)
+			{
+				v1PipelineStateWarmUp::ShaderCombinationHeader shaderCombinationHeader;
+				if (static_cast<size_t>(payloadEnd - currentPayload) < sizeof(v1PipelineStateWarmUp::ShaderCombinationHeader))
+				{
+					return false;
+				}
+				memcpy(&shaderCombinationHeader, currentPayload, sizeof(v1PipelineStateWarmUp::ShaderCombinationHeader));
+				currentPayload += sizeof(v1PipelineStateWarmUp::ShaderCombinationHeader);
+				if (static_cast<uint64_t>(payloadEnd - currentPayload) < static_cast<uint64_t>(shaderCombinationHeader.numberOfShaderProperties) * sizeof(v1PipelineStateWarmUp::ShaderProperty))
+				{
+					return false;
+				}
+				sortedPropertyVector.resize(shaderCombinationHeader.numberOfShaderProperties);
+				for (ShaderProperties::Property& property : sortedPropertyVector)
+				{
+					v1PipelineStateWarmUp::ShaderProperty shaderProperty;
+					memcpy(&shaderProperty, currentPayload, sizeof(v1PipelineStateWarmUp::ShaderProperty));
+					currentPayload += sizeof(v1PipelineStateWarmUp::ShaderProperty);
+					property.shaderPropertyId = shaderProperty.shaderPropertyId;
+					property.value			  = shaderProperty.value;
+				}
+				insertShaderCombination(materialBlueprintHeader.materialBlueprintAssetId, sortedPropertyVector);
+			}
+		}
+		mWarmUpListFile.setInSync();
+
+		// Done
+		return true;
+	}
+
+	void PipelineStateWarmUpManager::saveWarmUpList(IFile& file)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+
+		// Material blueprints and their shader combinations
+		std::vector<uint8_t> payload;
+		for (const auto& shaderCombinationsElement : mShaderCombinationsByMaterialBlueprintAssetId)
+		{
+			const v1PipelineStateWarmUp::MaterialBlueprintHeader materialBlueprintHeader = { shaderCombinationsElement.first, static_cast<uint32_t>(shaderCombinationsElement.second.size()) };
+			const uint8_t* materialBlueprintHeaderBytes = reinterpret_cast<const uint8_t*>(&materialBlueprintHeader);
+			payload.insert(payload.end(), materialBlueprintHeaderBytes, materialBlueprintHeaderBytes + sizeof(v1PipelineStateWarmUp::MaterialBlueprintHeader));
+			for (const ShaderProperties::SortedPropertyVector& sortedPropertyVector : shaderCombinationsElement.second)
+			{
+				const v1PipelineStateWarmUp::ShaderCombinationHeader shaderCombinationHeader = { static_cast<uint32_t>(sortedPropertyVector.size()) };
+				const uint8_t* shaderCombinationHeaderBytes = reinterpret_cast<const uint8_t*>(&shaderCombinationHeader);
+				payload.insert(payload.end(), shaderCombinationHeaderBytes, shaderCombinationHeaderBytes + sizeof(v1PipelineStateWarmUp::ShaderCombinationHeader));
+				for (const ShaderProperties::Property& property : sortedPropertyVector)
+				{
+					const v1PipelineStateWarmUp::ShaderProperty shaderProperty = { property.shaderPropertyId, property.value };
+					const uint8_t* shaderPropertyBytes = reinterpret_cast<const uint8_t*>(&shaderProperty);
+					payload.insert(payload.end(), shaderPropertyBytes, shaderPropertyBytes + sizeof(v1PipelineStateWarmUp::ShaderProperty));
+				}
+			}
+		}
+
+		// Write down the header and the payload
+		const v1PipelineStateWarmUp::Header header = { static_cast<uint32_t>(mShaderCombinationsByMaterialBlueprintAssetId.size()) };
+		mWarmUpListFile.write(file, &header, sizeof(v1PipelineStateWarmUp::Header), payload);
+	}
+
+	void PipelineStateWarmUpManager::warmUpMaterialBlueprintResource(MaterialBlueprintResource& materialBlueprintResource)
+	{
+		// Material blueprint resource must be fully loaded, meaning also all referenced shader resources
+		assert(IResource::LoadingState::LOADED == materialBlueprintResource.getLoadingState());
+
+		// Get a copy of the recorded shader combinations, requesting pipeline state caches might record new shader combinations
+		ShaderCombinations shaderCombinations;
+		{
+			std::unique_lock<std::mutex> mutexLock(mMutex);
+			ShaderCombinationsByMaterialBlueprintAssetId::const_iterator iterator = mShaderCombinationsByMaterialBlueprintAssetId.find(materialBlueprintResource.getAssetId());
+			if (iterator != mShaderCombinationsByMaterialBlueprintAssetId.cend())
+			{
+				shaderCombinations = iterator->second;
+			}
+		}
+
+		// The shader combinations precompiled by the renderer toolkit come first, the recorded shader combinations add what the toolkit couldn't foresee
+		const MaterialBlueprintResource::ShaderCombinations& precompiledShaderCombinations = materialBlueprintResource.getPrecompiledShaderCombinations();
+		if (precompiledShaderCombinations.empty() && shaderCombinations.empty())
+		{
+			// Nothing to warm up
+			return;
+		}
+		PipelineStateSignatureIds pipelineStateSignatureIds;
+		requestShaderCombinations(materialBlueprintResource, precompiledShaderCombinations, pipelineStateSignatureIds);
+		requestShaderCombinations(materialBlueprintResource, shaderCombinations, pipelineStateSignatureIds);
+	}
+
+	uint32_t PipelineStateWarmUpManager::getNumberOfPendingWarmUpShaderCombinations()
+	{
+		// Remove all pipeline state caches which are no longer using fallback data
+		// -> Pipeline state caches which no longer exist (e.g. due to material blueprint reloading) are considered to be done as well
+		const MaterialBlueprintResources& materialBlueprintResources = mMaterialBlueprintResourceManager.getMaterialBlueprintResources();
+		PendingPipelineStateCaches::iterator iterator = mPendingPipelineStateCaches.begin();
+		while (iterator != mPendingPipelineStateCaches.end())
+		{
+			MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResources.tryGetElementById(iterator->first);
+			if (nullptr != materialBlueprintResource && materialBlueprintResource->getPipelineStateCacheManager().isPipelineStateCacheUsingFallback(iterator->second))
+			{
+				++iterator;
+			}
+			else
+			{
+				iterator = mPendingPipelineStateCaches.erase(iterator);
+			}
+		}
+
+		// Done
+		return static_cast<uint32_t>(mPendingPipelineStateCaches.size());
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	PipelineStateWarmUpManager::PipelineStateWarmUpManager(MaterialBlueprintResourceManager& materialBlueprintResourceManager) :
+		mMaterialBlueprintResourceManager(materialBlueprintResourceManager),
+		mWarmUpListFile(materialBlueprintResourceManager.getRendererRuntime().getFileManager(), v1PipelineStateWarmUp::FORMAT_TYPE, v1PipelineStateWarmUp::FORMAT_VERSION),
+		mNumberOfWarmUpShaderCombinations(0)
+	{
+		// Nothing here
+	}
+
+	PipelineStateWarmUpManager::~PipelineStateWarmUpManager()
+	{
+		saveDirtyWarmUpList();
+	}
+
+	void PipelineStateWarmUpManager::update()
+	{
+		// Entering a new area records a handful of new shader combinations across several frames, write them back together once recording pauses
+		if (mWarmUpListFile.isWriteBackDue())
+		{
+			saveDirtyWarmUpList();
+		}
+	}
+
+	void PipelineStateWarmUpManager::addShaderCombination(AssetId materialBlueprintAssetId, const ShaderProperties& shaderProperties)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		if (insertShaderCombination(materialBlueprintAssetId, shaderProperties.getSortedPropertyVector()))
+		{
+			mWarmUpListFile.addChange();
+		}
+	}
+
+	void PipelineStateWarmUpManager::requestShaderCombinations(MaterialBlueprintResource& materialBlueprintResource, const ShaderCombinations& shaderCombinations, PipelineStateSignatureIds& pipelineStateSignatureIds)
+	{
+		// TODO(co) Fill dynamic shader pieces
+		const DynamicShaderPieces dynamicShaderPieces[NUMBER_OF_SHADER_TYPES];
+
+		// Request the pipeline state caches
+		// -> Don't allow emergency synchronous compilation, if there's no fallback the empty shader combination is used in the worst case
+		const MaterialProperties& materialProperties = materialBlueprintResource.getMaterialProperties();
+		PipelineStateCacheManager& pipelineStateCacheManager = materialBlueprintResource.getPipelineStateCacheManager();
+		ShaderProperties shaderProperties;
+		for (const ShaderProperties::SortedPropertyVector& sortedPropertyVector : shaderCombinations)
+		{
+			// Ignore shader properties which are no longer shader combination properties of the material blueprint
+			shaderProperties.clear();
+			for (const ShaderProperties::Property& property : sortedPropertyVector)
+			{
+				// Shader property ID and material property ID are identical, so this is valid
+				const MaterialProperty* materialProperty = materialProperties.getPropertyById(property.shaderPropertyId);
+				if (nullptr != materialProperty && materialProperty->getUsage() == MaterialProperty::Usage::SHADER_COMBINATION)
+				{
+					shaderProperties.setPropertyValue(property.shaderPropertyId, property.value);
+				}
+			}
+
+			// Skip shader combinations which have already been requested by this warm-up
+			ShaderCombinationId shaderCombinationId[NUMBER_OF_SHADER_TYPES];
+			const PipelineStateSignatureId pipelineStateSignatureId = PipelineStateSignature::generatePipelineStateSignatureId(materialBlueprintResource, shaderProperties, dynamicShaderPieces, shaderCombinationId);
+			if (!pipelineStateSignatureIds.insert(pipelineStateSignatureId).second)
+			{
+				continue;
+			}
+
+			// Request the pipeline state cache and remember it in case the pipeline state compiler is working on it
+			pipelineStateCacheManager.getPipelineStateCacheByCombination(shaderProperties, dynamicShaderPieces, false);
+			mPendingPipelineStateCaches.emplace_back(materialBlueprintResource.getId(), pipelineStateSignatureId);
+			++mNumberOfWarmUpShaderCombinations;
+		}
+	}
+
+	bool PipelineStateWarmUpManager::insertShaderCombination(AssetId materialBlueprintAssetId, const ShaderProperties::SortedPropertyVector& sortedPropertyVector)
+	{
+		if (mShaderCombinationIds.insert(calculateShaderCombinationId(materialBlueprintAssetId, sortedPropertyVector)).second)
+		{
+			mShaderCombinationsByMaterialBlueprintAssetId[materialBlueprintAssetId].push_back(sortedPropertyVector);
+			return true;
+		}
+
+		// The shader combination is already known
+		return false;
+	}
+
+	uint32_t PipelineStateWarmUpManager::calculateShaderCombinationId(AssetId materialBlueprintAssetId, const ShaderProperties::SortedPropertyVector& sortedPropertyVector)
+	{
+		const uint32_t assetId = materialBlueprintAssetId;
+		uint32_t shaderCombinationId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&assetId), sizeof(uint32_t));
+		for (const ShaderProperties::Property& property : sortedPropertyVector)
+		{
+			shaderCombinationId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&property.shaderPropertyId), sizeof(uint32_t), shaderCombinationId);
+			shaderCombinationId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&property.value), sizeof(int32_t), shaderCombinationId);
+		}
+		return shaderCombinationId;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
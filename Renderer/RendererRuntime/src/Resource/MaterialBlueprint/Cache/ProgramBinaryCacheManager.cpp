@@ -0,0 +1,200 @@
+/*********************************************************\
+ * Copyright (c) 2012-2017 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererRuntime/PrecompiledHeader.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/ProgramBinaryCacheManager.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/Cache/ProgramBinaryCacheFileFormat.h"
+#include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
+#include "RendererRuntime/Core/File/IFile.h"
+#include "RendererRuntime/IRendererRuntime.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererRuntime
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void ProgramBinaryCacheManager::loadProgramBinaryCacheByFilename(const char* filename)
+	{
+		// Without program binary cache file the renderer links all programs from source code and hands over the program binaries afterwards
+		IFile* file = mProgramBinaryCacheFile.openFile(filename);
+		if (nullptr != file)
+		{
+			loadProgramBinaryCache(*file);
+			mProgramBinaryCacheFile.closeFile(*file);
+		}
+
+		// Set as renderer program binary cache, renderer backends without program binary support just ignore it
+		mMaterialBlueprintResourceManager.getRendererRuntime().getRenderer().setProgramBinaryCache(this);
+		mRegistered = true;
+	}
+
+	void ProgramBinaryCacheManager::saveDirtyProgramBinaryCache()
+	{
+		IFile* file = mProgramBinaryCacheFile.createFileForWriteBack();
+		if (nullptr != file)
+		{
+			saveProgramBinaryCache(*file);
+			mProgramBinaryCacheFile.closeFile(*file);
+		}
+	}
+
+	bool ProgramBinaryCacheManager::loadProgramBinaryCache(IFile& file)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		mProgramBinaries.clear();
+
+		// Program binaries of a different driver are just rejected by the renderer, so there's nothing to check beside the file itself
+		v1ProgramBinaryCache::Header header;
+		std::vector<uint8_t> payload;
+		if (!mProgramBinaryCacheFile.read(file, &header, sizeof(v1ProgramBinaryCache::Header), payload))
+		{
+			return false;
+		}
+
+		// Program binaries
+		const uint8_t* currentPayload = payload.data();
+		const uint8_t* payloadEnd = currentPayload + payload.size();
+		for (uint32_t programBinaryIndex = 0; programBinaryIndex < header.numberOfProgramBinaries; ++programBinaryIndex)
+		{
+			v1ProgramBinaryCache::ProgramBinaryHeader programBinaryHeader;
+			if (static_cast<size_t>(payloadEnd - currentPayload) < sizeof(v1ProgramBinaryCache::ProgramBinaryHeader))
+			{
+				mProgramBinaries.clear();
+				return false;
+			}
+			memcpy(&programBinaryHeader, currentPayload, sizeof(v1ProgramBinaryCache::ProgramBinaryHeader));
+			currentPayload += sizeof(v1ProgramBinaryCache::ProgramBinaryHeader);
+			if (static_cast<size_t>(payloadEnd - currentPayload) < programBinaryHeader.numberOfBytes)
+			{
+				mProgramBinaries.clear();
+				return false;
+			}
+			ProgramBinary& programBinary = mProgramBinaries[programBinaryHeader.programBinaryId];
+			programBinary.binaryFormat = programBinaryHeader.binaryFormat;
+			programBinary.binary.assign(currentPayload, currentPayload + programBinaryHeader.numberOfBytes);
+			currentPayload += programBinaryHeader.numberOfBytes;
+		}
+		mProgramBinaryCacheFile.setInSync();
+
+		// Done
+		return true;
+	}
+
+	void ProgramBinaryCacheManager::saveProgramBinaryCache(IFile& file)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+
+		// Program binaries
+		std::vector<uint8_t> payload;
+		for (const auto& programBinaryElement : mProgramBinaries)
+		{
+			const ProgramBinary& programBinary = programBinaryElement.second;
+			const v1ProgramBinaryCache::ProgramBinaryHeader programBinaryHeader = { programBinaryElement.first, programBinary.binaryFormat, static_cast<uint32_t>(programBinary.binary.size()) };
+			const uint8_t* programBinaryHeaderBytes = reinterpret_cast<const uint8_t*>(&programBinaryHeader);
+			payload.insert(payload.end(), programBinaryHeaderBytes, programBinaryHeaderBytes + sizeof(v1ProgramBinaryCache::ProgramBinaryHeader));
+			payload.insert(payload.end(), programBinary.binary.cbegin(), programBinary.binary.cend());
+		}
+
+		// Write down the header and the payload
+		const v1ProgramBinaryCache::Header header = { static_cast<uint32_t>(mProgramBinaries.size()) };
+		mProgramBinaryCacheFile.write(file, &header, sizeof(v1ProgramBinaryCache::Header), payload);
+	}
+
+	uint32_t ProgramBinaryCacheManager::getNumberOfProgramBinaries()
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		return static_cast<uint32_t>(mProgramBinaries.size());
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::IProgramBinaryCache methods  ]
+	//[-------------------------------------------------------]
+	const uint8_t* ProgramBinaryCacheManager::getProgramBinary(uint64_t programBinaryId, uint32_t& binaryFormat, uint32_t& numberOfBytes)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		ProgramBinaries::const_iterator iterator = mProgramBinaries.find(programBinaryId);
+		if (iterator != mProgramBinaries.cend() && !iterator->second.binary.empty())
+		{
+			// Unordered map elements don't move in memory, so the program binary stays valid until it's set again
+			binaryFormat  = iterator->second.binaryFormat;
+			numberOfBytes = static_cast<uint32_t>(iterator->second.binary.size());
+			return iterator->second.binary.data();
+		}
+
+		// There's no such program binary
+		return nullptr;
+	}
+
+	void ProgramBinaryCacheManager::setProgramBinary(uint64_t programBinaryId, uint32_t binaryFormat, const uint8_t* binary, uint32_t numberOfBytes)
+	{
+		assert(nullptr != binary);
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		ProgramBinary& programBinary = mProgramBinaries[programBinaryId];
+		programBinary.binaryFormat = binaryFormat;
+		programBinary.binary.assign(binary, binary + numberOfBytes);
+		mProgramBinaryCacheFile.addChange();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	ProgramBinaryCacheManager::ProgramBinaryCacheManager(MaterialBlueprintResourceManager& materialBlueprintResourceManager) :
+		mMaterialBlueprintResourceManager(materialBlueprintResourceManager),
+		mProgramBinaryCacheFile(materialBlueprintResourceManager.getRendererRuntime().getFileManager(), v1ProgramBinaryCache::FORMAT_TYPE, v1ProgramBinaryCache::FORMAT_VERSION),
+		mRegistered(false)
+	{
+		// Nothing here
+	}
+
+	ProgramBinaryCacheManager::~ProgramBinaryCacheManager()
+	{
+		// The renderer must not use the program binary cache after this point
+		if (mRegistered)
+		{
+			mMaterialBlueprintResourceManager.getRendererRuntime().getRenderer().setProgramBinaryCache(nullptr);
+		}
+		saveDirtyProgramBinaryCache();
+	}
+
+	void ProgramBinaryCacheManager::update()
+	{
+		// Program binaries can be multiple megabytes, don't write them back while the renderer is still busy linking programs
+		if (mProgramBinaryCacheFile.isWriteBackDue())
+		{
+			saveDirtyProgramBinaryCache();
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererRuntime
@@ -116,7 +116,6 @@ namespace RendererRuntime
 
 		// Get camera settings
 		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
-		const float fovY  = (nullptr != cameraSceneItem) ? cameraSceneItem->getFovY()  : CameraSceneItem::DEFAULT_FOV_Y;
 		mNearZ = (nullptr != cameraSceneItem) ? cameraSceneItem->getNearZ() : CameraSceneItem::DEFAULT_NEAR_Z;
 		mFarZ  = (nullptr != cameraSceneItem) ? cameraSceneItem->getFarZ()  : CameraSceneItem::DEFAULT_FAR_Z;
 
@@ -136,30 +135,10 @@ namespace RendererRuntime
 		}
 		else
 		{
-			// Get the aspect ratio
+			// Calculate the final matrices, the camera scene item is also used by "RendererRuntime::CompositorWorkspaceInstance" for culling
 			const float aspectRatio = static_cast<float>(mRenderTargetWidth) / mRenderTargetHeight;
-
-			// Calculate the view space to clip space matrix
-			// TODO(co) Just a test: Implement decent custom matrices
-			if (nullptr != cameraSceneItem->mViewSpaceToClipSpaceMatrix)
-			{
-				viewSpaceToClipSpaceMatrix = *cameraSceneItem->mViewSpaceToClipSpaceMatrix;
-			}
-			else
-			{
-				viewSpaceToClipSpaceMatrix = glm::perspective(fovY, aspectRatio, mNearZ, mFarZ);
-			}
-
-			// Calculate the final matrices
-			// TODO(co) Just a test: Implement decent custom matrices
-			if (nullptr != cameraSceneItem->mWorldSpaceToViewSpaceMatrix)
-			{
-				mPassData->worldSpaceToViewSpaceMatrix = *cameraSceneItem->mWorldSpaceToViewSpaceMatrix;
-			}
-			else
-			{
-				mPassData->worldSpaceToViewSpaceMatrix = glm::lookAt(worldSpaceToViewSpaceTransform.position, worldSpaceToViewSpaceTransform.position + worldSpaceToViewSpaceTransform.rotation * Math::FORWARD_VECTOR, Math::UP_VECTOR);
-			}
+			viewSpaceToClipSpaceMatrix = cameraSceneItem->getViewSpaceToClipSpaceMatrix(aspectRatio);
+			mPassData->worldSpaceToViewSpaceMatrix = cameraSceneItem->getWorldSpaceToViewSpaceMatrix();
 		}
 		mPassData->worldSpaceToViewSpaceQuaternion = glm::quat(mPassData->worldSpaceToViewSpaceMatrix);
 		mPassData->worldSpaceToClipSpaceMatrix = viewSpaceToClipSpaceMatrix * viewTranslateMatrix * mPassData->worldSpaceToViewSpaceMatrix;
@@ -346,7 +325,7 @@ namespace RendererRuntime
 			uint32_t* integerBuffer = reinterpret_cast<uint32_t*>(buffer);
 
 			// 0 = x = The instance texture buffer start index
-			integerBuffer[0] = 0;
+			integerBuffer[0] = mInstanceTextureBufferStartIndex;
 
 			// 1 = y = The assigned material slot inside the material uniform buffer
 			integerBuffer[1] = mMaterialTechnique->getAssignedMaterialSlot();
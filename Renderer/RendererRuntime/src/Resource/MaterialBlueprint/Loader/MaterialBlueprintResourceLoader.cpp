@@ -66,6 +66,7 @@ namespace RendererRuntime
 			ShaderProperties::SortedPropertyVector& sortedPropertyVector = const_cast<ShaderProperties::SortedPropertyVector&>(mMaterialBlueprintResource->mVisualImportanceOfShaderProperties.getSortedPropertyVector());
 			sortedPropertyVector.resize(materialBlueprintHeader.numberOfShaderCombinationProperties);
 			file.read(sortedPropertyVector.data(), sizeof(ShaderProperties::Property) * materialBlueprintHeader.numberOfShaderCombinationProperties);
+			mMaterialBlueprintResource->calculateFallbackChain();
 		}
 
 		{ // Read maximum integer value of shader properties
@@ -210,6 +211,29 @@ namespace RendererRuntime
 			// Allocate material blueprint resource textures
 			mMaterialBlueprintResource->mTextures.resize(materialBlueprintHeader.numberOfTextures);
 		}
+
+		{ // Read in the precompiled shader combinations
+			// Read in the number of shader properties per shader combination
+			std::vector<uint32_t> numberOfShaderProperties(materialBlueprintHeader.numberOfPrecompiledShaderCombinations);
+			file.read(numberOfShaderProperties.data(), sizeof(uint32_t) * materialBlueprintHeader.numberOfPrecompiledShaderCombinations);
+
+			// Read in the shader properties of all shader combinations
+			ShaderProperties::SortedPropertyVector sortedPropertyVector(materialBlueprintHeader.numberOfPrecompiledShaderCombinationProperties);
+			file.read(sortedPropertyVector.data(), sizeof(ShaderProperties::Property) * materialBlueprintHeader.numberOfPrecompiledShaderCombinationProperties);
+
+			// Split the shader properties into the shader combinations
+			MaterialBlueprintResource::ShaderCombinations& shaderCombinations = mMaterialBlueprintResource->mPrecompiledShaderCombinations;
+			shaderCombinations.clear();
+			shaderCombinations.reserve(materialBlueprintHeader.numberOfPrecompiledShaderCombinations);
+			ShaderProperties::SortedPropertyVector::const_iterator iterator = sortedPropertyVector.cbegin();
+			for (uint32_t currentNumberOfShaderProperties : numberOfShaderProperties)
+			{
+				// TODO(co) Error handling: Inconsistent number of shader properties
+				assert(static_cast<size_t>(sortedPropertyVector.cend() - iterator) >= currentNumberOfShaderProperties);
+				shaderCombinations.emplace_back(iterator, iterator + currentNumberOfShaderProperties);
+				iterator += currentNumberOfShaderProperties;
+			}
+		}
 	}
 
 	bool MaterialBlueprintResourceLoader::onDispatch()
@@ -32,6 +32,7 @@
 #include "RendererRuntime/Resource/Detail/ResourceStreamer.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -217,8 +218,10 @@ namespace RendererRuntime
 
 	void MaterialBlueprintResource::enforceFullyLoaded()
 	{
-		// TODO(co) Implement more efficient solution: We need to extend "Runtime::ResourceStreamer" to request emergency immediate processing of requested resources
+		// Promote the load request so it doesn't wait behind e.g. bulk prefetches
+		// TODO(co) Implement more efficient solution: Don't busy wait for the resource streamer
 		ResourceStreamer& resourceStreamer = getResourceManager<MaterialBlueprintResourceManager>().getRendererRuntime().getResourceStreamer();
+		resourceStreamer.setLoadPriority(*this, ResourceStreamer::LoadPriority::EMERGENCY);
 		while (LoadingState::LOADED != getLoadingState())
 		{
 			using namespace std::chrono_literals;
@@ -336,8 +339,10 @@ namespace RendererRuntime
 				}
 
 				// Create the current pipeline state cache instances for the material blueprint
-				const Renderer::IPipelineStatePtr pipelineStatePtr = mPipelineStateCacheManager.getPipelineStateCacheByCombination(shaderProperties, dynamicShaderPieces, true);
-				assert(nullptr != pipelineStatePtr);	// TODO(co) Decent error handling
+				if (nullptr == mPipelineStateCacheManager.getPipelineStateCacheByCombination(shaderProperties, dynamicShaderPieces, true))
+				{
+					assert(false);	// TODO(co) Decent error handling
+				}
 			}
 			while (shaderCombinationIterator.iterate());
 		}
@@ -360,6 +365,7 @@ namespace RendererRuntime
 		mMaterialBufferManager(nullptr)
 	{
 		memset(mShaderBlueprintResourceId, static_cast<int>(getUninitialized<ShaderBlueprintResourceId>()), sizeof(ShaderBlueprintResourceId) * NUMBER_OF_SHADER_TYPES);
+		mPrecompiledShaderCombinations.clear();
 	}
 
 	MaterialBlueprintResource::~MaterialBlueprintResource()
@@ -413,6 +419,31 @@ namespace RendererRuntime
 		IResource::deinitializeElement();
 	}
 
+	void MaterialBlueprintResource::calculateFallbackChain()
+	{
+		// Gather the non-mandatory shader properties, the visual importance shader properties are already sorted by ascending shader property ID
+		ShaderProperties::SortedPropertyVector sortedPropertyVector;
+		for (const ShaderProperties::Property& property : mVisualImportanceOfShaderProperties.getSortedPropertyVector())
+		{
+			if (MANDATORY_SHADER_PROPERTY != property.value)
+			{
+				sortedPropertyVector.push_back(property);
+			}
+		}
+
+		// Lower visual importance value = lower probability that someone will miss the shader property, so sacrifice it first
+		// -> Stable sort to keep ascending shader property ID order for shader properties with the same visual importance
+		std::stable_sort(sortedPropertyVector.begin(), sortedPropertyVector.end(), [](const ShaderProperties::Property& left, const ShaderProperties::Property& right) { return (left.value < right.value); });
+
+		// Store the fallback chain
+		mFallbackChain.clear();
+		mFallbackChain.reserve(sortedPropertyVector.size());
+		for (const ShaderProperties::Property& property : sortedPropertyVector)
+		{
+			mFallbackChain.push_back(property.shaderPropertyId);
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -33,6 +33,11 @@
 #include "RendererRuntime/IRendererRuntime.h"
 
 
+// Disable warnings
+// TODO(co) See "RendererRuntime::MaterialBlueprintResourceManager::MaterialBlueprintResourceManager()": How the heck should we avoid such a situation without using complicated solutions like a pointer to an instance? (= more individual allocations/deallocations)
+PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -200,6 +205,9 @@ namespace RendererRuntime
 				}
 
 				materialBlueprintResource->createPipelineStateCaches(true);
+
+				// Request the shader combinations precompiled by the renderer toolkit and recorded during previous runs, so they're compiled before they're needed
+				mPipelineStateWarmUpManager.warmUpMaterialBlueprintResource(*materialBlueprintResource);
 			}
 
 			// Done
@@ -253,7 +261,8 @@ namespace RendererRuntime
 
 	void MaterialBlueprintResourceManager::update()
 	{
-		// TODO(co) Implement me
+		mPipelineStateWarmUpManager.update();
+		mProgramBinaryCacheManager.update();
 	}
 
 
@@ -264,7 +273,9 @@ namespace RendererRuntime
 		mRendererRuntime(rendererRuntime),
 		mMaterialBlueprintResourceListener(&::detail::defaultMaterialBlueprintResourceListener),
 		mInstanceBufferManager(nullptr),
-		mLightBufferManager(nullptr)
+		mLightBufferManager(nullptr),
+		mPipelineStateWarmUpManager(*this),
+		mProgramBinaryCacheManager(*this)
 	{
 		const Renderer::Capabilities& capabilities = rendererRuntime.getRenderer().getCapabilities();
 		if (capabilities.maximumUniformBufferSize > 0 && capabilities.maximumTextureBufferSize > 0)
@@ -55,30 +55,42 @@ namespace RendererRuntime
 		file.read(&meshHeader, sizeof(v1Mesh::Header));
 		mMeshResource->mNumberOfVertices = meshHeader.numberOfVertices;
 		mMeshResource->mNumberOfIndices  = meshHeader.numberOfIndices;
+		mMeshResource->setBoundingBoxPosition(glm::make_vec3(meshHeader.minimumBoundingBoxPosition), glm::make_vec3(meshHeader.maximumBoundingBoxPosition));
+		mMeshResource->setBoundingSpherePositionRadius(glm::make_vec3(meshHeader.boundingSpherePosition), meshHeader.boundingSphereRadius);
 
-		// Allocate memory for the local vertex buffer data
+		// Read in the vertex buffer, the renderer can upload directly from a view of the file so there's no need to copy the data
 		mNumberOfUsedVertexBufferDataBytes = meshHeader.numberOfBytesPerVertex * mMeshResource->mNumberOfVertices;
-		if (mNumberOfVertexBufferDataBytes < mNumberOfUsedVertexBufferDataBytes)
+		mUsedVertexBufferData = file.readView(mNumberOfUsedVertexBufferDataBytes);
+		if (nullptr == mUsedVertexBufferData)
 		{
-			mNumberOfVertexBufferDataBytes = mNumberOfUsedVertexBufferDataBytes;
-			delete [] mVertexBufferData;
-			mVertexBufferData = new uint8_t[mNumberOfVertexBufferDataBytes];
+			// Allocate memory for the local vertex buffer data
+			if (mNumberOfVertexBufferDataBytes < mNumberOfUsedVertexBufferDataBytes)
+			{
+				mNumberOfVertexBufferDataBytes = mNumberOfUsedVertexBufferDataBytes;
+				delete [] mVertexBufferData;
+				mVertexBufferData = new uint8_t[mNumberOfVertexBufferDataBytes];
+			}
+			file.read(mVertexBufferData, mNumberOfUsedVertexBufferDataBytes);
+			mUsedVertexBufferData = mVertexBufferData;
 		}
 
-		// Allocate memory for the local index buffer data
+		// Read in the index buffer
 		mIndexBufferFormat = meshHeader.indexBufferFormat;
 		mNumberOfUsedIndexBufferDataBytes = Renderer::IndexBufferFormat::getNumberOfBytesPerElement(static_cast<Renderer::IndexBufferFormat::Enum>(mIndexBufferFormat)) * mMeshResource->mNumberOfIndices;
-		if (mNumberOfIndexBufferDataBytes < mNumberOfUsedIndexBufferDataBytes)
+		mUsedIndexBufferData = file.readView(mNumberOfUsedIndexBufferDataBytes);
+		if (nullptr == mUsedIndexBufferData)
 		{
-			mNumberOfIndexBufferDataBytes = mNumberOfUsedIndexBufferDataBytes;
-			delete [] mIndexBufferData;
-			mIndexBufferData = new uint8_t[mNumberOfIndexBufferDataBytes];
+			// Allocate memory for the local index buffer data
+			if (mNumberOfIndexBufferDataBytes < mNumberOfUsedIndexBufferDataBytes)
+			{
+				mNumberOfIndexBufferDataBytes = mNumberOfUsedIndexBufferDataBytes;
+				delete [] mIndexBufferData;
+				mIndexBufferData = new uint8_t[mNumberOfIndexBufferDataBytes];
+			}
+			file.read(mIndexBufferData, mNumberOfUsedIndexBufferDataBytes);
+			mUsedIndexBufferData = mIndexBufferData;
 		}
 
-		// Read in the vertex and index buffer
-		file.read(mVertexBufferData, mNumberOfUsedVertexBufferDataBytes);
-		file.read(mIndexBufferData, mNumberOfUsedIndexBufferDataBytes);
-
 		// Read in the vertex attributes
 		mNumberOfUsedVertexAttributes = meshHeader.numberOfVertexAttributes;
 		if (mNumberOfVertexAttributes < mNumberOfUsedVertexAttributes)
@@ -108,8 +120,9 @@ namespace RendererRuntime
 
 	bool MeshResourceLoader::onDispatch()
 	{
-		// Create vertex array object (VAO)
+		// Create vertex array object (VAO), an asynchronously created one is owned by the mesh resource from now on
 		mMeshResource->mVertexArray = mRendererRuntime.getRenderer().getCapabilities().nativeMultiThreading ? mVertexArray : createVertexArray();
+		mVertexArray = nullptr;
 
 		{ // Create sub-meshes
 			MaterialResourceManager& materialResourceManager = mRendererRuntime.getMaterialResourceManager();
@@ -126,6 +139,10 @@ namespace RendererRuntime
 				subMesh.mPrimitiveTopology  = static_cast<Renderer::PrimitiveTopology>(v1SubMesh.primitiveTopology);
 				subMesh.mStartIndexLocation = v1SubMesh.startIndexLocation;
 				subMesh.mNumberOfIndices	= v1SubMesh.numberOfIndices;
+				subMesh.mMinimumBoundingBoxPosition = glm::make_vec3(v1SubMesh.minimumBoundingBoxPosition);
+				subMesh.mMaximumBoundingBoxPosition = glm::make_vec3(v1SubMesh.maximumBoundingBoxPosition);
+				subMesh.mBoundingSpherePosition		= glm::make_vec3(v1SubMesh.boundingSpherePosition);
+				subMesh.mBoundingSphereRadius		= v1SubMesh.boundingSphereRadius;
 
 				// Sanity check
 				assert(isInitialized(subMesh.mMaterialResourceId));
@@ -155,6 +172,16 @@ namespace RendererRuntime
 		return true;
 	}
 
+	void MeshResourceLoader::onCancellation()
+	{
+		// Destroy the asynchronously created vertex array object (VAO), if there's one
+		if (nullptr != mVertexArray)
+		{
+			mVertexArray->releaseReference();
+			mVertexArray = nullptr;
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -168,9 +195,11 @@ namespace RendererRuntime
 		mNumberOfVertexBufferDataBytes(0),
 		mNumberOfUsedVertexBufferDataBytes(0),
 		mVertexBufferData(nullptr),
+		mUsedVertexBufferData(nullptr),
 		mNumberOfIndexBufferDataBytes(0),
 		mNumberOfUsedIndexBufferDataBytes(0),
 		mIndexBufferData(nullptr),
+		mUsedIndexBufferData(nullptr),
 		mIndexBufferFormat(0),
 		mNumberOfVertexAttributes(0),
 		mNumberOfUsedVertexAttributes(0),
@@ -193,11 +222,11 @@ namespace RendererRuntime
 	Renderer::IVertexArray* MeshResourceLoader::createVertexArray() const
 	{
 		// Create the vertex buffer object (VBO)
-		Renderer::IVertexBufferPtr vertexBuffer(mBufferManager.createVertexBuffer(mNumberOfUsedVertexBufferDataBytes, mVertexBufferData, Renderer::BufferUsage::STATIC_DRAW));
+		Renderer::IVertexBufferPtr vertexBuffer(mBufferManager.createVertexBuffer(mNumberOfUsedVertexBufferDataBytes, mUsedVertexBufferData, Renderer::BufferUsage::STATIC_DRAW));
 		RENDERER_SET_RESOURCE_DEBUG_NAME(vertexBuffer, getAsset().assetFilename)
 
 		// Create the index buffer object (IBO)
-		Renderer::IIndexBuffer *indexBuffer = mBufferManager.createIndexBuffer(mNumberOfUsedIndexBufferDataBytes, static_cast<Renderer::IndexBufferFormat::Enum>(mIndexBufferFormat), mIndexBufferData, Renderer::BufferUsage::STATIC_DRAW);
+		Renderer::IIndexBuffer *indexBuffer = mBufferManager.createIndexBuffer(mNumberOfUsedIndexBufferDataBytes, static_cast<Renderer::IndexBufferFormat::Enum>(mIndexBufferFormat), mUsedIndexBufferData, Renderer::BufferUsage::STATIC_DRAW);
 		RENDERER_SET_RESOURCE_DEBUG_NAME(indexBuffer, getAsset().assetFilename)
 
 		// Create vertex array object (VAO)
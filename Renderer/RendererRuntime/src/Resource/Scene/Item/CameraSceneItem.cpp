@@ -24,6 +24,15 @@
 #include "RendererRuntime/PrecompiledHeader.h"
 #include "RendererRuntime/Resource/Scene/Item/CameraSceneItem.h"
 #include "RendererRuntime/Resource/Scene/Loader/SceneFileFormat.h"
+#include "RendererRuntime/Resource/Scene/Node/ISceneNode.h"
+#include "RendererRuntime/Core/Math/Transform.h"
+#include "RendererRuntime/Core/Math/Math.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/gtc/matrix_transform.hpp>
+PRAGMA_WARNING_POP
 
 #include <cassert>
 
@@ -44,6 +53,28 @@ namespace RendererRuntime
 	const float CameraSceneItem::DEFAULT_FAR_Z  = 1000.0f;
 
 
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	glm::mat4 CameraSceneItem::getWorldSpaceToViewSpaceMatrix() const
+	{
+		// TODO(co) Just a test: Implement decent custom matrices
+		if (nullptr != mWorldSpaceToViewSpaceMatrix)
+		{
+			return *mWorldSpaceToViewSpaceMatrix;
+		}
+		const ISceneNode* sceneNode = getParentSceneNode();
+		const Transform& transform = (nullptr != sceneNode) ? sceneNode->getTransform() : Transform::IDENTITY;
+		return glm::lookAt(transform.position, transform.position + transform.rotation * Math::FORWARD_VECTOR, Math::UP_VECTOR);
+	}
+
+	glm::mat4 CameraSceneItem::getViewSpaceToClipSpaceMatrix(float aspectRatio) const
+	{
+		// TODO(co) Just a test: Implement decent custom matrices
+		return (nullptr != mViewSpaceToClipSpaceMatrix) ? *mViewSpaceToClipSpaceMatrix : glm::perspective(mFovY, aspectRatio, mNearZ, mFarZ);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public RendererRuntime::ISceneItem methods            ]
 	//[-------------------------------------------------------]
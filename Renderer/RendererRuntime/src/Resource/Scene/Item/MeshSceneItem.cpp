@@ -133,6 +133,10 @@ namespace RendererRuntime
 					// Get vertex array instance
 					const Renderer::IVertexArrayPtr vertexArrayPtr = meshResource->getVertexArrayPtr();
 
+					// Set the object space bounding volumes, used for culling
+					mRenderableManager.setBoundingBoxPosition(meshResource->getMinimumBoundingBoxPosition(), meshResource->getMaximumBoundingBoxPosition());
+					mRenderableManager.setBoundingSpherePositionRadius(meshResource->getBoundingSpherePosition(), meshResource->getBoundingSphereRadius());
+
 					// Set material resource ID of each sub-mesh
 					MaterialResourceManager& materialResourceManager = rendererRuntime.getMaterialResourceManager();
 					const SubMeshes& subMeshes = static_cast<const MeshResource&>(resource).getSubMeshes();
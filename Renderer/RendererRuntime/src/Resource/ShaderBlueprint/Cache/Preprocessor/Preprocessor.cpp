@@ -26,7 +26,139 @@
 #define MOJOSHADER_NO_VERSION_INCLUDE
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/Preprocessor/mojoshader.h"
 
+#include <mutex>
+#include <vector>
+#include <cstdlib>	// For "malloc()" and "free()"
 #include <cstring>	// For "strlen()"
+#include <algorithm>
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static const size_t ARENA_CHUNK_NUMBER_OF_BYTES			 = 256 * 1024;			///< Most shaders are preprocessed using a single arena chunk
+		static const size_t MAXIMUM_CACHE_NUMBER_OF_BYTES		 = 16 * 1024 * 1024;	///< The preprocessed source code cache is flushed as soon as it would become larger than this
+		typedef std::unordered_map<std::string, std::string> PreprocessedSourceCodeBySourceCode;	///< Key = source code before preprocessing, hashed by content
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Memory arena used by MojoShader for all of its internal allocations
+		*
+		*  @remarks
+		*    MojoShader performs hundreds of tiny allocations per preprocessed shader (tokens, macro tables, output buffer blocks etc.). Using a
+		*    per-thread arena, freeing becomes a no-op and all memory is released at once after the preprocessing. The chunks are kept, so
+		*    compilations in the same thread reuse the memory of the previous ones.
+		*/
+		class PreprocessorArena
+		{
+		public:
+			PreprocessorArena() :
+				mCurrentChunkIndex(0),
+				mCurrentChunkOffset(0)
+			{
+				// Nothing here
+			}
+
+			~PreprocessorArena()
+			{
+				for (Chunk& chunk : mChunks)
+				{
+					free(chunk.memory);
+				}
+			}
+
+			void* allocate(size_t numberOfBytes)
+			{
+				// Keep the alignment malloc would provide
+				numberOfBytes = (numberOfBytes + 15) & ~static_cast<size_t>(15);
+
+				// Use the remaining memory of the current chunk or one of the following already allocated chunks
+				while (mCurrentChunkIndex < mChunks.size())
+				{
+					Chunk& chunk = mChunks[mCurrentChunkIndex];
+					if (mCurrentChunkOffset + numberOfBytes <= chunk.numberOfBytes)
+					{
+						uint8_t* memory = chunk.memory + mCurrentChunkOffset;
+						mCurrentChunkOffset += numberOfBytes;
+						return memory;
+					}
+					++mCurrentChunkIndex;
+					mCurrentChunkOffset = 0;
+				}
+
+				// Allocate a new chunk, oversized allocations get a chunk of their own
+				const Chunk chunk = { static_cast<uint8_t*>(malloc(std::max(numberOfBytes, ARENA_CHUNK_NUMBER_OF_BYTES))), std::max(numberOfBytes, ARENA_CHUNK_NUMBER_OF_BYTES) };
+				if (nullptr == chunk.memory)
+				{
+					// MojoShader is handling out-of-memory situations
+					return nullptr;
+				}
+				mChunks.push_back(chunk);
+				mCurrentChunkIndex = mChunks.size() - 1;
+				mCurrentChunkOffset = numberOfBytes;
+				return chunk.memory;
+			}
+
+			void reset()
+			{
+				mCurrentChunkIndex = 0;
+				mCurrentChunkOffset = 0;
+			}
+
+		private:
+			struct Chunk
+			{
+				uint8_t* memory;
+				size_t	 numberOfBytes;
+			};
+			std::vector<Chunk> mChunks;
+			size_t			   mCurrentChunkIndex;
+			size_t			   mCurrentChunkOffset;
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		thread_local PreprocessorArena		g_PreprocessorArena;				///< Each thread calling the preprocessor has its own arena, so no synchronization is required
+		std::mutex							g_PreprocessedSourceCodeMutex;		///< Mutex guarding the preprocessed source code cache, never locked while preprocessing
+		PreprocessedSourceCodeBySourceCode	g_PreprocessedSourceCodeBySourceCode;
+		size_t								g_PreprocessedSourceCodeNumberOfBytes = 0;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void* preprocessorMalloc(int bytes, void* data)
+		{
+			return static_cast<PreprocessorArena*>(data)->allocate(static_cast<size_t>(bytes));
+		}
+
+		void preprocessorFree(void*, void*)
+		{
+			// Nothing here, the memory arena is reset as a whole
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -43,8 +175,19 @@ namespace RendererRuntime
 	{
 		// TODO(co) The usage of MojoShader just as preprocessor is overkill. Find a simpler but still efficient solution.
 
-		// Preprocess
-		const MOJOSHADER_preprocessData* preprocessData = MOJOSHADER_preprocess(nullptr, source.c_str(), static_cast<unsigned int>(source.length()), 0, 0, 0, 0, 0, 0, 0, 0, 0);
+		{ // Different shader combinations can result in one and the same source code, don't preprocess it twice
+			std::lock_guard<std::mutex> mutexLock(::detail::g_PreprocessedSourceCodeMutex);
+			::detail::PreprocessedSourceCodeBySourceCode::const_iterator iterator = ::detail::g_PreprocessedSourceCodeBySourceCode.find(source);
+			if (iterator != ::detail::g_PreprocessedSourceCodeBySourceCode.cend())
+			{
+				result = iterator->second;
+				return;
+			}
+		}
+
+		// Preprocess, this is done without holding the mutex
+		::detail::PreprocessorArena& preprocessorArena = ::detail::g_PreprocessorArena;
+		const MOJOSHADER_preprocessData* preprocessData = MOJOSHADER_preprocess(nullptr, source.c_str(), static_cast<unsigned int>(source.length()), 0, 0, 0, 0, 0, 0, &::detail::preprocessorMalloc, &::detail::preprocessorFree, &preprocessorArena);
 
 		// Evaluate the result
 		if (preprocessData->error_count > 0)
@@ -60,8 +203,22 @@ namespace RendererRuntime
 		else
 		{
 			result.assign(preprocessData->output, static_cast<size_t>(preprocessData->output_len));
+
+			// Remember the preprocessed source code, flush the cache instead of letting it grow without limits
+			std::lock_guard<std::mutex> mutexLock(::detail::g_PreprocessedSourceCodeMutex);
+			const size_t numberOfBytes = source.length() + result.length();
+			if (::detail::g_PreprocessedSourceCodeNumberOfBytes + numberOfBytes > ::detail::MAXIMUM_CACHE_NUMBER_OF_BYTES)
+			{
+				::detail::g_PreprocessedSourceCodeBySourceCode.clear();
+				::detail::g_PreprocessedSourceCodeNumberOfBytes = 0;
+			}
+			if (::detail::g_PreprocessedSourceCodeBySourceCode.emplace(source, result).second)
+			{
+				::detail::g_PreprocessedSourceCodeNumberOfBytes += numberOfBytes;
+			}
 		}
 		MOJOSHADER_freePreprocessData(preprocessData);
+		preprocessorArena.reset();
 	}
 
 
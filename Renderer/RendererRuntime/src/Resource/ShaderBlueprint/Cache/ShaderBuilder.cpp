@@ -527,12 +527,11 @@ namespace
 			return retVal;
 		}
 
-		bool evaluateExpression(const RendererRuntime::ShaderProperties& shaderProperties, SubStringRef& outSubString, bool& outSyntaxError)
+		bool parseExpression(SubStringRef& outSubString, ExpressionVec& outExpressions, bool& outSyntaxError)
 		{
 			const size_t expEnd = evaluateExpressionEnd(outSubString);
 			if (std::string::npos == expEnd)
 			{
-				outSyntaxError = true;
 				return false;
 			}
 
@@ -545,7 +544,6 @@ namespace
 			bool nextExpressionNegates = false;
 
 			std::vector<Expression*> expressionParents;
-			ExpressionVec outExpressions;
 			outExpressions.clear();
 			outExpressions.resize(1);
 
@@ -620,12 +618,29 @@ namespace
 				++it;
 			}
 
-			bool retVal = false;
-
 			if (!expressionParents.empty())
 			{
 				syntaxError = true;
 			}
+
+			outSyntaxError = syntaxError;
+
+			return true;
+		}
+
+		bool evaluateExpression(const RendererRuntime::ShaderProperties& shaderProperties, SubStringRef& outSubString, bool& outSyntaxError)
+		{
+			const SubStringRef subString = outSubString;
+			ExpressionVec outExpressions;
+			bool syntaxError = false;
+			if (!parseExpression(outSubString, outExpressions, syntaxError))
+			{
+				outSyntaxError = true;
+				return false;
+			}
+
+			bool retVal = false;
+
 			if (!syntaxError)
 			{
 				retVal = evaluateExpressionRecursive(shaderProperties, outExpressions, syntaxError);
@@ -747,6 +762,181 @@ namespace
 			}
 		}
 
+		//[-------------------------------------------------------]
+		//[ Shader template                                       ]
+		//[-------------------------------------------------------]
+		static const uint32_t MAXIMUM_PIECE_INSERTION_DEPTH = 64;	///< Parsing the source code would never finish when a piece is inserting itself
+
+		bool startsWith(const char* string, const char* prefix)
+		{
+			return (0 == strncmp(string, prefix, strlen(prefix)));
+		}
+
+		size_t findOperation(const std::string& buffer, size_t position, const Operation* operations, size_t numberOfOperations, size_t& keywordEnd)
+		{
+			// Same keyword matching as done by parsing the source code, "keywordEnd" receives the position of the character after the keyword
+			keywordEnd = buffer.find_first_of(" \t(", position + 1);
+			keywordEnd = (std::string::npos == keywordEnd) ? buffer.size() : keywordEnd;
+			const SubStringRef keywordStr(&buffer, position + 1, keywordEnd);
+			for (size_t i = 0; i < numberOfOperations; ++i)
+			{
+				if (keywordStr.matchEqual(operations[i].opName))
+				{
+					return i;
+				}
+			}
+			return static_cast<size_t>(~0);
+		}
+
+		bool isOperationDirective(const std::string& buffer, size_t position, const Operation& operation, size_t keywordEnd)
+		{
+			// "RendererRuntime::detail::SubStringRef::matchEqual()" also accepts a keyword which is just the start of the operation name, and the arguments are
+			// expected to start right after the full operation name: Only the exact operation name directly followed by "(" can be mapped onto a shader template
+			return (keywordEnd - position == operation.length - 1 && keywordEnd < buffer.size() && '(' == buffer[keywordEnd]);
+		}
+
+		RendererRuntime::ShaderTemplate::Operand getOperand(const std::string& argument)
+		{
+			RendererRuntime::ShaderTemplate::Operand operand;
+			char* endPtr = nullptr;
+			operand.number = static_cast<int32_t>(strtol(argument.c_str(), &endPtr, 10));
+			operand.isProperty = (argument.c_str() == endPtr);
+			if (operand.isProperty)
+			{
+				// Not a number, interpret as property
+				operand.propertyId = RendererRuntime::StringId(argument.c_str());
+			}
+			return operand;
+		}
+
+		int32_t getOperandValue(const RendererRuntime::ShaderProperties& shaderProperties, const RendererRuntime::ShaderTemplate::Operand& operand)
+		{
+			return operand.isProperty ? shaderProperties.getPropertyValueUnsafe(operand.propertyId) : operand.number;
+		}
+
+		RendererRuntime::ShaderTemplate::Operation getOperation(const StringVector& argValues, size_t operationIndex)
+		{
+			RendererRuntime::ShaderTemplate::Operation operation;
+			operation.operationIndex = static_cast<uint8_t>(operationIndex);
+			operation.destinationPropertyId = RendererRuntime::StringId(argValues[0].c_str());
+			operation.sourcePropertyId = operation.destinationPropertyId;
+			operation.operand = RendererRuntime::ShaderTemplate::Operand();
+			if (argValues.size() > 1)
+			{
+				size_t idx = 1;
+				if (argValues.size() == 3)
+				{
+					operation.sourcePropertyId = RendererRuntime::StringId(argValues[idx++].c_str());
+				}
+				operation.operand = getOperand(argValues[idx]);
+			}
+			return operation;
+		}
+
+		void addExpressionNodes(const ExpressionVec& expression, RendererRuntime::ShaderTemplate::ExpressionNodes& expressionNodes)
+		{
+			for (const Expression& exp : expression)
+			{
+				RendererRuntime::ShaderTemplate::ExpressionNode expressionNode;
+				expressionNode.negated = exp.negated;
+				expressionNode.numberOfChildren = 0;
+				switch (exp.type)
+				{
+					case EXPR_OPERATOR_OR:
+						expressionNode.type = RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_OR;
+						break;
+
+					case EXPR_OPERATOR_AND:
+						expressionNode.type = RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_AND;
+						break;
+
+					case EXPR_OBJECT:
+						expressionNode.type = RendererRuntime::ShaderTemplate::ExpressionType::OBJECT;
+						expressionNode.numberOfChildren = static_cast<uint32_t>(exp.children.size());
+						break;
+
+					case EXPR_VAR:
+					default:
+						expressionNode.type = RendererRuntime::ShaderTemplate::ExpressionType::VARIABLE;
+						expressionNode.propertyId = RendererRuntime::StringId(exp.value.c_str());
+						break;
+				}
+				expressionNodes.push_back(expressionNode);
+				if (EXPR_OBJECT == exp.type)
+				{
+					addExpressionNodes(exp.children, expressionNodes);
+				}
+			}
+		}
+
+		bool evaluateExpressionNodes(const RendererRuntime::ShaderProperties& shaderProperties, const RendererRuntime::ShaderTemplate::ExpressionNode*& expressionNode, uint32_t numberOfExpressionNodes)
+		{
+			// Same evaluation as "::detail::evaluateExpressionRecursive()", just without the syntax checks already done when compiling the shader template
+			bool retVal = true;
+			bool andMode = true;
+			for (uint32_t i = 0; i < numberOfExpressionNodes; ++i)
+			{
+				const RendererRuntime::ShaderTemplate::ExpressionNode& exp = *expressionNode;
+				++expressionNode;
+				if (RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_OR == exp.type)
+				{
+					andMode = false;
+				}
+				else if (RendererRuntime::ShaderTemplate::ExpressionType::OPERATOR_AND == exp.type)
+				{
+					andMode = true;
+				}
+				else
+				{
+					bool result = (RendererRuntime::ShaderTemplate::ExpressionType::VARIABLE == exp.type) ? (0 != shaderProperties.getPropertyValueUnsafe(exp.propertyId)) : evaluateExpressionNodes(shaderProperties, expressionNode, exp.numberOfChildren);
+					if (exp.negated)
+					{
+						result = !result;
+					}
+					if (andMode)
+					{
+						retVal &= result;
+					}
+					else
+					{
+						retVal |= result;
+					}
+				}
+			}
+			return retVal;
+		}
+
+		void executeMathOperations(RendererRuntime::ShaderProperties& shaderProperties, const RendererRuntime::ShaderTemplate::Operations& operations)
+		{
+			for (const RendererRuntime::ShaderTemplate::Operation& operation : operations)
+			{
+				const int op1Value = shaderProperties.getPropertyValueUnsafe(operation.sourcePropertyId);
+				const int op2Value = getOperandValue(shaderProperties, operation.operand);
+				shaderProperties.setPropertyValue(operation.destinationPropertyId, c_operations[operation.operationIndex].opFunc(op1Value, op2Value));
+			}
+		}
+
+		bool executeCounterOperation(RendererRuntime::ShaderProperties& shaderProperties, const RendererRuntime::ShaderTemplate::Operation& operation, int& value)
+		{
+			if (operation.operationIndex <= 1)
+			{
+				// @value & @counter write, the others are invisible
+				value = shaderProperties.getPropertyValueUnsafe(operation.sourcePropertyId);
+				if (0 == operation.operationIndex)
+				{
+					shaderProperties.setPropertyValue(operation.destinationPropertyId, value + 1);
+				}
+				return true;
+			}
+			else
+			{
+				const int op1Value = shaderProperties.getPropertyValueUnsafe(operation.sourcePropertyId);
+				const int op2Value = getOperandValue(shaderProperties, operation.operand);
+				shaderProperties.setPropertyValue(operation.destinationPropertyId, c_counterOperations[operation.operationIndex].opFunc(op1Value, op2Value));
+				return false;
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -776,6 +966,370 @@ namespace RendererRuntime
 	}
 
 	const std::string& ShaderBuilder::createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties)
+	{
+		// Evaluate the shader templates compiled when loading the resources, fall back to parsing the source code if this isn't possible
+		if (!createSourceCodeByShaderTemplates(shaderPieceResourceManager, shaderBlueprintResource, shaderProperties))
+		{
+			createSourceCodeByParsing(shaderPieceResourceManager, shaderBlueprintResource, shaderProperties);
+		}
+
+		// Apply a C-preprocessor
+		Preprocessor::preprocess(mInString, mOutString);
+
+		// Done
+		return mOutString;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void ShaderBuilder::compileShaderTemplate(const std::string& sourceCode, ShaderTemplate& shaderTemplate)
+	{
+		shaderTemplate.clear();
+		shaderTemplate.mSourceCode.reserve(sourceCode.size());
+
+		// Math operations are applied upfront, no matter where they're located inside the source code
+		// -> Gather them and strip them from the source code just like "RendererRuntime::ShaderBuilder::parseMath()" does
+		::detail::StringVector argValues;
+		size_t copyStart = 0;
+		size_t pos = sourceCode.find('@');
+		while (std::string::npos != pos)
+		{
+			size_t keywordEnd = 0;
+			const size_t keyword = ::detail::findOperation(sourceCode, pos, ::detail::c_operations, 8, keywordEnd);
+			if (static_cast<size_t>(~0) == keyword)
+			{
+				pos = sourceCode.find('@', pos + 1);
+			}
+			else
+			{
+				if (!::detail::isOperationDirective(sourceCode, pos, ::detail::c_operations[keyword], keywordEnd))
+				{
+					shaderTemplate.clear();
+					return;
+				}
+				shaderTemplate.mSourceCode.append(sourceCode, copyStart, pos - copyStart);
+
+				::detail::SubStringRef subString(&sourceCode, keywordEnd + 1);
+				bool syntaxError = false;
+				::detail::evaluateParamArgs(subString, argValues, syntaxError);
+				if (syntaxError || argValues.size() < 2 || argValues.size() > 3)
+				{
+					shaderTemplate.clear();
+					return;
+				}
+				shaderTemplate.mMathOperations.push_back(::detail::getOperation(argValues, keyword));
+
+				copyStart = subString.getStart();
+				pos = sourceCode.find('@', copyStart);
+			}
+		}
+		shaderTemplate.mSourceCode.append(sourceCode, copyStart, std::string::npos);
+
+		// Compile the remaining source code into instructions
+		size_t position = 0;
+		if (compileShaderTemplateInstructions(shaderTemplate, position, std::string(), false, false, false))
+		{
+			shaderTemplate.mValid = true;
+		}
+		else
+		{
+			shaderTemplate.clear();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	bool ShaderBuilder::compileShaderTemplateInstructions(ShaderTemplate& shaderTemplate, size_t& position, const std::string& counterVariable, bool insideForEach, bool insidePiece, bool insideBlock)
+	{
+		// The instructions must map one-to-one onto what parsing the source code would do, everything else results in an invalid shader template:
+		// - Every "@" must start a known directive and directive arguments must not contain "@", so concatenating text can never result in new directives
+		// - Blocks must end where "::detail::findBlockEnd()" ends them and the character after "@end", which is skipped, must not start a directive
+		// - "@foreach" and "@piece" can't be nested since parsing the source code only handles one level of them per pass
+		const std::string& sourceCode = shaderTemplate.mSourceCode;
+		ShaderTemplate::Instructions& instructions = shaderTemplate.mInstructions;
+		::detail::StringVector argValues;
+
+		// Compile a block body, the position must point to the first character after the block start directive
+		const auto compileBlock = [&](size_t blockStart, const std::string& blockCounterVariable, bool blockInsideForEach, bool blockInsidePiece, size_t instructionIndex) -> bool
+		{
+			::detail::SubStringRef blockSubString(&sourceCode, blockStart);
+			bool syntaxError = false;
+			::detail::findBlockEnd(blockSubString, syntaxError);
+			position = blockStart;
+			if (syntaxError || !compileShaderTemplateInstructions(shaderTemplate, position, blockCounterVariable, blockInsideForEach, blockInsidePiece, true) || std::min(blockSubString.getEnd() + sizeof("@end"), sourceCode.size()) != position)
+			{
+				return false;
+			}
+			instructions[instructionIndex].size = static_cast<uint32_t>(instructions.size() - instructionIndex - 1);
+			return true;
+		};
+
+		for (;;)
+		{
+			// Text up to the next directive
+			const size_t pos = sourceCode.find('@', position);
+			const size_t textEnd = (std::string::npos == pos) ? sourceCode.size() : pos;
+			if (textEnd > position)
+			{
+				instructions.push_back({ ShaderTemplate::InstructionType::TEXT, static_cast<uint32_t>(position), static_cast<uint32_t>(textEnd - position) });
+			}
+			if (std::string::npos == pos)
+			{
+				// A block without "@end" is a syntax error
+				position = sourceCode.size();
+				return !insideBlock;
+			}
+			const char* keyword = sourceCode.c_str() + pos + 1;
+
+			// Inside "@foreach" the counter variable is replaced before anything else, it must not hide a block keyword "::detail::findBlockEnd()" is looking for
+			if (!counterVariable.empty() && ::detail::startsWith(keyword, counterVariable.c_str()))
+			{
+				if (::detail::startsWith(keyword, "end") || ::detail::startsWith(keyword, "foreach") || ::detail::startsWith(keyword, "property") || ::detail::startsWith(keyword, "piece"))
+				{
+					return false;
+				}
+				instructions.push_back({ ShaderTemplate::InstructionType::COUNTER_VALUE, 0, 0 });
+				position = pos + 1 + counterVariable.size();
+			}
+			else if (::detail::startsWith(keyword, "end"))
+			{
+				if (!insideBlock)
+				{
+					return false;
+				}
+				position = std::min(pos + sizeof("@end"), sourceCode.size());
+				return ('@' != sourceCode[position - 1]);
+			}
+			else if (::detail::startsWith(keyword, "foreach("))
+			{
+				if (insideForEach)
+				{
+					return false;
+				}
+				::detail::SubStringRef subString(&sourceCode, pos + sizeof("@foreach"));
+				bool syntaxError = false;
+				::detail::evaluateParamArgs(subString, argValues, syntaxError);
+				if (syntaxError)
+				{
+					return false;
+				}
+				ShaderTemplate::ForEach forEach;
+				forEach.count = ::detail::getOperand(argValues[0]);
+				forEach.hasStart = (argValues.size() > 2);
+				forEach.start = forEach.hasStart ? ::detail::getOperand(argValues[2]) : ShaderTemplate::Operand();
+				const std::string forEachCounterVariable = (argValues.size() > 1) ? argValues[1] : std::string();
+				const size_t instructionIndex = instructions.size();
+				instructions.push_back({ ShaderTemplate::InstructionType::FOREACH, static_cast<uint32_t>(shaderTemplate.mForEaches.size()), 0 });
+				shaderTemplate.mForEaches.push_back(forEach);
+				if (!compileBlock(subString.getStart(), forEachCounterVariable, true, insidePiece, instructionIndex))
+				{
+					return false;
+				}
+			}
+			else if (::detail::startsWith(keyword, "property("))
+			{
+				::detail::SubStringRef subString(&sourceCode, pos + sizeof("@property"));
+				::detail::ExpressionVec expressions;
+				bool syntaxError = false;
+				if (!::detail::parseExpression(subString, expressions, syntaxError) || syntaxError || sourceCode.find('@', pos + 1) < subString.getStart())
+				{
+					return false;
+				}
+				const ShaderProperties shaderProperties;
+				::detail::evaluateExpressionRecursive(shaderProperties, expressions, syntaxError);
+				if (syntaxError)
+				{
+					return false;
+				}
+				const size_t instructionIndex = instructions.size();
+				instructions.push_back({ ShaderTemplate::InstructionType::PROPERTY, static_cast<uint32_t>(shaderTemplate.mExpressionNodes.size()), 0 });
+				::detail::addExpressionNodes(expressions, shaderTemplate.mExpressionNodes);
+				if (!compileBlock(subString.getStart(), counterVariable, insideForEach, insidePiece, instructionIndex))
+				{
+					return false;
+				}
+			}
+			else if (::detail::startsWith(keyword, "piece("))
+			{
+				if (insidePiece)
+				{
+					return false;
+				}
+				::detail::SubStringRef subString(&sourceCode, pos + sizeof("@piece"));
+				bool syntaxError = false;
+				::detail::evaluateParamArgs(subString, argValues, syntaxError);
+				if (syntaxError || argValues.size() != 1)
+				{
+					return false;
+				}
+				const size_t instructionIndex = instructions.size();
+				instructions.push_back({ ShaderTemplate::InstructionType::PIECE, StringId(argValues[0].c_str()).getId(), 0 });
+				if (!compileBlock(subString.getStart(), counterVariable, insideForEach, true, instructionIndex))
+				{
+					return false;
+				}
+			}
+			else if (::detail::startsWith(keyword, "insertpiece("))
+			{
+				::detail::SubStringRef subString(&sourceCode, pos + sizeof("@insertpiece"));
+				bool syntaxError = false;
+				::detail::evaluateParamArgs(subString, argValues, syntaxError);
+				if (syntaxError || argValues.size() != 1)
+				{
+					return false;
+				}
+				instructions.push_back({ ShaderTemplate::InstructionType::INSERT_PIECE, StringId(argValues[0].c_str()).getId(), 0 });
+				position = subString.getStart();
+			}
+			else
+			{
+				// Counter operation
+				size_t keywordEnd = 0;
+				const size_t operationIndex = ::detail::findOperation(sourceCode, pos, ::detail::c_counterOperations, 10, keywordEnd);
+				if (static_cast<size_t>(~0) == operationIndex || !::detail::isOperationDirective(sourceCode, pos, ::detail::c_counterOperations[operationIndex], keywordEnd))
+				{
+					return false;
+				}
+				::detail::SubStringRef subString(&sourceCode, keywordEnd + 1);
+				bool syntaxError = false;
+				::detail::evaluateParamArgs(subString, argValues, syntaxError);
+				if (syntaxError || ((operationIndex <= 1) ? (argValues.size() != 1) : (argValues.size() < 2 || argValues.size() > 3)))
+				{
+					return false;
+				}
+				instructions.push_back({ ShaderTemplate::InstructionType::COUNTER, static_cast<uint32_t>(shaderTemplate.mCounterOperations.size()), 0 });
+				shaderTemplate.mCounterOperations.push_back(::detail::getOperation(argValues, operationIndex));
+				position = subString.getStart();
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	bool ShaderBuilder::createSourceCodeByShaderTemplates(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties)
+	{
+		const ShaderBlueprintResource::IncludeShaderPieceResourceIds& includeShaderPieceResourceIds = shaderBlueprintResource.getIncludeShaderPieceResourceIds();
+		const ShaderPieceResources& shaderPieceResources = shaderPieceResourceManager.getShaderPieceResources();
+		const size_t numberOfShaderPieces = includeShaderPieceResourceIds.size();
+
+		// All shader templates must be valid
+		size_t numberOfReservedCharacters = shaderBlueprintResource.getShaderTemplate().getSourceCode().size();
+		if (!shaderBlueprintResource.getShaderTemplate().isValid())
+		{
+			return false;
+		}
+		for (size_t i = 0; i < numberOfShaderPieces; ++i)
+		{
+			const ShaderPieceResource* shaderPieceResource = shaderPieceResources.tryGetElementById(includeShaderPieceResourceIds[i]);
+			if (nullptr != shaderPieceResource)
+			{
+				if (!shaderPieceResource->getShaderTemplate().isValid())
+				{
+					return false;
+				}
+				numberOfReservedCharacters += shaderPieceResource->getShaderTemplate().getSourceCode().size();
+			}
+		}
+
+		// Initialize
+		mShaderProperties = shaderProperties;
+		mShaderProperties.setPropertyValues(static_cast<const ShaderBlueprintResourceManager&>(shaderBlueprintResource.getResourceManager()).getRendererShaderProperties());
+		mResolvedInstructions.clear();
+		mResolvedPieces.clear();
+
+		// Parsing the source code expands all "@foreach"-blocks before evaluating "@property"-blocks, so an unknown "@foreach" start property is an error even inside an excluded block
+		const auto hasValidForEachStarts = [this](const ShaderTemplate& shaderTemplate) -> bool
+		{
+			int start = 0;
+			for (const ShaderTemplate::ForEach& forEach : shaderTemplate.mForEaches)
+			{
+				if (forEach.hasStart && forEach.start.isProperty && !mShaderProperties.getPropertyValue(forEach.start.propertyId, start, -1))
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+
+		{ // Process the shader piece resources to include
+			for (size_t i = 0; i < numberOfShaderPieces; ++i)
+			{
+				const ShaderPieceResource* shaderPieceResource = shaderPieceResources.tryGetElementById(includeShaderPieceResourceIds[i]);
+				if (nullptr != shaderPieceResource)
+				{
+					// Resolve the instructions, this collects the pieces
+					const ShaderTemplate& shaderTemplate = shaderPieceResource->getShaderTemplate();
+					::detail::executeMathOperations(mShaderProperties, shaderTemplate.mMathOperations);
+					const size_t firstResolvedInstruction = mResolvedInstructions.size();
+					if (!hasValidForEachStarts(shaderTemplate) || !resolveShaderTemplateInstructions(shaderTemplate, 0, static_cast<uint32_t>(shaderTemplate.mInstructions.size()), 0))
+					{
+						return false;
+					}
+
+					// Counter operations outside of pieces are executed until the first other directive, the resulting source code itself isn't used
+					const size_t numberOfResolvedInstructions = mResolvedInstructions.size();
+					for (size_t resolvedInstructionIndex = firstResolvedInstruction; resolvedInstructionIndex < numberOfResolvedInstructions; ++resolvedInstructionIndex)
+					{
+						const ResolvedInstruction& resolvedInstruction = mResolvedInstructions[resolvedInstructionIndex];
+						if (ShaderTemplate::InstructionType::PIECE == resolvedInstruction.type)
+						{
+							resolvedInstructionIndex += resolvedInstruction.value;
+						}
+						else if (ShaderTemplate::InstructionType::COUNTER == resolvedInstruction.type)
+						{
+							// A counter operation at the very end of the source code is a syntax error when parsing the source code, since "::detail::evaluateExpressionEnd()" expects a character after ")"
+							if (isLastResolvedInstruction(resolvedInstructionIndex, numberOfResolvedInstructions))
+							{
+								break;
+							}
+							int value = 0;
+							::detail::executeCounterOperation(mShaderProperties, *resolvedInstruction.operation, value);
+						}
+						else if (ShaderTemplate::InstructionType::INSERT_PIECE == resolvedInstruction.type)
+						{
+							break;
+						}
+					}
+				}
+				else
+				{
+					// TODO(co) Error handling
+					assert(false);
+				}
+			}
+		}
+
+		{ // Process the shader blueprint resource
+			const ShaderTemplate& shaderTemplate = shaderBlueprintResource.getShaderTemplate();
+			::detail::executeMathOperations(mShaderProperties, shaderTemplate.mMathOperations);
+			const size_t firstResolvedInstruction = mResolvedInstructions.size();
+			if (!hasValidForEachStarts(shaderTemplate) || !resolveShaderTemplateInstructions(shaderTemplate, 0, static_cast<uint32_t>(shaderTemplate.mInstructions.size()), 0))
+			{
+				return false;
+			}
+
+			// Write the shader source code into a single preallocated buffer, this inserts the pieces and executes the counter operations
+			// -> A piece insertion or counter operation at the very end of the source code is a syntax error when parsing the source code, since "::detail::evaluateExpressionEnd()" expects a character after ")", let parsing the source code handle this
+			mInString.clear();
+			mInString.reserve(numberOfReservedCharacters);
+			ShaderTemplate::InstructionType lastInstructionType = ShaderTemplate::InstructionType::TEXT;
+			if (!writeResolvedInstructions(firstResolvedInstruction, mResolvedInstructions.size() - firstResolvedInstruction, 0, lastInstructionType) || ShaderTemplate::InstructionType::COUNTER == lastInstructionType)
+			{
+				return false;
+			}
+		}
+
+		// Done
+		return true;
+	}
+
+	void ShaderBuilder::createSourceCodeByParsing(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties)
 	{
 		mShaderProperties = shaderProperties;
 		mShaderProperties.setPropertyValues(static_cast<const ShaderBlueprintResourceManager&>(shaderBlueprintResource.getResourceManager()).getRendererShaderProperties());
@@ -826,12 +1380,190 @@ namespace RendererRuntime
 			}
 			syntaxError |= parseCounter(mOutString, mInString);
 		}
+	}
 
-		// Apply a C-preprocessor
-		Preprocessor::preprocess(mInString, mOutString);
+	bool ShaderBuilder::resolveShaderTemplateInstructions(const ShaderTemplate& shaderTemplate, uint32_t firstInstruction, uint32_t numberOfInstructions, int32_t passNumber)
+	{
+		const ShaderTemplate::Instruction* instruction = shaderTemplate.mInstructions.data() + firstInstruction;
+		const ShaderTemplate::Instruction* instructionEnd = instruction + numberOfInstructions;
+		for (; instruction < instructionEnd; ++instruction)
+		{
+			switch (instruction->type)
+			{
+				case ShaderTemplate::InstructionType::TEXT:
+					mResolvedInstructions.push_back({ instruction->type, instruction->size, shaderTemplate.mSourceCode.c_str() + instruction->value, nullptr });
+					break;
 
-		// Done
-		return mOutString;
+				case ShaderTemplate::InstructionType::COUNTER_VALUE:
+					mResolvedInstructions.push_back({ instruction->type, static_cast<uint32_t>(passNumber), nullptr, nullptr });
+					break;
+
+				case ShaderTemplate::InstructionType::FOREACH:
+				{
+					const ShaderTemplate::ForEach& forEach = shaderTemplate.mForEaches[instruction->value];
+					const int count = ::detail::getOperandValue(mShaderProperties, forEach.count);
+					int start = 0;
+					if (forEach.hasStart)
+					{
+						if (forEach.start.isProperty)
+						{
+							// Already checked by "RendererRuntime::ShaderBuilder::createSourceCodeByShaderTemplates()"
+							mShaderProperties.getPropertyValue(forEach.start.propertyId, start, -1);
+						}
+						else
+						{
+							start = forEach.start.number;
+						}
+					}
+					const uint32_t firstBlockInstruction = static_cast<uint32_t>(instruction - shaderTemplate.mInstructions.data()) + 1;
+					for (int i = start; i < count; ++i)
+					{
+						if (!resolveShaderTemplateInstructions(shaderTemplate, firstBlockInstruction, instruction->size, i))
+						{
+							return false;
+						}
+					}
+					instruction += instruction->size;
+					break;
+				}
+
+				case ShaderTemplate::InstructionType::PROPERTY:
+				{
+					const ShaderTemplate::ExpressionNode* expressionNode = shaderTemplate.mExpressionNodes.data() + instruction->value;
+					if (::detail::evaluateExpressionNodes(mShaderProperties, expressionNode, 1) && !resolveShaderTemplateInstructions(shaderTemplate, static_cast<uint32_t>(instruction - shaderTemplate.mInstructions.data()) + 1, instruction->size, passNumber))
+					{
+						return false;
+					}
+					instruction += instruction->size;
+					break;
+				}
+
+				case ShaderTemplate::InstructionType::PIECE:
+				{
+					// A piece can only be defined once, let parsing the source code report the error
+					const StringId pieceId(instruction->value);
+					for (const ResolvedPiece& resolvedPiece : mResolvedPieces)
+					{
+						if (resolvedPiece.pieceId == pieceId)
+						{
+							return false;
+						}
+					}
+
+					// The piece instructions are skipped when writing the shader source code
+					const size_t resolvedInstructionIndex = mResolvedInstructions.size();
+					mResolvedInstructions.push_back({ instruction->type, 0, nullptr, nullptr });
+					if (!resolveShaderTemplateInstructions(shaderTemplate, static_cast<uint32_t>(instruction - shaderTemplate.mInstructions.data()) + 1, instruction->size, passNumber))
+					{
+						return false;
+					}
+					const uint32_t numberOfResolvedInstructions = static_cast<uint32_t>(mResolvedInstructions.size() - resolvedInstructionIndex - 1);
+					mResolvedInstructions[resolvedInstructionIndex].value = numberOfResolvedInstructions;
+					mResolvedPieces.push_back({ pieceId, static_cast<uint32_t>(resolvedInstructionIndex + 1), numberOfResolvedInstructions });
+					instruction += instruction->size;
+					break;
+				}
+
+				case ShaderTemplate::InstructionType::INSERT_PIECE:
+					mResolvedInstructions.push_back({ instruction->type, instruction->value, nullptr, nullptr });
+					break;
+
+				case ShaderTemplate::InstructionType::COUNTER:
+					mResolvedInstructions.push_back({ instruction->type, 0, nullptr, &shaderTemplate.mCounterOperations[instruction->value] });
+					break;
+			}
+		}
+		return true;
+	}
+
+	bool ShaderBuilder::isLastResolvedInstruction(size_t resolvedInstructionIndex, size_t resolvedInstructionEnd) const
+	{
+		// Pieces are no longer part of the source code when the following directives are processed
+		for (size_t i = resolvedInstructionIndex + 1; i < resolvedInstructionEnd; ++i)
+		{
+			if (ShaderTemplate::InstructionType::PIECE == mResolvedInstructions[i].type)
+			{
+				i += mResolvedInstructions[i].value;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool ShaderBuilder::writeResolvedInstructions(size_t firstResolvedInstruction, size_t numberOfResolvedInstructions, uint32_t pieceInsertionDepth, ShaderTemplate::InstructionType& lastInstructionType)
+	{
+		char temp[32];
+		const size_t resolvedInstructionEnd = firstResolvedInstruction + numberOfResolvedInstructions;
+		for (size_t resolvedInstructionIndex = firstResolvedInstruction; resolvedInstructionIndex < resolvedInstructionEnd; ++resolvedInstructionIndex)
+		{
+			const ResolvedInstruction& resolvedInstruction = mResolvedInstructions[resolvedInstructionIndex];
+			switch (resolvedInstruction.type)
+			{
+				case ShaderTemplate::InstructionType::TEXT:
+					mInString.append(resolvedInstruction.text, resolvedInstruction.value);
+					lastInstructionType = resolvedInstruction.type;
+					break;
+
+				case ShaderTemplate::InstructionType::COUNTER_VALUE:
+					sprintf(temp, "%lu", static_cast<unsigned long>(static_cast<size_t>(static_cast<int32_t>(resolvedInstruction.value))));
+					mInString += temp;
+					lastInstructionType = resolvedInstruction.type;
+					break;
+
+				case ShaderTemplate::InstructionType::PIECE:
+					resolvedInstructionIndex += resolvedInstruction.value;
+					break;
+
+				case ShaderTemplate::InstructionType::INSERT_PIECE:
+				{
+					// Piece insertions inside inserted pieces can't be at the very end of the source code, the piece insertion itself would already have been at the end
+					if (0 == pieceInsertionDepth && isLastResolvedInstruction(resolvedInstructionIndex, resolvedInstructionEnd))
+					{
+						return false;
+					}
+					const StringId pieceId(resolvedInstruction.value);
+					for (const ResolvedPiece& resolvedPiece : mResolvedPieces)
+					{
+						if (resolvedPiece.pieceId == pieceId)
+						{
+							if (pieceInsertionDepth >= ::detail::MAXIMUM_PIECE_INSERTION_DEPTH)
+							{
+								printf("Error: @insertpiece exceeds the maximum piece insertion depth of %u, is a piece inserting itself?\n", ::detail::MAXIMUM_PIECE_INSERTION_DEPTH);
+								return false;
+							}
+							if (!writeResolvedInstructions(resolvedPiece.firstResolvedInstruction, resolvedPiece.numberOfResolvedInstructions, pieceInsertionDepth + 1, lastInstructionType))
+							{
+								return false;
+							}
+							break;
+						}
+					}
+					break;
+				}
+
+				case ShaderTemplate::InstructionType::COUNTER:
+				{
+					int value = 0;
+					if (::detail::executeCounterOperation(mShaderProperties, *resolvedInstruction.operation, value))
+					{
+						sprintf(temp, "%i", value);
+						mInString += temp;
+					}
+					lastInstructionType = resolvedInstruction.type;
+					break;
+				}
+
+				case ShaderTemplate::InstructionType::FOREACH:
+				case ShaderTemplate::InstructionType::PROPERTY:
+					// Already resolved
+					assert(false);
+					break;
+			}
+		}
+		return true;
 	}
 
 
@@ -25,12 +25,17 @@
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCacheManager.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCache.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderCacheFileFormat.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
+#include "RendererRuntime/Resource/ShaderPiece/ShaderPieceResourceManager.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
 #include "RendererRuntime/Resource/MaterialBlueprint/Cache/PipelineStateSignature.h"
+#include "RendererRuntime/Core/File/IFile.h"
 #include "RendererRuntime/Core/Math/Math.h"
 #include "RendererRuntime/IRendererRuntime.h"
 
+#include <unordered_set>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -53,81 +58,119 @@ namespace RendererRuntime
 			// Get the shader cache identifier, often but not always identical to the shader combination ID
 			const ShaderCacheId shaderCacheId = pipelineStateSignature.getShaderCombinationId(shaderType);
 
-			// Does the shader cache already exist?
+			// Does the shader cache already exist or is someone else already working on it?
 			std::unique_lock<std::mutex> mutexLock(mMutex);
-			ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = mShaderCacheByShaderCacheId.find(shaderCacheId);
-			if (shaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
-			{
-				shaderCache = shaderCacheIdIterator->second;
-			}
-			else
+			std::promise<ShaderCache*> shaderCachePromise;
+			if (!findOrBeginShaderCache(shaderCacheId, mutexLock, shaderCachePromise, shaderCache))
 			{
 				// Try to create the new program cache instance
 				const ShaderBlueprintResource* shaderBlueprintResource = mShaderBlueprintResourceManager.getShaderBlueprintResources().tryGetElementById(shaderBlueprintResourceId);
 				if (nullptr != shaderBlueprintResource)
 				{
-					// Build the shader source code
-					ShaderBuilder shaderBuilder;
-					const std::string& sourceCode = shaderBuilder.createSourceCode(mShaderBlueprintResourceManager.getRendererRuntime().getShaderPieceResourceManager(), *shaderBlueprintResource, pipelineStateSignature.getShaderProperties());
-					if (sourceCode.empty())
-					{
-						// TODO(co) Error handling
-						assert(false);
-					}
-					else
+					// Try to use the persistent shader cache, on success there's no need to build the shader source code
+					const uint32_t shaderAssetsId = calculateShaderAssetsId(*shaderBlueprintResource);
+					const ShaderSourceCodeId persistentShaderSourceCodeId = getPersistentShaderSourceCodeId(shaderCacheId, shaderAssetsId);
+					if (isInitialized(persistentShaderSourceCodeId))
 					{
-						// Generate the shader source code ID
-						// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
-						// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
-						const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
-						ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
+						ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.find(persistentShaderSourceCodeId);
 						if (shaderSourceCodeIdIterator != mShaderCacheByShaderSourceCodeId.cend() && nullptr != shaderSourceCodeIdIterator->second->getShaderPtr().getPointer())
 						{
 							// Reuse already existing shader instance
-							// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
 							shaderCache = new ShaderCache(shaderCacheId, shaderSourceCodeIdIterator->second);
 							mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
 						}
 						else
 						{
-							// Create the shader instance
-							Renderer::IShader* shader = nullptr;
-							switch (shaderType)
-							{
-								case ShaderType::Vertex:
-									shader = shaderLanguage.createVertexShaderFromSourceCode(materialBlueprintResource.getVertexAttributes(), sourceCode.c_str());
-									break;
-
-								case ShaderType::TessellationControl:
-									shader = shaderLanguage.createTessellationControlShaderFromSourceCode(sourceCode.c_str());
-									break;
-
-								case ShaderType::TessellationEvaluation:
-									shader = shaderLanguage.createTessellationEvaluationShaderFromSourceCode(sourceCode.c_str());
-									break;
-
-								case ShaderType::Geometry:
-									// TODO(co) "RendererRuntime::ShaderCacheManager::getShaderCache()" needs to provide additional geometry shader information
-									// shader = shaderLanguage.createGeometryShaderFromSourceCode(sourceCode.c_str());
-									break;
-
-								case ShaderType::Fragment:
-									shader = shaderLanguage.createFragmentShaderFromSourceCode(sourceCode.c_str());
-									break;
-							}
-
-							// Create the new shader cache instance
+							// Create the shader instance by using the persistent shader bytecode, if there's any
+							// -> Done without holding the mutex, references to unordered map elements stay valid when other elements are added
+							const std::vector<uint8_t>* shaderBytecode = getPersistentShaderBytecode(persistentShaderSourceCodeId);
+							mutexLock.unlock();
+							Renderer::IShader* shader = (nullptr != shaderBytecode) ? createShaderFromBytecode(shaderLanguage, shaderType, materialBlueprintResource.getVertexAttributes(), *shaderBytecode) : nullptr;
+							mutexLock.lock();
 							if (nullptr != shader)
 							{
 								RENDERER_SET_RESOURCE_DEBUG_NAME(shader, "Shader cache manager")
 								shaderCache = new ShaderCache(shaderCacheId, *shader);
 								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCache);
+								mShaderCacheByShaderSourceCodeId.emplace(persistentShaderSourceCodeId, shaderCache);
+							}
+						}
+					}
+
+					// Build the shader source code, if required
+					// -> The shader source code is build without holding the mutex, the shader blueprint and shader piece resources are only read
+					if (nullptr == shaderCache)
+					{
+						mutexLock.unlock();
+						ShaderBuilder shaderBuilder;
+						const std::string& sourceCode = shaderBuilder.createSourceCode(mShaderBlueprintResourceManager.getRendererRuntime().getShaderPieceResourceManager(), *shaderBlueprintResource, pipelineStateSignature.getShaderProperties());
+						if (sourceCode.empty())
+						{
+							// TODO(co) Error handling
+							assert(false);
+							mutexLock.lock();
+						}
+						else
+						{
+							// Generate the shader source code ID
+							// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
+							// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
+							const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
+							mutexLock.lock();
+							ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
+							if (shaderSourceCodeIdIterator != mShaderCacheByShaderSourceCodeId.cend() && nullptr != shaderSourceCodeIdIterator->second->getShaderPtr().getPointer())
+							{
+								// Reuse already existing shader instance
+								// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
+								shaderCache = new ShaderCache(shaderCacheId, shaderSourceCodeIdIterator->second);
+								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+								addPersistentShaderCache(shaderCacheId, shaderSourceCodeId, shaderAssetsId);
 							}
 							else
 							{
-								// TODO(co) Error handling
-								assert(false);
+								// Create the shader instance, this is done without holding the mutex as well
+								mutexLock.unlock();
+								Renderer::IShader* shader = nullptr;
+								switch (shaderType)
+								{
+									case ShaderType::Vertex:
+										shader = shaderLanguage.createVertexShaderFromSourceCode(materialBlueprintResource.getVertexAttributes(), sourceCode.c_str());
+										break;
+
+									case ShaderType::TessellationControl:
+										shader = shaderLanguage.createTessellationControlShaderFromSourceCode(sourceCode.c_str());
+										break;
+
+									case ShaderType::TessellationEvaluation:
+										shader = shaderLanguage.createTessellationEvaluationShaderFromSourceCode(sourceCode.c_str());
+										break;
+
+									case ShaderType::Geometry:
+										// TODO(co) "RendererRuntime::ShaderCacheManager::getShaderCache()" needs to provide additional geometry shader information
+										// shader = shaderLanguage.createGeometryShaderFromSourceCode(sourceCode.c_str());
+										break;
+
+									case ShaderType::Fragment:
+										shader = shaderLanguage.createFragmentShaderFromSourceCode(sourceCode.c_str());
+										break;
+								}
+								mutexLock.lock();
+
+								// Create the new shader cache instance
+								// -> In case another shader combination resulting in the same shader source code was faster, its shader stays the one referenced by the shader source code ID
+								if (nullptr != shader)
+								{
+									RENDERER_SET_RESOURCE_DEBUG_NAME(shader, "Shader cache manager")
+									shaderCache = new ShaderCache(shaderCacheId, *shader);
+									mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+									mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCache);
+									addPersistentShaderCache(shaderCacheId, shaderSourceCodeId, shaderAssetsId);
+								}
+								else
+								{
+									// TODO(co) Error handling
+									assert(false);
+								}
 							}
 						}
 					}
@@ -137,6 +180,9 @@ namespace RendererRuntime
 					// TODO(co) Error handling
 					assert(false);
 				}
+
+				// Tell everyone waiting for the shader cache about the result
+				endShaderCache(shaderCacheId, shaderCachePromise, shaderCache);
 			}
 		}
 
@@ -155,6 +201,282 @@ namespace RendererRuntime
 		mShaderCacheByShaderSourceCodeId.clear();
 	}
 
+	void ShaderCacheManager::loadCacheByFilename(const char* filename)
+	{
+		// The first run has no persistent shader cache file, so there's nothing to load
+		IFile* file = mCacheFile.openFile(filename);
+		if (nullptr != file)
+		{
+			loadCache(*file);
+			mCacheFile.closeFile(*file);
+		}
+	}
+
+	void ShaderCacheManager::saveDirtyCache()
+	{
+		// Pipeline state compiler threads might add shader caches at the same time, saving locks the mutex so it's a consistent snapshot
+		IFile* file = mCacheFile.createFileForWriteBack();
+		if (nullptr != file)
+		{
+			saveCache(*file);
+			mCacheFile.closeFile(*file);
+		}
+	}
+
+	bool ShaderCacheManager::loadCache(IFile& file)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		mPersistentShaderCacheByShaderCacheId.clear();
+		mShaderBytecodeByShaderSourceCodeId.clear();
+
+		// Shader bytecode is specific to the renderer and shader language it was compiled for, everything else is useless
+		v1ShaderCache::Header header;
+		std::vector<uint8_t> payload;
+		const Renderer::IRenderer& renderer = mShaderBlueprintResourceManager.getRendererRuntime().getRenderer();
+		if (!mCacheFile.read(file, &header, sizeof(v1ShaderCache::Header), payload) ||
+			StringId(renderer.getName()) != header.rendererNameId || StringId(renderer.getShaderLanguageName(0)) != header.shaderLanguageNameId ||
+			static_cast<uint64_t>(header.numberOfShaderCaches) * sizeof(v1ShaderCache::ShaderCacheHeader) > payload.size())
+		{
+			return false;
+		}
+
+		// Shader cache ID to shader source code ID mapping
+		const uint8_t* currentPayload = payload.data();
+		const uint8_t* payloadEnd = currentPayload + payload.size();
+		mPersistentShaderCacheByShaderCacheId.reserve(header.numberOfShaderCaches);
+		for (uint32_t i = 0; i < header.numberOfShaderCaches; ++i)
+		{
+			v1ShaderCache::ShaderCacheHeader shaderCacheHeader;
+			memcpy(&shaderCacheHeader, currentPayload, sizeof(v1ShaderCache::ShaderCacheHeader));
+			currentPayload += sizeof(v1ShaderCache::ShaderCacheHeader);
+			mPersistentShaderCacheByShaderCacheId[shaderCacheHeader.shaderCacheId] = { shaderCacheHeader.shaderSourceCodeId, shaderCacheHeader.shaderAssetsId };
+		}
+
+		// Shader bytecode by shader source code ID
+		mShaderBytecodeByShaderSourceCodeId.reserve(header.numberOfShaderBytecodes);
+		for (uint32_t i = 0; i < header.numberOfShaderBytecodes; ++i)
+		{
+			v1ShaderCache::ShaderBytecodeHeader shaderBytecodeHeader;
+			if (static_cast<size_t>(payloadEnd - currentPayload) < sizeof(v1ShaderCache::ShaderBytecodeHeader))
+			{
+				break;
+			}
+			memcpy(&shaderBytecodeHeader, currentPayload, sizeof(v1ShaderCache::ShaderBytecodeHeader));
+			currentPayload += sizeof(v1ShaderCache::ShaderBytecodeHeader);
+			if (static_cast<size_t>(payloadEnd - currentPayload) < shaderBytecodeHeader.numberOfBytes)
+			{
+				break;
+			}
+			mShaderBytecodeByShaderSourceCodeId[shaderBytecodeHeader.shaderSourceCodeId].assign(currentPayload, currentPayload + shaderBytecodeHeader.numberOfBytes);
+			currentPayload += shaderBytecodeHeader.numberOfBytes;
+		}
+		if (currentPayload != payloadEnd)
+		{
+			// Corrupted payload, the checksum matched by accident
+			mPersistentShaderCacheByShaderCacheId.clear();
+			mShaderBytecodeByShaderSourceCodeId.clear();
+			return false;
+		}
+
+		// Done
+		return true;
+	}
+
+	void ShaderCacheManager::saveCache(IFile& file)
+	{
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+
+		// Gather the shader bytecode of shaders which have been compiled since the persistent shader cache was loaded
+		for (auto& shaderCacheElement : mShaderCacheByShaderSourceCodeId)
+		{
+			const Renderer::IShader* shader = shaderCacheElement.second->mShaderPtr.getPointer();
+			if (nullptr != shader && mShaderBytecodeByShaderSourceCodeId.find(shaderCacheElement.first) == mShaderBytecodeByShaderSourceCodeId.cend())
+			{
+				uint32_t numberOfBytes = 0;
+				const uint8_t* bytecode = shader->getShaderBytecode(numberOfBytes);
+				if (nullptr != bytecode && numberOfBytes > 0)
+				{
+					mShaderBytecodeByShaderSourceCodeId.emplace(shaderCacheElement.first, std::vector<uint8_t>(bytecode, bytecode + numberOfBytes));
+				}
+			}
+		}
+
+		// Shader cache ID to shader source code ID mapping
+		std::vector<uint8_t> payload;
+		std::unordered_set<ShaderSourceCodeId> referencedShaderSourceCodeIds;
+		payload.reserve(mPersistentShaderCacheByShaderCacheId.size() * sizeof(v1ShaderCache::ShaderCacheHeader));
+		for (const auto& persistentShaderCacheElement : mPersistentShaderCacheByShaderCacheId)
+		{
+			const v1ShaderCache::ShaderCacheHeader shaderCacheHeader = { persistentShaderCacheElement.first, persistentShaderCacheElement.second.shaderSourceCodeId, persistentShaderCacheElement.second.shaderAssetsId };
+			const uint8_t* shaderCacheHeaderBytes = reinterpret_cast<const uint8_t*>(&shaderCacheHeader);
+			payload.insert(payload.end(), shaderCacheHeaderBytes, shaderCacheHeaderBytes + sizeof(v1ShaderCache::ShaderCacheHeader));
+			referencedShaderSourceCodeIds.insert(persistentShaderCacheElement.second.shaderSourceCodeId);
+		}
+
+		// Shader bytecode by shader source code ID, shader bytecode which is no longer referenced is dropped
+		uint32_t numberOfShaderBytecodes = 0;
+		for (const auto& shaderBytecodeElement : mShaderBytecodeByShaderSourceCodeId)
+		{
+			if (referencedShaderSourceCodeIds.find(shaderBytecodeElement.first) != referencedShaderSourceCodeIds.cend())
+			{
+				const v1ShaderCache::ShaderBytecodeHeader shaderBytecodeHeader = { shaderBytecodeElement.first, static_cast<uint32_t>(shaderBytecodeElement.second.size()) };
+				const uint8_t* shaderBytecodeHeaderBytes = reinterpret_cast<const uint8_t*>(&shaderBytecodeHeader);
+				payload.insert(payload.end(), shaderBytecodeHeaderBytes, shaderBytecodeHeaderBytes + sizeof(v1ShaderCache::ShaderBytecodeHeader));
+				payload.insert(payload.end(), shaderBytecodeElement.second.cbegin(), shaderBytecodeElement.second.cend());
+				++numberOfShaderBytecodes;
+			}
+		}
+
+		{ // Write down the header and the payload
+			const Renderer::IRenderer& renderer = mShaderBlueprintResourceManager.getRendererRuntime().getRenderer();
+			const v1ShaderCache::Header header =
+			{
+				StringId(renderer.getName()),
+				StringId(renderer.getShaderLanguageName(0)),
+				static_cast<uint32_t>(mPersistentShaderCacheByShaderCacheId.size()),
+				numberOfShaderBytecodes
+			};
+			mCacheFile.write(file, &header, sizeof(v1ShaderCache::Header), payload);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	ShaderCacheManager::ShaderCacheManager(ShaderBlueprintResourceManager& shaderBlueprintResourceManager) :
+		mShaderBlueprintResourceManager(shaderBlueprintResourceManager),
+		mCacheFile(shaderBlueprintResourceManager.getRendererRuntime().getFileManager(), v1ShaderCache::FORMAT_TYPE, v1ShaderCache::FORMAT_VERSION)
+	{
+		// Nothing here
+	}
+
+	ShaderCacheManager::~ShaderCacheManager()
+	{
+		saveDirtyCache();
+		clearCache();
+	}
+
+	bool ShaderCacheManager::findOrBeginShaderCache(ShaderCacheId shaderCacheId, std::unique_lock<std::mutex>& mutexLock, std::promise<ShaderCache*>& shaderCachePromise, ShaderCache*& shaderCache)
+	{
+		// Does the shader cache already exist?
+		ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = mShaderCacheByShaderCacheId.find(shaderCacheId);
+		if (shaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
+		{
+			shaderCache = shaderCacheIdIterator->second;
+			return true;
+		}
+
+		// Is someone else already working on the shader cache? If so, wait for the result without holding the mutex.
+		InFlightShaderCacheByShaderCacheId::const_iterator inFlightIterator = mInFlightShaderCacheByShaderCacheId.find(shaderCacheId);
+		if (inFlightIterator != mInFlightShaderCacheByShaderCacheId.cend())
+		{
+			const std::shared_future<ShaderCache*> shaderCacheFuture = inFlightIterator->second;
+			mutexLock.unlock();
+			shaderCache = shaderCacheFuture.get();
+			mutexLock.lock();
+			return true;
+		}
+
+		// The caller is now responsible for the shader cache and must call "RendererRuntime::ShaderCacheManager::endShaderCache()" when done
+		mInFlightShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCachePromise.get_future().share());
+		return false;
+	}
+
+	void ShaderCacheManager::endShaderCache(ShaderCacheId shaderCacheId, std::promise<ShaderCache*>& shaderCachePromise, ShaderCache* shaderCache)
+	{
+		mInFlightShaderCacheByShaderCacheId.erase(shaderCacheId);
+		shaderCachePromise.set_value(shaderCache);
+	}
+
+	void ShaderCacheManager::update()
+	{
+		// Loading usually requests lots of new shader caches within a few frames, wait until this settles down instead of rewriting the file each frame
+		if (mCacheFile.isWriteBackDue())
+		{
+			saveDirtyCache();
+		}
+	}
+
+	ShaderSourceCodeId ShaderCacheManager::getPersistentShaderSourceCodeId(ShaderCacheId shaderCacheId, uint32_t shaderAssetsId) const
+	{
+		// Outdated entries, meaning the shader blueprint or included shader pieces have been changed, are ignored
+		PersistentShaderCacheByShaderCacheId::const_iterator iterator = mPersistentShaderCacheByShaderCacheId.find(shaderCacheId);
+		return (iterator != mPersistentShaderCacheByShaderCacheId.cend() && iterator->second.shaderAssetsId == shaderAssetsId) ? iterator->second.shaderSourceCodeId : getUninitialized<ShaderSourceCodeId>();
+	}
+
+	const std::vector<uint8_t>* ShaderCacheManager::getPersistentShaderBytecode(ShaderSourceCodeId shaderSourceCodeId) const
+	{
+		ShaderBytecodeByShaderSourceCodeId::const_iterator iterator = mShaderBytecodeByShaderSourceCodeId.find(shaderSourceCodeId);
+		return (iterator != mShaderBytecodeByShaderSourceCodeId.cend()) ? &iterator->second : nullptr;
+	}
+
+	void ShaderCacheManager::addPersistentShaderCache(ShaderCacheId shaderCacheId, ShaderSourceCodeId shaderSourceCodeId, uint32_t shaderAssetsId)
+	{
+		// Overwrite outdated entries
+		// -> Renderer backends without shader bytecode build the shader source code on each persistent shader cache hit and end up here with
+		//    the already known entry, this is no change and mustn't result in writing back the persistent shader cache each run
+		const PersistentShaderCache persistentShaderCache = { shaderSourceCodeId, shaderAssetsId };
+		std::pair<PersistentShaderCacheByShaderCacheId::iterator, bool> result = mPersistentShaderCacheByShaderCacheId.emplace(shaderCacheId, persistentShaderCache);
+		if (result.second)
+		{
+			mCacheFile.addChange();
+		}
+		else if (result.first->second.shaderSourceCodeId != shaderSourceCodeId || result.first->second.shaderAssetsId != shaderAssetsId)
+		{
+			result.first->second = persistentShaderCache;
+			mCacheFile.addChange();
+		}
+	}
+
+	uint32_t ShaderCacheManager::calculateShaderAssetsId(const ShaderBlueprintResource& shaderBlueprintResource) const
+	{
+		// Hash the shader blueprint source code as well as the source codes of the included shader pieces, way cheaper than building the shader source code
+		// -> The renderer toolkit gathers the "@includepiece" directives of the shader blueprint into its include list and shader pieces can't include
+		//    further shader pieces, so the include list already is the complete set of shader pieces the shader builder might insert
+		// -> The asset ID of each included shader piece is hashed as well, not yet loaded shader pieces are hashed as such so they never alias with a
+		//    different set of shader pieces
+		const std::string& shaderBlueprintSourceCode = shaderBlueprintResource.getShaderSourceCode();
+		uint32_t shaderAssetsId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(shaderBlueprintSourceCode.c_str()), static_cast<uint32_t>(shaderBlueprintSourceCode.size()));
+		const ShaderPieceResources& shaderPieceResources = mShaderBlueprintResourceManager.getRendererRuntime().getShaderPieceResourceManager().getShaderPieceResources();
+		for (ShaderPieceResourceId shaderPieceResourceId : shaderBlueprintResource.getIncludeShaderPieceResourceIds())
+		{
+			const ShaderPieceResource* shaderPieceResource = shaderPieceResources.tryGetElementById(shaderPieceResourceId);
+			const AssetId assetId = (nullptr != shaderPieceResource) ? shaderPieceResource->getAssetId() : getUninitialized<AssetId>();
+			shaderAssetsId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(&assetId), sizeof(AssetId), shaderAssetsId);
+			if (nullptr != shaderPieceResource)
+			{
+				const std::string& shaderPieceSourceCode = shaderPieceResource->getShaderSourceCode();
+				shaderAssetsId = Math::calculateFNV1a(reinterpret_cast<const uint8_t*>(shaderPieceSourceCode.c_str()), static_cast<uint32_t>(shaderPieceSourceCode.size()), shaderAssetsId);
+			}
+		}
+		return shaderAssetsId;
+	}
+
+	Renderer::IShader* ShaderCacheManager::createShaderFromBytecode(Renderer::IShaderLanguage& shaderLanguage, ShaderType shaderType, const Renderer::VertexAttributes& vertexAttributes, const std::vector<uint8_t>& shaderBytecode)
+	{
+		const uint32_t numberOfBytes = static_cast<uint32_t>(shaderBytecode.size());
+		switch (shaderType)
+		{
+			case ShaderType::Vertex:
+				return shaderLanguage.createVertexShaderFromBytecode(vertexAttributes, shaderBytecode.data(), numberOfBytes);
+
+			case ShaderType::TessellationControl:
+				return shaderLanguage.createTessellationControlShaderFromBytecode(shaderBytecode.data(), numberOfBytes);
+
+			case ShaderType::TessellationEvaluation:
+				return shaderLanguage.createTessellationEvaluationShaderFromBytecode(shaderBytecode.data(), numberOfBytes);
+
+			case ShaderType::Geometry:
+				// TODO(co) "RendererRuntime::ShaderCacheManager::getShaderCache()" needs to provide additional geometry shader information
+				return nullptr;
+
+			case ShaderType::Fragment:
+				return shaderLanguage.createFragmentShaderFromBytecode(shaderBytecode.data(), numberOfBytes);
+		}
+		return nullptr;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
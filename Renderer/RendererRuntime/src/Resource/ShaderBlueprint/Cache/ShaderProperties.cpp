@@ -108,6 +108,18 @@ namespace RendererRuntime
 		}
 	}
 
+	bool ShaderProperties::removePropertyValue(ShaderPropertyId shaderPropertyId)
+	{
+		const Property property(shaderPropertyId, 0);
+		SortedPropertyVector::iterator iterator = std::lower_bound(mSortedPropertyVector.begin(), mSortedPropertyVector.end(), property, ::detail::orderPropertyByShaderPropertyId);
+		if (iterator != mSortedPropertyVector.end() && iterator->shaderPropertyId == property.shaderPropertyId)
+		{
+			mSortedPropertyVector.erase(iterator);
+			return true;
+		}
+		return false;
+	}
+
 	void ShaderProperties::setPropertyValues(const ShaderProperties& shaderProperties)
 	{
 		// We'll have to set the properties by using "RendererRuntime::ShaderProperties::setPropertyValue()" in order to maintain the internal vector order
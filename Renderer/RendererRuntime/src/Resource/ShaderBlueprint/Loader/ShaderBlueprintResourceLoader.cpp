@@ -24,6 +24,7 @@
 #include "RendererRuntime/PrecompiledHeader.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Loader/ShaderBlueprintResourceLoader.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/Loader/ShaderBlueprintFileFormat.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
 #include "RendererRuntime/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "RendererRuntime/Resource/ShaderPiece/ShaderPieceResourceManager.h"
 #include "RendererRuntime/Resource/Material/MaterialResourceManager.h"
@@ -83,6 +84,9 @@ namespace RendererRuntime
 		// Read the shader blueprint ASCII source code
 		file.read(mShaderSourceCode, shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
 		mShaderBlueprintResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
+
+		// Compile the shader template once instead of parsing the shader source code for each shader combination
+		ShaderBuilder::compileShaderTemplate(mShaderBlueprintResource->mShaderSourceCode, mShaderBlueprintResource->mShaderTemplate);
 	}
 
 	bool ShaderBlueprintResourceLoader::onDispatch()
@@ -124,7 +124,7 @@ namespace RendererRuntime
 
 	void ShaderBlueprintResourceManager::update()
 	{
-		// TODO(co) Implement me
+		mShaderCacheManager.update();
 	}
 
 
@@ -25,6 +25,7 @@
 #include "RendererRuntime/Resource/ShaderPiece/Loader/ShaderPieceResourceLoader.h"
 #include "RendererRuntime/Resource/ShaderPiece/Loader/ShaderPieceFileFormat.h"
 #include "RendererRuntime/Resource/ShaderPiece/ShaderPieceResource.h"
+#include "RendererRuntime/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
 #include "RendererRuntime/Core/File/IFile.h"
 
 
@@ -61,6 +62,9 @@ namespace RendererRuntime
 		// Read the shader piece ASCII source code
 		file.read(mShaderSourceCode, shaderPieceHeader.numberOfShaderSourceCodeBytes);
 		mShaderPieceResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderPieceHeader.numberOfShaderSourceCodeBytes);
+
+		// Compile the shader template once instead of parsing the shader source code for each shader combination
+		ShaderBuilder::compileShaderTemplate(mShaderPieceResource->mShaderSourceCode, mShaderPieceResource->mShaderTemplate);
 	}
 
 
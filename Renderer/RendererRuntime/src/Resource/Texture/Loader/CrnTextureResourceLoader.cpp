@@ -63,14 +63,20 @@ namespace RendererRuntime
 	void CrnTextureResourceLoader::onDeserialization(IFile& file)
 	{
 		// Load the source image file into memory: Get file size and file data
+		// -> Transcoding can work directly on a view of the file, this way there's no need to copy the file data
 		mNumberOfUsedFileDataBytes = static_cast<uint32_t>(file.getNumberOfBytes());
-		if (mNumberOfFileDataBytes < mNumberOfUsedFileDataBytes)
+		mUsedFileData = file.readView(mNumberOfUsedFileDataBytes);
+		if (nullptr == mUsedFileData)
 		{
-			mNumberOfFileDataBytes = mNumberOfUsedFileDataBytes;
-			delete [] mFileData;
-			mFileData = new uint8_t[mNumberOfFileDataBytes];
+			if (mNumberOfFileDataBytes < mNumberOfUsedFileDataBytes)
+			{
+				mNumberOfFileDataBytes = mNumberOfUsedFileDataBytes;
+				delete [] mFileData;
+				mFileData = new uint8_t[mNumberOfFileDataBytes];
+			}
+			file.read(mFileData, mNumberOfUsedFileDataBytes);
+			mUsedFileData = mFileData;
 		}
-		file.read(mFileData, mNumberOfFileDataBytes);
 	}
 
 	void CrnTextureResourceLoader::onProcessing()
@@ -87,7 +93,7 @@ namespace RendererRuntime
 		//     Mip1: Face0, Face1, Face2, Face3, Face4, Face5
 		//     etc.
 		crnd::crn_texture_info crnTextureInfo;
-		if (!crnd::crnd_get_texture_info(mFileData, mNumberOfFileDataBytes, &crnTextureInfo))
+		if (!crnd::crnd_get_texture_info(mUsedFileData, mNumberOfUsedFileDataBytes, &crnTextureInfo))
 		{
 			//return error("crnd_get_texture_info() failed!\n");
 			return;
@@ -133,7 +139,7 @@ namespace RendererRuntime
 				return;
 		}
 
-		crnd::crnd_unpack_context crndUnpackContext = crnd::crnd_unpack_begin(mFileData, mNumberOfFileDataBytes);
+		crnd::crnd_unpack_context crndUnpackContext = crnd::crnd_unpack_begin(mUsedFileData, mNumberOfUsedFileDataBytes);
 		if (nullptr == crndUnpackContext)
 		{
 		//	return error("crnd_unpack_begin() failed!\n");
@@ -208,13 +214,24 @@ namespace RendererRuntime
 
 	bool CrnTextureResourceLoader::onDispatch()
 	{
-		// Create the renderer texture instance
+		// Create the renderer texture instance, an asynchronously created one is owned by the texture resource from now on
 		mTextureResource->mTexture = mRendererRuntime.getRenderer().getCapabilities().nativeMultiThreading ? mTexture : createRendererTexture();
+		mTexture = nullptr;
 
 		// Fully loaded
 		return true;
 	}
 
+	void CrnTextureResourceLoader::onCancellation()
+	{
+		// Destroy the asynchronously created renderer texture instance, if there's one
+		if (nullptr != mTexture)
+		{
+			mTexture->releaseReference();
+			mTexture = nullptr;
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -120,13 +120,24 @@ namespace RendererRuntime
 
 	bool KtxTextureResourceLoader::onDispatch()
 	{
-		// Create the renderer texture instance
+		// Create the renderer texture instance, an asynchronously created one is owned by the texture resource from now on
 		mTextureResource->mTexture = mRendererRuntime.getRenderer().getCapabilities().nativeMultiThreading ? mTexture : createRendererTexture();
+		mTexture = nullptr;
 
 		// Fully loaded
 		return true;
 	}
 
+	void KtxTextureResourceLoader::onCancellation()
+	{
+		// Destroy the asynchronously created renderer texture instance, if there's one
+		if (nullptr != mTexture)
+		{
+			mTexture->releaseReference();
+			mTexture = nullptr;
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
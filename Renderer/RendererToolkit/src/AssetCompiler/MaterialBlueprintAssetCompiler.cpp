@@ -24,6 +24,7 @@
 #include "RendererToolkit/AssetCompiler/MaterialBlueprintAssetCompiler.h"
 #include "RendererToolkit/Helper/JsonMaterialBlueprintHelper.h"
 #include "RendererToolkit/Helper/JsonMaterialHelper.h"
+#include "RendererToolkit/Helper/FileSystemHelper.h"
 #include "RendererToolkit/Helper/StringHelper.h"
 #include "RendererToolkit/Helper/JsonHelper.h"
 
@@ -41,6 +42,141 @@ PRAGMA_WARNING_PUSH
 PRAGMA_WARNING_POP
 
 #include <fstream>
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		typedef std::vector<RendererRuntime::ShaderProperties::SortedPropertyVector> ShaderCombinations;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void addShaderCombination(const RendererRuntime::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector, const RendererRuntime::ShaderProperties& visualImportanceOfShaderProperties, const RendererRuntime::ShaderProperties& maximumIntegerValueOfShaderProperties, ShaderCombinations& shaderCombinations)
+		{
+			// Gather the shader properties the same way the renderer runtime does when requesting a pipeline state
+			// -> See "RendererRuntime::RenderQueue" and "RendererRuntime::MaterialBlueprintResource::optimizeShaderProperties()"
+			RendererRuntime::ShaderProperties shaderProperties;
+			for (const RendererRuntime::MaterialProperty& materialProperty : sortedMaterialPropertyVector)
+			{
+				// Shader property ID and material property ID are identical, so this is valid
+				const RendererRuntime::ShaderPropertyId shaderPropertyId = materialProperty.getMaterialPropertyId();
+				if (materialProperty.getUsage() == RendererRuntime::MaterialProperty::Usage::SHADER_COMBINATION && visualImportanceOfShaderProperties.hasPropertyValue(shaderPropertyId))
+				{
+					int32_t value = 0;
+					switch (materialProperty.getValueType())
+					{
+						case RendererRuntime::MaterialProperty::ValueType::BOOLEAN:
+							value = materialProperty.getBooleanValue();
+							break;
+
+						case RendererRuntime::MaterialProperty::ValueType::INTEGER:
+							// Respect the property range of the material blueprint
+							value = std::max(0, std::min(materialProperty.getIntegerValue(), maximumIntegerValueOfShaderProperties.getPropertyValueUnsafe(shaderPropertyId)));
+							break;
+
+						case RendererRuntime::MaterialProperty::ValueType::UNKNOWN:
+						case RendererRuntime::MaterialProperty::ValueType::INTEGER_2:
+						case RendererRuntime::MaterialProperty::ValueType::INTEGER_3:
+						case RendererRuntime::MaterialProperty::ValueType::INTEGER_4:
+						case RendererRuntime::MaterialProperty::ValueType::FLOAT:
+						case RendererRuntime::MaterialProperty::ValueType::FLOAT_2:
+						case RendererRuntime::MaterialProperty::ValueType::FLOAT_3:
+						case RendererRuntime::MaterialProperty::ValueType::FLOAT_4:
+						case RendererRuntime::MaterialProperty::ValueType::FLOAT_3_3:
+						case RendererRuntime::MaterialProperty::ValueType::FLOAT_4_4:
+						case RendererRuntime::MaterialProperty::ValueType::FILL_MODE:
+						case RendererRuntime::MaterialProperty::ValueType::CULL_MODE:
+						case RendererRuntime::MaterialProperty::ValueType::CONSERVATIVE_RASTERIZATION_MODE:
+						case RendererRuntime::MaterialProperty::ValueType::DEPTH_WRITE_MASK:
+						case RendererRuntime::MaterialProperty::ValueType::STENCIL_OP:
+						case RendererRuntime::MaterialProperty::ValueType::COMPARISON_FUNC:
+						case RendererRuntime::MaterialProperty::ValueType::BLEND:
+						case RendererRuntime::MaterialProperty::ValueType::BLEND_OP:
+						case RendererRuntime::MaterialProperty::ValueType::FILTER_MODE:
+						case RendererRuntime::MaterialProperty::ValueType::TEXTURE_ADDRESS_MODE:
+						case RendererRuntime::MaterialProperty::ValueType::TEXTURE_ASSET_ID:
+						default:
+							throw std::runtime_error("Unsupported shader combination material property value type");
+					}
+					if (0 != value)
+					{
+						shaderProperties.setPropertyValue(shaderPropertyId, value);
+					}
+				}
+			}
+
+			// Different materials usually result in one and the same shader combination
+			const RendererRuntime::ShaderProperties::SortedPropertyVector& sortedPropertyVector = shaderProperties.getSortedPropertyVector();
+			if (std::find(shaderCombinations.cbegin(), shaderCombinations.cend(), sortedPropertyVector) == shaderCombinations.cend())
+			{
+				shaderCombinations.push_back(sortedPropertyVector);
+			}
+		}
+
+		void gatherPrecompiledShaderCombinations(const RendererToolkit::IAssetCompiler::Input& input, uint32_t materialBlueprintSourceAssetId, const RendererRuntime::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector, const RendererRuntime::ShaderProperties& visualImportanceOfShaderProperties, const RendererRuntime::ShaderProperties& maximumIntegerValueOfShaderProperties, ShaderCombinations& shaderCombinations)
+		{
+			// The material blueprint default values, e.g. used by compositor materials directly referencing the material blueprint
+			addShaderCombination(sortedMaterialPropertyVector, visualImportanceOfShaderProperties, maximumIntegerValueOfShaderProperties, shaderCombinations);
+
+			// The shader combinations of all materials referencing the material blueprint inside one of their techniques
+			for (const auto& sourceAssetIdToAbsoluteFilenameElement : input.sourceAssetIdToAbsoluteFilename)
+			{
+				// Parse asset JSON, only material assets are of interest
+				const std::string& absoluteAssetFilename = sourceAssetIdToAbsoluteFilenameElement.second;
+				std::ifstream assetInputFileStream(absoluteAssetFilename, std::ios::binary);
+				rapidjson::Document rapidJsonDocumentAsset;
+				RendererToolkit::JsonHelper::parseDocumentByInputFileStream(rapidJsonDocumentAsset, assetInputFileStream, absoluteAssetFilename, "Asset", "1");
+				const rapidjson::Value& rapidJsonValueAsset = rapidJsonDocumentAsset["Asset"];
+				if (!rapidJsonValueAsset.HasMember("MaterialAssetCompiler"))
+				{
+					continue;
+				}
+
+				// Parse material JSON
+				const std::string absoluteMaterialFilename = STD_FILESYSTEM_PATH(absoluteAssetFilename).parent_path().generic_string() + '/' + rapidJsonValueAsset["MaterialAssetCompiler"]["InputFile"].GetString();
+				std::ifstream materialInputFileStream(absoluteMaterialFilename, std::ios::binary);
+				rapidjson::Document rapidJsonDocument;
+				RendererToolkit::JsonHelper::parseDocumentByInputFileStream(rapidJsonDocument, materialInputFileStream, absoluteMaterialFilename, "MaterialAsset", "1");
+
+				// Is the material referencing the material blueprint?
+				bool referencesMaterialBlueprint = false;
+				const rapidjson::Value& rapidJsonValueTechniques = rapidJsonDocument["MaterialAsset"]["Techniques"];
+				for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorTechniques = rapidJsonValueTechniques.MemberBegin(); rapidJsonMemberIteratorTechniques != rapidJsonValueTechniques.MemberEnd(); ++rapidJsonMemberIteratorTechniques)
+				{
+					if (static_cast<uint32_t>(std::atoi(rapidJsonMemberIteratorTechniques->value.GetString())) == materialBlueprintSourceAssetId)
+					{
+						referencesMaterialBlueprint = true;
+						break;
+					}
+				}
+				if (referencesMaterialBlueprint)
+				{
+					std::vector<RendererRuntime::v1Material::Technique> techniques;
+					RendererRuntime::MaterialProperties::SortedPropertyVector materialSortedMaterialPropertyVector;
+					RendererToolkit::JsonMaterialHelper::getTechniquesAndPropertiesByMaterialAssetId(input, rapidJsonDocument, techniques, materialSortedMaterialPropertyVector);
+					addShaderCombination(materialSortedMaterialPropertyVector, visualImportanceOfShaderProperties, maximumIntegerValueOfShaderProperties, shaderCombinations);
+				}
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -91,11 +227,13 @@ namespace RendererToolkit
 		// Read configuration
 		std::string inputFile;
 		bool allowCrazyNumberOfShaderCombinations = false;
+		bool precompileShaderCombinations = false;
 		{
 			// Read material blueprint asset compiler configuration
 			const rapidjson::Value& rapidJsonValueMaterialBlueprintAssetCompiler = rapidJsonValueAsset["MaterialBlueprintAssetCompiler"];
 			inputFile = rapidJsonValueMaterialBlueprintAssetCompiler["InputFile"].GetString();
 			JsonHelper::optionalBooleanProperty(rapidJsonValueMaterialBlueprintAssetCompiler, "AllowCrazyNumberOfShaderCombinations", allowCrazyNumberOfShaderCombinations);
+			JsonHelper::optionalBooleanProperty(rapidJsonValueMaterialBlueprintAssetCompiler, "PrecompileShaderCombinations", precompileShaderCombinations);
 		}
 
 		// Open the input file
@@ -149,6 +287,20 @@ namespace RendererToolkit
 				}
 			}
 
+			// Gather the shader combinations which can be reached by the materials referencing the material blueprint, so the renderer runtime can request them as soon as the material blueprint has been loaded
+			// -> Materials aren't dependencies of the material blueprint asset, so a material change requires a material blueprint rebuild to update the precompiled shader combinations
+			::detail::ShaderCombinations precompiledShaderCombinations;
+			uint32_t numberOfPrecompiledShaderCombinationProperties = 0;
+			if (precompileShaderCombinations)
+			{
+				const uint32_t materialBlueprintSourceAssetId = static_cast<uint32_t>(std::atoi(rapidJsonValueAsset["AssetMetadata"]["AssetId"].GetString()));
+				::detail::gatherPrecompiledShaderCombinations(input, materialBlueprintSourceAssetId, sortedMaterialPropertyVector, visualImportanceOfShaderProperties, maximumIntegerValueOfShaderProperties, precompiledShaderCombinations);
+				for (const RendererRuntime::ShaderProperties::SortedPropertyVector& sortedPropertyVector : precompiledShaderCombinations)
+				{
+					numberOfPrecompiledShaderCombinationProperties += static_cast<uint32_t>(sortedPropertyVector.size());
+				}
+			}
+
 			{ // Material blueprint header
 				RendererRuntime::v1MaterialBlueprint::Header materialBlueprintHeader;
 				materialBlueprintHeader.formatType									= RendererRuntime::v1MaterialBlueprint::FORMAT_TYPE;
@@ -160,6 +312,8 @@ namespace RendererToolkit
 				materialBlueprintHeader.numberOfTextureBuffers						= rapidJsonValueTextureBuffers.IsObject() ? rapidJsonValueTextureBuffers.MemberCount() : 0;
 				materialBlueprintHeader.numberOfSamplerStates						= rapidJsonValueSamplerStates.IsObject() ? rapidJsonValueSamplerStates.MemberCount() : 0;
 				materialBlueprintHeader.numberOfTextures							= rapidJsonValueTextures.IsObject() ? rapidJsonValueTextures.MemberCount() : 0;
+				materialBlueprintHeader.numberOfPrecompiledShaderCombinations			= static_cast<uint32_t>(precompiledShaderCombinations.size());
+				materialBlueprintHeader.numberOfPrecompiledShaderCombinationProperties	= numberOfPrecompiledShaderCombinationProperties;
 
 				// Write down the material blueprint header
 				outputFileStream.write(reinterpret_cast<const char*>(&materialBlueprintHeader), sizeof(RendererRuntime::v1MaterialBlueprint::Header));
@@ -206,6 +360,21 @@ namespace RendererToolkit
 					JsonMaterialBlueprintHelper::readTextures(input, sortedMaterialPropertyVector, rapidJsonValueTextures, outputFileStream, shaderProperties);
 				}
 			}
+
+			{ // Precompiled shader combinations
+				// Write down the number of shader properties per shader combination
+				for (const RendererRuntime::ShaderProperties::SortedPropertyVector& sortedPropertyVector : precompiledShaderCombinations)
+				{
+					const uint32_t numberOfShaderProperties = static_cast<uint32_t>(sortedPropertyVector.size());
+					outputFileStream.write(reinterpret_cast<const char*>(&numberOfShaderProperties), sizeof(uint32_t));
+				}
+
+				// Write down the shader properties of all shader combinations
+				for (const RendererRuntime::ShaderProperties::SortedPropertyVector& sortedPropertyVector : precompiledShaderCombinations)
+				{
+					outputFileStream.write(reinterpret_cast<const char*>(sortedPropertyVector.data()), static_cast<std::streamsize>(sizeof(RendererRuntime::ShaderProperties::Property) * sortedPropertyVector.size()));
+				}
+			}
 		}
 
 		{ // Update the output asset package
@@ -29,6 +29,12 @@
 #include <RendererRuntime/Resource/Mesh/MeshResource.h>
 #include <RendererRuntime/Resource/Mesh/Loader/MeshFileFormat.h>
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/gtc/type_ptr.hpp>
+PRAGMA_WARNING_POP
+
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4061)	// warning C4061: enumerator 'FORCE_32BIT' in switch of enum 'aiMetadataType' is not explicitly handled by a case label
@@ -46,6 +52,7 @@ PRAGMA_WARNING_PUSH
 	#include <rapidjson/document.h>
 PRAGMA_WARNING_POP
 
+#include <limits>
 #include <memory>
 #include <fstream>
 
@@ -256,6 +263,66 @@ namespace
 			}
 		}
 
+		/**
+		*  @brief
+		*    Calculate the axis aligned bounding box (AABB) and the bounding sphere of the vertices referenced by the given indices
+		*
+		*  @param[in]  vertexBuffer
+		*    Vertex buffer, the position is expected to be the first vertex attribute
+		*  @param[in]  indexBuffer
+		*    Index buffer range to consider
+		*  @param[in]  numberOfIndices
+		*    Number of indices inside the given index buffer range
+		*  @param[out] minimumBoundingBoxPosition
+		*    Receives the minimum bounding box position
+		*  @param[out] maximumBoundingBoxPosition
+		*    Receives the maximum bounding box position
+		*  @param[out] boundingSpherePosition
+		*    Receives the bounding sphere position
+		*  @param[out] boundingSphereRadius
+		*    Receives the bounding sphere radius
+		*
+		*  @note
+		*    - The bounding sphere is centered at the bounding box center, which isn't the minimal bounding sphere but cheap and good enough for culling
+		*/
+		void calculateBounding(const uint8_t* vertexBuffer, const uint16_t* indexBuffer, uint32_t numberOfIndices, float minimumBoundingBoxPosition[3], float maximumBoundingBoxPosition[3], float boundingSpherePosition[3], float& boundingSphereRadius)
+		{
+			if (0 == numberOfIndices)
+			{
+				for (int i = 0; i < 3; ++i)
+				{
+					minimumBoundingBoxPosition[i] = maximumBoundingBoxPosition[i] = boundingSpherePosition[i] = 0.0f;
+				}
+				boundingSphereRadius = 0.0f;
+				return;
+			}
+
+			// Axis aligned bounding box
+			glm::vec3 minimumPosition(std::numeric_limits<float>::max());
+			glm::vec3 maximumPosition(-std::numeric_limits<float>::max());
+			for (uint32_t i = 0; i < numberOfIndices; ++i)
+			{
+				const glm::vec3 position = glm::make_vec3(reinterpret_cast<const float*>(vertexBuffer + indexBuffer[i] * NUMBER_OF_BYTES_PER_VERTEX));
+				minimumPosition = glm::min(minimumPosition, position);
+				maximumPosition = glm::max(maximumPosition, position);
+			}
+
+			// Bounding sphere
+			const glm::vec3 centerPosition = (minimumPosition + maximumPosition) * 0.5f;
+			float squaredRadius = 0.0f;
+			for (uint32_t i = 0; i < numberOfIndices; ++i)
+			{
+				const glm::vec3 position = glm::make_vec3(reinterpret_cast<const float*>(vertexBuffer + indexBuffer[i] * NUMBER_OF_BYTES_PER_VERTEX));
+				squaredRadius = std::max(squaredRadius, glm::dot(position - centerPosition, position - centerPosition));
+			}
+
+			// Done
+			memcpy(minimumBoundingBoxPosition, glm::value_ptr(minimumPosition), sizeof(float) * 3);
+			memcpy(maximumBoundingBoxPosition, glm::value_ptr(maximumPosition), sizeof(float) * 3);
+			memcpy(boundingSpherePosition, glm::value_ptr(centerPosition), sizeof(float) * 3);
+			boundingSphereRadius = std::sqrt(squaredRadius);
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -337,21 +404,6 @@ namespace RendererToolkit
 			::detail::SubMeshes subMeshes;
 			::detail::getNumberOfVerticesAndIndicesRecursive(input, *assimpScene, *assimpScene->mRootNode, numberOfVertices, numberOfIndices, subMeshes);
 
-			{ // Mesh header
-				RendererRuntime::v1Mesh::Header meshHeader;
-				meshHeader.formatType				= RendererRuntime::v1Mesh::FORMAT_TYPE;
-				meshHeader.formatVersion			= RendererRuntime::v1Mesh::FORMAT_VERSION;
-				meshHeader.numberOfBytesPerVertex	= ::detail::NUMBER_OF_BYTES_PER_VERTEX;
-				meshHeader.numberOfVertices			= numberOfVertices;
-				meshHeader.indexBufferFormat		= Renderer::IndexBufferFormat::UNSIGNED_SHORT;
-				meshHeader.numberOfIndices			= numberOfIndices;
-				meshHeader.numberOfVertexAttributes = static_cast<uint8_t>(RendererRuntime::MeshResource::VERTEX_ATTRIBUTES.numberOfAttributes);
-				meshHeader.numberOfSubMeshes		= static_cast<uint8_t>(subMeshes.size());
-
-				// Write down the mesh header
-				outputFileStream.write(reinterpret_cast<const char*>(&meshHeader), sizeof(RendererRuntime::v1Mesh::Header));
-			}
-
 			{ // Vertex and index buffer data
 				// Allocate memory for the local vertex and index buffer data
 				uint8_t *vertexBufferData = new uint8_t[::detail::NUMBER_OF_BYTES_PER_VERTEX * numberOfVertices];
@@ -367,6 +419,28 @@ namespace RendererToolkit
 					numberOfIndices  = numberOfFilledIndices;
 				}
 
+				// Calculate the sub-mesh bounding volumes, the mesh data is filled in the same order the sub-meshes were gathered
+				for (RendererRuntime::v1Mesh::SubMesh& subMesh : subMeshes)
+				{
+					::detail::calculateBounding(vertexBufferData, indexBufferData + subMesh.startIndexLocation, subMesh.numberOfIndices, subMesh.minimumBoundingBoxPosition, subMesh.maximumBoundingBoxPosition, subMesh.boundingSpherePosition, subMesh.boundingSphereRadius);
+				}
+
+				{ // Mesh header
+					RendererRuntime::v1Mesh::Header meshHeader;
+					meshHeader.formatType				= RendererRuntime::v1Mesh::FORMAT_TYPE;
+					meshHeader.formatVersion			= RendererRuntime::v1Mesh::FORMAT_VERSION;
+					::detail::calculateBounding(vertexBufferData, indexBufferData, numberOfIndices, meshHeader.minimumBoundingBoxPosition, meshHeader.maximumBoundingBoxPosition, meshHeader.boundingSpherePosition, meshHeader.boundingSphereRadius);
+					meshHeader.numberOfBytesPerVertex	= ::detail::NUMBER_OF_BYTES_PER_VERTEX;
+					meshHeader.numberOfVertices			= numberOfVertices;
+					meshHeader.indexBufferFormat		= Renderer::IndexBufferFormat::UNSIGNED_SHORT;
+					meshHeader.numberOfIndices			= numberOfIndices;
+					meshHeader.numberOfVertexAttributes = static_cast<uint8_t>(RendererRuntime::MeshResource::VERTEX_ATTRIBUTES.numberOfAttributes);
+					meshHeader.numberOfSubMeshes		= static_cast<uint8_t>(subMeshes.size());
+
+					// Write down the mesh header
+					outputFileStream.write(reinterpret_cast<const char*>(&meshHeader), sizeof(RendererRuntime::v1Mesh::Header));
+				}
+
 				// Write down the vertex and index buffer
 				outputFileStream.write(reinterpret_cast<const char*>(vertexBufferData), ::detail::NUMBER_OF_BYTES_PER_VERTEX * numberOfVertices);
 				outputFileStream.write(reinterpret_cast<const char*>(indexBufferData), static_cast<std::streamsize>(sizeof(uint16_t) * numberOfIndices));